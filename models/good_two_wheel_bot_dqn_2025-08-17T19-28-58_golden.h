@@ -0,0 +1,373 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (golden test vectors)
+ * Generated: 2025-08-17T19-28-58
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * 327 raw states in 215 sequences with the outputs the simulator computes
+ * for them: float Q-values and action (CPUBackend.forward without its ±100
+ * clamp), int8 accumulators and action of the _int8 export, and the action
+ * of the _lut export (-1 for multi-timestep models). Reset the policy with
+ * the state of every vector marked reset, then call forward once per vector.
+ * native/tests/test_conformance.cpp checks every kernel and precision
+ * against this table.
+ */
+
+#include <stdint.h>
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNGolden {
+    static const int COUNT = 327;
+    static const int INPUT_SIZE = 2;
+    static const int OUTPUT_SIZE = 3;
+
+    struct Vector {
+        float angle;                          // Raw state (rad, rad/s)
+        float angularVelocity;
+        bool reset;                           // Reset the policy with this state first
+        int action;                           // Float argmax
+        float qValues[OUTPUT_SIZE];
+        int int8Action;
+        int32_t int8Accumulators[OUTPUT_SIZE];
+        int lookupAction;
+    };
+
+    static const Vector vectors[COUNT] = {
+        {-1.2566371f, -12.0f, true, 0, {-374.22879f, -418.778198f, -704.186829f}, 0, {-3834299, -4308954, -7245509}, 0},
+        {-1.2566371f, -10.0f, true, 0, {-374.22879f, -418.778198f, -704.186829f}, 0, {-3834299, -4308954, -7245509}, 0},
+        {-1.2566371f, -8.0f, true, 0, {-324.877899f, -365.617859f, -590.852905f}, 0, {-3338409, -3770437, -6099485}, 0},
+        {-1.2566371f, -6.0f, true, 0, {-262.016754f, -321.240265f, -478.793915f}, 0, {-2680139, -3304757, -4919210}, 0},
+        {-1.2566371f, -4.0f, true, 0, {-190.315933f, -302.084259f, -379.412079f}, 0, {-1960274, -3108581, -3913348}, 0},
+        {-1.2566371f, -2.0f, true, 0, {-123.539551f, -291.517273f, -294.770569f}, 0, {-1263205, -2998901, -3024752}, 0},
+        {-1.2566371f, 0.0f, true, 0, {-139.99472f, -311.917969f, -226.801453f}, 0, {-1449088, -3207114, -2343534}, 0},
+        {-1.2566371f, 2.0f, true, 2, {-182.967606f, -349.722809f, -171.645248f}, 2, {-1890324, -3581366, -1786876}, 2},
+        {-1.2566371f, 4.0f, true, 2, {-218.204102f, -390.13623f, -120.114746f}, 2, {-2265006, -4002047, -1245764}, 2},
+        {-1.2566371f, 6.0f, true, 2, {-256.453003f, -432.893951f, -73.1168823f}, 2, {-2656726, -4434221, -776715}, 2},
+        {-1.2566371f, 8.0f, true, 2, {-384.721375f, -543.397278f, -102.39946f}, 2, {-4001301, -5588764, -1075419}, 2},
+        {-1.2566371f, 10.0f, true, 2, {-573.961243f, -717.880066f, -173.09317f}, 2, {-5909433, -7338499, -1785743}, 2},
+        {-1.2566371f, 12.0f, true, 2, {-573.961243f, -717.880066f, -173.09317f}, 2, {-5909433, -7338499, -1785743}, 2},
+        {-1.04719758f, -12.0f, true, 0, {-374.22879f, -418.778198f, -704.186829f}, 0, {-3834299, -4308954, -7245509}, 0},
+        {-1.04719758f, -10.0f, true, 0, {-374.22879f, -418.778198f, -704.186829f}, 0, {-3834299, -4308954, -7245509}, 0},
+        {-1.04719758f, -8.0f, true, 0, {-324.877899f, -365.617859f, -590.852905f}, 0, {-3338409, -3770437, -6099485}, 0},
+        {-1.04719758f, -6.0f, true, 0, {-262.016754f, -321.240265f, -478.793915f}, 0, {-2680139, -3304757, -4919210}, 0},
+        {-1.04719758f, -4.0f, true, 0, {-190.315933f, -302.084259f, -379.412079f}, 0, {-1960274, -3108581, -3913348}, 0},
+        {-1.04719758f, -2.0f, true, 0, {-123.539551f, -291.517273f, -294.770569f}, 0, {-1263205, -2998901, -3024752}, 0},
+        {-1.04719758f, 0.0f, true, 0, {-139.99472f, -311.917969f, -226.801453f}, 0, {-1449088, -3207114, -2343534}, 0},
+        {-1.04719758f, 2.0f, true, 2, {-182.967606f, -349.722809f, -171.645248f}, 2, {-1890324, -3581366, -1786876}, 2},
+        {-1.04719758f, 4.0f, true, 2, {-218.204102f, -390.13623f, -120.114746f}, 2, {-2265006, -4002047, -1245764}, 2},
+        {-1.04719758f, 6.0f, true, 2, {-256.453003f, -432.893951f, -73.1168823f}, 2, {-2656726, -4434221, -776715}, 2},
+        {-1.04719758f, 8.0f, true, 2, {-384.721375f, -543.397278f, -102.39946f}, 2, {-4001301, -5588764, -1075419}, 2},
+        {-1.04719758f, 10.0f, true, 2, {-573.961243f, -717.880066f, -173.09317f}, 2, {-5909433, -7338499, -1785743}, 2},
+        {-1.04719758f, 12.0f, true, 2, {-573.961243f, -717.880066f, -173.09317f}, 2, {-5909433, -7338499, -1785743}, 2},
+        {-0.837758064f, -12.0f, true, 1, {-344.899902f, -340.707977f, -627.771057f}, 1, {-3538132, -3522708, -6470688}, 1},
+        {-0.837758064f, -10.0f, true, 1, {-344.899902f, -340.707977f, -627.771057f}, 1, {-3538132, -3522708, -6470688}, 1},
+        {-0.837758064f, -8.0f, true, 1, {-294.950928f, -285.437988f, -514.380005f}, 1, {-3036427, -2963582, -5324748}, 1},
+        {-0.837758064f, -6.0f, true, 0, {-237.653442f, -241.060104f, -407.30899f}, 0, {-2433165, -2494840, -4195979}, 0},
+        {-0.837758064f, -4.0f, true, 0, {-163.322159f, -234.039597f, -318.002197f}, 0, {-1686231, -2421303, -3291447}, 0},
+        {-0.837758064f, -2.0f, true, 0, {-94.2144012f, -226.411697f, -230.072357f}, 0, {-963242, -2337036, -2368633}, 0},
+        {-0.837758064f, 0.0f, true, 0, {-82.7339172f, -232.129089f, -157.841537f}, 0, {-869444, -2397775, -1643074}, 0},
+        {-0.837758064f, 2.0f, true, 2, {-121.28434f, -270.091919f, -105.49369f}, 2, {-1266168, -2775189, -1113741}, 2},
+        {-0.837758064f, 4.0f, true, 2, {-150.973801f, -302.550446f, -48.4932213f}, 2, {-1586805, -3118390, -521434}, 2},
+        {-0.837758064f, 6.0f, true, 2, {-236.126114f, -375.203522f, -37.906311f}, 2, {-2430198, -3834895, -397585}, 2},
+        {-0.837758064f, 8.0f, true, 2, {-421.443176f, -544.346497f, -107.329666f}, 2, {-4366899, -5590156, -1118707}, 2},
+        {-0.837758064f, 10.0f, true, 2, {-624.019409f, -768.309631f, -197.693054f}, 2, {-6405471, -7843870, -2033678}, 2},
+        {-0.837758064f, 12.0f, true, 2, {-624.019409f, -768.309631f, -197.693054f}, 2, {-6405471, -7843870, -2033678}, 2},
+        {-0.628318548f, -12.0f, true, 1, {-314.61911f, -249.671631f, -550.376038f}, 1, {-3217970, -2569241, -5656271}, 1},
+        {-0.628318548f, -10.0f, true, 1, {-314.61911f, -249.671631f, -550.376038f}, 1, {-3217970, -2569241, -5656271}, 1},
+        {-0.628318548f, -8.0f, true, 1, {-264.550903f, -191.963058f, -437.196747f}, 1, {-2715197, -1977797, -4508624}, 1},
+        {-0.628318548f, -6.0f, true, 1, {-209.179916f, -170.233673f, -345.344391f}, 1, {-2136677, -1745201, -3541793}, 1},
+        {-0.628318548f, -4.0f, true, 0, {-137.00087f, -167.929688f, -254.633331f}, 0, {-1408193, -1722510, -2623591}, 0},
+        {-0.628318548f, -2.0f, true, 0, {-71.1070099f, -158.222809f, -169.509476f}, 0, {-720222, -1616368, -1728699}, 0},
+        {-0.628318548f, 0.0f, true, 0, {-26.5550404f, -150.477448f, -91.1417084f}, 0, {-278501, -1535830, -938922}, 0},
+        {-0.628318548f, 2.0f, true, 2, {-52.137661f, -179.628799f, -30.8233223f}, 2, {-541956, -1827594, -330282}, 2},
+        {-0.628318548f, 4.0f, true, 2, {-95.4656906f, -219.71051f, 16.1540928f}, 2, {-1004742, -2245458, 160191}, 2},
+        {-0.628318548f, 6.0f, true, 2, {-268.925079f, -370.812988f, -41.5661812f}, 2, {-2763518, -3772873, -425274}, 2},
+        {-0.628318548f, 8.0f, true, 2, {-471.560211f, -595.042664f, -131.347519f}, 2, {-4884449, -6118659, -1368704}, 2},
+        {-0.628318548f, 10.0f, true, 2, {-675.114563f, -820.874634f, -220.090195f}, 2, {-6936391, -8391690, -2263856}, 2},
+        {-0.628318548f, 12.0f, true, 2, {-675.114563f, -820.874634f, -220.090195f}, 2, {-6936391, -8391690, -2263856}, 2},
+        {-0.418879032f, -12.0f, true, 1, {-277.052979f, -150.43956f, -480.455933f}, 1, {-2836197, -1559593, -4945014}, 1},
+        {-0.418879032f, -10.0f, true, 1, {-277.052979f, -150.43956f, -480.455933f}, 1, {-2836197, -1559593, -4945014}, 1},
+        {-0.418879032f, -8.0f, true, 1, {-227.161728f, -120.691185f, -377.460663f}, 1, {-2335616, -1252676, -3901357}, 1},
+        {-0.418879032f, -6.0f, true, 1, {-175.506683f, -109.164139f, -283.0914f}, 1, {-1794796, -1127569, -2909778}, 1},
+        {-0.418879032f, -4.0f, true, 1, {-114.459274f, -99.4141312f, -194.180023f}, 1, {-1179331, -1027609, -2010843}, 1},
+        {-0.418879032f, -2.0f, true, 0, {-48.7803268f, -86.3941727f, -108.57048f}, 0, {-494312, -887440, -1110045}, 0},
+        {-0.418879032f, 0.0f, true, 0, {28.0023575f, -62.1066475f, -17.5423679f}, 0, {276094, -639904, -190495}, 0},
+        {-0.418879032f, 2.0f, true, 2, {18.8037395f, -85.5940933f, 48.0128288f}, 2, {178937, -871882, 473319}, 2},
+        {-0.418879032f, 4.0f, true, 2, {-118.041496f, -201.178101f, 19.3939819f}, 2, {-1237301, -2062962, 194613}, 2},
+        {-0.418879032f, 6.0f, true, 2, {-319.101044f, -421.775726f, -65.0019913f}, 2, {-3260798, -4281646, -659323}, 2},
+        {-0.418879032f, 8.0f, true, 2, {-522.655396f, -647.607666f, -153.744659f}, 2, {-5394917, -6645436, -1590097}, 2},
+        {-0.418879032f, 10.0f, true, 2, {-732.133179f, -877.958984f, -246.940536f}, 2, {-7507142, -8963916, -2530220}, 2},
+        {-0.418879032f, 12.0f, true, 2, {-732.133179f, -877.958984f, -246.940536f}, 2, {-7507142, -8963916, -2530220}, 2},
+        {-0.209439516f, -12.0f, true, 1, {-234.860413f, -74.8929901f, -430.448242f}, 1, {-2391423, -764743, -4415833}, 1},
+        {-0.209439516f, -10.0f, true, 1, {-234.860413f, -74.8929901f, -430.448242f}, 1, {-2391423, -764743, -4415833}, 1},
+        {-0.209439516f, -8.0f, true, 1, {-183.484039f, -59.0162277f, -335.438263f}, 1, {-1876192, -603365, -3458173}, 1},
+        {-0.209439516f, -6.0f, true, 1, {-134.231064f, -41.4887238f, -237.064102f}, 1, {-1362130, -414766, -2423038}, 1},
+        {-0.209439516f, -4.0f, true, 1, {-83.2151489f, -19.3498287f, -136.921173f}, 1, {-849909, -181709, -1405381}, 1},
+        {-0.209439516f, -2.0f, true, 1, {-12.1937866f, 3.55953932f, -37.5608978f}, 1, {-108420, 61701, -360464}, 1},
+        {-0.209439516f, 0.0f, true, 0, {68.2840424f, 22.560524f, 56.0622215f}, 0, {700109, 252828, 587410}, 0},
+        {-0.209439516f, 2.0f, true, 2, {30.449749f, -36.7449951f, 76.0567017f}, 2, {326620, -338381, 792468}, 2},
+        {-0.209439516f, 4.0f, true, 2, {-167.878036f, -251.405365f, -2.21230435f}, 2, {-1752090, -2585496, -30286}, 2},
+        {-0.209439516f, 6.0f, true, 2, {-376.131653f, -478.869232f, -91.8613358f}, 2, {-3854430, -4877170, -936669}, 2},
+        {-0.209439516f, 8.0f, true, 2, {-586.187622f, -709.661682f, -185.491882f}, 2, {-6056994, -7293025, -1918923}, 2},
+        {-0.209439516f, 10.0f, true, 2, {-790.238892f, -933.866699f, -280.494781f}, 2, {-8114484, -9549642, -2876982}, 2},
+        {-0.209439516f, 12.0f, true, 2, {-790.238892f, -933.866699f, -280.494781f}, 2, {-8114484, -9549642, -2876982}, 2},
+        {0.0f, -12.0f, true, 1, {-186.242432f, -18.8561211f, -374.450623f}, 1, {-1901107, -199516, -3847235}, 1},
+        {0.0f, -10.0f, true, 1, {-186.242432f, -18.8561211f, -374.450623f}, 1, {-1901107, -199516, -3847235}, 1},
+        {0.0f, -8.0f, true, 1, {-142.569977f, 0.183078513f, -289.53833f}, 1, {-1462029, -4020, -2988224}, 1},
+        {0.0f, -6.0f, true, 1, {-92.7038956f, 28.9647255f, -193.022079f}, 1, {-941017, 302634, -1972219}, 1},
+        {0.0f, -4.0f, true, 1, {-35.7808189f, 64.2059784f, -83.5922775f}, 1, {-369676, 661757, -864855}, 1},
+        {0.0f, -2.0f, true, 1, {32.635006f, 95.4210892f, 20.1181316f}, 1, {344713, 992881, 225868}, 1},
+        {0.0f, 0.0f, true, 0, {100.24559f, 99.4217148f, 100.14386f}, 2, {1022979, 1031499, 1032790}, 2},
+        {0.0f, 2.0f, true, 2, {-14.7809906f, -81.944519f, 43.157814f}, 2, {-122461, -788514, 463727}, 2},
+        {0.0f, 4.0f, true, 2, {-223.076859f, -305.38855f, -42.695385f}, 2, {-2306916, -3129149, -437296}, 2},
+        {0.0f, 6.0f, true, 2, {-427.868622f, -527.782349f, -132.521225f}, 2, {-4372649, -5368498, -1342686}, 2},
+        {0.0f, 8.0f, true, 2, {-630.645935f, -750.345886f, -227.229782f}, 2, {-6499730, -7699118, -2335946}, 2},
+        {0.0f, 10.0f, true, 2, {-833.381287f, -972.15979f, -320.739532f}, 2, {-8544535, -9932750, -3279303}, 2},
+        {0.0f, 12.0f, true, 2, {-833.381287f, -972.15979f, -320.739532f}, 2, {-8544535, -9932750, -3279303}, 2},
+        {0.209439516f, -12.0f, true, 1, {-140.281448f, 39.6385002f, -319.818909f}, 1, {-1437401, 393883, -3293233}, 1},
+        {0.209439516f, -10.0f, true, 1, {-140.281448f, 39.6385002f, -319.818909f}, 1, {-1437401, 393883, -3293233}, 1},
+        {0.209439516f, -8.0f, true, 1, {-92.2427979f, 71.1095047f, -225.358261f}, 1, {-955108, 713894, -2338513}, 1},
+        {0.209439516f, -6.0f, true, 1, {-40.9151878f, 108.043877f, -129.972702f}, 1, {-418297, 1104649, -1333908}, 1},
+        {0.209439516f, -4.0f, true, 1, {16.0521126f, 148.593277f, -39.6288109f}, 1, {154287, 1515848, -416564}, 1},
+        {0.209439516f, -2.0f, true, 1, {72.1905136f, 174.387024f, 50.3598251f}, 1, {745706, 1789875, 534200}, 1},
+        {0.209439516f, 0.0f, true, 1, {30.5534477f, 47.5688286f, 31.5076504f}, 1, {321782, 509060, 342012}, 1},
+        {0.209439516f, 2.0f, true, 2, {-55.8834724f, -123.309456f, -17.703371f}, 2, {-542606, -1207357, -150600}, 2},
+        {0.209439516f, 4.0f, true, 2, {-252.752731f, -336.870605f, -96.6976166f}, 2, {-2601012, -3440997, -976498}, 2},
+        {0.209439516f, 6.0f, true, 2, {-459.148438f, -559.266602f, -183.835983f}, 2, {-4683432, -5682769, -1857339}, 2},
+        {0.209439516f, 8.0f, true, 2, {-666.484497f, -783.847717f, -273.268372f}, 2, {-6858228, -8034690, -2795224}, 2},
+        {0.209439516f, 10.0f, true, 2, {-873.820496f, -1008.42877f, -362.700745f}, 2, {-8949503, -10296075, -3697095}, 2},
+        {0.209439516f, 12.0f, true, 2, {-873.820496f, -1008.42877f, -362.700745f}, 2, {-8949503, -10296075, -3697095}, 2},
+        {0.418879032f, -12.0f, true, 1, {-82.6110153f, 117.18924f, -262.43927f}, 1, {-830001, 1214673, -2690545}, 1},
+        {0.418879032f, -10.0f, true, 1, {-82.6110153f, 117.18924f, -262.43927f}, 1, {-830001, 1214673, -2690545}, 1},
+        {0.418879032f, -8.0f, true, 1, {-30.0910072f, 156.874176f, -171.169876f}, 1, {-302431, 1617856, -1766415}, 1},
+        {0.418879032f, -6.0f, true, 1, {19.0247879f, 193.682068f, -85.1698761f}, 1, {213015, 2009743, -857795}, 1},
+        {0.418879032f, -4.0f, true, 1, {67.8799057f, 228.621979f, -2.04573965f}, 1, {700038, 2361929, -15889}, 1},
+        {0.418879032f, -2.0f, true, 1, {44.1291656f, 158.312271f, 12.7869568f}, 1, {432483, 1606288, 124173}, 1},
+        {0.418879032f, 0.0f, true, 1, {-35.9759941f, -2.7353313f, -37.7227249f}, 1, {-372237, -15335, -381509}, 1},
+        {0.418879032f, 2.0f, true, 2, {-121.252037f, -174.643005f, -86.3301392f}, 2, {-1229899, -1745331, -870240}, 2},
+        {0.418879032f, 4.0f, true, 2, {-286.744415f, -376.207489f, -157.210907f}, 2, {-2953180, -3851178, -1609050}, 2},
+        {0.418879032f, 6.0f, true, 2, {-492.037506f, -596.186584f, -242.224091f}, 2, {-5023546, -6066295, -2466233}, 2},
+        {0.418879032f, 8.0f, true, 2, {-697.425232f, -816.516357f, -327.675354f}, 2, {-7177735, -8373177, -3361935}, 2},
+        {0.418879032f, 10.0f, true, 2, {-903.394287f, -1038.16248f, -414.291412f}, 2, {-9254925, -10604201, -4234697}, 2},
+        {0.418879032f, 12.0f, true, 2, {-903.394287f, -1038.16248f, -414.291412f}, 2, {-9254925, -10604201, -4234697}, 2},
+        {0.628318548f, -12.0f, true, 1, {-20.4612789f, 202.333374f, -213.165405f}, 1, {-200254, 2080921, -2188216}, 1},
+        {0.628318548f, -10.0f, true, 1, {-20.4612789f, 202.333374f, -213.165405f}, 1, {-200254, 2080921, -2188216}, 1},
+        {0.628318548f, -8.0f, true, 1, {30.8395538f, 244.400375f, -124.766876f}, 1, {314070, 2506722, -1292273}, 1},
+        {0.628318548f, -6.0f, true, 1, {79.5901337f, 280.235199f, -41.1948891f}, 1, {819897, 2883975, -410646}, 1},
+        {0.628318548f, -4.0f, true, 1, {88.9260483f, 246.802887f, 9.02489281f}, 1, {920933, 2551484, 103721}, 1},
+        {0.628318548f, -2.0f, true, 1, {-7.26827431f, 104.73542f, -38.8628845f}, 1, {-84043, 1066717, -395515}, 1},
+        {0.628318548f, 0.0f, true, 1, {-103.232727f, -55.5587196f, -99.0651016f}, 1, {-1048112, -545222, -999819}, 1},
+        {0.628318548f, 2.0f, true, 2, {-189.838135f, -226.115524f, -153.957993f}, 2, {-1918468, -2262381, -1550983}, 2},
+        {0.628318548f, 4.0f, true, 2, {-320.731781f, -415.466888f, -217.600281f}, 2, {-3291648, -4244864, -2215868}, 2},
+        {0.628318548f, 6.0f, true, 2, {-526.322021f, -636.142273f, -303.468201f}, 2, {-5365122, -6466652, -3081415}, 2},
+        {0.628318548f, 8.0f, true, 2, {-731.959839f, -856.929199f, -389.473083f}, 2, {-7521783, -8778169, -3982679}, 2},
+        {0.628318548f, 10.0f, true, 2, {-937.221375f, -1077.02832f, -474.64502f}, 2, {-9591822, -10994157, -4841374}, 2},
+        {0.628318548f, 12.0f, true, 2, {-937.221375f, -1077.02832f, -474.64502f}, 2, {-9591822, -10994157, -4841374}, 2},
+        {0.837758064f, -12.0f, true, 1, {43.702877f, 292.034027f, -163.691422f}, 1, {472379, 3026541, -1665564}, 1},
+        {0.837758064f, -10.0f, true, 1, {43.702877f, 292.034027f, -163.691422f}, 1, {472379, 3026541, -1665564}, 1},
+        {0.837758064f, -8.0f, true, 1, {92.2759247f, 329.083466f, -79.2933426f}, 1, {954260, 3398546, -809777}, 1},
+        {0.837758064f, -6.0f, true, 1, {119.947807f, 309.996246f, -15.2677498f}, 1, {1239520, 3189440, -137825}, 1},
+        {0.837758064f, -4.0f, true, 1, {39.5656967f, 203.791504f, -37.102066f}, 1, {406176, 2103595, -377967}, 1},
+        {0.837758064f, -2.0f, true, 1, {-58.9816284f, 49.1336479f, -88.6392746f}, 1, {-623660, 485500, -915957}, 1},
+        {0.837758064f, 0.0f, true, 1, {-167.321548f, -109.36203f, -149.430054f}, 1, {-1717650, -1106603, -1526008}, 1},
+        {0.837758064f, 2.0f, true, 2, {-255.984802f, -279.034027f, -211.443619f}, 2, {-2610036, -2814827, -2150050}, 2},
+        {0.837758064f, 4.0f, true, 2, {-358.879181f, -456.812775f, -277.980072f}, 2, {-3686746, -4675937, -2847802}, 2},
+        {0.837758064f, 6.0f, true, 2, {-560.606506f, -676.0979f, -364.71228f}, 2, {-5720347, -6883094, -3721314}, 2},
+        {0.837758064f, 8.0f, true, 2, {-766.244324f, -896.884827f, -450.717163f}, 2, {-7877008, -9194611, -4622578}, 2},
+        {0.837758064f, 10.0f, true, 2, {-971.84375f, -1117.60168f, -536.637146f}, 2, {-9950479, -11417034, -5488995}, 2},
+        {0.837758064f, 12.0f, true, 2, {-971.84375f, -1117.60168f, -536.637146f}, 2, {-9950479, -11417034, -5488995}, 2},
+        {1.04719758f, -12.0f, true, 1, {105.331757f, 376.697906f, -117.048302f}, 1, {1086885, 3880883, -1190118}, 1},
+        {1.04719758f, -10.0f, true, 1, {105.331757f, 376.697906f, -117.048302f}, 1, {1086885, 3880883, -1190118}, 1},
+        {1.04719758f, -8.0f, true, 1, {136.591797f, 363.111755f, -51.2558174f}, 1, {1401984, 3741709, -523931}, 1},
+        {1.04719758f, -6.0f, true, 1, {96.0460815f, 288.701904f, -38.3287468f}, 1, {975414, 2960424, -390388}, 1},
+        {1.04719758f, -4.0f, true, 1, {-11.6558065f, 154.24794f, -86.0027466f}, 1, {-108559, 1606094, -869333}, 1},
+        {1.04719758f, -2.0f, true, 1, {-113.024879f, -9.25268173f, -139.236908f}, 1, {-1165294, -101401, -1423828}, 1},
+        {1.04719758f, 0.0f, true, 1, {-222.743668f, -166.87851f, -199.834564f}, 1, {-2269652, -1687136, -2033210}, 1},
+        {1.04719758f, 2.0f, true, 2, {-319.867371f, -333.078766f, -262.212708f}, 2, {-3251231, -3355394, -2657635}, 2},
+        {1.04719758f, 4.0f, true, 2, {-409.89093f, -506.373566f, -329.157745f}, 2, {-4192676, -5170527, -3360878}, 2},
+        {1.04719758f, 6.0f, true, 2, {-594.744141f, -716.136841f, -425.382568f}, 2, {-6060876, -7284165, -4332661}, 2},
+        {1.04719758f, 8.0f, true, 2, {-800.528809f, -936.840454f, -511.961243f}, 2, {-8218557, -9595104, -5237971}, 2},
+        {1.04719758f, 10.0f, true, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {1.04719758f, 12.0f, true, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {1.2566371f, -12.0f, true, 1, {105.331757f, 376.697906f, -117.048302f}, 1, {1086885, 3880883, -1190118}, 1},
+        {1.2566371f, -10.0f, true, 1, {105.331757f, 376.697906f, -117.048302f}, 1, {1086885, 3880883, -1190118}, 1},
+        {1.2566371f, -8.0f, true, 1, {136.591797f, 363.111755f, -51.2558174f}, 1, {1401984, 3741709, -523931}, 1},
+        {1.2566371f, -6.0f, true, 1, {96.0460815f, 288.701904f, -38.3287468f}, 1, {975414, 2960424, -390388}, 1},
+        {1.2566371f, -4.0f, true, 1, {-11.6558065f, 154.24794f, -86.0027466f}, 1, {-108559, 1606094, -869333}, 1},
+        {1.2566371f, -2.0f, true, 1, {-113.024879f, -9.25268173f, -139.236908f}, 1, {-1165294, -101401, -1423828}, 1},
+        {1.2566371f, 0.0f, true, 1, {-222.743668f, -166.87851f, -199.834564f}, 1, {-2269652, -1687136, -2033210}, 1},
+        {1.2566371f, 2.0f, true, 2, {-319.867371f, -333.078766f, -262.212708f}, 2, {-3251231, -3355394, -2657635}, 2},
+        {1.2566371f, 4.0f, true, 2, {-409.89093f, -506.373566f, -329.157745f}, 2, {-4192676, -5170527, -3360878}, 2},
+        {1.2566371f, 6.0f, true, 2, {-594.744141f, -716.136841f, -425.382568f}, 2, {-6060876, -7284165, -4332661}, 2},
+        {1.2566371f, 8.0f, true, 2, {-800.528809f, -936.840454f, -511.961243f}, 2, {-8218557, -9595104, -5237971}, 2},
+        {1.2566371f, 10.0f, true, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {1.2566371f, 12.0f, true, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {0.0f, 0.0f, true, 0, {100.24559f, 99.4217148f, 100.14386f}, 2, {1022979, 1031499, 1032790}, 2},
+        {1.04719758f, 10.0f, true, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {-1.04719758f, -10.0f, true, 0, {-374.22879f, -418.778198f, -704.186829f}, 0, {-3834299, -4308954, -7245509}, 0},
+        {1.04719758f, -10.0f, true, 1, {105.331757f, 376.697906f, -117.048302f}, 1, {1086885, 3880883, -1190118}, 1},
+        {9.9999461e-41f, -9.9999461e-41f, true, 0, {100.24559f, 99.4217148f, 100.14386f}, 2, {1022979, 1031499, 1032790}, 2},
+        {-1e-30f, 1e-30f, true, 0, {100.24559f, 99.4217148f, 100.14386f}, 2, {1022979, 1031499, 1032790}, 2},
+        {-1.04719758f, 1.74038398f, true, 0, {-178.373077f, -344.453949f, -178.373077f}, 0, {-1846634, -3532573, -1849539}, 0},
+        {-1.04719758f, 1.7403841f, true, 2, {-178.373093f, -344.453949f, -178.373062f}, 0, {-1846634, -3532573, -1849539}, 0},
+        {-0.87266463f, -8.15743542f, true, 0, {-304.029419f, -304.029419f, -535.985535f}, 0, {-3126870, -3146687, -5539713}, 0},
+        {-0.87266463f, -8.15743446f, true, 1, {-304.029388f, -304.029358f, -535.985474f}, 0, {-3126870, -3146687, -5539713}, 0},
+        {-0.87266463f, -6.37886477f, true, 1, {-255.97757f, -255.977554f, -435.430206f}, 0, {-2623546, -2644367, -4487075}, 0},
+        {-0.87266463f, -6.37886429f, true, 0, {-255.977524f, -255.977554f, -435.430145f}, 0, {-2623546, -2644367, -4487075}, 0},
+        {-0.87266463f, 1.65182865f, true, 0, {-125.451118f, -276.351074f, -125.451118f}, 2, {-1308221, -2839297, -1304948}, 0},
+        {-0.87266463f, 1.65182877f, true, 2, {-125.451118f, -276.351074f, -125.451111f}, 2, {-1308221, -2839297, -1304948}, 0},
+        {-0.69813168f, -5.2069478f, true, 1, {-190.263092f, -190.263062f, -330.766388f}, 0, {-1948620, -1968573, -3409175}, 1},
+        {-0.69813168f, -5.20694733f, true, 0, {-190.263062f, -190.263062f, -330.766357f}, 0, {-1948620, -1968573, -3409175}, 1},
+        {-0.69813168f, 1.57716811f, true, 0, {-70.8480911f, -205.831284f, -70.8480911f}, 2, {-753083, -2122869, -750635}, 0},
+        {-0.69813168f, 1.57716823f, true, 2, {-70.8480911f, -205.831299f, -70.8480759f}, 2, {-753083, -2122869, -750635}, 0},
+        {-0.52359879f, -4.2493391f, true, 1, {-134.363495f, -134.363464f, -235.386322f}, 0, {-1381448, -1396314, -2437071}, 1},
+        {-0.52359879f, -4.24933863f, true, 0, {-134.363464f, -134.363464f, -235.386292f}, 0, {-1381448, -1396314, -2437071}, 1},
+        {-0.52359879f, 1.43401742f, true, 0, {-8.3902626f, -124.052353f, -8.39026356f}, 0, {-113621, -1285989, -115628}, 2},
+        {-0.52359879f, 1.43401754f, true, 2, {-8.39026928f, -124.052361f, -8.39025974f}, 0, {-113621, -1285989, -115628}, 2},
+        {-0.34906584f, -2.94032431f, true, 1, {-71.0140076f, -71.0139999f, -127.556137f}, 1, {-716854, -714882, -1292018}, 0},
+        {-0.34906584f, -2.94032407f, true, 0, {-71.0139923f, -71.0139923f, -127.556122f}, 1, {-716854, -714882, -1292018}, 0},
+        {-0.34906584f, 1.28900337f, true, 0, {54.1600761f, -42.1235428f, 54.1600723f}, 0, {556320, -408782, 553784}, 2},
+        {-0.34906584f, 1.28900349f, true, 2, {54.1600685f, -42.1235428f, 54.1600761f}, 0, {556320, -408782, 553784}, 2},
+        {-0.17453292f, -1.02298653f, true, 1, {31.2372532f, 31.2372608f, 19.2880421f}, 1, {319228, 333993, 202266}, 0},
+        {-0.17453292f, -1.02298641f, true, 0, {31.2372608f, 31.2372589f, 19.2880497f}, 1, {319228, 333993, 202266}, 0},
+        {-0.17453292f, 1.02756f, true, 0, {102.768547f, 34.163868f, 102.768547f}, 2, {1047361, 365560, 1058048}, 0},
+        {-0.17453292f, 1.02756011f, true, 2, {102.768539f, 34.1638718f, 102.768547f}, 2, {1047361, 365560, 1058048}, 0},
+        {0.874227881f, 0.997162282f, true, 2, {-223.050415f, -203.383026f, -189.204971f}, 2, {-2288414, -2081983, -1932500}, 2},
+        {-0.244047657f, -10.9921875f, false, 1, {-242.640793f, -85.2954712f, -439.048676f}, 1, {-2486573, -892420, -4521247}, 1},
+        {1.03203368f, 10.9004059f, false, 2, {-1003.68433f, -1154.7345f, -593.531982f}, 2, {-10265051, -11785564, -6055369}, 2},
+        {0.0952072889f, -9.41381454f, false, 1, {-152.647171f, 13.2353354f, -324.733551f}, 1, {-1556673, 139252, -3340894}, 1},
+        {0.201052874f, -4.90567398f, false, 1, {-12.3513126f, 126.744873f, -82.8769836f}, 1, {-124510, 1299734, -845112}, 1},
+        {-0.973515093f, 2.5528841f, false, 2, {-171.071762f, -332.951263f, -134.006668f}, 2, {-1767029, -3404981, -1398078}, 2},
+        {0.126528978f, 2.60087109f, false, 2, {-96.9563751f, -169.733047f, -15.9592419f}, 2, {-988058, -1712761, -144326}, 2},
+        {-0.805078745f, 8.92741203f, false, 2, {-522.826904f, -655.39917f, -153.595566f}, 2, {-5338010, -6655340, -1567904}, 2},
+        {0.996682823f, -4.59340858f, true, 1, {32.0014992f, 208.102341f, -59.5306549f}, 1, {310893, 2124376, -612556}, 1},
+        {-0.983323872f, 3.59257531f, false, 2, {-192.116516f, -357.509338f, -110.621979f}, 2, {-1991708, -3661645, -1136721}, 2},
+        {1.12118328f, -5.77920055f, false, 1, {85.1528015f, 275.412781f, -42.4766083f}, 1, {856415, 2814932, -435589}, 1},
+        {0.0798611417f, -0.615320861f, false, 1, {92.9129028f, 124.956001f, 86.8292465f}, 1, {945954, 1299893, 891955}, 1},
+        {0.118173428f, -2.45727253f, false, 1, {41.0639877f, 137.096542f, 24.6131153f}, 1, {420772, 1406893, 260332}, 1},
+        {-1.09070063f, 9.1196537f, false, 2, {-483.810028f, -632.942688f, -138.0858f}, 2, {-5005402, -6491596, -1435331}, 2},
+        {-1.14618576f, -3.34715295f, false, 0, {-166.659393f, -300.605316f, -351.03894f}, 0, {-1725838, -3095314, -3631026}, 0},
+        {-0.361105651f, -9.05461597f, false, 1, {-241.934357f, -110.94931f, -415.747467f}, 1, {-2477287, -1150352, -4278519}, 1},
+        {0.842510164f, -1.29970253f, true, 1, {-98.6411209f, -7.3606143f, -111.022133f}, 1, {-977040, -21876, -1110941}, 1},
+        {-0.406158328f, -7.07051563f, false, 1, {-200.59729f, -109.244545f, -331.136261f}, 1, {-2051521, -1119846, -3408328}, 1},
+        {0.925090253f, -10.2917805f, false, 1, {70.5535431f, 329.564026f, -143.29834f}, 1, {731804, 3391081, -1466224}, 1},
+        {-0.347512752f, 7.28862333f, false, 2, {-469.208313f, -586.371521f, -130.972656f}, 2, {-4857918, -6030666, -1361244}, 2},
+        {0.830642283f, 3.1706183f, false, 2, {-305.803589f, -377.687164f, -247.372101f}, 2, {-3119592, -3829110, -2518019}, 2},
+        {-0.500768483f, 0.968191624f, false, 0, {5.62134123f, -107.293259f, -14.2282867f}, 0, {39481, -1104461, -169363}, 0},
+        {1.09485614f, 9.21164894f, false, 2, {-925.109192f, -1070.59863f, -564.065125f}, 2, {-9462891, -10928553, -5757952}, 2},
+        {-0.577214241f, -1.71847069f, false, 0, {-56.9734497f, -138.427597f, -143.09903f}, 0, {-591978, -1421772, -1480924}, 0},
+        {0.337294728f, -6.24379158f, true, 1, {-8.27794933f, 157.196884f, -111.401024f}, 1, {-70326, 1628496, -1129392}, 1},
+        {0.198239788f, -3.50727558f, false, 1, {27.4108753f, 153.029953f, -16.3445129f}, 1, {273482, 1572132, -182104}, 1},
+        {-0.854180396f, 10.2438917f, false, 2, {-620.013f, -764.187988f, -195.93689f}, 2, {-6364631, -7801730, -2015972}, 2},
+        {-0.87015146f, 9.54098511f, false, 2, {-569.399475f, -708.349426f, -173.861862f}, 2, {-5831302, -7214100, -1783472}, 2},
+        {-0.406728268f, 5.65683985f, false, 2, {-287.139435f, -386.076996f, -51.0748749f}, 2, {-2973312, -3960126, -533833}, 2},
+        {-0.537623823f, -0.970322192f, false, 0, {-29.3874474f, -118.422707f, -101.100182f}, 0, {-295927, -1205059, -1028015}, 0},
+        {0.464062959f, -10.2470207f, false, 1, {-68.8144836f, 135.552353f, -251.257965f}, 1, {-701002, 1387251, -2585363}, 1},
+        {-0.501388371f, -2.3852365f, false, 0, {-69.7522583f, -118.226715f, -148.698547f}, 0, {-711420, -1216657, -1526314}, 0},
+        {-0.40000841f, -7.10640049f, true, 1, {-200.123032f, -107.459183f, -331.376892f}, 1, {-2051521, -1119846, -3408328}, 1},
+        {0.92387104f, 3.18246627f, false, 2, {-335.007629f, -402.863373f, -270.799957f}, 2, {-3404248, -4068513, -2746740}, 2},
+        {-0.999387503f, 9.41743565f, false, 2, {-525.850525f, -665.488892f, -153.217728f}, 2, {-5456747, -6840623, -1595255}, 2},
+        {-0.377836347f, -2.52568555f, false, 0, {-61.0292664f, -77.1534576f, -118.588013f}, 0, {-627653, -795893, -1223534}, 0},
+        {-0.153356984f, -8.18384171f, false, 1, {-177.518646f, -44.6275749f, -334.37851f}, 1, {-1820464, -472839, -3445591}, 1},
+        {0.671451926f, 7.92291832f, false, 2, {-731.095093f, -856.648621f, -398.771393f}, 2, {-7507240, -8769299, -4071199}, 2},
+        {1.02691853f, 6.9147892f, false, 2, {-685.628967f, -813.17157f, -459.364532f}, 2, {-7029953, -8318407, -4703452}, 2},
+        {-0.974105f, 3.1712234f, false, 2, {-182.138672f, -345.669189f, -118.263023f}, 2, {-1882508, -3534641, -1231225}, 2},
+        {0.612808943f, -5.20723057f, true, 1, {90.8703995f, 274.146057f, -15.351243f}, 1, {931765, 2819072, -147666}, 1},
+        {0.308757395f, -4.67529917f, false, 1, {22.5522919f, 174.242386f, -50.7045746f}, 1, {235230, 1788765, -510476}, 1},
+        {0.513477385f, 6.70520449f, false, 2, {-580.031189f, -692.083435f, -300.211975f}, 2, {-5920382, -7042815, -3049187}, 2},
+        {-1.01216614f, 3.21078563f, false, 2, {-194.087601f, -360.986938f, -129.185486f}, 2, {-2022004, -3712336, -1344434}, 2},
+        {-0.941969454f, -2.04849005f, false, 0, {-109.174248f, -256.334991f, -265.566864f}, 0, {-1120621, -2629986, -2730738}, 0},
+        {0.481764019f, 9.79899025f, false, 2, {-892.373596f, -1026.53235f, -422.725647f}, 2, {-9095213, -10435427, -4289878}, 2},
+        {-0.448759228f, -4.81294155f, false, 1, {-146.190735f, -110.889053f, -238.534805f}, 1, {-1488644, -1129242, -2439970}, 1},
+        {0.720375836f, 9.73359489f, false, 2, {-925.10968f, -1065.56555f, -490.573853f}, 2, {-9495244, -10907173, -5012339}, 2},
+        {-0.451369315f, -0.781416833f, true, 0, {-10.1381798f, -81.1632004f, -63.832901f}, 0, {-115154, -840897, -670965}, 0},
+        {-0.509895146f, -3.05573273f, false, 0, {-91.5125732f, -126.795166f, -178.848999f}, 0, {-945041, -1308375, -1851409}, 0},
+        {1.1018492f, 4.37155008f, false, 2, {-431.196045f, -540.642944f, -343.697357f}, 2, {-4439000, -5547175, -3523533}, 2},
+        {0.957268834f, 5.64032221f, false, 2, {-543.188232f, -659.191345f, -384.192444f}, 2, {-5579828, -6751714, -3927219}, 2},
+        {0.458932132f, -10.1208239f, false, 1, {-70.3811417f, 133.467133f, -252.527664f}, 1, {-701002, 1387251, -2585363}, 1},
+        {0.890538096f, 2.64168859f, false, 2, {-300.675476f, -347.742554f, -245.1642f}, 2, {-3086121, -3566010, -2507129}, 2},
+        {0.0391887613f, -0.739373863f, false, 1, {91.3803406f, 119.837959f, 88.1272202f}, 1, {940036, 1241430, 918347}, 1},
+        {0.783842087f, -6.85365105f, false, 1, {101.811089f, 316.616791f, -47.0972786f}, 1, {1047267, 3258511, -472444}, 1},
+        {0.355692267f, -3.52930403f, true, 1, {62.7891121f, 212.298187f, 4.97049475f}, 1, {640021, 2185354, 51328}, 1},
+        {-0.548349679f, 1.34216881f, false, 0, {-15.7822628f, -134.129105f, -20.7612762f}, 0, {-191173, -1391568, -238880}, 2},
+        {-0.128483579f, -5.85479641f, false, 1, {-116.283974f, -15.0961781f, -215.416931f}, 1, {-1187995, -162124, -2205940}, 1},
+        {1.12919772f, 4.7414813f, false, 2, {-466.579498f, -579.771851f, -362.429077f}, 2, {-4748491, -5888354, -3686942}, 2},
+        {-0.872936964f, 10.0598211f, false, 2, {-615.437134f, -759.480469f, -193.931091f}, 2, {-6323791, -7759590, -1998266}, 2},
+        {0.200239763f, -7.75046968f, false, 1, {-88.4218369f, 72.1363373f, -216.253403f}, 1, {-897215, 740246, -2208909}, 1},
+        {0.34905833f, 5.36348152f, false, 2, {-415.161957f, -512.599121f, -194.435349f}, 2, {-4237009, -5210838, -1967312}, 2},
+        {-0.961582661f, -8.48631287f, false, 0, {-325.046204f, -347.665619f, -586.955444f}, 0, {-3341422, -3596854, -6062113}, 0},
+        {0.239535794f, 4.94941235f, true, 2, {-354.659363f, -445.994507f, -144.60289f}, 2, {-3644747, -4558044, -1474169}, 2},
+        {-0.955605805f, 7.63679886f, false, 2, {-362.582947f, -507.376282f, -89.6800079f}, 2, {-3743221, -5192856, -932645}, 2},
+        {-0.639353991f, -6.59333134f, false, 1, {-227.52861f, -179.54805f, -375.408905f}, 1, {-2343878, -1863440, -3884180}, 1},
+        {1.10630858f, -7.50281954f, false, 1, {139.894577f, 353.360474f, -36.3847351f}, 1, {1440026, 3631552, -354779}, 1},
+        {-0.797471523f, -1.44546485f, false, 0, {-72.9566269f, -210.462738f, -195.65361f}, 0, {-747386, -2169756, -2013044}, 0},
+        {-0.954298079f, -4.03970528f, false, 0, {-179.788116f, -274.255798f, -354.01947f}, 0, {-1839377, -2830404, -3640831}, 0},
+        {0.809995234f, 4.82581854f, false, 2, {-435.33371f, -541.179443f, -306.101196f}, 2, {-4421468, -5485719, -3103265}, 2},
+        {1.10171461f, -1.94567001f, false, 1, {-115.959732f, -13.602911f, -140.833633f}, 1, {-1165294, -101401, -1423828}, 1},
+        {0.798692524f, 6.53636456f, true, 2, {-609.359985f, -727.856323f, -376.35376f}, 2, {-6232767, -7425290, -3841031}, 2},
+        {-0.324152857f, 1.25208235f, false, 0, {63.0217171f, -30.4568367f, 62.3972664f}, 2, {640719, -296051, 648844}, 2},
+        {-0.595865846f, -2.3287642f, false, 0, {-77.9266891f, -149.943985f, -173.698105f}, 0, {-809496, -1535436, -1797229}, 0},
+        {-0.209601849f, 1.13598561f, false, 2, {95.5379181f, 18.4801846f, 96.4786606f}, 2, {986778, 219648, 996131}, 0},
+        {-0.77459836f, -6.95752096f, false, 1, {-259.66629f, -227.377701f, -432.170868f}, 1, {-2655397, -2335992, -4433105}, 1},
+        {-0.597200096f, 10.2932959f, false, 2, {-682.706299f, -828.684692f, -223.417969f}, 2, {-7018071, -8475970, -2299268}, 2},
+        {1.10654068f, 6.43215895f, false, 2, {-639.325073f, -763.761047f, -444.540222f}, 2, {-6559587, -7817014, -4544691}, 2},
+        {0.717802763f, 4.74661875f, false, 2, {-412.098938f, -514.848389f, -275.736603f}, 2, {-4188220, -5220435, -2797623}, 2},
+        {0.829133213f, 7.02594471f, true, 2, {-664.681091f, -787.710083f, -406.308319f}, 2, {-6785108, -8022785, -4147461}, 2},
+        {-0.533179343f, -1.4369626f, false, 0, {-43.5837059f, -121.041565f, -118.734589f}, 0, {-447478, -1248923, -1224186}, 0},
+        {0.64620465f, 9.99440002f, false, 2, {-939.603638f, -1079.87744f, -479.701202f}, 2, {-9619411, -11026686, -4891191}, 2},
+        {-0.421499789f, -1.1985383f, false, 0, {-20.4124985f, -75.1138992f, -72.4682541f}, 0, {-205846, -761611, -736769}, 0},
+        {-0.847951353f, 6.60389662f, false, 2, {-285.110809f, -419.502045f, -56.1301956f}, 2, {-2956488, -4303645, -590565}, 2},
+        {1.09955835f, -7.61479568f, false, 1, {139.150711f, 355.556671f, -39.7340355f}, 1, {1429131, 3663010, -403136}, 1},
+        {0.150508866f, -2.49957943f, false, 1, {46.6434746f, 150.499161f, 27.1175022f}, 1, {468330, 1542577, 271686}, 1},
+        {0.970953107f, 5.57657528f, false, 2, {-538.873962f, -654.764709f, -385.452728f}, 2, {-5524203, -6695104, -3942135}, 2},
+        {-0.735801816f, -2.86372852f, true, 0, {-110.247803f, -199.197342f, -236.113892f}, 0, {-1120101, -2040824, -2414021}, 0},
+        {1.07824349f, 10.9191103f, false, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {0.821314216f, 5.54283524f, false, 2, {-510.909454f, -622.492798f, -340.244537f}, 2, {-5195331, -6317633, -3464107}, 2},
+        {-0.390326768f, 2.60165596f, false, 2, {1.45773697f, -92.7695694f, 60.2425842f}, 2, {3734, -933768, 619605}, 2},
+        {1.07120764f, -4.48887587f, false, 1, {13.2606783f, 189.36731f, -73.7606812f}, 1, {137074, 1953273, -748876}, 1},
+        {0.269400001f, -8.22232342f, false, 1, {-81.6936874f, 89.8415604f, -216.976532f}, 1, {-810914, 944992, -2205425}, 1},
+        {0.416605383f, 9.55352592f, false, 2, {-856.788208f, -987.704895f, -393.766754f}, 2, {-8753049, -10061450, -4018262}, 2},
+        {-0.711140454f, -4.75329638f, false, 0, {-174.986801f, -193.138611f, -314.540131f}, 0, {-1779617, -1980226, -3219177}, 0},
+        {-0.795371354f, 9.66535854f, true, 2, {-600.30127f, -741.161499f, -187.377365f}, 2, {-6199665, -7606630, -1943600}, 2},
+        {-0.898539603f, 5.20257139f, false, 2, {-194.735443f, -353.859314f, -40.3876228f}, 2, {-2023781, -3625992, -435757}, 2},
+        {0.87754482f, 10.2497444f, false, 2, {-978.395081f, -1125.26208f, -548.356445f}, 2, {-10005369, -11481552, -5587981}, 2},
+        {0.0494863354f, -10.5495844f, false, 1, {-175.26857f, -5.21088982f, -361.459198f}, 1, {-1788673, -58873, -3713423}, 1},
+        {0.948928058f, -2.87752008f, false, 1, {-42.0659904f, 91.0977173f, -91.6540909f}, 1, {-403364, 983175, -917854}, 1},
+        {0.131958634f, -1.88366807f, false, 1, {65.1824036f, 151.122772f, 52.3374367f}, 1, {664631, 1561125, 539460}, 1},
+        {-0.34041658f, 10.0405064f, false, 2, {-756.15094f, -901.371582f, -258.996857f}, 2, {-7763992, -9214666, -2658350}, 2},
+        {0.724170148f, 5.37413692f, false, 2, {-477.661987f, -585.337036f, -304.583374f}, 2, {-4865484, -5947620, -3099441}, 2},
+        {-1.01681685f, -10.8933935f, true, 0, {-370.343964f, -408.33963f, -692.900146f}, 0, {-3791995, -4194545, -7118929}, 0},
+        {0.840382993f, 0.78813374f, false, 2, {-203.396561f, -176.950592f, -174.57753f}, 2, {-2078093, -1790376, -1776328}, 2},
+        {0.664657116f, -6.46552515f, false, 1, {79.0635681f, 288.355377f, -52.2274361f}, 1, {826683, 2982696, -518092}, 1},
+        {1.034132f, -7.07460403f, false, 1, {138.119202f, 342.34079f, -27.4372883f}, 1, {1422203, 3526755, -270632}, 1},
+        {0.315273106f, -1.96479487f, false, 1, {69.250412f, 178.223114f, 41.157074f}, 1, {712771, 1843050, 434011}, 1},
+        {-0.908324063f, -6.99885654f, false, 0, {-280.265503f, -286.314209f, -483.192291f}, 0, {-2874703, -2945917, -4974392}, 0},
+        {-0.669913888f, -3.15418959f, false, 0, {-112.165535f, -179.786423f, -229.072617f}, 0, {-1146935, -1842302, -2350963}, 0},
+        {0.272236586f, 8.38110733f, false, 2, {-714.860352f, -835.557617f, -305.778687f}, 2, {-7286788, -8491332, -3104930}, 2},
+        {-0.621109188f, 1.53539097f, true, 2, {-43.5646019f, -170.031799f, -42.6146812f}, 0, {-448198, -1723825, -449505}, 0},
+        {-0.629559517f, 8.69357777f, false, 2, {-541.847839f, -673.04718f, -161.989777f}, 2, {-5541101, -6845979, -1655096}, 2},
+        {0.990826428f, -10.6859722f, false, 1, {90.8308868f, 357.901459f, -128.112976f}, 1, {940280, 3683805, -1308936}, 1},
+        {-0.442293823f, 9.88130474f, false, 2, {-712.499451f, -857.275208f, -237.785919f}, 2, {-7260546, -8703126, -2416416}, 2},
+        {0.765289843f, -0.788527966f, false, 1, {-106.787407f, -26.0769062f, -107.88649f}, 1, {-1091232, -254341, -1098430}, 1},
+        {1.12630153f, 10.5897541f, false, 2, {-1006.16663f, -1157.62744f, -597.966187f}, 2, {-10292376, -11817598, -6104592}, 2},
+        {-1.0643481f, -0.430741251f, false, 0, {-129.065781f, -304.000183f, -239.929474f}, 0, {-1346109, -3133725, -2466509}, 0},
+        {0.713491917f, -0.830888271f, false, 1, {-91.010376f, -8.26721191f, -94.0776596f}, 1, {-916925, -49795, -952030}, 1},
+        {-0.501204193f, 1.4375664f, true, 2, {-0.662562013f, -113.856323f, 0.310474783f}, 2, {-24986, -1169372, -17554}, 2},
+        {-0.436797708f, 10.5513535f, false, 2, {-726.648193f, -872.612183f, -244.187195f}, 2, {-7455772, -8913766, -2504594}, 2},
+        {-0.476978511f, -1.55750978f, false, 0, {-41.3611565f, -102.822098f, -107.617775f}, 0, {-434501, -1059442, -1120345}, 0},
+        {0.255414099f, 3.87775731f, false, 2, {-247.777161f, -332.371918f, -105.190147f}, 2, {-2518113, -3362617, -1059324}, 2},
+        {-0.978744566f, -6.93482351f, false, 0, {-286.819397f, -313.683929f, -505.531891f}, 0, {-2939489, -3242117, -5210498}, 0},
+        {-0.373616129f, -3.38017869f, false, 1, {-88.4440918f, -81.5054245f, -153.767853f}, 1, {-905673, -826713, -1577752}, 1},
+        {-0.997485042f, -7.16337729f, false, 0, {-296.688293f, -325.91037f, -525.244995f}, 0, {-3040543, -3359572, -5408708}, 0},
+        {0.962540209f, 3.19272804f, false, 2, {-347.358948f, -413.765564f, -280.689331f}, 2, {-3569591, -4246574, -2876776}, 2}
+    };
+}
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
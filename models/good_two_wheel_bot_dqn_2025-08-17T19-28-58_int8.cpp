@@ -0,0 +1,105 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (int8 quantized)
+ * Generated: 2025-08-17T19-28-58
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * Integer-only variant for MCUs without an FPU: int8 weights with one scale
+ * per layer, int32 accumulators, integer ReLU and int16 hidden activations.
+ * Drop-in API compatible with the float TwoWheelBotDQN export. Inference
+ * code lives in DQNPolicy.h (native/include/); copy it next to this file.
+ *
+ * Quantization report (argmax agreement with the float network):
+ *   Sweep: 101x101 grid, angle +/-1.0472 rad, angular velocity +/-10 rad/s
+ *   Agreement: 10175/10201 (99.75%)
+ *   Max |Q error|: 8.435581
+ *   Weight flash: 588 bytes (float export: 1548 bytes)
+ */
+
+#include "DQNPolicy.h"
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNInt8Weights {
+    static const int INPUT_SIZE = 2;
+    static const int HIDDEN_SIZE = 64;
+    static const int OUTPUT_SIZE = 3;
+
+    // Hidden requantization: int16 = (acc + round) >> HIDDEN_SHIFT
+    static const int HIDDEN_SHIFT = 1;
+
+    // Input scales: radians and rad/s to int8 LSBs (127 / limit)
+    struct InputScales {
+        static constexpr float angleScale() { return 121.27607f; }
+        static constexpr float angularVelocityScale() { return 12.6999998f; }
+    };
+
+    // Layer scales (real = integer * scale), for reference only
+    //   weightsInputHidden:  7.874010e-2
+    //   weightsHiddenOutput: 7.874016e-2
+    //   Q-value per output LSB: 9.763791e-5
+    static DQN_FLASH dqn::DQNQuantizedWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM = {
+        // weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]
+        {
+            80, -24, -46, 8, -87, -27, -27, 97, -22, 123, 60, -27, -33, 116, 6, -24,
+            -33, 93, -55, -50, 124, -28, 68, 113, -85, 54, 127, 51, 102, -71, 60, 31,
+            -24, -49, -46, 64, 59, 104, -80, 52, 120, -29, 108, 126, -27, 30, 8, -123,
+            -91, -57, -112, 127, -90, -29, -88, 12, -127, 127, 100, 63, 116, 100, 67, 127,
+            89, 82, -70, -16, 91, 88, 98, 118, 82, 116, 90, 97, 45, 112, 37, 93,
+            95, 56, -67, -69, 33, 76, 99, 47, -126, 91, 85, 89, 82, -2, 87, 121,
+            94, 120, -70, 89, 85, 107, -48, 105, 121, 95, 43, 15, 86, 1, -103, -125,
+            39, 52, 88, 127, -45, 95, -127, 84, -124, 127, 111, 100, 127, -34, 101, 127
+        },
+        // biasHidden[HIDDEN_SIZE]
+        {
+            130, -1499, -10487, -290, 14960, -2381, -1860, -95,
+            -1603, -52, -49, -1845, -2289, 16122, -1626, -1928,
+            -1207, 16128, -11318, -10809, -388, -1470, 97, 16125,
+            -883, 725, 15012, -30, 7321, -9118, -142, 2632,
+            -1911, 5159, -10362, 176, -140, 221, 4573, -1899,
+            -109, -1529, -1873, 15815, -1405, 4864, -3605, -949,
+            37, 5535, 7467, -336, 97, -1534, -452, -5220,
+            -156, 15912, 10983, 5884, 8686, 2278, -64, 16122
+        },
+        // weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]
+        {
+            -124, -123, -44, -71, -39, -32, 19, -123, -72, -28, -2, 66, 5, -18, 5, -81,
+            -15, 3, -93, -23, -25, -82, -126, -26, -65, -55, -44, -70, -18, 107, -123, -125,
+            -95, -107, -22, -30, 8, 15, 18, -8, -81, 38, -8, -51, -83, -107, -25, -25,
+            -83, -38, -19, 8, 22, 5, 14, -127, -70, 17, -127, -72, 57, 62, -127, -62,
+            -46, 28, -103, -121, -40, -5, 79, 19, -124, -59, -127, -122, -122, -103, 0, 7,
+            -22, -123, -125, -105, 80, 120, 127, 76, 125, -30, -92, -126, -98, 127, -115, -10,
+            -88, -28, -39, 127, -84, -13, 19, -100, -69, -109, -123, -64, -81, -126, -97, 49,
+            13, 97, 1, 17, 27, -83, -103, -28, -95, -112, -21, -106, -26, -20, 91, 100,
+            70, 2, 39, -8, -74, -37, -26, 0, -40, 45, -50, 74, -54, -117, -126, -127,
+            -45, -97, -93, 42, 7, 10, 30, -17, 119, 25, -59, -93, -117, -89, -88, -107,
+            -29, -21, -124, 42, -127, -20, -47, -58, 127, -29, -73, -14, 21, -10, -10, 30,
+            2, 6, 7, -14, 7, 8, -13, 109, 66, -97, -19, 35, -20, -6, 23, -13
+        },
+        // biasOutput[OUTPUT_SIZE]
+        {
+            102419, 101028, 87141
+        }
+    };
+}
+
+typedef dqn::QuantizedDQNPolicy<TwoWheelBotDQNInt8Weights::INPUT_SIZE,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SIZE,
+                                TwoWheelBotDQNInt8Weights::OUTPUT_SIZE,
+                                dqn::ReLU,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SHIFT,
+                                TwoWheelBotDQNInt8Weights::weights,
+                                dqn::ScaledInput<TwoWheelBotDQNInt8Weights::InputScales> > TwoWheelBotDQNInt8;
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
+
+// Usage example:
+// TwoWheelBotDQNInt8 bot;
+// int action = bot.getAction(angle, angularVelocity);
+// float torque = bot.getMotorTorque(action);
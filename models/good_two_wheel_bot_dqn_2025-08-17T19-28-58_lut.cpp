@@ -0,0 +1,76 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (action lookup table)
+ * Generated: 2025-08-17T19-28-58
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * The float network sampled into a 32x32 grid over the normalized
+ * (angle, angularVelocity) square with 2-bit cells: each cell holds the action
+ * the network picks most often on a 4x4 sub-grid of the cell.
+ * A tick is one table read; there are no Q-values. Drop-in for getAction
+ * and getMotorTorque of the float TwoWheelBotDQN export. Inference code
+ * lives in DQNPolicy.h (native/include/); copy it next to this file.
+ *
+ * Lookup report (argmax agreement with the float network):
+ *   Sweep: 101x101 grid, angle +/-1.0472 rad, angular velocity +/-10 rad/s
+ *   Agreement: 10057/10201 (98.59%)
+ *   Table flash: 256 bytes (float export: 1548 bytes)
+ */
+
+#include "DQNPolicy.h"
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNLookupTable {
+    static const int ROWS = 32;
+    static const int COLS = 32;
+    static const int OUTPUT_SIZE = 3;
+
+    // Input scales: radians and rad/s to the table's [-1, 1] square (1 / limit)
+    struct InputScales {
+        static constexpr float angleScale() { return 0.95492965f; }
+        static constexpr float angularVelocityScale() { return 0.100000001f; }
+    };
+
+    // Row-major cells (row: angle, column: angular velocity), packed low bits first
+    static DQN_FLASH dqn::DQNActionGrid<ROWS, COLS, OUTPUT_SIZE> table DQN_PROGMEM = {
+        // cells[BYTES]
+        {
+            0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA,
+            0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x55, 0x05, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA,
+            0x55, 0x15, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x01, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x05, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x05, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x15, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x05, 0xA0, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x05, 0xA0, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x15, 0xA8, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x15, 0xAA, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA,
+            0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA
+        }
+    };
+}
+
+typedef dqn::DQNLookupPolicy<TwoWheelBotDQNLookupTable::ROWS,
+                             TwoWheelBotDQNLookupTable::COLS,
+                             TwoWheelBotDQNLookupTable::OUTPUT_SIZE,
+                             TwoWheelBotDQNLookupTable::table,
+                             dqn::ScaledInput<TwoWheelBotDQNLookupTable::InputScales> > TwoWheelBotDQNLookup;
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
+
+// Usage example:
+// TwoWheelBotDQNLookup bot;
+// int action = bot.getAction(angle, angularVelocity);
+// float torque = bot.getMotorTorque(action);
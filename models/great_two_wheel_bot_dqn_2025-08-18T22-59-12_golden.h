@@ -0,0 +1,373 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (golden test vectors)
+ * Generated: 2025-08-18T22-59-12
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * 327 raw states in 215 sequences with the outputs the simulator computes
+ * for them: float Q-values and action (CPUBackend.forward without its ±100
+ * clamp), int8 accumulators and action of the _int8 export, and the action
+ * of the _lut export (-1 for multi-timestep models). Reset the policy with
+ * the state of every vector marked reset, then call forward once per vector.
+ * native/tests/test_conformance.cpp checks every kernel and precision
+ * against this table.
+ */
+
+#include <stdint.h>
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNGolden {
+    static const int COUNT = 327;
+    static const int INPUT_SIZE = 2;
+    static const int OUTPUT_SIZE = 3;
+
+    struct Vector {
+        float angle;                          // Raw state (rad, rad/s)
+        float angularVelocity;
+        bool reset;                           // Reset the policy with this state first
+        int action;                           // Float argmax
+        float qValues[OUTPUT_SIZE];
+        int int8Action;
+        int32_t int8Accumulators[OUTPUT_SIZE];
+        int lookupAction;
+    };
+
+    static const Vector vectors[COUNT] = {
+        {-1.2566371f, -12.0f, true, 0, {83.3670425f, 60.5451965f, 75.1614761f}, 0, {7259515, 5259509, 6553651}, 0},
+        {-1.2566371f, -10.0f, true, 0, {83.3670425f, 60.5451965f, 75.1614761f}, 0, {7259515, 5259509, 6553651}, 0},
+        {-1.2566371f, -8.0f, true, 0, {83.4107132f, 64.1368332f, 77.1637039f}, 0, {7263575, 5569766, 6723238}, 0},
+        {-1.2566371f, -6.0f, true, 0, {83.8607712f, 68.3025284f, 79.3505707f}, 0, {7304691, 5945562, 6916620}, 0},
+        {-1.2566371f, -4.0f, true, 0, {84.8958511f, 72.259613f, 81.6898193f}, 0, {7392870, 6290172, 7113582}, 0},
+        {-1.2566371f, -2.0f, true, 0, {86.6545868f, 75.9350204f, 84.6132736f}, 0, {7549242, 6626971, 7373383}, 0},
+        {-1.2566371f, 0.0f, true, 0, {89.3371277f, 80.090004f, 88.2979431f}, 0, {7777744, 6986859, 7691086}, 0},
+        {-1.2566371f, 2.0f, true, 0, {92.2414322f, 84.3293762f, 92.1723862f}, 0, {8025636, 7351250, 8021085}, 0},
+        {-1.2566371f, 4.0f, true, 2, {95.165329f, 88.3439255f, 95.6262207f}, 2, {8285143, 7711854, 8328448}, 2},
+        {-1.2566371f, 6.0f, true, 2, {98.0828934f, 92.2268066f, 98.8862305f}, 2, {8534154, 8048253, 8608752}, 2},
+        {-1.2566371f, 8.0f, true, 2, {99.9549408f, 94.3031006f, 101.087555f}, 2, {8699811, 8237873, 8805938}, 2},
+        {-1.2566371f, 10.0f, true, 2, {100.612274f, 92.1297073f, 102.02565f}, 2, {8754611, 8055123, 8888043}, 2},
+        {-1.2566371f, 12.0f, true, 2, {100.612274f, 92.1297073f, 102.02565f}, 2, {8754611, 8055123, 8888043}, 2},
+        {-1.04719758f, -12.0f, true, 0, {83.3670425f, 60.5451965f, 75.1614761f}, 0, {7259515, 5259509, 6553651}, 0},
+        {-1.04719758f, -10.0f, true, 0, {83.3670425f, 60.5451965f, 75.1614761f}, 0, {7259515, 5259509, 6553651}, 0},
+        {-1.04719758f, -8.0f, true, 0, {83.4107132f, 64.1368332f, 77.1637039f}, 0, {7263575, 5569766, 6723238}, 0},
+        {-1.04719758f, -6.0f, true, 0, {83.8607712f, 68.3025284f, 79.3505707f}, 0, {7304691, 5945562, 6916620}, 0},
+        {-1.04719758f, -4.0f, true, 0, {84.8958511f, 72.259613f, 81.6898193f}, 0, {7392870, 6290172, 7113582}, 0},
+        {-1.04719758f, -2.0f, true, 0, {86.6545868f, 75.9350204f, 84.6132736f}, 0, {7549242, 6626971, 7373383}, 0},
+        {-1.04719758f, 0.0f, true, 0, {89.3371277f, 80.090004f, 88.2979431f}, 0, {7777744, 6986859, 7691086}, 0},
+        {-1.04719758f, 2.0f, true, 0, {92.2414322f, 84.3293762f, 92.1723862f}, 0, {8025636, 7351250, 8021085}, 0},
+        {-1.04719758f, 4.0f, true, 2, {95.165329f, 88.3439255f, 95.6262207f}, 2, {8285143, 7711854, 8328448}, 2},
+        {-1.04719758f, 6.0f, true, 2, {98.0828934f, 92.2268066f, 98.8862305f}, 2, {8534154, 8048253, 8608752}, 2},
+        {-1.04719758f, 8.0f, true, 2, {99.9549408f, 94.3031006f, 101.087555f}, 2, {8699811, 8237873, 8805938}, 2},
+        {-1.04719758f, 10.0f, true, 2, {100.612274f, 92.1297073f, 102.02565f}, 2, {8754611, 8055123, 8888043}, 2},
+        {-1.04719758f, 12.0f, true, 2, {100.612274f, 92.1297073f, 102.02565f}, 2, {8754611, 8055123, 8888043}, 2},
+        {-0.837758064f, -12.0f, true, 0, {84.3997498f, 64.8840714f, 77.3992462f}, 0, {7349442, 5633615, 6744705}, 0},
+        {-0.837758064f, -10.0f, true, 0, {84.3997498f, 64.8840714f, 77.3992462f}, 0, {7349442, 5633615, 6744705}, 0},
+        {-0.837758064f, -8.0f, true, 0, {84.6519775f, 67.8022842f, 79.5231323f}, 0, {7370638, 5889050, 6923863}, 0},
+        {-0.837758064f, -6.0f, true, 0, {85.5472336f, 71.6629791f, 81.8310318f}, 0, {7450295, 6237547, 7126207}, 0},
+        {-0.837758064f, -4.0f, true, 0, {86.8578339f, 75.7574234f, 84.3253174f}, 0, {7560891, 6589344, 7337783}, 0},
+        {-0.837758064f, -2.0f, true, 0, {88.7790756f, 80.3810196f, 87.2232132f}, 0, {7729510, 7009021, 7593551}, 0},
+        {-0.837758064f, 0.0f, true, 0, {91.4702606f, 84.4940567f, 90.6619797f}, 0, {7961817, 7365674, 7890569}, 0},
+        {-0.837758064f, 2.0f, true, 0, {94.263588f, 88.4053116f, 93.9282837f}, 0, {8200337, 7704153, 8171572}, 0},
+        {-0.837758064f, 4.0f, true, 2, {97.1553955f, 92.1635895f, 97.1592331f}, 2, {8457229, 8042703, 8460652}, 0},
+        {-0.837758064f, 6.0f, true, 2, {99.4385605f, 94.8195648f, 99.5475693f}, 2, {8653653, 8276445, 8667292}, 2},
+        {-0.837758064f, 8.0f, true, 2, {100.180214f, 93.1556168f, 100.480934f}, 2, {8720147, 8140457, 8754598}, 2},
+        {-0.837758064f, 10.0f, true, 2, {100.645432f, 90.3977203f, 101.136475f}, 2, {8759679, 7910989, 8814197}, 2},
+        {-0.837758064f, 12.0f, true, 2, {100.645432f, 90.3977203f, 101.136475f}, 2, {8759679, 7910989, 8814197}, 2},
+        {-0.628318548f, -12.0f, true, 0, {85.9738464f, 69.3887253f, 79.9380112f}, 0, {7491029, 6037187, 6969468}, 0},
+        {-0.628318548f, -10.0f, true, 0, {85.9738464f, 69.3887253f, 79.9380112f}, 0, {7491029, 6037187, 6969468}, 0},
+        {-0.628318548f, -8.0f, true, 0, {86.5782623f, 72.1144638f, 82.1540375f}, 0, {7542843, 6276665, 7155709}, 0},
+        {-0.628318548f, -6.0f, true, 0, {87.6594086f, 75.3788223f, 84.5217896f}, 0, {7638826, 6570734, 7364562}, 0},
+        {-0.628318548f, -4.0f, true, 0, {89.3473129f, 80.1567688f, 87.2239227f}, 0, {7782045, 6987601, 7594720}, 0},
+        {-0.628318548f, -2.0f, true, 0, {91.2738953f, 84.940918f, 90.1391678f}, 0, {7953362, 7417479, 7853451}, 0},
+        {-0.628318548f, 0.0f, true, 0, {93.6073456f, 88.8485336f, 93.0612411f}, 0, {8153776, 7756022, 8103058}, 0},
+        {-0.628318548f, 2.0f, true, 0, {96.3153152f, 92.7315674f, 96.0750275f}, 0, {8384677, 8091859, 8361102}, 0},
+        {-0.628318548f, 4.0f, true, 0, {99.0079803f, 95.9169617f, 98.6054535f}, 0, {8622146, 8378129, 8587492}, 0},
+        {-0.628318548f, 6.0f, true, 0, {99.9203186f, 95.2063751f, 99.7424469f}, 0, {8698463, 8321235, 8686608}, 0},
+        {-0.628318548f, 8.0f, true, 0, {100.31813f, 92.2816162f, 100.286407f}, 2, {8732128, 8063337, 8737150}, 0},
+        {-0.628318548f, 10.0f, true, 2, {100.430115f, 88.5894928f, 100.507935f}, 2, {8739803, 7750036, 8758159}, 2},
+        {-0.628318548f, 12.0f, true, 2, {100.430115f, 88.5894928f, 100.507935f}, 2, {8739803, 7750036, 8758159}, 2},
+        {-0.418879032f, -12.0f, true, 0, {87.8685532f, 73.769722f, 82.5997009f}, 0, {7653669, 6413623, 7194896}, 0},
+        {-0.418879032f, -10.0f, true, 0, {87.8685532f, 73.769722f, 82.5997009f}, 0, {7653669, 6413623, 7194896}, 0},
+        {-0.418879032f, -8.0f, true, 0, {89.0085068f, 76.9761581f, 84.9833221f}, 0, {7751103, 6693419, 7397323}, 0},
+        {-0.418879032f, -6.0f, true, 0, {90.2303085f, 80.3829269f, 87.3943863f}, 0, {7860317, 7003895, 7611237}, 0},
+        {-0.418879032f, -4.0f, true, 0, {91.8690872f, 84.6222076f, 90.169838f}, 0, {7999445, 7373026, 7846920}, 0},
+        {-0.418879032f, -2.0f, true, 0, {93.8136673f, 89.3106384f, 92.9154205f}, 0, {8172433, 7793750, 8090312}, 0},
+        {-0.418879032f, 0.0f, true, 0, {95.8062668f, 93.1876373f, 95.4671249f}, 0, {8342832, 8130021, 8307752}, 0},
+        {-0.418879032f, 2.0f, true, 0, {98.4375992f, 96.9616013f, 98.2613602f}, 0, {8568047, 8457389, 8548632}, 0},
+        {-0.418879032f, 4.0f, true, 0, {99.605484f, 97.3218765f, 99.3738022f}, 0, {8673288, 8500619, 8652504}, 0},
+        {-0.418879032f, 6.0f, true, 0, {99.9960709f, 94.2233047f, 99.5352554f}, 0, {8705449, 8239379, 8669448}, 0},
+        {-0.418879032f, 8.0f, true, 0, {100.109283f, 90.6086578f, 99.6905594f}, 0, {8713395, 7919561, 8685674}, 0},
+        {-0.418879032f, 10.0f, true, 0, {99.8983536f, 86.0446472f, 99.576355f}, 0, {8695990, 7534280, 8678973}, 0},
+        {-0.418879032f, 12.0f, true, 0, {99.8983536f, 86.0446472f, 99.576355f}, 0, {8695990, 7534280, 8678973}, 0},
+        {-0.209439516f, -12.0f, true, 0, {90.4916763f, 78.8615265f, 85.6730804f}, 0, {7888666, 6871016, 7469271}, 0},
+        {-0.209439516f, -10.0f, true, 0, {90.4916763f, 78.8615265f, 85.6730804f}, 0, {7888666, 6871016, 7469271}, 0},
+        {-0.209439516f, -8.0f, true, 0, {91.6060257f, 82.1433334f, 87.8495178f}, 0, {7983725, 7156765, 7652721}, 0},
+        {-0.209439516f, -6.0f, true, 0, {92.8810654f, 85.8248978f, 90.3817368f}, 0, {8096142, 7491815, 7876434}, 0},
+        {-0.209439516f, -4.0f, true, 0, {94.4538498f, 89.2505722f, 92.9523163f}, 0, {8231142, 7788990, 8094835}, 0},
+        {-0.209439516f, -2.0f, true, 0, {96.3584747f, 93.6242828f, 95.6471329f}, 0, {8400600, 8181740, 8333735}, 0},
+        {-0.209439516f, 0.0f, true, 0, {98.332695f, 97.5557556f, 98.1751404f}, 0, {8569507, 8521469, 8549061}, 0},
+        {-0.209439516f, 2.0f, true, 0, {99.3888931f, 98.9063263f, 99.3693619f}, 0, {8656079, 8638822, 8649701}, 0},
+        {-0.209439516f, 4.0f, true, 0, {99.6236267f, 96.4759064f, 99.4790039f}, 0, {8674624, 8425410, 8661835}, 0},
+        {-0.209439516f, 6.0f, true, 0, {99.1906662f, 92.0401154f, 98.9709549f}, 0, {8632842, 8044695, 8619056}, 0},
+        {-0.209439516f, 8.0f, true, 0, {98.4338074f, 86.9690857f, 98.1854477f}, 0, {8562746, 7595421, 8551268}, 0},
+        {-0.209439516f, 10.0f, true, 0, {97.5606461f, 81.6231155f, 97.4977264f}, 2, {8483969, 7137450, 8492117}, 0},
+        {-0.209439516f, 12.0f, true, 0, {97.5606461f, 81.6231155f, 97.4977264f}, 2, {8483969, 7137450, 8492117}, 0},
+        {0.0f, -12.0f, true, 0, {93.1930313f, 84.0863419f, 88.7544632f}, 0, {8121341, 7321791, 7733596}, 0},
+        {0.0f, -10.0f, true, 0, {93.1930313f, 84.0863419f, 88.7544632f}, 0, {8121341, 7321791, 7733596}, 0},
+        {0.0f, -8.0f, true, 0, {94.2360535f, 87.5400925f, 90.8218231f}, 0, {8210592, 7622870, 7908964}, 0},
+        {0.0f, -6.0f, true, 0, {95.6350555f, 91.0567627f, 93.2435303f}, 0, {8333213, 7941586, 8121345}, 0},
+        {0.0f, -4.0f, true, 0, {97.1932068f, 94.4593353f, 95.7723465f}, 0, {8466938, 8237011, 8336495}, 0},
+        {0.0f, -2.0f, true, 0, {98.9042435f, 97.9107437f, 98.3720627f}, 0, {8620100, 8551765, 8567035}, 0},
+        {0.0f, 0.0f, true, 1, {99.9640656f, 99.97612f, 99.9705505f}, 1, {8707992, 8727886, 8701643}, 2},
+        {0.0f, 2.0f, true, 2, {98.6105194f, 97.4016647f, 98.9066391f}, 2, {8590511, 8513628, 8612826}, 2},
+        {0.0f, 4.0f, true, 2, {97.354393f, 92.3958282f, 97.7821503f}, 2, {8475101, 8070494, 8514498}, 2},
+        {0.0f, 6.0f, true, 2, {96.2956924f, 87.138176f, 96.7264709f}, 2, {8381661, 7622319, 8426353}, 2},
+        {0.0f, 8.0f, true, 2, {95.3235931f, 81.6346436f, 95.7077866f}, 2, {8292101, 7132861, 8337523}, 2},
+        {0.0f, 10.0f, true, 2, {94.3430557f, 75.893013f, 94.6647491f}, 2, {8205351, 6643086, 8250198}, 2},
+        {0.0f, 12.0f, true, 2, {94.3430557f, 75.893013f, 94.6647491f}, 2, {8205351, 6643086, 8250198}, 2},
+        {0.209439516f, -12.0f, true, 0, {95.6345749f, 89.357048f, 91.4003372f}, 0, {8331317, 7777405, 7960944}, 0},
+        {0.209439516f, -10.0f, true, 0, {95.6345749f, 89.357048f, 91.4003372f}, 0, {8331317, 7777405, 7960944}, 0},
+        {0.209439516f, -8.0f, true, 0, {96.5918121f, 92.5889359f, 93.1872406f}, 0, {8414237, 8060259, 8114192}, 0},
+        {0.209439516f, -6.0f, true, 0, {97.7909698f, 95.6324234f, 95.216156f}, 0, {8519108, 8335937, 8291543}, 0},
+        {0.209439516f, -4.0f, true, 0, {98.6675262f, 98.3035583f, 97.2410126f}, 0, {8595477, 8569526, 8464761}, 0},
+        {0.209439516f, -2.0f, true, 1, {98.7207718f, 99.2814255f, 98.5416107f}, 1, {8599622, 8661076, 8580391}, 1},
+        {0.209439516f, 0.0f, true, 2, {97.5314636f, 96.7146454f, 98.0320892f}, 2, {8497127, 8449320, 8538492}, 2},
+        {0.209439516f, 2.0f, true, 2, {95.6175385f, 91.7690201f, 96.1936417f}, 2, {8331341, 8029399, 8382228}, 2},
+        {0.209439516f, 4.0f, true, 2, {93.9220505f, 86.4245834f, 94.6130371f}, 2, {8178036, 7555499, 8243163}, 2},
+        {0.209439516f, 6.0f, true, 2, {92.7462769f, 81.0907745f, 93.4764862f}, 2, {8074496, 7100624, 8147818}, 2},
+        {0.209439516f, 8.0f, true, 2, {91.7657089f, 75.3625107f, 92.4324951f}, 2, {7984276, 6592686, 8056898}, 2},
+        {0.209439516f, 10.0f, true, 2, {90.7851791f, 69.6208801f, 91.3894577f}, 2, {7897526, 6102911, 7969573}, 2},
+        {0.209439516f, 12.0f, true, 2, {90.7851791f, 69.6208801f, 91.3894577f}, 2, {7897526, 6102911, 7969573}, 2},
+        {0.418879032f, -12.0f, true, 0, {97.17202f, 93.4855194f, 92.9243164f}, 0, {8466517, 8149951, 8098298}, 0},
+        {0.418879032f, -10.0f, true, 0, {97.17202f, 93.4855194f, 92.9243164f}, 0, {8466517, 8149951, 8098298}, 0},
+        {0.418879032f, -8.0f, true, 0, {97.3613739f, 95.5677643f, 94.1707993f}, 0, {8480399, 8327023, 8202147}, 0},
+        {0.418879032f, -6.0f, true, 0, {97.7820587f, 97.7692947f, 95.6209946f}, 1, {8517398, 8525636, 8329525}, 1},
+        {0.418879032f, -4.0f, true, 1, {97.8831253f, 98.8833618f, 96.9956818f}, 1, {8522502, 8618577, 8443653}, 1},
+        {0.418879032f, -2.0f, true, 1, {96.5812225f, 96.846962f, 96.7135773f}, 1, {8403520, 8435121, 8416267}, 1},
+        {0.418879032f, 0.0f, true, 2, {94.6428452f, 91.3093872f, 95.2555542f}, 2, {8236073, 7961208, 8291747}, 2},
+        {0.418879032f, 2.0f, true, 2, {92.5681763f, 85.514122f, 93.3329086f}, 2, {8056573, 7468813, 8128052}, 2},
+        {0.418879032f, 4.0f, true, 2, {90.5594559f, 80.1798248f, 91.4464264f}, 2, {7875728, 6995853, 7961523}, 2},
+        {0.418879032f, 6.0f, true, 2, {89.2408066f, 74.7875137f, 90.2207489f}, 2, {7759441, 6535850, 7857855}, 2},
+        {0.418879032f, 8.0f, true, 2, {88.2078323f, 69.0903702f, 89.1572037f}, 2, {7664138, 6030904, 7765048}, 2},
+        {0.418879032f, 10.0f, true, 2, {87.2086029f, 63.2677879f, 88.1176758f}, 2, {7575124, 5530658, 7678289}, 2},
+        {0.418879032f, 12.0f, true, 2, {87.2086029f, 63.2677879f, 88.1176758f}, 2, {7575124, 5530658, 7678289}, 2},
+        {0.628318548f, -12.0f, true, 0, {96.8714752f, 95.5051498f, 93.2246857f}, 0, {8438950, 8322740, 8125080}, 0},
+        {0.628318548f, -10.0f, true, 0, {96.8714752f, 95.5051498f, 93.2246857f}, 0, {8438950, 8322740, 8125080}, 0},
+        {0.628318548f, -8.0f, true, 0, {97.1353149f, 97.0459442f, 94.4615402f}, 0, {8459532, 8452212, 8228154}, 1},
+        {0.628318548f, -6.0f, true, 1, {97.1009979f, 98.0760574f, 95.5116501f}, 1, {8454591, 8544780, 8319256}, 1},
+        {0.628318548f, -4.0f, true, 1, {95.8918381f, 96.3103104f, 95.23806f}, 1, {8348593, 8395783, 8293894}, 1},
+        {0.628318548f, -2.0f, true, 2, {93.9117355f, 92.0889816f, 94.0780716f}, 2, {8171845, 8024271, 8191392}, 2},
+        {0.628318548f, 0.0f, true, 2, {91.7217865f, 85.9908142f, 92.4598618f}, 2, {7982373, 7501283, 8052947}, 2},
+        {0.628318548f, 2.0f, true, 2, {89.5287476f, 79.3317795f, 90.477211f}, 2, {7792973, 6934308, 7883972}, 2},
+        {0.628318548f, 4.0f, true, 2, {87.5078201f, 73.9287338f, 88.5818024f}, 2, {7610997, 6457654, 7716238}, 2},
+        {0.628318548f, 6.0f, true, 2, {85.7892456f, 68.4251785f, 86.98703f}, 2, {7460816, 5987675, 7580830}, 2},
+        {0.628318548f, 8.0f, true, 2, {84.6137619f, 62.6615028f, 85.88871f}, 2, {7352649, 5473783, 7485339}, 2},
+        {0.628318548f, 10.0f, true, 2, {83.5722275f, 56.6125984f, 84.8616562f}, 2, {7260954, 4956667, 7399676}, 2},
+        {0.628318548f, 12.0f, true, 2, {83.5722275f, 56.6125984f, 84.8616562f}, 2, {7260954, 4956667, 7399676}, 2},
+        {0.837758064f, -12.0f, true, 1, {97.1687698f, 97.3214645f, 93.9921112f}, 1, {8460583, 8484065, 8191844}, 1},
+        {0.837758064f, -10.0f, true, 1, {97.1687698f, 97.3214645f, 93.9921112f}, 1, {8460583, 8484065, 8191844}, 1},
+        {0.837758064f, -8.0f, true, 1, {96.3334503f, 96.9900894f, 94.1966019f}, 1, {8384737, 8444112, 8204712}, 1},
+        {0.837758064f, -6.0f, true, 1, {95.2292023f, 95.5289078f, 94.0703735f}, 1, {8283594, 8313746, 8190268}, 1},
+        {0.837758064f, -4.0f, true, 0, {93.3644028f, 92.0104218f, 92.8497391f}, 0, {8121463, 8010904, 8083667}, 0},
+        {0.837758064f, -2.0f, true, 2, {91.1405487f, 86.9284286f, 91.3883514f}, 2, {7920854, 7557564, 7952111}, 2},
+        {0.837758064f, 0.0f, true, 2, {88.8007278f, 80.6722412f, 89.6641693f}, 2, {7718525, 7022961, 7804595}, 2},
+        {0.837758064f, 2.0f, true, 2, {86.6076889f, 74.0132065f, 87.6815186f}, 2, {7529125, 6455986, 7635620}, 2},
+        {0.837758064f, 4.0f, true, 2, {84.4584961f, 67.6593094f, 85.7221146f}, 2, {7336229, 5895080, 7462204}, 2},
+        {0.837758064f, 6.0f, true, 2, {82.3944321f, 61.8536034f, 83.85923f}, 2, {7156709, 5397125, 7303959}, 2},
+        {0.837758064f, 8.0f, true, 2, {81.0072784f, 55.9616051f, 82.6459808f}, 2, {7028891, 4872574, 7196758}, 2},
+        {0.837758064f, 10.0f, true, 2, {80.1172714f, 50.0737572f, 81.7680969f}, 2, {6953022, 4373517, 7126378}, 2},
+        {0.837758064f, 12.0f, true, 2, {80.1172714f, 50.0737572f, 81.7680969f}, 2, {6953022, 4373517, 7126378}, 2},
+        {1.04719758f, -12.0f, true, 0, {97.2801132f, 97.1381149f, 94.4873352f}, 0, {8463990, 8458592, 8231364}, 1},
+        {1.04719758f, -10.0f, true, 0, {97.2801132f, 97.1381149f, 94.4873352f}, 0, {8463990, 8458592, 8231364}, 1},
+        {1.04719758f, -8.0f, true, 1, {94.9165039f, 94.9337921f, 93.2089462f}, 1, {8260538, 8266330, 8121357}, 1},
+        {1.04719758f, -6.0f, true, 0, {93.0597687f, 92.0665741f, 92.1243439f}, 0, {8093638, 8010079, 8023042}, 0},
+        {1.04719758f, -4.0f, true, 0, {90.7987442f, 87.3100739f, 90.4294128f}, 0, {7898788, 7605304, 7877542}, 0},
+        {1.04719758f, -2.0f, true, 2, {88.3152847f, 81.5537949f, 88.6697998f}, 2, {7675529, 7093164, 7719886}, 2},
+        {1.04719758f, 0.0f, true, 2, {85.9480133f, 75.3389969f, 86.8999481f}, 2, {7471545, 6561756, 7568995}, 2},
+        {1.04719758f, 2.0f, true, 2, {83.6829529f, 68.678688f, 84.8865204f}, 2, {7274729, 5992842, 7396994}, 2},
+        {1.04719758f, 4.0f, true, 2, {81.4263306f, 61.6141891f, 82.9259109f}, 2, {7072129, 5366124, 7223488}, 2},
+        {1.04719758f, 6.0f, true, 2, {79.2934418f, 55.0641518f, 81.0378571f}, 2, {6888459, 4811535, 7063039}, 2},
+        {1.04719758f, 8.0f, true, 2, {77.7287979f, 49.4292068f, 79.663559f}, 2, {6748347, 4312542, 6943778}, 2},
+        {1.04719758f, 10.0f, true, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {1.04719758f, 12.0f, true, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {1.2566371f, -12.0f, true, 0, {97.2801132f, 97.1381149f, 94.4873352f}, 0, {8463990, 8458592, 8231364}, 1},
+        {1.2566371f, -10.0f, true, 0, {97.2801132f, 97.1381149f, 94.4873352f}, 0, {8463990, 8458592, 8231364}, 1},
+        {1.2566371f, -8.0f, true, 1, {94.9165039f, 94.9337921f, 93.2089462f}, 1, {8260538, 8266330, 8121357}, 1},
+        {1.2566371f, -6.0f, true, 0, {93.0597687f, 92.0665741f, 92.1243439f}, 0, {8093638, 8010079, 8023042}, 0},
+        {1.2566371f, -4.0f, true, 0, {90.7987442f, 87.3100739f, 90.4294128f}, 0, {7898788, 7605304, 7877542}, 0},
+        {1.2566371f, -2.0f, true, 2, {88.3152847f, 81.5537949f, 88.6697998f}, 2, {7675529, 7093164, 7719886}, 2},
+        {1.2566371f, 0.0f, true, 2, {85.9480133f, 75.3389969f, 86.8999481f}, 2, {7471545, 6561756, 7568995}, 2},
+        {1.2566371f, 2.0f, true, 2, {83.6829529f, 68.678688f, 84.8865204f}, 2, {7274729, 5992842, 7396994}, 2},
+        {1.2566371f, 4.0f, true, 2, {81.4263306f, 61.6141891f, 82.9259109f}, 2, {7072129, 5366124, 7223488}, 2},
+        {1.2566371f, 6.0f, true, 2, {79.2934418f, 55.0641518f, 81.0378571f}, 2, {6888459, 4811535, 7063039}, 2},
+        {1.2566371f, 8.0f, true, 2, {77.7287979f, 49.4292068f, 79.663559f}, 2, {6748347, 4312542, 6943778}, 2},
+        {1.2566371f, 10.0f, true, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {1.2566371f, 12.0f, true, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {0.0f, 0.0f, true, 1, {99.9640656f, 99.97612f, 99.9705505f}, 1, {8707992, 8727886, 8701643}, 2},
+        {1.04719758f, 10.0f, true, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {-1.04719758f, -10.0f, true, 0, {83.3670425f, 60.5451965f, 75.1614761f}, 0, {7259515, 5259509, 6553651}, 0},
+        {1.04719758f, -10.0f, true, 0, {97.2801132f, 97.1381149f, 94.4873352f}, 0, {8463990, 8458592, 8231364}, 1},
+        {9.9999461e-41f, -9.9999461e-41f, true, 1, {99.9640656f, 99.97612f, 99.9705505f}, 1, {8707992, 8727886, 8701643}, 2},
+        {-1e-30f, 1e-30f, true, 1, {99.9640656f, 99.97612f, 99.9705505f}, 1, {8707992, 8727886, 8701643}, 2},
+        {-1.04719758f, 2.19067955f, true, 0, {92.5183868f, 84.7256622f, 92.5183868f}, 2, {8055369, 7394399, 8058441}, 0},
+        {-1.04719758f, 2.19067979f, true, 2, {92.5183868f, 84.7256622f, 92.5183945f}, 2, {8055369, 7394399, 8058441}, 0},
+        {-0.87266463f, 3.71807551f, true, 0, {96.4059372f, 90.9384384f, 96.4059372f}, 2, {8389391, 7932621, 8391200}, 0},
+        {-0.87266463f, 3.71807575f, true, 2, {96.4059372f, 90.9384384f, 96.4059448f}, 2, {8389391, 7932621, 8391200}, 0},
+        {-0.69813168f, 6.88794374f, true, 0, {100.06501f, 94.2314072f, 100.06501f}, 2, {8709397, 8240736, 8714989}, 2},
+        {-0.69813168f, 6.88794422f, true, 2, {100.06501f, 94.2314072f, 100.065018f}, 2, {8709397, 8240736, 8714989}, 2},
+        {0.0f, -0.0488649756f, true, 0, {99.9690552f, 99.9690552f, 99.957283f}, 1, {8708431, 8726349, 8699512}, 0},
+        {0.0f, -0.0488649718f, true, 1, {99.9690552f, 99.9690628f, 99.957283f}, 1, {8708431, 8726349, 8699512}, 0},
+        {0.0f, 0.0265744235f, true, 1, {99.9559402f, 99.9736252f, 99.9736252f}, 1, {8707992, 8727886, 8701643}, 2},
+        {0.0f, 0.0265744254f, true, 2, {99.9559402f, 99.9736176f, 99.9736252f}, 1, {8707992, 8727886, 8701643}, 2},
+        {0.17453292f, -3.0308392f, true, 0, {98.930275f, 98.930275f, 98.0432892f}, 1, {8618701, 8631205, 8537827}, 1},
+        {0.17453292f, -3.03083897f, true, 1, {98.930275f, 98.9302826f, 98.0432892f}, 1, {8618701, 8631205, 8537827}, 1},
+        {0.17453292f, -1.09642518f, true, 1, {98.7431717f, 98.8496704f, 98.8496704f}, 1, {8601170, 8626077, 8605607}, 2},
+        {0.17453292f, -1.09642506f, true, 2, {98.7431717f, 98.8496704f, 98.849678f}, 1, {8601170, 8626077, 8605607}, 2},
+        {0.34906584f, -5.29267883f, true, 0, {98.0730743f, 98.0730743f, 96.1735153f}, 1, {8543546, 8550585, 8376138}, 1},
+        {0.34906584f, -5.29267836f, true, 1, {98.0730743f, 98.073082f, 96.1735153f}, 1, {8543546, 8550585, 8376138}, 1},
+        {0.34906584f, -1.52772057f, true, 1, {97.0344849f, 97.3037567f, 97.3037491f}, 1, {8448948, 8483795, 8471917}, 1},
+        {0.34906584f, -1.52772045f, true, 2, {97.0344849f, 97.3037491f, 97.3037567f}, 1, {8448948, 8483795, 8471917}, 1},
+        {0.52359879f, -6.94161987f, true, 0, {97.4709015f, 97.4709015f, 95.0833664f}, 1, {8489460, 8498892, 8284216}, 1},
+        {0.52359879f, -6.9416194f, true, 1, {97.4709015f, 97.4709091f, 95.0833664f}, 1, {8489460, 8498892, 8284216}, 1},
+        {0.52359879f, -2.60347819f, true, 1, {95.8713531f, 95.8713608f, 95.7883759f}, 1, {8340121, 8347927, 8334892}, 0},
+        {0.52359879f, -2.60347795f, true, 0, {95.8713531f, 95.8713531f, 95.7883759f}, 1, {8340121, 8347927, 8334892}, 0},
+        {0.69813168f, -8.63031197f, true, 0, {96.9386597f, 96.9386597f, 94.1247177f}, 1, {8441821, 8446050, 8200675}, 1},
+        {0.69813168f, -8.63031101f, true, 1, {96.9386597f, 96.9386673f, 94.1247253f}, 1, {8441821, 8446050, 8200675}, 1},
+        {0.874227881f, 0.997162282f, true, 2, {87.1986771f, 76.4260483f, 88.1888428f}, 2, {7579445, 6654546, 7678520}, 2},
+        {-0.244047657f, -10.9921875f, false, 0, {90.0452957f, 77.9981689f, 85.1639023f}, 0, {7842131, 6780861, 7416406}, 0},
+        {1.03203368f, 10.9004059f, false, 2, {77.1351013f, 44.3150291f, 79.1192932f}, 2, {6697630, 3880949, 6901254}, 2},
+        {0.0952072889f, -9.41381454f, false, 0, {94.6726303f, 87.419426f, 90.661972f}, 0, {8252337, 7617986, 7899607}, 0},
+        {0.201052874f, -4.90567398f, false, 0, {98.3987122f, 97.1178055f, 96.3830109f}, 0, {8573312, 8469176, 8393670}, 0},
+        {-0.973515093f, 2.5528841f, false, 0, {93.7310715f, 86.7175369f, 93.6283493f}, 0, {8156192, 7562919, 8148878}, 0},
+        {0.126528978f, 2.60087109f, false, 2, {96.2256775f, 92.596199f, 96.7626266f}, 2, {8381885, 8095418, 8429169}, 2},
+        {-0.805078745f, 8.92741203f, false, 2, {100.464882f, 91.8434448f, 100.793686f}, 2, {8742521, 8033854, 8780483}, 2},
+        {0.996682823f, -4.59340858f, true, 0, {92.0884094f, 89.8550262f, 91.5160675f}, 0, {8006788, 7815985, 7967752}, 0},
+        {-0.983323872f, 3.59257531f, false, 2, {95.1458054f, 88.5211563f, 95.2614441f}, 2, {8287696, 7732395, 8299616}, 2},
+        {1.12118328f, -5.77920055f, false, 0, {92.8101501f, 91.5414581f, 91.9372253f}, 0, {8070256, 7961506, 8005582}, 0},
+        {0.0798611417f, -0.615320861f, false, 2, {99.4421539f, 99.4649429f, 99.4657822f}, 1, {8660455, 8680402, 8656748}, 2},
+        {0.118173428f, -2.45727253f, false, 0, {99.2286453f, 99.0632477f, 98.5404205f}, 0, {8645602, 8642371, 8579254}, 0},
+        {-1.09070063f, 9.1196537f, false, 2, {100.365463f, 93.1947556f, 101.647568f}, 2, {8734503, 8145543, 8855120}, 2},
+        {-1.14618576f, -3.34715295f, false, 0, {85.2985611f, 73.5106125f, 82.508316f}, 0, {7426235, 6397806, 7180737}, 0},
+        {-0.361105651f, -9.05461597f, false, 0, {89.0834351f, 76.6410217f, 84.5144272f}, 0, {7759353, 6666690, 7360381}, 0},
+        {0.842510164f, -1.29970253f, true, 2, {90.2572632f, 84.805603f, 90.8209915f}, 2, {7856294, 7401740, 7912519}, 2},
+        {-0.406158328f, -7.07051563f, false, 0, {89.7317429f, 78.8415985f, 86.2674942f}, 0, {7819193, 6868885, 7514541}, 0},
+        {0.925090253f, -10.2917805f, false, 1, {97.3512421f, 97.6361771f, 94.3690567f}, 1, {8472843, 8505095, 8221764}, 1},
+        {-0.347512752f, 7.28862333f, false, 0, {99.9797897f, 91.2409286f, 99.3835831f}, 0, {8702019, 7970258, 8656919}, 0},
+        {0.830642283f, 3.1706183f, false, 2, {85.4233322f, 70.2963181f, 86.6160355f}, 2, {7425633, 6134198, 7543787}, 2},
+        {-0.500768483f, 0.968191624f, false, 0, {96.2367249f, 93.3794632f, 96.0274124f}, 0, {8376833, 8142521, 8353609}, 0},
+        {1.09485614f, 9.21164894f, false, 2, {77.1796646f, 46.0996971f, 79.1896362f}, 2, {6700222, 4031687, 6904808}, 2},
+        {-0.577214241f, -1.71847069f, false, 0, {92.1684952f, 86.5804672f, 91.2004929f}, 0, {8026001, 7549962, 7938009}, 0},
+        {0.337294728f, -6.24379158f, true, 0, {97.8112946f, 96.8083649f, 95.3033829f}, 0, {8520865, 8442669, 8301982}, 0},
+        {0.198239788f, -3.50727558f, false, 0, {98.8011169f, 98.7085266f, 97.6631393f}, 1, {8606436, 8606675, 8500076}, 1},
+        {-0.854180396f, 10.2438917f, false, 2, {100.674385f, 90.6113205f, 101.242256f}, 2, {8762185, 7929721, 8823393}, 2},
+        {-0.87015146f, 9.54098511f, false, 2, {100.569687f, 91.3720093f, 101.142708f}, 2, {8751287, 7991841, 8811873}, 2},
+        {-0.406728268f, 5.65683985f, false, 0, {99.9590607f, 94.7773972f, 99.5451813f}, 0, {8702299, 8280039, 8669500}, 0},
+        {-0.537623823f, -0.970322192f, false, 0, {93.3882141f, 88.8619003f, 92.661377f}, 0, {8137451, 7760217, 8070889}, 0},
+        {0.464062959f, -10.2470207f, false, 0, {97.1132126f, 94.0146179f, 93.0111771f}, 0, {8461462, 8191996, 8105488}, 0},
+        {-0.501388371f, -2.3852365f, false, 0, {92.4346619f, 86.7464371f, 91.3254547f}, 0, {8051205, 7567899, 7951453}, 0},
+        {-0.40000841f, -7.10640049f, true, 0, {89.7861786f, 78.9334259f, 86.3087921f}, 0, {7819193, 6868885, 7514541}, 0},
+        {0.92387104f, 3.18246627f, false, 2, {84.1100769f, 67.889389f, 85.3598328f}, 2, {7314005, 5931831, 7438715}, 2},
+        {-0.999387503f, 9.41743565f, false, 2, {100.472198f, 92.4799271f, 101.590256f}, 2, {8743999, 8080491, 8850460}, 2},
+        {-0.377836347f, -2.52568555f, false, 0, {93.7996979f, 88.9459763f, 92.7421722f}, 0, {8169579, 7757512, 8072901}, 0},
+        {-0.153356984f, -8.18384171f, false, 0, {92.1897278f, 83.2200851f, 88.3974533f}, 0, {8029041, 7240387, 7695397}, 0},
+        {0.671451926f, 7.92291832f, false, 2, {83.9039154f, 61.5265236f, 85.257164f}, 2, {7293378, 5379900, 7433001}, 2},
+        {1.02691853f, 6.9147892f, false, 2, {78.6629028f, 53.0195389f, 80.4735794f}, 2, {6827847, 4619778, 7009926}, 2},
+        {-0.974105f, 3.1712234f, false, 2, {94.6195984f, 87.8698807f, 94.6255646f}, 2, {8235240, 7667127, 8237886}, 2},
+        {0.612808943f, -5.20723057f, true, 1, {96.7991943f, 97.7129364f, 95.5915756f}, 1, {8428398, 8515076, 8325962}, 1},
+        {0.308757395f, -4.67529917f, false, 1, {98.3048248f, 98.3980408f, 96.697998f}, 1, {8563937, 8579546, 8421781}, 0},
+        {0.513477385f, 6.70520449f, false, 2, {87.2484665f, 69.9636383f, 88.3581238f}, 2, {7589157, 6124994, 7701530}, 2},
+        {-1.01216614f, 3.21078563f, false, 2, {94.3261795f, 87.3153839f, 94.4613495f}, 2, {8211457, 7618872, 8226312}, 2},
+        {-0.941969454f, -2.04849005f, false, 0, {87.6176834f, 78.0289383f, 85.8212585f}, 0, {7631507, 6808148, 7475221}, 0},
+        {0.481764019f, 9.79899025f, false, 2, {86.2201538f, 61.8804703f, 87.2426071f}, 2, {7498055, 5432225, 7610515}, 2},
+        {-0.448759228f, -4.81294155f, false, 0, {90.727356f, 82.0082245f, 88.5565262f}, 0, {7907567, 7158605, 7716436}, 0},
+        {0.720375836f, 9.73359489f, false, 2, {82.1255264f, 54.4634247f, 83.5739059f}, 2, {7134888, 4763601, 7287832}, 2},
+        {-0.451369315f, -0.781416833f, true, 0, {94.6224442f, 91.0177078f, 94.027153f}, 0, {8238707, 7936989, 8181831}, 0},
+        {-0.509895146f, -3.05573273f, false, 0, {91.6814804f, 84.9779282f, 90.275383f}, 0, {7982737, 7405243, 7856216}, 0},
+        {1.1018492f, 4.37155008f, false, 2, {81.0119705f, 60.2651062f, 82.5659714f}, 2, {7033679, 5242279, 7190483}, 2},
+        {0.957268834f, 5.64032221f, false, 2, {80.9891663f, 59.0559959f, 82.57901f}, 2, {7034442, 5151086, 7194005}, 2},
+        {0.458932132f, -10.1208239f, false, 0, {97.1198883f, 93.9545364f, 93.0013123f}, 0, {8461462, 8191996, 8105488}, 0},
+        {0.890538096f, 2.64168859f, false, 2, {85.1679459f, 70.5363846f, 86.3408661f}, 2, {7400053, 6141493, 7517477}, 2},
+        {0.0391887613f, -0.739373863f, false, 0, {99.7508698f, 99.6716614f, 99.6219711f}, 1, {8688087, 8699368, 8671292}, 0},
+        {0.783842087f, -6.85365105f, false, 1, {96.3014374f, 97.0377121f, 94.6149445f}, 1, {8382450, 8450060, 8241290}, 1},
+        {0.355692267f, -3.52930403f, true, 1, {98.1638412f, 99.0922241f, 97.439682f}, 1, {8549665, 8640499, 8483465}, 1},
+        {-0.548349679f, 1.34216881f, false, 0, {96.2514648f, 93.1168518f, 96.0297928f}, 0, {8378151, 8119605, 8354672}, 0},
+        {-0.128483579f, -5.85479641f, false, 0, {94.056488f, 88.1108093f, 91.6919861f}, 0, {8192007, 7678676, 7983421}, 0},
+        {1.12919772f, 4.7414813f, false, 2, {80.599411f, 58.9219017f, 82.2075958f}, 2, {7002919, 5143203, 7164079}, 2},
+        {-0.872936964f, 10.0598211f, false, 2, {100.697037f, 90.8314209f, 101.351059f}, 2, {8762255, 7942521, 8829831}, 2},
+        {0.200239763f, -7.75046968f, false, 0, {96.6395569f, 92.8173294f, 93.3406296f}, 0, {8420960, 8091532, 8132212}, 0},
+        {0.34905833f, 5.36348152f, false, 2, {90.7826843f, 78.6382751f, 91.6638336f}, 2, {7901514, 6881313, 7988384}, 2},
+        {-0.961582661f, -8.48631287f, false, 0, {83.7408295f, 64.4994888f, 77.5692215f}, 0, {7292037, 5599776, 6757376}, 0},
+        {0.239535794f, 4.94941235f, true, 2, {92.842308f, 83.0129929f, 93.5978928f}, 2, {8078404, 7252555, 8152143}, 2},
+        {-0.955605805f, 7.63679886f, false, 2, {99.9942703f, 94.3094482f, 100.655922f}, 2, {8703775, 8242741, 8767761}, 2},
+        {-0.639353991f, -6.59333134f, false, 0, {87.1298904f, 73.8848953f, 83.6460876f}, 0, {7585301, 6422977, 7278503}, 0},
+        {1.10630858f, -7.50281954f, false, 0, {94.3246307f, 94.266449f, 92.8867035f}, 0, {8202982, 8202168, 8089146}, 1},
+        {-0.797471523f, -1.44546485f, false, 0, {89.9025574f, 82.3779068f, 88.6480942f}, 0, {7830460, 7186323, 7720168}, 0},
+        {-0.954298079f, -4.03970528f, false, 0, {85.6923523f, 73.6442871f, 82.7889404f}, 0, {7463556, 6415726, 7210712}, 0},
+        {0.809995234f, 4.82581854f, false, 2, {84.0297852f, 66.187088f, 85.3276291f}, 2, {7308101, 5789886, 7437570}, 2},
+        {1.10171461f, -1.94567001f, false, 2, {88.2517319f, 81.3985672f, 88.6305695f}, 2, {7675529, 7093164, 7719886}, 2},
+        {0.798692524f, 6.53636456f, true, 2, {82.5959473f, 61.5240707f, 84.0611877f}, 2, {7174436, 5370794, 7322669}, 2},
+        {-0.324152857f, 1.25208235f, false, 0, {98.4061203f, 97.4988708f, 98.2844849f}, 0, {8574629, 8517557, 8557857}, 0},
+        {-0.595865846f, -2.3287642f, false, 0, {91.3456039f, 84.912796f, 90.1330032f}, 0, {7954988, 7402426, 7845534}, 0},
+        {-0.209601849f, 1.13598561f, false, 0, {99.0153351f, 98.6931839f, 98.9422531f}, 0, {8625693, 8618767, 8612738}, 0},
+        {-0.77459836f, -6.95752096f, false, 0, {85.5942841f, 70.7798157f, 81.4691162f}, 0, {7456733, 6165759, 7099127}, 0},
+        {-0.597200096f, 10.2932959f, false, 2, {100.399483f, 88.3289185f, 100.420914f}, 2, {8736855, 7725988, 8750087}, 2},
+        {1.10654068f, 6.43215895f, false, 2, {78.8508224f, 53.782074f, 80.6391449f}, 2, {6845919, 4690041, 7025353}, 2},
+        {0.717802763f, 4.74661875f, false, 2, {85.4543839f, 69.2128983f, 86.6576843f}, 2, {7431965, 6052376, 7551085}, 2},
+        {0.829133213f, 7.02594471f, true, 2, {81.7682419f, 59.1118965f, 83.3193817f}, 2, {7098616, 5157814, 7256145}, 2},
+        {-0.533179343f, -1.4369626f, false, 0, {92.9813614f, 88.0425262f, 92.1311035f}, 0, {8096903, 7678971, 8019283}, 0},
+        {0.64620465f, 9.99440002f, false, 2, {83.2676315f, 56.0541992f, 84.5880203f}, 2, {7236078, 4910181, 7377490}, 2},
+        {-0.421499789f, -1.1985383f, false, 0, {94.5733185f, 90.8217545f, 93.8917007f}, 0, {8240013, 7929160, 8176322}, 0},
+        {-0.847951353f, 6.60389662f, false, 2, {99.8010101f, 95.0223846f, 100.001198f}, 2, {8688415, 8303763, 8711176}, 2},
+        {1.09955835f, -7.61479568f, false, 0, {94.4589081f, 94.4253082f, 92.9726105f}, 1, {8219559, 8221694, 8100246}, 1},
+        {0.150508866f, -2.49957943f, false, 1, {99.0962524f, 99.1817856f, 98.4795685f}, 1, {8632792, 8650416, 8571536}, 1},
+        {0.970953107f, 5.57657528f, false, 2, {80.852478f, 58.8000526f, 82.453804f}, 2, {7020146, 5124325, 7181042}, 2},
+        {-0.735801816f, -2.86372852f, true, 0, {89.1461105f, 80.6283112f, 87.3796234f}, 0, {7767682, 7039435, 7613906}, 0},
+        {1.07824349f, 10.9191103f, false, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {0.821314216f, 5.54283524f, false, 2, {83.1154709f, 63.7214394f, 84.507309f}, 2, {7221605, 5563495, 7361277}, 2},
+        {-0.390326768f, 2.60165596f, false, 0, {99.0546341f, 97.7300491f, 98.8894424f}, 0, {8627273, 8536172, 8609631}, 0},
+        {1.07120764f, -4.48887587f, false, 0, {91.3514252f, 88.4727402f, 90.8437195f}, 0, {7945552, 7702450, 7912462}, 0},
+        {0.269400001f, -8.22232342f, false, 0, {96.9231873f, 93.3148422f, 93.3973923f}, 0, {8449223, 8141875, 8141242}, 0},
+        {0.416605383f, 9.55352592f, false, 2, {87.4821091f, 64.6868744f, 88.3830795f}, 2, {7597288, 5654420, 7698911}, 2},
+        {-0.711140454f, -4.75329638f, false, 0, {87.6951828f, 76.5849304f, 85.0251389f}, 0, {7643146, 6680428, 7410008}, 0},
+        {-0.795371354f, 9.66535854f, true, 2, {100.575768f, 90.6268082f, 100.936546f}, 2, {8753315, 7921700, 8795065}, 2},
+        {-0.898539603f, 5.20257139f, false, 2, {98.2864761f, 93.102684f, 98.4121399f}, 2, {8554864, 8127357, 8569456}, 2},
+        {0.87754482f, 10.2497444f, false, 2, {79.5065384f, 48.8943939f, 81.2256317f}, 2, {6908606, 4287853, 7087226}, 2},
+        {0.0494863354f, -10.5495844f, false, 0, {93.8326187f, 85.3317566f, 89.4852371f}, 0, {8177383, 7431657, 7797434}, 0},
+        {0.948928058f, -2.87752008f, false, 0, {90.6673965f, 86.5828247f, 90.5790024f}, 2, {7890641, 7550113, 7891817}, 0},
+        {0.131958634f, -1.88366807f, false, 1, {99.2207642f, 99.366272f, 98.9157791f}, 1, {8643075, 8669468, 8610208}, 1},
+        {-0.34041658f, 10.0405064f, false, 0, {99.0613022f, 84.4496536f, 98.8355789f}, 0, {8618470, 7388040, 8610993}, 0},
+        {0.724170148f, 5.37413692f, false, 2, {84.7309036f, 67.271347f, 85.9832535f}, 2, {7365589, 5878739, 7490283}, 2},
+        {-1.01681685f, -10.8933935f, true, 0, {83.4867096f, 61.157032f, 75.4729919f}, 0, {7271063, 5317733, 6583075}, 0},
+        {0.840382993f, 0.78813374f, false, 2, {87.8999176f, 77.9814758f, 88.8478317f}, 2, {7642765, 6796171, 7737005}, 2},
+        {0.664657116f, -6.46552515f, false, 1, {97.0016785f, 97.9144821f, 95.2607193f}, 1, {8443502, 8528042, 8296501}, 1},
+        {1.034132f, -7.07460403f, false, 0, {94.1145477f, 93.9906158f, 92.8194962f}, 0, {8191653, 8186594, 8088275}, 0},
+        {0.315273106f, -1.96479487f, false, 1, {97.7999878f, 98.5437469f, 97.8313293f}, 1, {8517565, 8596409, 8518116}, 1},
+        {-0.908324063f, -6.99885654f, false, 0, {84.4057236f, 68.5523605f, 79.7870636f}, 0, {7352862, 5964540, 6952806}, 0},
+        {-0.669913888f, -3.15418959f, false, 0, {89.6600571f, 81.3267593f, 87.8801193f}, 0, {7810934, 7095503, 7654522}, 0},
+        {0.272236586f, 8.38110733f, false, 2, {90.5120926f, 72.3878174f, 91.2517014f}, 2, {7871892, 6341466, 7953126}, 2},
+        {-0.621109188f, 1.53539097f, true, 0, {95.7688828f, 91.9903793f, 95.5004044f}, 0, {8337451, 8027189, 8310958}, 0},
+        {-0.629559517f, 8.69357777f, false, 2, {100.358093f, 91.049675f, 100.363976f}, 2, {8734584, 7965921, 8743670}, 0},
+        {0.990826428f, -10.6859722f, false, 1, {97.3645477f, 97.4981689f, 94.4950027f}, 1, {8472271, 8490911, 8231924}, 1},
+        {-0.442293823f, 9.88130474f, false, 0, {100.106453f, 86.7451935f, 99.7725449f}, 0, {8711887, 7601414, 8694881}, 0},
+        {0.765289843f, -0.788527966f, false, 2, {90.7082138f, 85.1223907f, 91.4031906f}, 2, {7888795, 7413706, 7956759}, 2},
+        {1.12630153f, 10.5897541f, false, 2, {76.9023285f, 43.8655434f, 78.9125443f}, 2, {6675422, 3838117, 6881678}, 2},
+        {-1.0643481f, -0.430741251f, false, 0, {88.7537308f, 79.1696548f, 87.4789429f}, 0, {7731439, 6912924, 7625916}, 0},
+        {0.713491917f, -0.830888271f, false, 2, {91.4563751f, 86.5762634f, 92.1070251f}, 2, {7955684, 7546292, 8017855}, 2},
+        {-0.501204193f, 1.4375664f, true, 0, {96.8584366f, 94.2690811f, 96.6833496f}, 0, {8431421, 8222057, 8411635}, 0},
+        {-0.436797708f, 10.5513535f, false, 0, {100.089516f, 86.4088974f, 99.7455215f}, 0, {8709828, 7562032, 8691617}, 0},
+        {-0.476978511f, -1.55750978f, false, 0, {93.5449524f, 88.9713287f, 92.7138138f}, 0, {8144805, 7756672, 8067699}, 0},
+        {0.255414099f, 3.87775731f, false, 2, {93.239502f, 85.3709946f, 93.9725266f}, 2, {8115008, 7461863, 8184313}, 2},
+        {-0.978744566f, -6.93482351f, false, 0, {83.9117813f, 67.4907837f, 79.0443802f}, 0, {7308601, 5868530, 6887538}, 0},
+        {-0.373616129f, -3.38017869f, false, 0, {93.0189285f, 87.030014f, 91.6364365f}, 0, {8105066, 7594102, 7980307}, 0},
+        {-0.997485042f, -7.16337729f, false, 0, {83.7506256f, 66.6954346f, 78.5950775f}, 0, {7294835, 5800043, 6850034}, 0},
+        {0.962540209f, 3.19272804f, false, 2, {83.5499191f, 66.831749f, 84.8352814f}, 2, {7254209, 5810322, 7384566}, 2}
+    };
+}
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
@@ -0,0 +1,105 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (int8 quantized)
+ * Generated: 2025-08-18T22-59-12
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * Integer-only variant for MCUs without an FPU: int8 weights with one scale
+ * per layer, int32 accumulators, integer ReLU and int16 hidden activations.
+ * Drop-in API compatible with the float TwoWheelBotDQN export. Inference
+ * code lives in DQNPolicy.h (native/include/); copy it next to this file.
+ *
+ * Quantization report (argmax agreement with the float network):
+ *   Sweep: 101x101 grid, angle +/-1.0472 rad, angular velocity +/-10 rad/s
+ *   Agreement: 9888/10201 (96.93%)
+ *   Max |Q error|: 0.470798
+ *   Weight flash: 588 bytes (float export: 1548 bytes)
+ */
+
+#include "DQNPolicy.h"
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNInt8Weights {
+    static const int INPUT_SIZE = 2;
+    static const int HIDDEN_SIZE = 64;
+    static const int OUTPUT_SIZE = 3;
+
+    // Hidden requantization: int16 = (acc + round) >> HIDDEN_SHIFT
+    static const int HIDDEN_SHIFT = 0;
+
+    // Input scales: radians and rad/s to int8 LSBs (127 / limit)
+    struct InputScales {
+        static constexpr float angleScale() { return 121.27607f; }
+        static constexpr float angularVelocityScale() { return 12.6999998f; }
+    };
+
+    // Layer scales (real = integer * scale), for reference only
+    //   weightsInputHidden:  3.748756e-2
+    //   weightsHiddenOutput: 3.882450e-2
+    //   Q-value per output LSB: 1.146012e-5
+    static DQN_FLASH dqn::DQNQuantizedWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM = {
+        // weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]
+        {
+            42, 14, -13, 75, 127, 68, 30, 40, 48, 44, -55, 31, 11, -15, 41, -28,
+            -28, -19, 40, -27, 60, 33, 42, 63, 6, 72, -29, -45, 48, -34, 97, 73,
+            59, 54, 44, 16, -17, 57, -30, 76, -15, 43, -5, 45, -14, -16, -11, 86,
+            77, -4, -61, -3, 21, 22, 44, -31, -16, 31, -4, 35, -5, 50, 30, 17,
+            4, -34, -32, 73, 51, 51, -4, 6, -18, 32, 70, 4, 22, 58, -43, 40,
+            -28, -1, -36, 37, 16, 7, 72, 87, -95, 52, -24, 32, 2, 66, 22, 57,
+            92, 22, -34, 31, -16, 33, 55, 96, 40, 64, -45, 12, 29, 37, -12, -19,
+            67, 9, -4, -3, -40, 58, -85, -48, -11, 22, 27, 28, -45, 64, 45, 18
+        },
+        // biasHidden[HIDDEN_SIZE]
+        {
+            11298, -1458, -2810, 1624, 220, 10088, 5207, 13851,
+            14107, 6334, 13603, 7516, 7436, 7416, 13928, 1088,
+            -2735, 11832, 18756, 14738, 8698, 15724, -1711, -805,
+            -2182, -1604, 5670, 12433, 12830, 11577, -8, 10439,
+            22, 8272, 4964, 10965, -3102, 10705, 5442, 1319,
+            14714, 10167, 113, -1132, 5777, -2217, -2311, 11066,
+            -463, 9855, 27, 11663, 910, -5060, 2397, -721,
+            -2814, -5019, 3546, -5058, 12368, 11692, 5178, 10285
+        },
+        // weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]
+        {
+            12, 39, 49, 21, -4, 10, 31, -22, 23, -20, -50, -16, -49, -44, -28, 7,
+            18, 3, 19, 2, 12, -3, 9, 47, 31, 21, 41, 12, 9, 8, 47, 5,
+            39, 1, 46, -8, 14, 50, 15, 5, 42, 10, 39, 10, 40, 15, 113, 8,
+            3, -22, -27, 22, 20, 53, 78, 10, 19, 46, 5, 43, 12, 11, -1, 31,
+            127, -46, -13, -51, -7, -9, -75, -21, 1, -28, -7, -11, -42, -17, 46, 63,
+            45, 40, -3, 45, 31, 9, 27, 26, -10, 25, -29, -46, -28, 11, 23, 1,
+            -25, -29, -19, 13, 4, 10, -2, 15, 33, 10, 10, 37, 26, -25, 27, 16,
+            6, 11, 12, 7, 25, -27, -48, -22, 33, 9, 42, 8, -4, 0, -7, -9,
+            -33, -3, -49, -12, 16, -4, 28, 23, -20, 9, 17, -13, 2, 6, 39, 30,
+            -21, -48, -24, 19, 39, 28, -25, -16, -43, -12, 43, -3, 9, -14, 15, 0,
+            -14, 1, 27, 8, 23, -2, -18, -28, 31, -32, 25, 5, -11, 2, 6, 100,
+            9, -8, -37, 2, 31, 30, 45, 9, 0, -3, 2, 33, 11, 23, 24, 29
+        },
+        // biasOutput[OUTPUT_SIZE]
+        {
+            53101, 408772, 37574
+        }
+    };
+}
+
+typedef dqn::QuantizedDQNPolicy<TwoWheelBotDQNInt8Weights::INPUT_SIZE,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SIZE,
+                                TwoWheelBotDQNInt8Weights::OUTPUT_SIZE,
+                                dqn::ReLU,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SHIFT,
+                                TwoWheelBotDQNInt8Weights::weights,
+                                dqn::ScaledInput<TwoWheelBotDQNInt8Weights::InputScales> > TwoWheelBotDQNInt8;
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
+
+// Usage example:
+// TwoWheelBotDQNInt8 bot;
+// int action = bot.getAction(angle, angularVelocity);
+// float torque = bot.getMotorTorque(action);
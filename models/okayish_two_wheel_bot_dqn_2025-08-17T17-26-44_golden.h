@@ -0,0 +1,373 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (golden test vectors)
+ * Generated: 2025-08-17T17-26-44
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * 327 raw states in 215 sequences with the outputs the simulator computes
+ * for them: float Q-values and action (CPUBackend.forward without its ±100
+ * clamp), int8 accumulators and action of the _int8 export, and the action
+ * of the _lut export (-1 for multi-timestep models). Reset the policy with
+ * the state of every vector marked reset, then call forward once per vector.
+ * native/tests/test_conformance.cpp checks every kernel and precision
+ * against this table.
+ */
+
+#include <stdint.h>
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNGolden {
+    static const int COUNT = 327;
+    static const int INPUT_SIZE = 2;
+    static const int OUTPUT_SIZE = 3;
+
+    struct Vector {
+        float angle;                          // Raw state (rad, rad/s)
+        float angularVelocity;
+        bool reset;                           // Reset the policy with this state first
+        int action;                           // Float argmax
+        float qValues[OUTPUT_SIZE];
+        int int8Action;
+        int32_t int8Accumulators[OUTPUT_SIZE];
+        int lookupAction;
+    };
+
+    static const Vector vectors[COUNT] = {
+        {-1.2566371f, -12.0f, true, 0, {-84.5211792f, -123.24617f, -241.067322f}, 0, {-873062, -1251186, -2499382}, 0},
+        {-1.2566371f, -10.0f, true, 0, {-84.5211792f, -123.24617f, -241.067322f}, 0, {-873062, -1251186, -2499382}, 0},
+        {-1.2566371f, -8.0f, true, 0, {-68.4987259f, -82.5900955f, -175.527573f}, 0, {-710017, -840204, -1834348}, 0},
+        {-1.2566371f, -6.0f, true, 1, {-47.9637947f, -38.6192894f, -106.639565f}, 1, {-490893, -375084, -1101601}, 1},
+        {-1.2566371f, -4.0f, true, 1, {-19.5725422f, -12.4935141f, -47.9795036f}, 1, {-205309, -111442, -505297}, 1},
+        {-1.2566371f, -2.0f, true, 0, {9.43056679f, 3.13807774f, -4.60412979f}, 0, {100362, 49200, -49344}, 0},
+        {-1.2566371f, 0.0f, true, 2, {-31.3193798f, -6.08257627f, 10.2634516f}, 2, {-319526, -43251, 100107}, 2},
+        {-1.2566371f, 2.0f, true, 2, {-94.2492447f, -24.3507786f, 17.7726364f}, 2, {-953064, -226573, 178317}, 2},
+        {-1.2566371f, 4.0f, true, 2, {-202.947983f, -57.4492683f, -7.16397429f}, 2, {-2091687, -574801, -80370}, 2},
+        {-1.2566371f, 6.0f, true, 2, {-381.54541f, -143.022766f, -88.5894089f}, 2, {-3895110, -1438915, -899240}, 2},
+        {-1.2566371f, 8.0f, true, 2, {-588.458618f, -295.177002f, -228.310059f}, 2, {-6080992, -3042729, -2368780}, 2},
+        {-1.2566371f, 10.0f, true, 2, {-826.708313f, -476.654358f, -380.982056f}, 2, {-8485957, -4872952, -3911792}, 2},
+        {-1.2566371f, 12.0f, true, 2, {-826.708313f, -476.654358f, -380.982056f}, 2, {-8485957, -4872952, -3911792}, 2},
+        {-1.04719758f, -12.0f, true, 0, {-84.5211792f, -123.24617f, -241.067322f}, 0, {-873062, -1251186, -2499382}, 0},
+        {-1.04719758f, -10.0f, true, 0, {-84.5211792f, -123.24617f, -241.067322f}, 0, {-873062, -1251186, -2499382}, 0},
+        {-1.04719758f, -8.0f, true, 0, {-68.4987259f, -82.5900955f, -175.527573f}, 0, {-710017, -840204, -1834348}, 0},
+        {-1.04719758f, -6.0f, true, 1, {-47.9637947f, -38.6192894f, -106.639565f}, 1, {-490893, -375084, -1101601}, 1},
+        {-1.04719758f, -4.0f, true, 1, {-19.5725422f, -12.4935141f, -47.9795036f}, 1, {-205309, -111442, -505297}, 1},
+        {-1.04719758f, -2.0f, true, 0, {9.43056679f, 3.13807774f, -4.60412979f}, 0, {100362, 49200, -49344}, 0},
+        {-1.04719758f, 0.0f, true, 2, {-31.3193798f, -6.08257627f, 10.2634516f}, 2, {-319526, -43251, 100107}, 2},
+        {-1.04719758f, 2.0f, true, 2, {-94.2492447f, -24.3507786f, 17.7726364f}, 2, {-953064, -226573, 178317}, 2},
+        {-1.04719758f, 4.0f, true, 2, {-202.947983f, -57.4492683f, -7.16397429f}, 2, {-2091687, -574801, -80370}, 2},
+        {-1.04719758f, 6.0f, true, 2, {-381.54541f, -143.022766f, -88.5894089f}, 2, {-3895110, -1438915, -899240}, 2},
+        {-1.04719758f, 8.0f, true, 2, {-588.458618f, -295.177002f, -228.310059f}, 2, {-6080992, -3042729, -2368780}, 2},
+        {-1.04719758f, 10.0f, true, 2, {-826.708313f, -476.654358f, -380.982056f}, 2, {-8485957, -4872952, -3911792}, 2},
+        {-1.04719758f, 12.0f, true, 2, {-826.708313f, -476.654358f, -380.982056f}, 2, {-8485957, -4872952, -3911792}, 2},
+        {-0.837758064f, -12.0f, true, 0, {-88.5263824f, -90.8812485f, -203.660156f}, 0, {-914359, -929042, -2120924}, 1},
+        {-0.837758064f, -10.0f, true, 0, {-88.5263824f, -90.8812485f, -203.660156f}, 0, {-914359, -929042, -2120924}, 1},
+        {-0.837758064f, -8.0f, true, 1, {-70.5245972f, -49.9266357f, -138.412994f}, 1, {-730981, -515038, -1458947}, 1},
+        {-0.837758064f, -6.0f, true, 1, {-49.1297493f, -19.2448292f, -81.3242264f}, 1, {-506970, -185811, -851216}, 1},
+        {-0.837758064f, -4.0f, true, 1, {-13.8385611f, -6.93164587f, -35.3997841f}, 1, {-148703, -58702, -379178}, 1},
+        {-0.837758064f, -2.0f, true, 0, {24.0727921f, 19.8158264f, 9.36700439f}, 0, {250038, 220208, 93106}, 0},
+        {-0.837758064f, 0.0f, true, 2, {10.5347042f, 21.7376347f, 33.4940109f}, 2, {101149, 234132, 332860}, 2},
+        {-0.837758064f, 2.0f, true, 2, {-58.3615723f, 1.07271135f, 37.3939857f}, 2, {-591854, 26899, 375187}, 2},
+        {-0.837758064f, 4.0f, true, 2, {-193.627991f, -47.1712303f, -12.118886f}, 2, {-1999125, -474680, -132507}, 2},
+        {-0.837758064f, 6.0f, true, 2, {-387.993958f, -172.011368f, -123.694603f}, 2, {-3963011, -1730116, -1252667}, 2},
+        {-0.837758064f, 8.0f, true, 2, {-620.760071f, -348.976654f, -276.198761f}, 2, {-6407393, -3586997, -2856225}, 2},
+        {-0.837758064f, 10.0f, true, 2, {-864.473755f, -534.185852f, -419.111633f}, 2, {-8868172, -5454157, -4297650}, 2},
+        {-0.837758064f, 12.0f, true, 2, {-864.473755f, -534.185852f, -419.111633f}, 2, {-8868172, -5454157, -4297650}, 2},
+        {-0.628318548f, -12.0f, true, 1, {-90.3087158f, -57.8151131f, -166.642365f}, 1, {-932523, -584165, -1731890}, 1},
+        {-0.628318548f, -10.0f, true, 1, {-90.3087158f, -57.8151131f, -166.642365f}, 1, {-932523, -584165, -1731890}, 1},
+        {-0.628318548f, -8.0f, true, 1, {-70.4686127f, -17.8813229f, -103.98838f}, 1, {-731798, -175022, -1092691}, 1},
+        {-0.628318548f, -6.0f, true, 1, {-40.1037521f, -6.00071907f, -64.0896759f}, 1, {-411682, -47690, -670603}, 1},
+        {-0.628318548f, -4.0f, true, 1, {-2.24203587f, 8.85083294f, -21.6793213f}, 1, {-28735, 104033, -237125}, 1},
+        {-0.628318548f, -2.0f, true, 0, {36.4159927f, 34.4222336f, 23.9511623f}, 0, {377828, 370683, 244257}, 0},
+        {-0.628318548f, 0.0f, true, 2, {50.9309998f, 49.2664566f, 56.7946129f}, 2, {522675, 518941, 574958}, 2},
+        {-0.628318548f, 2.0f, true, 2, {-25.1069107f, 27.7515335f, 54.8731613f}, 2, {-239642, 301686, 560753}, 2},
+        {-0.628318548f, 4.0f, true, 2, {-191.003372f, -52.5222054f, -20.8935108f}, 2, {-1980234, -540741, -235117}, 2},
+        {-0.628318548f, 6.0f, true, 2, {-415.578949f, -222.007553f, -171.478287f}, 2, {-4255438, -2258670, -1759168}, 2},
+        {-0.628318548f, 8.0f, true, 2, {-658.525513f, -406.508179f, -314.328339f}, 2, {-6804491, -4191068, -3257444}, 2},
+        {-0.628318548f, 10.0f, true, 2, {-898.574707f, -588.610413f, -459.65802f}, 2, {-9224986, -6023912, -4725352}, 2},
+        {-0.628318548f, 12.0f, true, 2, {-898.574707f, -588.610413f, -459.65802f}, 2, {-9224986, -6023912, -4725352}, 2},
+        {-0.418879032f, -12.0f, true, 1, {-90.3866577f, -22.724493f, -131.383209f}, 1, {-933839, -228187, -1372932}, 1},
+        {-0.418879032f, -10.0f, true, 1, {-90.3866577f, -22.724493f, -131.383209f}, 1, {-933839, -228187, -1372932}, 1},
+        {-0.418879032f, -8.0f, true, 1, {-60.9249878f, 0.456405938f, -84.7155838f}, 1, {-636929, 9205, -897243}, 1},
+        {-0.418879032f, -6.0f, true, 1, {-25.9476547f, 13.584589f, -45.8806686f}, 1, {-269900, 147239, -487444}, 1},
+        {-0.418879032f, -4.0f, true, 1, {11.0798445f, 26.2471886f, -4.97772789f}, 1, {103690, 275374, -72492}, 1},
+        {-0.418879032f, -2.0f, true, 1, {48.7591896f, 49.0286446f, 38.5353279f}, 1, {500625, 515362, 389556}, 1},
+        {-0.418879032f, 0.0f, true, 0, {79.6928253f, 72.387207f, 76.4232178f}, 0, {811271, 749111, 771836}, 2},
+        {-0.418879032f, 2.0f, true, 2, {-4.74744892f, 48.8537025f, 63.4028893f}, 2, {-22123, 524777, 651652}, 2},
+        {-0.418879032f, 4.0f, true, 2, {-211.895096f, -96.4215775f, -66.8803711f}, 2, {-2198802, -993075, -705260}, 2},
+        {-0.418879032f, 6.0f, true, 2, {-452.577301f, -278.830475f, -209.54509f}, 2, {-4627640, -2830680, -2144273}, 2},
+        {-0.418879032f, 8.0f, true, 2, {-689.258301f, -458.076996f, -357.0961f}, 2, {-7112619, -4709184, -3691964}, 2},
+        {-0.418879032f, 10.0f, true, 2, {-922.046265f, -632.675049f, -513.96637f}, 2, {-9462431, -6468372, -5273196}, 2},
+        {-0.418879032f, 12.0f, true, 2, {-922.046265f, -632.675049f, -513.96637f}, 2, {-9462431, -6468372, -5273196}, 2},
+        {-0.209439516f, -12.0f, true, 1, {-81.7462311f, 6.91351366f, -105.341507f}, 1, {-842628, 79355, -1100994}, 1},
+        {-0.209439516f, -10.0f, true, 1, {-81.7462311f, 6.91351366f, -105.341507f}, 1, {-842628, 79355, -1100994}, 1},
+        {-0.209439516f, -8.0f, true, 1, {-46.7688789f, 20.0417023f, -66.5065765f}, 1, {-489561, 211966, -706871}, 1},
+        {-0.209439516f, -6.0f, true, 1, {-11.5733414f, 33.1203384f, -27.4515533f}, 1, {-120052, 349440, -294572}, 1},
+        {-0.209439516f, -4.0f, true, 1, {26.009388f, 45.6568413f, 14.011466f}, 1, {259118, 476315, 126005}, 1},
+        {-0.209439516f, -2.0f, true, 1, {61.1023788f, 63.6350517f, 53.1194878f}, 1, {628415, 665837, 540707}, 1},
+        {-0.209439516f, 0.0f, true, 0, {95.4995041f, 89.8344803f, 93.8076019f}, 0, {975744, 929521, 952633}, 0},
+        {-0.209439516f, 2.0f, true, 2, {-9.99357319f, 27.8361816f, 37.567276f}, 2, {-78515, 309395, 389275}, 2},
+        {-0.209439516f, 4.0f, true, 2, {-246.628998f, -151.152725f, -104.761795f}, 2, {-2563769, -1567545, -1103949}, 2},
+        {-0.209439516f, 6.0f, true, 2, {-479.941956f, -327.543579f, -254.53418f}, 2, {-4915658, -3341831, -2617202}, 2},
+        {-0.209439516f, 8.0f, true, 2, {-712.456604f, -502.440308f, -408.927673f}, 2, {-7357119, -5174653, -4237014}, 2},
+        {-0.209439516f, 10.0f, true, 2, {-951.312683f, -678.052063f, -560.682495f}, 2, {-9768833, -6944275, -5766844}, 2},
+        {-0.209439516f, 12.0f, true, 2, {-951.312683f, -678.052063f, -560.682495f}, 2, {-9768833, -6944275, -5766844}, 2},
+        {0.0f, -12.0f, true, 1, {-67.5901184f, 26.4988251f, -87.1324921f}, 1, {-700835, 274255, -917904}, 1},
+        {0.0f, -10.0f, true, 1, {-67.5901184f, 26.4988251f, -87.1324921f}, 1, {-700835, 274255, -917904}, 1},
+        {0.0f, -8.0f, true, 1, {-32.6127853f, 39.6270103f, -48.2975731f}, 1, {-347943, 406962, -523930}, 1},
+        {0.0f, -6.0f, true, 1, {3.35620499f, 52.529995f, -8.46235657f}, 1, {29378, 542672, -103756}, 1},
+        {0.0f, -4.0f, true, 1, {40.9389381f, 65.0664978f, 33.0006599f}, 1, {408599, 669479, 316845}, 1},
+        {0.0f, -2.0f, true, 1, {76.0105133f, 81.5487213f, 71.6538162f}, 1, {776618, 842913, 724483}, 1},
+        {0.0f, 0.0f, true, 0, {100.024864f, 99.9187164f, 99.8890305f}, 1, {1018194, 1027685, 1010329}, 2},
+        {0.0f, 2.0f, true, 2, {-38.9161415f, -20.9595642f, -0.330414325f}, 2, {-371920, -182737, 6474}, 2},
+        {0.0f, 4.0f, true, 2, {-270.62326f, -197.005997f, -151.967239f}, 2, {-2803100, -2027034, -1583740}, 2},
+        {0.0f, 6.0f, true, 2, {-502.866943f, -372.205505f, -303.889008f}, 2, {-5147340, -3792230, -3113950}, 2},
+        {0.0f, 8.0f, true, 2, {-741.704102f, -547.812744f, -455.670563f}, 2, {-7653693, -5632496, -4708373}, 2},
+        {0.0f, 10.0f, true, 2, {-984.33197f, -725.240723f, -604.130005f}, 2, {-10100903, -7418973, -6206789}, 2},
+        {0.0f, 12.0f, true, 2, {-984.33197f, -725.240723f, -604.130005f}, 2, {-10100903, -7418973, -6206789}, 2},
+        {0.209439516f, -12.0f, true, 1, {-53.4340248f, 46.0841217f, -68.9234848f}, 1, {-559228, 469280, -734894}, 1},
+        {0.209439516f, -10.0f, true, 1, {-53.4340248f, 46.0841217f, -68.9234848f}, 1, {-559228, 469280, -734894}, 1},
+        {0.209439516f, -8.0f, true, 1, {-18.4566841f, 59.2123146f, -30.088562f}, 1, {-206161, 601891, -340771}, 1},
+        {0.209439516f, -6.0f, true, 1, {18.2857552f, 71.9396515f, 10.526845f}, 1, {178848, 735865, 87153}, 1},
+        {0.209439516f, -4.0f, true, 1, {55.8684883f, 84.4761505f, 51.9898605f}, 1, {558018, 862740, 507730}, 1},
+        {0.209439516f, -2.0f, true, 1, {88.9197922f, 98.1427307f, 88.5755844f}, 1, {905239, 1008083, 894125}, 1},
+        {0.209439516f, 0.0f, true, 2, {73.887207f, 70.1448517f, 77.7902145f}, 2, {757720, 731716, 791003}, 2},
+        {0.209439516f, 2.0f, true, 2, {-72.1340714f, -69.3926544f, -50.0267563f}, 2, {-715192, -673878, -498024}, 2},
+        {0.209439516f, 4.0f, true, 2, {-292.078766f, -240.511551f, -198.721588f}, 2, {-3021935, -2466809, -2057271}, 2},
+        {0.209439516f, 6.0f, true, 2, {-526.390869f, -413.512543f, -347.687927f}, 2, {-5385613, -4210402, -3561017}, 2},
+        {0.209439516f, 8.0f, true, 2, {-761.752808f, -585.688965f, -491.563293f}, 2, {-7855917, -6014311, -5073230}, 2},
+        {0.209439516f, 10.0f, true, 2, {-1003.95825f, -761.750427f, -631.046509f}, 2, {-10297654, -7786911, -6481848}, 2},
+        {0.209439516f, 12.0f, true, 2, {-1003.95825f, -761.750427f, -631.046509f}, 2, {-10297654, -7786911, -6481848}, 2},
+        {0.418879032f, -12.0f, true, 1, {-38.337574f, 66.4468765f, -50.1629486f}, 1, {-405891, 676976, -541044}, 1},
+        {0.418879032f, -10.0f, true, 1, {-38.337574f, 66.4468765f, -50.1629486f}, 1, {-405891, 676976, -541044}, 1},
+        {0.418879032f, -8.0f, true, 1, {-0.814007759f, 81.6257858f, -9.7940731f}, 1, {-27551, 830050, -131871}, 1},
+        {0.418879032f, -6.0f, true, 1, {41.1521454f, 97.6232681f, 34.3858337f}, 1, {413397, 999293, 333948}, 1},
+        {0.418879032f, -4.0f, true, 1, {83.1851425f, 113.60556f, 78.6331558f}, 1, {840573, 1163218, 784169}, 1},
+        {0.418879032f, -2.0f, true, 0, {128.060028f, 124.753807f, 108.235535f}, 0, {1303623, 1279317, 1094597}, 0},
+        {0.418879032f, 0.0f, true, 0, {55.5038109f, 39.4845772f, 43.8906746f}, 0, {560258, 407822, 432225}, 0},
+        {0.418879032f, 2.0f, true, 2, {-81.8922577f, -94.863884f, -80.7576981f}, 0, {-825704, -946239, -826415}, 2},
+        {0.418879032f, 4.0f, true, 2, {-272.758362f, -249.164276f, -215.531738f}, 2, {-2822233, -2560827, -2238398}, 2},
+        {0.418879032f, 6.0f, true, 2, {-507.887756f, -421.595581f, -359.564972f}, 2, {-5192830, -4296186, -3691406}, 2},
+        {0.418879032f, 8.0f, true, 2, {-750.278015f, -598.044312f, -499.554901f}, 2, {-7736822, -6144421, -5159156}, 2},
+        {0.418879032f, 10.0f, true, 2, {-997.306885f, -774.75354f, -633.563416f}, 2, {-10228442, -7923632, -6511280}, 2},
+        {0.418879032f, 12.0f, true, 2, {-997.306885f, -774.75354f, -633.563416f}, 2, {-10228442, -7923632, -6511280}, 2},
+        {0.628318548f, -12.0f, true, 1, {13.5486364f, 115.290169f, -8.94053936f}, 1, {115251, 1165864, -127975}, 1},
+        {0.628318548f, -10.0f, true, 1, {13.5486364f, 115.290169f, -8.94053936f}, 1, {115251, 1165864, -127975}, 1},
+        {0.628318548f, -8.0f, true, 1, {58.4037399f, 135.064301f, 35.8498611f}, 1, {568317, 1366580, 325911}, 1},
+        {0.628318548f, -6.0f, true, 1, {105.790642f, 154.943939f, 82.1380997f}, 1, {1065991, 1575583, 815011}, 1},
+        {0.628318548f, -4.0f, true, 1, {163.095245f, 179.364044f, 117.390678f}, 1, {1650404, 1830467, 1180030}, 1},
+        {0.628318548f, -2.0f, true, 0, {159.247055f, 138.676788f, 118.925392f}, 0, {1611741, 1412045, 1191980}, 0},
+        {0.628318548f, 0.0f, true, 0, {60.098774f, 26.2485371f, 23.8190403f}, 0, {606251, 275002, 228218}, 0},
+        {0.628318548f, 2.0f, true, 0, {-82.8786163f, -109.190125f, -96.6327209f}, 0, {-832251, -1088216, -985566}, 0},
+        {0.628318548f, 4.0f, true, 2, {-253.667068f, -256.470734f, -226.255966f}, 2, {-2628286, -2633890, -2349838}, 2},
+        {0.628318548f, 6.0f, true, 2, {-496.045929f, -433.329376f, -366.841644f}, 2, {-5072819, -4414561, -3768646}, 2},
+        {0.628318548f, 8.0f, true, 2, {-743.538818f, -610.886902f, -501.877472f}, 2, {-7669166, -6274042, -5185464}, 2},
+        {0.628318548f, 10.0f, true, 2, {-990.655457f, -787.756653f, -636.080322f}, 2, {-10162271, -8055470, -6539604}, 2},
+        {0.628318548f, 12.0f, true, 2, {-990.655457f, -787.756653f, -636.080322f}, 2, {-10162271, -8055470, -6539604}, 2},
+        {0.837758064f, -12.0f, true, 1, {81.5227203f, 175.625473f, 40.9184608f}, 1, {827261, 1795441, 392883}, 1},
+        {0.837758064f, -10.0f, true, 1, {81.5227203f, 175.625473f, 40.9184608f}, 1, {827261, 1795441, 392883}, 1},
+        {0.837758064f, -8.0f, true, 1, {131.152435f, 198.616394f, 83.8502045f}, 1, {1329319, 2029205, 827985}, 1},
+        {0.837758064f, -6.0f, true, 1, {190.576874f, 230.826813f, 127.093201f}, 1, {1952670, 2368729, 1289592}, 1},
+        {0.837758064f, -4.0f, true, 0, {221.278137f, 214.467834f, 148.757431f}, 0, {2264467, 2202092, 1507990}, 0},
+        {0.837758064f, -2.0f, true, 0, {176.716629f, 134.940491f, 111.858192f}, 0, {1784601, 1364088, 1105658}, 0},
+        {0.837758064f, 0.0f, true, 0, {58.9709892f, 11.7473469f, 11.0022736f}, 0, {594757, 123459, 91359}, 0},
+        {0.837758064f, 2.0f, true, 0, {-88.7788086f, -124.623352f, -109.726509f}, 0, {-891684, -1246970, -1124000}, 0},
+        {0.837758064f, 4.0f, true, 2, {-250.132233f, -271.577881f, -234.285065f}, 2, {-2586667, -2789298, -2434224}, 2},
+        {0.837758064f, 6.0f, true, 2, {-489.056641f, -445.714783f, -368.610565f}, 2, {-5000175, -4544847, -3790356}, 2},
+        {0.837758064f, 8.0f, true, 2, {-736.549561f, -623.272339f, -503.646393f}, 2, {-7596522, -6404328, -5207174}, 2},
+        {0.837758064f, 10.0f, true, 2, {-984.004089f, -800.759766f, -638.59729f}, 2, {-10095099, -8193449, -6568050}, 2},
+        {0.837758064f, 12.0f, true, 2, {-984.004089f, -800.759766f, -638.59729f}, 2, {-10095099, -8193449, -6568050}, 2},
+        {1.04719758f, -12.0f, true, 1, {155.380569f, 240.703827f, 92.70121f}, 1, {1571111, 2449112, 914510}, 1},
+        {1.04719758f, -10.0f, true, 1, {155.380569f, 240.703827f, 92.70121f}, 1, {1571111, 2449112, 914510}, 1},
+        {1.04719758f, -8.0f, true, 1, {220.578812f, 278.063141f, 138.570877f}, 1, {2239185, 2836516, 1389750}, 1},
+        {1.04719758f, -6.0f, true, 1, {259.686707f, 278.4823f, 160.434509f}, 1, {2652025, 2845121, 1624760}, 1},
+        {1.04719758f, -4.0f, true, 0, {253.276352f, 225.961136f, 164.352844f}, 0, {2589500, 2322142, 1665697}, 0},
+        {1.04719758f, -2.0f, true, 0, {181.062012f, 122.126892f, 106.10482f}, 0, {1825722, 1235066, 1047719}, 0},
+        {1.04719758f, 0.0f, true, 0, {49.9209633f, -6.6436286f, -2.23382282f}, 0, {504752, -60336, -44605}, 0},
+        {1.04719758f, 2.0f, true, 0, {-101.827545f, -144.211914f, -118.408806f}, 0, {-1023479, -1444104, -1214772}, 0},
+        {1.04719758f, 4.0f, true, 2, {-269.044403f, -292.957031f, -239.454498f}, 2, {-2777154, -3002473, -2484849}, 2},
+        {1.04719758f, 6.0f, true, 2, {-484.091797f, -459.35437f, -369.41748f}, 2, {-4953103, -4684286, -3800485}, 2},
+        {1.04719758f, 8.0f, true, 2, {-732.998413f, -637.787781f, -503.781494f}, 2, {-7564270, -6552906, -5210140}, 2},
+        {1.04719758f, 10.0f, true, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {1.04719758f, 12.0f, true, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {1.2566371f, -12.0f, true, 1, {155.380569f, 240.703827f, 92.70121f}, 1, {1571111, 2449112, 914510}, 1},
+        {1.2566371f, -10.0f, true, 1, {155.380569f, 240.703827f, 92.70121f}, 1, {1571111, 2449112, 914510}, 1},
+        {1.2566371f, -8.0f, true, 1, {220.578812f, 278.063141f, 138.570877f}, 1, {2239185, 2836516, 1389750}, 1},
+        {1.2566371f, -6.0f, true, 1, {259.686707f, 278.4823f, 160.434509f}, 1, {2652025, 2845121, 1624760}, 1},
+        {1.2566371f, -4.0f, true, 0, {253.276352f, 225.961136f, 164.352844f}, 0, {2589500, 2322142, 1665697}, 0},
+        {1.2566371f, -2.0f, true, 0, {181.062012f, 122.126892f, 106.10482f}, 0, {1825722, 1235066, 1047719}, 0},
+        {1.2566371f, 0.0f, true, 0, {49.9209633f, -6.6436286f, -2.23382282f}, 0, {504752, -60336, -44605}, 0},
+        {1.2566371f, 2.0f, true, 0, {-101.827545f, -144.211914f, -118.408806f}, 0, {-1023479, -1444104, -1214772}, 0},
+        {1.2566371f, 4.0f, true, 2, {-269.044403f, -292.957031f, -239.454498f}, 2, {-2777154, -3002473, -2484849}, 2},
+        {1.2566371f, 6.0f, true, 2, {-484.091797f, -459.35437f, -369.41748f}, 2, {-4953103, -4684286, -3800485}, 2},
+        {1.2566371f, 8.0f, true, 2, {-732.998413f, -637.787781f, -503.781494f}, 2, {-7564270, -6552906, -5210140}, 2},
+        {1.2566371f, 10.0f, true, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {1.2566371f, 12.0f, true, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {0.0f, 0.0f, true, 0, {100.024864f, 99.9187164f, 99.8890305f}, 1, {1018194, 1027685, 1010329}, 2},
+        {1.04719758f, 10.0f, true, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {-1.04719758f, -10.0f, true, 0, {-84.5211792f, -123.24617f, -241.067322f}, 0, {-873062, -1251186, -2499382}, 0},
+        {1.04719758f, -10.0f, true, 1, {155.380569f, 240.703827f, 92.70121f}, 1, {1571111, 2449112, 914510}, 1},
+        {9.9999461e-41f, -9.9999461e-41f, true, 0, {100.024864f, 99.9187164f, 99.8890305f}, 1, {1018194, 1027685, 1010329}, 2},
+        {-1e-30f, 1e-30f, true, 0, {100.024864f, 99.9187164f, 99.8890305f}, 1, {1018194, 1027685, 1010329}, 2},
+        {-1.04719758f, -6.77615261f, true, 0, {-57.0475845f, -57.0475922f, -134.859604f}, 1, {-584953, -566724, -1398956}, 1},
+        {-1.04719758f, -3.06836247f, true, 1, {-5.68297434f, -5.68297338f, -26.5596924f}, 1, {-59034, -42962, -279496}, 0},
+        {-1.04719758f, -1.25913072f, true, 0, {4.30530357f, 3.17131138f, 4.30530071f}, 1, {43608, 49498, 36408}, 0},
+        {-0.87266463f, -9.28871918f, true, 0, {-81.8271484f, -81.8271484f, -186.625259f}, 1, {-845885, -833088, -1942479}, 1},
+        {-0.87266463f, -3.26690459f, true, 1, {-1.05155063f, -1.05154943f, -20.3574638f}, 1, {-4960, 9614, -209450}, 1},
+        {-0.87266463f, -0.824974597f, true, 0, {25.0698452f, 23.1513252f, 25.0698433f}, 2, {247035, 249103, 250740}, 0},
+        {-0.69813168f, -2.67863607f, true, 1, {19.8424129f, 19.8424149f, 4.34301281f}, 1, {200123, 214772, 33462}, 1},
+        {-0.69813168f, -0.406280875f, true, 0, {46.1293869f, 42.3319397f, 46.1293869f}, 0, {464419, 442787, 462281}, 2},
+        {-0.52359879f, -2.21290112f, true, 1, {38.6789017f, 38.6789093f, 26.6169071f}, 1, {392339, 405554, 261181}, 1},
+        {-0.52359879f, 0.0025236872f, true, 0, {67.1334076f, 61.5257187f, 67.1334076f}, 0, {679117, 636224, 673910}, 2},
+        {-0.34906584f, -1.74716651f, true, 1, {57.5153961f, 57.5153999f, 48.8907928f}, 1, {589443, 602047, 494699}, 0},
+        {-0.34906584f, 0.40324387f, true, 0, {88.2168427f, 80.8506165f, 88.2168427f}, 0, {904176, 839630, 894757}, 0},
+        {-0.17453292f, -1.28143156f, true, 1, {76.3518829f, 76.3518906f, 71.1646805f}, 1, {781605, 792676, 722389}, 1},
+        {-0.17453292f, 0.309362829f, true, 0, {99.3566589f, 96.7585449f, 99.3566589f}, 0, {1013830, 999215, 1008078}, 2},
+        {0.0f, -0.230706766f, true, 1, {99.3732147f, 99.3732224f, 98.0822067f}, 1, {1011248, 1021816, 991297}, 0},
+        {0.0f, 0.0302807298f, true, 0, {99.8649139f, 99.7004776f, 99.8649139f}, 1, {1018194, 1027685, 1010329}, 2},
+        {0.17453292f, -0.696848392f, true, 1, {101.097717f, 101.097725f, 98.6536789f}, 1, {1029818, 1040903, 996127}, 1},
+        {0.34906584f, -1.62485111f, true, 1, {110.603058f, 110.603065f, 100.054497f}, 1, {1116315, 1130367, 1005869}, 0},
+        {0.34906584f, 0.512361884f, true, 0, {19.8771229f, 10.5382481f, 19.8771229f}, 0, {168177, 88566, 167178}, 0},
+        {0.52359879f, -2.87400579f, true, 1, {150.383133f, 150.383148f, 115.938545f}, 0, {1550672, 1544636, 1185539}, 0},
+        {0.52359879f, 2.62172437f, true, 0, {-127.326317f, -144.661835f, -127.326317f}, 0, {-1297017, -1463916, -1312006}, 0},
+        {0.69813168f, -3.65506411f, true, 1, {190.029663f, 190.029678f, 133.363159f}, 0, {1946857, 1943453, 1357508}, 0},
+        {0.69813168f, 3.2216692f, true, 0, {-178.652237f, -201.050262f, -178.652237f}, 0, {-1844230, -2059710, -1858217}, 2},
+        {0.87266463f, -4.42869473f, true, 1, {228.113068f, 228.113098f, 150.112289f}, 1, {2331958, 2332220, 1522819}, 1},
+        {0.874227881f, 0.997162282f, true, 0, {-13.8374462f, -57.2389412f, -50.7798767f}, 0, {-168363, -596753, -555404}, 0},
+        {-0.244047657f, -10.9921875f, false, 1, {-84.0854034f, 3.67720628f, -108.350388f}, 1, {-870875, 40300, -1137564}, 1},
+        {1.03203368f, 10.9004059f, false, 2, {-982.058167f, -815.105835f, -638.185181f}, 2, {-10076242, -8336867, -6565769}, 2},
+        {0.0952072889f, -9.41381454f, false, 1, {-50.9034309f, 39.2497101f, -67.4727859f}, 1, {-534024, 404982, -719773}, 1},
+        {0.201052874f, -4.90567398f, false, 1, {38.2518082f, 78.0219345f, 32.4534874f}, 1, {385237, 799150, 315008}, 1},
+        {-0.973515093f, 2.5528841f, false, 2, {-108.708031f, -24.3202f, 20.8796482f}, 2, {-1099727, -226370, 210954}, 2},
+        {0.126528978f, 2.60087109f, false, 2, {-121.490494f, -100.445152f, -74.4657745f}, 2, {-1248870, -1016058, -769699}, 2},
+        {-0.805078745f, 8.92741203f, false, 2, {-739.664185f, -443.83606f, -348.417755f}, 2, {-7551363, -4501655, -3552192}, 2},
+        {0.996682823f, -4.59340858f, true, 0, {253.937057f, 243.656433f, 164.568207f}, 0, {2592887, 2485451, 1668618}, 0},
+        {-0.983323872f, 3.59257531f, false, 2, {-167.949402f, -41.3664932f, 6.26361895f}, 2, {-1739953, -410943, 53332}, 2},
+        {1.12118328f, -5.77920055f, false, 1, {261.363586f, 274.994507f, 163.686142f}, 1, {2670435, 2807400, 1660619}, 1},
+        {0.0798611417f, -0.615320861f, false, 1, {97.6411362f, 97.7811966f, 94.6258469f}, 1, {994281, 1006347, 956053}, 0},
+        {0.118173428f, -2.45727253f, false, 1, {77.4709854f, 87.0737381f, 74.7115479f}, 1, {786160, 894120, 749449}, 1},
+        {-1.09070063f, 9.1196537f, false, 2, {-722.138062f, -397.344849f, -316.085693f}, 2, {-7430515, -4073087, -3254539}, 2},
+        {-1.14618576f, -3.34715295f, false, 1, {-9.80545235f, -8.24018288f, -32.757019f}, 1, {-106404, -72520, -351920}, 1},
+        {-0.361105651f, -9.05461597f, false, 1, {-75.4638977f, -1.06365156f, -100.170647f}, 1, {-780829, -5171, -1050934}, 1},
+        {0.842510164f, -1.29970253f, true, 0, {143.584656f, 94.4430847f, 78.6046753f}, 0, {1478707, 994306, 800190}, 0},
+        {-0.406158328f, -7.07051563f, false, 1, {-43.809742f, 7.74716663f, -65.561409f}, 1, {-456195, 88510, -693461}, 1},
+        {0.925090253f, -10.2917805f, false, 1, {109.706253f, 200.621674f, 62.4409714f}, 1, {1099551, 2036026, 600293}, 1},
+        {-0.347512752f, 7.28862333f, false, 2, {-614.466675f, -410.978149f, -319.898712f}, 2, {-6352037, -4235835, -3319894}, 2},
+        {0.830642283f, 3.1706183f, false, 0, {-181.981537f, -210.356995f, -184.352982f}, 0, {-1853657, -2131004, -1896800}, 2},
+        {-0.500768483f, 0.968191624f, false, 2, {49.3699532f, 58.4002991f, 75.7444992f}, 2, {506293, 608494, 764462}, 2},
+        {1.09485614f, 9.21164894f, false, 2, {-883.792114f, -745.887085f, -585.182495f}, 2, {-9070319, -7630631, -6023350}, 2},
+        {-0.577214241f, -1.71847069f, false, 0, {44.5964317f, 42.0148468f, 33.6274109f}, 0, {451823, 439997, 331921}, 0},
+        {0.337294728f, -6.24379158f, true, 1, {22.8185234f, 82.2603912f, 17.0648899f}, 1, {228892, 844408, 158810}, 1},
+        {0.198239788f, -3.50727558f, false, 1, {64.3291016f, 86.5267487f, 61.1893387f}, 1, {643094, 885389, 601017}, 1},
+        {-0.854180396f, 10.2438917f, false, 2, {-861.512573f, -529.674805f, -416.121857f}, 2, {-8837626, -5407690, -4266787}, 2},
+        {-0.87015146f, 9.54098511f, false, 2, {-802.698608f, -482.780762f, -380.414673f}, 2, {-8216551, -4913179, -3889988}, 2},
+        {-0.406728268f, 5.65683985f, false, 2, {-412.951782f, -250.389923f, -187.23616f}, 2, {-4264500, -2578451, -1944512}, 2},
+        {-0.537623823f, -0.970322192f, false, 0, {59.9493942f, 54.7355652f, 51.7869225f}, 0, {616206, 575327, 526863}, 0},
+        {0.464062959f, -10.2470207f, false, 1, {-29.4341431f, 75.3226776f, -42.6654129f}, 1, {-325896, 757084, -473261}, 1},
+        {-0.501388371f, -2.3852365f, false, 1, {36.8239326f, 37.7618179f, 24.4186592f}, 1, {377399, 399784, 243400}, 1},
+        {-0.40000841f, -7.10640049f, true, 1, {-44.0216484f, 8.08672333f, -65.7235031f}, 1, {-456195, 88510, -693461}, 1},
+        {0.92387104f, 3.18246627f, false, 2, {-189.792206f, -220.038193f, -188.165604f}, 0, {-1921596, -2218255, -1928697}, 2},
+        {-0.999387503f, 9.41743565f, false, 2, {-764.339844f, -435.839294f, -348.058136f}, 2, {-7889076, -4489991, -3600932}, 2},
+        {-0.377836347f, -2.52568555f, false, 1, {41.5268784f, 44.3686218f, 29.9701557f}, 1, {421493, 463617, 295410}, 1},
+        {-0.153356984f, -8.18384171f, false, 1, {-46.1933899f, 24.0793896f, -65.2004166f}, 1, {-483786, 248139, -694462}, 1},
+        {0.671451926f, 7.92291832f, false, 2, {-732.560791f, -606.594421f, -497.037354f}, 2, {-7555251, -6227561, -5135208}, 2},
+        {1.02691853f, 6.9147892f, false, 2, {-598.14502f, -539.477173f, -430.927856f}, 2, {-6159885, -5534262, -4451339}, 2},
+        {-0.974105f, 3.1712234f, false, 2, {-140.564606f, -33.6623535f, 15.3874092f}, 2, {-1427677, -324830, 157747}, 2},
+        {0.612808943f, -5.20723057f, true, 1, {124.476723f, 162.949036f, 96.3959961f}, 1, {1253630, 1655450, 960612}, 1},
+        {0.308757395f, -4.67529917f, false, 1, {50.2584038f, 89.4474182f, 46.9947128f}, 1, {508390, 914914, 464752}, 1},
+        {0.513477385f, 6.70520449f, false, 2, {-587.144775f, -489.145264f, -413.485596f}, 2, {-6010960, -4988424, -4247470}, 2},
+        {-1.01216614f, 3.21078563f, false, 2, {-148.044998f, -39.3873367f, 12.3469191f}, 2, {-1532020, -392055, 119055}, 2},
+        {-0.941969454f, -2.04849005f, false, 0, {16.8013706f, 11.5671577f, 1.34880352f}, 0, {173382, 136533, 8600}, 0},
+        {0.481764019f, 9.79899025f, false, 2, {-970.482178f, -760.897644f, -620.850647f}, 2, {-9910855, -7746916, -6356878}, 2},
+        {-0.448759228f, -4.81294155f, false, 1, {-6.32639551f, 18.3823433f, -24.5403671f}, 1, {-65918, 201430, -263658}, 1},
+        {0.720375836f, 9.73359489f, false, 2, {-954.827026f, -769.933899f, -619.336365f}, 2, {-9833939, -7899709, -6389844}, 2},
+        {-0.451369315f, -0.781416833f, true, 0, {68.4013748f, 63.3504105f, 61.7792587f}, 0, {695204, 656456, 620433}, 0},
+        {-0.509895146f, -3.05573273f, false, 1, {24.012846f, 27.5740013f, 9.25640011f}, 1, {239032, 290316, 79197}, 1},
+        {1.1018492f, 4.37155008f, false, 2, {-300.355865f, -320.717041f, -261.576782f}, 2, {-3117298, -3303721, -2725178}, 2},
+        {0.957268834f, 5.64032221f, false, 2, {-440.559509f, -420.850342f, -345.335205f}, 2, {-4561621, -4328927, -3584074}, 2},
+        {0.458932132f, -10.1208239f, false, 1, {-30.6613846f, 74.1563721f, -43.658783f}, 1, {-325896, 757084, -473261}, 1},
+        {0.890538096f, 2.64168859f, false, 0, {-142.650223f, -176.789948f, -154.123398f}, 0, {-1496225, -1827883, -1622287}, 0},
+        {0.0391887613f, -0.739373863f, false, 1, {96.3833618f, 96.537674f, 94.0117569f}, 1, {984113, 996163, 948364}, 1},
+        {0.783842087f, -6.85365105f, false, 1, {143.94075f, 197.518585f, 96.6489105f}, 1, {1458991, 2014288, 963545}, 1},
+        {0.355692267f, -3.52930403f, true, 1, {77.7306442f, 103.056824f, 76.57798f}, 1, {776965, 1048647, 758259}, 1},
+        {-0.548349679f, 1.34216881f, false, 2, {23.4542675f, 46.8090363f, 69.0236816f}, 2, {230048, 485837, 694385}, 2},
+        {-0.128483579f, -5.85479641f, false, 1, {-3.07394743f, 41.5330467f, -17.1012402f}, 1, {-35929, 429158, -192260}, 1},
+        {1.12919772f, 4.7414813f, false, 2, {-331.530884f, -348.35614f, -283.602661f}, 2, {-3391250, -3546002, -2918779}, 2},
+        {-0.872936964f, 10.0598211f, false, 2, {-858.130432f, -524.522522f, -412.707123f}, 2, {-8807080, -5361223, -4235924}, 2},
+        {0.200239763f, -7.75046968f, false, 1, {-14.7145405f, 59.9899635f, -26.0431519f}, 1, {-155445, 615362, -285156}, 1},
+        {0.34905833f, 5.36348152f, false, 2, {-438.705963f, -363.666779f, -310.285034f}, 2, {-4498403, -3709659, -3187311}, 2},
+        {-0.961582661f, -8.48631287f, false, 0, {-73.8480759f, -79.4343338f, -176.163879f}, 0, {-764825, -813306, -1842091}, 0},
+        {0.239535794f, 4.94941235f, true, 2, {-402.527802f, -326.075958f, -274.434265f}, 2, {-4148480, -3342632, -2834884}, 2},
+        {-0.955605805f, 7.63679886f, false, 2, {-560.037292f, -286.496674f, -222.240768f}, 2, {-5750668, -2923493, -2280692}, 2},
+        {-0.639353991f, -6.59333134f, false, 1, {-51.1302528f, -11.0145655f, -76.5092468f}, 1, {-533937, -107131, -810456}, 1},
+        {1.10630858f, -7.50281954f, false, 1, {229.509201f, 281.105408f, 146.879288f}, 1, {2340558, 2871873, 1484817}, 1},
+        {-0.797471523f, -1.44546485f, false, 0, {34.8473015f, 29.2069454f, 22.9610004f}, 0, {356557, 313481, 230209}, 0},
+        {-0.954298079f, -4.03970528f, false, 1, {-19.4480762f, -12.0726013f, -43.0131645f}, 1, {-197594, -106496, -445824}, 1},
+        {0.809995234f, 4.82581854f, false, 2, {-344.682281f, -339.830566f, -289.097778f}, 2, {-3513748, -3452376, -2969698}, 2},
+        {1.10171461f, -1.94567001f, false, 0, {178.320206f, 118.972198f, 103.750809f}, 0, {1825722, 1235066, 1047719}, 0},
+        {0.798692524f, 6.53636456f, true, 2, {-556.733521f, -491.022369f, -404.494812f}, 2, {-5713076, -5020404, -4167694}, 2},
+        {-0.324152857f, 1.25208235f, false, 2, {60.0514374f, 78.7170639f, 85.7393036f}, 2, {609012, 816245, 868686}, 2},
+        {-0.595865846f, -2.3287642f, false, 0, {32.2927475f, 31.9810143f, 19.0669365f}, 1, {323361, 336198, 179466}, 0},
+        {-0.209601849f, 1.13598561f, false, 2, {74.5781326f, 86.0694351f, 90.9769592f}, 2, {779920, 899470, 930044}, 2},
+        {-0.77459836f, -6.95752096f, false, 1, {-60.1434288f, -19.6234798f, -95.3679733f}, 1, {-618787, -185107, -988809}, 1},
+        {-0.597200096f, 10.2932959f, false, 2, {-902.013794f, -595.210327f, -467.289246f}, 2, {-9262476, -6095648, -4808115}, 2},
+        {1.10654068f, 6.43215895f, false, 2, {-537.875366f, -497.910126f, -398.450775f}, 2, {-5555680, -5115506, -4125790}, 2},
+        {0.717802763f, 4.74661875f, false, 2, {-337.958191f, -327.347412f, -282.97171f}, 2, {-3444611, -3325675, -2906072}, 2},
+        {0.829133213f, 7.02594471f, true, 2, {-616.301453f, -536.286804f, -437.807343f}, 2, {-6301057, -5469559, -4497992}, 2},
+        {-0.533179343f, -1.4369626f, false, 0, {52.3598518f, 49.1141319f, 42.8109169f}, 0, {535687, 514970, 431388}, 0},
+        {0.64620465f, 9.99440002f, false, 2, {-989.395752f, -788.372314f, -635.920044f}, 2, {-10156947, -8065987, -6541868}, 2},
+        {-0.421499789f, -1.1985383f, false, 0, {63.3188858f, 60.3144798f, 55.7686043f}, 0, {648915, 630642, 565591}, 0},
+        {-0.847951353f, 6.60389662f, false, 2, {-454.278564f, -220.996429f, -167.599152f}, 2, {-4676851, -2260683, -1728115}, 2},
+        {1.09955835f, -7.61479568f, false, 1, {227.497879f, 280.420227f, 145.008041f}, 1, {2311596, 2861828, 1457663}, 1},
+        {0.150508866f, -2.49957943f, false, 1, {79.1817322f, 89.4897537f, 76.9908524f}, 1, {798045, 915047, 766660}, 1},
+        {0.970953107f, 5.57657528f, false, 2, {-432.214447f, -416.000244f, -341.146759f}, 2, {-4458263, -4268891, -3530458}, 2},
+        {-0.735801816f, -2.86372852f, true, 1, {14.224206f, 14.5666809f, -2.30217695f}, 1, {150805, 168566, -24999}, 0},
+        {1.07824349f, 10.9191103f, false, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {0.821314216f, 5.54283524f, false, 2, {-433.032806f, -404.155762f, -337.604828f}, 2, {-4406606, -4105714, -3461728}, 2},
+        {-0.390326768f, 2.60165596f, false, 2, {-60.5719948f, 13.4693003f, 31.6681576f}, 2, {-624750, 144485, 312026}, 2},
+        {1.07120764f, -4.48887587f, false, 0, {261.464294f, 242.604187f, 171.649429f}, 0, {2668067, 2484031, 1737976}, 0},
+        {0.269400001f, -8.22232342f, false, 1, {-18.2920761f, 63.3600426f, -29.1924667f}, 1, {-189050, 653661, -313718}, 1},
+        {0.416605383f, 9.55352592f, false, 2, {-942.233093f, -735.164307f, -603.620422f}, 2, {-9630365, -7496546, -6186752}, 2},
+        {-0.711140454f, -4.75329638f, false, 1, {-23.0315151f, -4.51137495f, -45.9592323f}, 1, {-230786, -26953, -475661}, 1},
+        {-0.795371354f, 9.66535854f, true, 2, {-831.33844f, -514.839844f, -402.916077f}, 2, {-8566124, -5294862, -4159615}, 2},
+        {-0.898539603f, 5.20257139f, false, 2, {-305.326324f, -104.927681f, -58.4018707f}, 2, {-3127101, -1055557, -595519}, 2},
+        {0.87754482f, 10.2497444f, false, 2, {-983.617859f, -803.742249f, -638.58905f}, 2, {-10092083, -8218827, -6568102}, 2},
+        {0.0494863354f, -10.5495844f, false, 1, {-64.2453156f, 31.1264343f, -82.8300629f}, 1, {-666827, 321046, -873972}, 1},
+        {0.948928058f, -2.87752008f, false, 0, {217.523224f, 179.397293f, 136.932983f}, 0, {2228577, 1856421, 1391868}, 0},
+        {0.131958634f, -1.88366807f, false, 1, {87.5670624f, 94.5635529f, 85.9895935f}, 1, {888089, 970646, 864147}, 1},
+        {-0.34041658f, 10.0405064f, false, 2, {-931.690247f, -649.358459f, -533.332581f}, 2, {-9565641, -6647907, -5483676}, 2},
+        {0.724170148f, 5.37413692f, false, 2, {-415.398895f, -383.434265f, -325.394226f}, 2, {-4240415, -3902545, -3342722}, 2},
+        {-1.01681685f, -10.8933935f, true, 0, {-85.4634323f, -119.138031f, -235.499359f}, 0, {-884536, -1207628, -2436928}, 0},
+        {0.840382993f, 0.78813374f, false, 0, {3.1239078f, -40.0366211f, -36.0625305f}, 0, {23602, -404131, -388156}, 0},
+        {0.664657116f, -6.46552515f, false, 1, {106.731842f, 160.791214f, 80.1215744f}, 1, {1093036, 1650949, 801682}, 1},
+        {1.034132f, -7.07460403f, false, 1, {233.310425f, 280.057587f, 150.806458f}, 1, {2360897, 2849894, 1511955}, 1},
+        {0.315273106f, -1.96479487f, false, 1, {102.138062f, 106.747849f, 94.5768051f}, 1, {1035875, 1094825, 953208}, 1},
+        {-0.908324063f, -6.99885654f, false, 1, {-60.8281937f, -40.4967499f, -118.288376f}, 1, {-629731, -405610, -1234485}, 1},
+        {-0.669913888f, -3.15418959f, false, 1, {12.7746582f, 15.0053492f, -4.02584171f}, 1, {130809, 168754, -48905}, 1},
+        {0.272236586f, 8.38110733f, false, 2, {-803.347351f, -622.792542f, -521.807556f}, 2, {-8198977, -6336549, -5337554}, 2},
+        {-0.621109188f, 1.53539097f, true, 2, {1.52140892f, 34.861763f, 60.8806038f}, 2, {35406, 378711, 620486}, 2},
+        {-0.629559517f, 8.69357777f, false, 2, {-742.818909f, -470.395782f, -363.662994f}, 2, {-7591863, -4788460, -3718692}, 2},
+        {0.990826428f, -10.6859722f, false, 1, {133.662842f, 221.663895f, 79.1483612f}, 1, {1343647, 2249958, 772769}, 1},
+        {-0.442293823f, 9.88130474f, false, 2, {-905.580811f, -617.4151f, -498.349884f}, 2, {-9245889, -6274961, -5077808}, 2},
+        {0.765289843f, -0.788527966f, false, 0, {115.422653f, 68.9213257f, 58.3044853f}, 0, {1171889, 708389, 575653}, 0},
+        {1.12630153f, 10.5897541f, false, 2, {-981.90509f, -816.221191f, -638.145508f}, 2, {-10074614, -8349331, -6565525}, 2},
+        {-1.0643481f, -0.430741251f, false, 2, {-18.5517273f, -2.77033281f, 8.24348259f}, 2, {-199809, -12218, 80941}, 2},
+        {0.713491917f, -0.830888271f, false, 0, {115.9142f, 74.4680099f, 65.0547714f}, 0, {1194706, 784921, 660512}, 0},
+        {-0.501204193f, 1.4375664f, true, 2, {25.0527515f, 51.8553009f, 71.3156738f}, 2, {262126, 540691, 723831}, 2},
+        {-0.436797708f, 10.5513535f, false, 2, {-920.033264f, -628.9104f, -509.27597f}, 2, {-9443351, -6432839, -5228900}, 2},
+        {-0.476978511f, -1.55750978f, false, 0, {53.4588737f, 51.3086281f, 44.1049347f}, 0, {540461, 532503, 436890}, 0},
+        {0.255414099f, 3.87775731f, false, 2, {-277.288239f, -235.436203f, -196.752182f}, 2, {-2829377, -2388687, -2016637}, 2},
+        {-0.978744566f, -6.93482351f, false, 1, {-59.7372437f, -50.3735161f, -128.582062f}, 1, {-616421, -508595, -1342403}, 1},
+        {-0.373616129f, -3.38017869f, false, 1, {25.953619f, 34.3270874f, 11.9759388f}, 1, {260922, 362313, 107907}, 1},
+        {-0.997485042f, -7.16337729f, false, 1, {-61.6349487f, -58.0124207f, -139.350632f}, 1, {-637239, -584867, -1451929}, 1},
+        {0.962540209f, 3.19272804f, false, 2, {-193.886795f, -224.505737f, -189.60408f}, 2, {-2024209, -2318329, -1986487}, 2}
+    };
+}
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
@@ -0,0 +1,105 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model (int8 quantized)
+ * Generated: 2025-08-17T17-26-44
+ * Architecture: 2-64-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * Integer-only variant for MCUs without an FPU: int8 weights with one scale
+ * per layer, int32 accumulators, integer ReLU and int16 hidden activations.
+ * Drop-in API compatible with the float TwoWheelBotDQN export. Inference
+ * code lives in DQNPolicy.h (native/include/); copy it next to this file.
+ *
+ * Quantization report (argmax agreement with the float network):
+ *   Sweep: 101x101 grid, angle +/-1.0472 rad, angular velocity +/-10 rad/s
+ *   Agreement: 10025/10201 (98.27%)
+ *   Max |Q error|: 6.769644
+ *   Weight flash: 588 bytes (float export: 1548 bytes)
+ */
+
+#include "DQNPolicy.h"
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNInt8Weights {
+    static const int INPUT_SIZE = 2;
+    static const int HIDDEN_SIZE = 64;
+    static const int OUTPUT_SIZE = 3;
+
+    // Hidden requantization: int16 = (acc + round) >> HIDDEN_SHIFT
+    static const int HIDDEN_SHIFT = 1;
+
+    // Input scales: radians and rad/s to int8 LSBs (127 / limit)
+    struct InputScales {
+        static constexpr float angleScale() { return 121.27607f; }
+        static constexpr float angularVelocityScale() { return 12.6999998f; }
+    };
+
+    // Layer scales (real = integer * scale), for reference only
+    //   weightsInputHidden:  7.873229e-2
+    //   weightsHiddenOutput: 7.874016e-2
+    //   Q-value per output LSB: 9.762824e-5
+    static DQN_FLASH dqn::DQNQuantizedWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM = {
+        // weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]
+        {
+            89, -25, -46, 8, -65, -27, -29, 45, -23, 71, 66, -28, -33, -52, 39, 20,
+            -34, 87, -55, -50, 25, -28, 113, 111, -87, 89, 89, 47, 114, -71, 71, -5,
+            18, 29, -46, 72, 41, 114, 38, 72, 69, -31, 112, 55, -28, 105, 8, -74,
+            -84, -63, 114, 64, 17, -30, -48, 69, -99, 76, 79, 109, 24, 43, 63, 108,
+            89, 79, -70, -16, -30, 87, 95, 116, 79, -7, 19, 94, 45, -37, 71, 127,
+            93, 91, -67, -69, 80, 76, 127, 85, -118, 127, 81, 127, 30, -2, 127, -17,
+            127, -48, -70, 67, 127, 16, 8, 127, 69, 93, 87, 57, 84, 9, -101, -104,
+            -127, -46, 13, 127, -83, 92, -122, 120, -105, 87, 80, 66, 57, 85, 86, 76
+        },
+        // biasHidden[HIDDEN_SIZE]
+        {
+            -7434, -1654, -10488, -290, 16130, -2429, -2078, -103,
+            -1772, -8721, -9077, -2071, -2289, 12275, -32, -431,
+            -1310, 14346, -11319, -10810, -482, -1502, -1220, 16129,
+            -1194, -1263, 14614, -732, -4252, -9119, 698, -1458,
+            -415, -630, -10363, -8218, -666, -4111, 16128, -1052,
+            -9965, -1702, -1792, 12817, -1545, 16068, -3650, -7,
+            -929, 16130, -4069, -955, -70, -1711, -970, -638,
+            66, 16126, 12916, 13832, 13902, -767, -6268, 16129
+        },
+        // weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]
+        {
+            -71, -17, 100, -63, -40, -34, 19, -123, -72, -28, -2, 66, -1, 9, 34, -81,
+            -15, 3, -85, -24, -27, -127, -116, -86, -58, -56, -46, -26, -26, 118, -60, -37,
+            29, -100, -23, -33, 8, 15, 18, 20, -16, 11, -52, -67, -98, -127, -49, -69,
+            -74, -38, -21, 25, 3, -7, 14, -127, -70, 17, -127, -72, 13, 5, -110, -62,
+            -46, 28, -127, -117, -10, 2, 79, 13, -122, -99, -127, -127, -104, -29, 22, 4,
+            -7, -127, -127, -102, 127, 90, 66, 76, 125, -30, -66, -67, 127, 124, -28, 125,
+            -123, -51, -83, 94, 114, 122, 19, -100, -69, -97, -77, 17, -127, -127, -109, 127,
+            93, 83, -48, 3, 18, -90, -124, -38, -83, -11, 94, -98, -27, -23, 108, 92,
+            -71, 27, 0, -3, -66, -38, -28, 13, -18, 43, -47, 74, -53, -74, -94, -71,
+            122, -30, -65, -11, 16, 33, 127, 105, 74, -69, -80, -59, -95, -99, -114, -99,
+            -30, -23, -126, 60, -103, -50, -66, -77, 115, 121, 119, 19, 16, -15, 20, 3,
+            -4, 9, -14, 11, 36, -4, -8, 101, 28, -127, -10, 10, -87, 9, 31, -12
+        },
+        // biasOutput[OUTPUT_SIZE]
+        {
+            97409, 102427, 102423
+        }
+    };
+}
+
+typedef dqn::QuantizedDQNPolicy<TwoWheelBotDQNInt8Weights::INPUT_SIZE,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SIZE,
+                                TwoWheelBotDQNInt8Weights::OUTPUT_SIZE,
+                                dqn::ReLU,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SHIFT,
+                                TwoWheelBotDQNInt8Weights::weights,
+                                dqn::ScaledInput<TwoWheelBotDQNInt8Weights::InputScales> > TwoWheelBotDQNInt8;
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
+
+// Usage example:
+// TwoWheelBotDQNInt8 bot;
+// int action = bot.getAction(angle, angularVelocity);
+// float torque = bot.getMotorTorque(action);
@@ -0,0 +1,59 @@
+/**
+ * Benchmark registry
+ *
+ * Each exported model is compiled into its own translation unit
+ * (bench_model.cpp) and registers its entry points here at static
+ * initialization, so one benchmark binary can compare every model.
+ */
+
+#ifndef TWOWHEELBOT_BENCH_REGISTRY_H
+#define TWOWHEELBOT_BENCH_REGISTRY_H
+
+#include <cstddef>
+#include <vector>
+
+namespace bench {
+
+typedef int (*ActionFn)(float angle, float angularVelocity);
+typedef void (*BatchFn)(const float* angles, const float* angularVelocities, int* actions, size_t n);
+typedef long (*LoopFn)(size_t steps);
+
+struct BenchModel {
+    const char* name;
+    const char* kernel;
+    int inputSize;
+    int hiddenSize;
+    int outputSize;
+
+    ActionFn floatAction;
+    ActionFn int8Action;
+    ActionFn lookupAction;
+    BatchFn floatBatch;
+    // Float policy driving the BalancingRobot simulator for n steps
+    LoopFn closedLoop;
+    // The same over a BalancingRobotBatch, one getActions call per step
+    LoopFn closedLoopBatch;
+
+    // Weight tables
+    size_t floatDataBytes;
+    size_t int8DataBytes;
+    size_t lookupDataBytes;
+
+    // Inference code for one getAction call (0 when the toolchain cannot tell)
+    size_t floatCodeBytes;
+    size_t int8CodeBytes;
+    size_t lookupCodeBytes;
+};
+
+inline std::vector<BenchModel>& models() {
+    static std::vector<BenchModel> registered;
+    return registered;
+}
+
+struct Registrar {
+    explicit Registrar(const BenchModel& model) { models().push_back(model); }
+};
+
+} // namespace bench
+
+#endif // TWOWHEELBOT_BENCH_REGISTRY_H
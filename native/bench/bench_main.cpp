@@ -0,0 +1,203 @@
+/**
+ * Microbenchmark for exported TwoWheelBotDQN models
+ *
+ * Times every registered model (see bench_model.cpp) for single float
+ * getAction calls, single int8 and lookup-table calls, batched float getActions and
+ * closed-loop simulator steps (float getAction plus one BalancingRobot
+ * step, and the same over a BalancingRobotBatch), and reports ns/inference, cycles/inference, throughput and
+ * code/data size.
+ * One binary is built per float kernel (bench_dqn_scalar, bench_dqn_simd),
+ * so comparing their reports compares the kernels.
+ *
+ * Usage: bench_dqn_<kernel> [--min-time seconds] [--csv file]
+ *   --min-time  Minimum measured time per case (default: 0.2)
+ *   --csv       Append one row per case to a CSV file, for tracking
+ *               results from export to export
+ *
+ * Cycles come from the x86 time-stamp counter (reference cycles at the
+ * nominal clock) or the AArch64 virtual counter (timer ticks), and read
+ * n/a elsewhere.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "BenchRegistry.h"
+
+namespace {
+
+const size_t STATE_COUNT = 4096;
+
+uint64_t readCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return 0;
+#endif
+}
+
+struct Measurement {
+    double nsPerInference;
+    double cyclesPerInference;
+    double inferencesPerSecond;
+};
+
+/**
+ * Repeat a pass over the state set until minTime has elapsed
+ * @param pass Runs one pass and returns a checksum of the actions
+ * @param inferencesPerPass States evaluated by one pass
+ */
+template <typename Pass>
+Measurement measure(Pass pass, size_t inferencesPerPass, double minTime, long& checksum) {
+    // Warm caches and branch predictors
+    checksum += pass();
+
+    size_t passes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const uint64_t startCycles = readCycles();
+    double elapsed = 0.0;
+    do {
+        for (int i = 0; i < 8; i++) checksum += pass();
+        passes += 8;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < minTime);
+    const uint64_t cycles = readCycles() - startCycles;
+
+    const double inferences = (double)passes * (double)inferencesPerPass;
+    Measurement m;
+    m.nsPerInference = elapsed * 1e9 / inferences;
+    m.cyclesPerInference = cycles > 0 ? (double)cycles / inferences : 0.0;
+    m.inferencesPerSecond = inferences / elapsed;
+    return m;
+}
+
+std::string formatCycles(double cycles) {
+    if (cycles <= 0.0) return "n/a";
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.1f", cycles);
+    return text;
+}
+
+std::string formatBytes(size_t bytes) {
+    return bytes > 0 ? std::to_string(bytes) : "n/a";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double minTime = 0.2;
+    const char* csvPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            minTime = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csvPath = argv[++i];
+        } else {
+            std::fprintf(stderr, "Usage: %s [--min-time seconds] [--csv file]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const std::vector<bench::BenchModel>& models = bench::models();
+    if (models.empty()) {
+        std::fprintf(stderr, "No models registered\n");
+        return 1;
+    }
+
+    // Deterministic states spanning the normalization range
+    std::vector<float> angles(STATE_COUNT), velocities(STATE_COUNT);
+    std::vector<int> actions(STATE_COUNT);
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < STATE_COUNT; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        angles[i] = 1.2f * ((float)(seed >> 8) / 8388608.0f - 1.0f);
+        seed = seed * 1664525u + 1013904223u;
+        velocities[i] = 12.0f * ((float)(seed >> 8) / 8388608.0f - 1.0f);
+    }
+
+    FILE* csv = csvPath ? std::fopen(csvPath, "a") : nullptr;
+    if (csvPath && !csv) {
+        std::fprintf(stderr, "Could not open %s\n", csvPath);
+        return 1;
+    }
+
+    std::printf("DQN policy benchmark (%s kernel, %zu states, min %.3f s per case)\n\n",
+                models[0].kernel, STATE_COUNT, minTime);
+    std::printf("%-10s %-8s %-8s %12s %12s %14s %10s %10s\n",
+                "model", "arch", "case", "ns/inf", "cycles/inf", "inf/s", "code B", "data B");
+
+    long checksum = 0;
+    for (const bench::BenchModel& model : models) {
+        const std::string arch = std::to_string(model.inputSize) + "-" + std::to_string(model.hiddenSize) +
+                                 "-" + std::to_string(model.outputSize);
+
+        struct Case {
+            const char* name;
+            Measurement result;
+            size_t codeBytes;
+            size_t dataBytes;
+        };
+        std::vector<Case> cases;
+
+        cases.push_back({"float", measure([&]() {
+            long sum = 0;
+            for (size_t i = 0; i < STATE_COUNT; i++) sum += model.floatAction(angles[i], velocities[i]);
+            return sum;
+        }, STATE_COUNT, minTime, checksum), model.floatCodeBytes, model.floatDataBytes});
+
+        cases.push_back({"int8", measure([&]() {
+            long sum = 0;
+            for (size_t i = 0; i < STATE_COUNT; i++) sum += model.int8Action(angles[i], velocities[i]);
+            return sum;
+        }, STATE_COUNT, minTime, checksum), model.int8CodeBytes, model.int8DataBytes});
+
+        cases.push_back({"lut", measure([&]() {
+            long sum = 0;
+            for (size_t i = 0; i < STATE_COUNT; i++) sum += model.lookupAction(angles[i], velocities[i]);
+            return sum;
+        }, STATE_COUNT, minTime, checksum), model.lookupCodeBytes, model.lookupDataBytes});
+
+        cases.push_back({"batch", measure([&]() {
+            model.floatBatch(angles.data(), velocities.data(), actions.data(), STATE_COUNT);
+            return (long)actions[STATE_COUNT - 1];
+        }, STATE_COUNT, minTime, checksum), 0, model.floatDataBytes});
+
+        cases.push_back({"loop", measure([&]() {
+            return model.closedLoop(STATE_COUNT);
+        }, STATE_COUNT, minTime, checksum), 0, model.floatDataBytes});
+
+        cases.push_back({"envbatch", measure([&]() {
+            return model.closedLoopBatch(STATE_COUNT);
+        }, STATE_COUNT, minTime, checksum), 0, model.floatDataBytes});
+
+        for (const Case& c : cases) {
+            std::printf("%-10s %-8s %-8s %12.2f %12s %14.0f %10s %10zu\n",
+                        model.name, arch.c_str(), c.name, c.result.nsPerInference,
+                        formatCycles(c.result.cyclesPerInference).c_str(), c.result.inferencesPerSecond,
+                        formatBytes(c.codeBytes).c_str(), c.dataBytes);
+            if (csv) {
+                std::fprintf(csv, "%s,%s,%s,%s,%.3f,%.3f,%.0f,%zu,%zu\n",
+                             model.name, model.kernel, arch.c_str(), c.name, c.result.nsPerInference,
+                             c.result.cyclesPerInference, c.result.inferencesPerSecond, c.codeBytes, c.dataBytes);
+            }
+        }
+    }
+
+    if (csv) std::fclose(csv);
+    // Keeps the measured loops observable
+    std::printf("\nchecksum %ld\n", checksum);
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * Benchmark entry points for one exported model
+ *
+ * Built once per model in models/ with DQN_MODEL_FILE, DQN_INT8_MODEL_FILE,
+ * DQN_LOOKUP_MODEL_FILE, DQN_BENCH_NAME (a string) and DQN_BENCH_ID (an identifier). Each
+ * single-call entry point is flattened into its own ELF section, so the
+ * section bounds give the size of the complete inference code.
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+#include DQN_LOOKUP_MODEL_FILE
+
+#include "BalancingRobotBatch.h"
+#include "BenchRegistry.h"
+
+#define DQN_BENCH_STR2(x) #x
+#define DQN_BENCH_STR(x) DQN_BENCH_STR2(x)
+#define DQN_BENCH_CAT2(a, b) a##b
+#define DQN_BENCH_CAT(a, b) DQN_BENCH_CAT2(a, b)
+
+#define DQN_FLOAT_SECTION DQN_BENCH_CAT(dqn_bench_float_, DQN_BENCH_ID)
+#define DQN_INT8_SECTION DQN_BENCH_CAT(dqn_bench_int8_, DQN_BENCH_ID)
+#define DQN_LOOKUP_SECTION DQN_BENCH_CAT(dqn_bench_lookup_, DQN_BENCH_ID)
+
+#if defined(__ELF__) && defined(__GNUC__)
+#define DQN_BENCH_CODE(name) __attribute__((noinline, flatten, section(DQN_BENCH_STR(name))))
+// The linker defines __start_/__stop_ symbols for C-identifier sections
+extern "C" char DQN_BENCH_CAT(__start_, DQN_FLOAT_SECTION)[];
+extern "C" char DQN_BENCH_CAT(__stop_, DQN_FLOAT_SECTION)[];
+extern "C" char DQN_BENCH_CAT(__start_, DQN_INT8_SECTION)[];
+extern "C" char DQN_BENCH_CAT(__stop_, DQN_INT8_SECTION)[];
+extern "C" char DQN_BENCH_CAT(__start_, DQN_LOOKUP_SECTION)[];
+extern "C" char DQN_BENCH_CAT(__stop_, DQN_LOOKUP_SECTION)[];
+#define DQN_SECTION_BYTES(name) \
+    (size_t)(DQN_BENCH_CAT(__stop_, name) - DQN_BENCH_CAT(__start_, name))
+#else
+#define DQN_BENCH_CODE(name) __attribute__((noinline))
+#define DQN_SECTION_BYTES(name) ((size_t)0)
+#endif
+
+namespace {
+
+TwoWheelBotDQN floatBot;
+TwoWheelBotDQNInt8 int8Bot;
+TwoWheelBotDQNLookup lookupBot;
+
+DQN_BENCH_CODE(DQN_FLOAT_SECTION) int floatAction(float angle, float angularVelocity) {
+    return floatBot.getAction(angle, angularVelocity);
+}
+
+DQN_BENCH_CODE(DQN_INT8_SECTION) int int8Action(float angle, float angularVelocity) {
+    return int8Bot.getAction(angle, angularVelocity);
+}
+
+DQN_BENCH_CODE(DQN_LOOKUP_SECTION) int lookupAction(float angle, float angularVelocity) {
+    return lookupBot.getAction(angle, angularVelocity);
+}
+
+__attribute__((noinline)) void floatBatch(const float* angles, const float* angularVelocities, int* actions, size_t n) {
+    floatBot.getActions(angles, angularVelocities, actions, n);
+}
+
+const int EPISODE_STEPS = 1000;
+const double START_ANGLES[4] = {0.05, -0.1, 0.2, -0.3};
+
+// Restarts from a few start angles whenever the robot falls or an
+// episode reaches EPISODE_STEPS
+__attribute__((noinline)) long closedLoop(size_t steps) {
+    static dqn::BalancingRobot robot;
+    static TwoWheelBotDQN loopBot;
+    static int episode = 0;
+
+    long sum = 0;
+    for (size_t i = 0; i < steps; i++) {
+        if (robot.hasFailed() || robot.getStepCount() >= EPISODE_STEPS) {
+            robot.reset(dqn::RobotState(START_ANGLES[episode++ & 3]));
+            loopBot.reset((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+        }
+        const int action = loopBot.getAction((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+        robot.step((double)loopBot.getMotorTorque(action));
+        sum += action;
+    }
+    return sum;
+}
+
+// Same episodes over BATCH_LANES robots per step; steps should be a
+// multiple of BATCH_LANES
+__attribute__((noinline)) long closedLoopBatch(size_t steps) {
+    static const int BATCH_LANES = 256;
+    static dqn::BalancingRobotBatch<BATCH_LANES> robots;
+    static int episode = 0;
+
+    long sum = 0;
+    for (size_t i = 0; i < steps; i += BATCH_LANES) {
+        for (int lane = 0; lane < BATCH_LANES; lane++) {
+            if (robots.isDone(lane) || robots.getStepCount(lane) >= EPISODE_STEPS) {
+                robots.reset(lane, dqn::RobotState(START_ANGLES[episode++ & 3]));
+            }
+        }
+        robots.stepPolicy(floatBot);
+        sum += robots.lastActions()[0];
+    }
+    return sum;
+}
+
+const bench::Registrar registrar({
+    DQN_BENCH_NAME,
+    DQN_KERNEL_NAME,
+    TwoWheelBotDQN::INPUT_SIZE,
+    TwoWheelBotDQN::HIDDEN_SIZE,
+    TwoWheelBotDQN::OUTPUT_SIZE,
+    floatAction,
+    int8Action,
+    lookupAction,
+    floatBatch,
+    closedLoop,
+    closedLoopBatch,
+    sizeof(TwoWheelBotDQNWeights::weights),
+    sizeof(TwoWheelBotDQNInt8Weights::weights),
+    sizeof(TwoWheelBotDQNLookupTable::table),
+    DQN_SECTION_BYTES(DQN_FLOAT_SECTION),
+    DQN_SECTION_BYTES(DQN_INT8_SECTION),
+    DQN_SECTION_BYTES(DQN_LOOKUP_SECTION)
+});
+
+} // namespace
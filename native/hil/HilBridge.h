@@ -0,0 +1,321 @@
+/**
+ * Hardware-in-the-loop bridge: host physics, device policy
+ *
+ * Runs dqn::BalancingRobot on the host and lets a dqn::HilDevice on the
+ * microcontroller choose every action over a serial link (DQNHil.h):
+ *
+ *   hil::SerialPort port;
+ *   port.open("/dev/ttyUSB0", 921600);
+ *   dqn::BalancingRobot robot(config, seed);
+ *   robot.reset(dqn::RobotState(0.05));
+ *   hil::HilReport report = hil::runHil(port, robot, options);
+ *
+ * - Ticks go out at options.rateHz on wall-clock deadlines (sleep, then
+ *   spin for the last stretch). Each tick sends the measured angle and
+ *   angular velocity, waits for the action frame with the same sequence
+ *   number and steps the robot with the device's torque
+ * - Simulated time per tick is the robot's timestep, independent of the
+ *   wall-clock rate: the default 1 kHz with the 0.02 s training timestep
+ *   tests the firmware at 20x real time on the dynamics the policy was
+ *   trained on; set the timestep to 1 / rate for real time
+ * - Latency is send to matching reply on the host clock (serial transfer
+ *   both ways plus the device's tick); a reply after the next deadline is
+ *   a missed deadline. Jitter is how late each send left after its
+ *   deadline, which is the host's share of the timing
+ * - A state without a reply within the timeout counts as a timeout and
+ *   the robot steps with zero torque, as DQNControlLoop.h does on a
+ *   failed read
+ *
+ * Host only (POSIX termios); C++11.
+ */
+
+#ifndef TWOWHEELBOT_HIL_BRIDGE_H
+#define TWOWHEELBOT_HIL_BRIDGE_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/select.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "BalancingRobot.h"
+#include "DQNHil.h"
+
+namespace hil {
+
+/**
+ * Raw 8N1 serial port
+ * Anything with write(bytes, n) and read(bytes, capacity, timeoutMicros)
+ * can stand in for it (runHil is a template on the link).
+ */
+class SerialPort {
+public:
+    SerialPort() : fd(-1) {}
+    ~SerialPort() { close(); }
+
+    /**
+     * @param baud Line rate; pseudo-terminals and USB CDC ports ignore it
+     * @return False if the port cannot be opened or the rate is unsupported
+     */
+    bool open(const char* path, int baud) {
+        close();
+        speed_t speed;
+        if (!speedOf(baud, speed)) return false;
+        fd = ::open(path, O_RDWR | O_NOCTTY);
+        if (fd < 0) return false;
+        termios tty;
+        if (tcgetattr(fd, &tty) != 0) {
+            close();
+            return false;
+        }
+        cfmakeraw(&tty);
+        tty.c_cflag |= CLOCAL | CREAD;
+        tty.c_cflag &= ~(tcflag_t)CRTSCTS;
+        tty.c_cc[VMIN] = 0;
+        tty.c_cc[VTIME] = 0;
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+        if (tcsetattr(fd, TCSANOW, &tty) != 0) {
+            close();
+            return false;
+        }
+        tcflush(fd, TCIOFLUSH);
+        return true;
+    }
+
+    void close() {
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+    }
+
+    bool write(const uint8_t* bytes, size_t size) {
+        while (size > 0) {
+            const ssize_t n = ::write(fd, bytes, size);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            bytes += n;
+            size -= (size_t)n;
+        }
+        return true;
+    }
+
+    /**
+     * @return Bytes read, 0 on timeout, -1 on error
+     */
+    int read(uint8_t* bytes, size_t capacity, long timeoutMicros) {
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(fd, &readable);
+        timeval timeout;
+        timeout.tv_sec = timeoutMicros / 1000000;
+        timeout.tv_usec = timeoutMicros % 1000000;
+        const int ready = select(fd + 1, &readable, nullptr, nullptr, &timeout);
+        if (ready < 0) return errno == EINTR ? 0 : -1;
+        if (ready == 0) return 0;
+        const ssize_t n = ::read(fd, bytes, capacity);
+        return n < 0 ? (errno == EINTR || errno == EAGAIN ? 0 : -1) : (int)n;
+    }
+
+    bool isOpen() const { return fd >= 0; }
+
+private:
+    static bool speedOf(int baud, speed_t& speed) {
+        switch (baud) {
+            case 9600: speed = B9600; return true;
+            case 19200: speed = B19200; return true;
+            case 38400: speed = B38400; return true;
+            case 57600: speed = B57600; return true;
+            case 115200: speed = B115200; return true;
+            case 230400: speed = B230400; return true;
+#if defined(B460800)
+            case 460800: speed = B460800; return true;
+#endif
+#if defined(B921600)
+            case 921600: speed = B921600; return true;
+#endif
+#if defined(B2000000)
+            case 2000000: speed = B2000000; return true;
+#endif
+            default: return false;
+        }
+    }
+
+    int fd;
+};
+
+struct HilOptions {
+    double rateHz;         // Wall-clock tick rate (1 - 10000 Hz)
+    int steps;             // Tick limit
+    double timeoutMillis;  // Reply wait before a tick counts as a timeout
+    bool realTime;         // False: send each state as soon as the last reply arrived
+
+    HilOptions() : rateHz(1000.0), steps(5000), timeoutMillis(20.0), realTime(true) {}
+};
+
+/**
+ * One exchange, for per-tick logs
+ */
+struct HilTick {
+    float angle;            // Sent (measured) state
+    float angularVelocity;
+    int action;             // -1 on timeout
+    float torque;
+    float latencyMicros;    // Send to reply; 0 on timeout
+    float lateMicros;       // Send after its deadline
+    uint32_t cycles;        // Device tick time
+};
+
+/**
+ * min / mean / percentiles of a sample
+ */
+struct Summary {
+    double min, mean, p50, p99, max;
+};
+
+inline Summary summarize(std::vector<double> values) {
+    Summary summary = {0.0, 0.0, 0.0, 0.0, 0.0};
+    if (values.empty()) return summary;
+    std::sort(values.begin(), values.end());
+    double sum = 0.0;
+    for (double value : values) sum += value;
+    const size_t last = values.size() - 1;
+    summary.min = values.front();
+    summary.mean = sum / (double)values.size();
+    summary.p50 = values[last / 2];
+    summary.p99 = values[(size_t)((double)last * 0.99)];
+    summary.max = values.back();
+    return summary;
+}
+
+struct HilReport {
+    int steps;                // Ticks exchanged
+    bool failed;              // Robot fell
+    double survivalSeconds;   // Simulated time upright
+    double totalReward;
+    double meanAbsAngle;      // True angle, rad
+    int timeouts;             // States without a reply
+    int missedDeadlines;      // Replies after the next tick's deadline
+    int staleReplies;         // Replies to earlier states (after a timeout)
+    size_t skippedBytes;      // Link noise while resynchronizing
+    Summary latencyMicros;    // Answered ticks
+    Summary jitterMicros;     // Send lateness, real-time runs
+    Summary deviceCycles;     // Device tick time in its CycleCounter units
+};
+
+/**
+ * Run the robot closed-loop with the device's policy
+ * The robot should already be reset; the first state carries HIL_RESET.
+ * @param link SerialPort or an equivalent (write, read with timeout)
+ * @param ticks Optional per-tick log
+ */
+template <typename Link>
+HilReport runHil(Link& link, dqn::BalancingRobot& robot, const HilOptions& options,
+                 std::vector<HilTick>* ticks = nullptr) {
+    typedef std::chrono::steady_clock Clock;
+    const double rate = std::min(std::max(options.rateHz, 1.0), 10000.0);
+    const Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+    const Clock::duration spin = std::chrono::microseconds(200);
+    const long timeoutMicros = (long)(options.timeoutMillis * 1000.0);
+
+    HilReport report = HilReport();
+    std::vector<double> latencies, jitters, cycles;
+    dqn::HilFrameDecoder decoder(dqn::HIL_ACTION_SYNC1);
+    double angleSum = 0.0;
+    uint16_t sequence = 0;
+    Clock::time_point deadline = Clock::now();
+
+    while (report.steps < options.steps) {
+        if (options.realTime) {
+            if (Clock::now() < deadline - spin) std::this_thread::sleep_until(deadline - spin);
+            while (Clock::now() < deadline) {
+            }
+        }
+
+        dqn::HilState state;
+        state.sequence = sequence;
+        state.flags = report.steps == 0 ? dqn::HIL_RESET : 0;
+        state.angle = (float)robot.measuredAngle();
+        state.angularVelocity = (float)robot.state().angularVelocity;
+        uint8_t frame[dqn::HIL_FRAME_SIZE];
+        dqn::encodeHilState(state, frame);
+
+        const Clock::time_point sent = Clock::now();
+        const double late = options.realTime ? std::chrono::duration<double, std::micro>(sent - deadline).count() : 0.0;
+        if (!link.write(frame, sizeof(frame))) break;
+
+        // Wait for this sequence's reply; older ones answer timed-out states
+        HilTick tick = {state.angle, state.angularVelocity, -1, 0.0f, 0.0f, (float)late, 0};
+        bool answered = false, linkError = false;
+        const Clock::time_point giveUp = sent + std::chrono::microseconds(timeoutMicros);
+        while (!answered) {
+            // Past the deadline, poll once more so a reply already buffered (e.g. after a slow write) still counts
+            const long remaining =
+                (long)std::chrono::duration_cast<std::chrono::microseconds>(giveUp - Clock::now()).count();
+            uint8_t bytes[64];
+            const int n = link.read(bytes, sizeof(bytes), std::max(remaining, 0L));
+            if (n < 0) {
+                linkError = true;
+                break;
+            }
+            if (n == 0 && remaining <= 0) break;
+            for (int i = 0; i < n && !answered; i++) {
+                const uint8_t* reply = decoder.push(bytes[i]);
+                dqn::HilAction action;
+                if (!reply || !dqn::decodeHilAction(reply, action)) continue;
+                if (action.sequence != sequence) {
+                    report.staleReplies++;
+                    continue;
+                }
+                const Clock::time_point received = Clock::now();
+                answered = true;
+                tick.action = action.action;
+                tick.torque = action.torque;
+                tick.cycles = action.cycles;
+                tick.latencyMicros = (float)std::chrono::duration<double, std::micro>(received - sent).count();
+                if (options.realTime && received > deadline + period) report.missedDeadlines++;
+            }
+        }
+        if (linkError) break;
+        if (answered) {
+            latencies.push_back(tick.latencyMicros);
+            cycles.push_back(tick.cycles);
+        } else {
+            report.timeouts++;
+        }
+        if (options.realTime) jitters.push_back(late);
+        if (ticks) ticks->push_back(tick);
+
+        const dqn::StepResult result = robot.step((double)tick.torque);
+        report.totalReward += result.reward;
+        angleSum += std::fabs(robot.state().angle);
+        report.steps++;
+        sequence++;
+        if (result.done) {
+            report.failed = true;
+            break;
+        }
+
+        // Ticks stay on the rate's grid; a long stall skips the deadlines it missed
+        deadline += period;
+        const Clock::time_point now = Clock::now();
+        if (options.realTime && now > deadline + period) deadline += (now - deadline) / period * period;
+    }
+
+    report.survivalSeconds = robot.simulationTime();
+    report.meanAbsAngle = report.steps > 0 ? angleSum / report.steps : 0.0;
+    report.skippedBytes = decoder.skippedBytes();
+    report.latencyMicros = summarize(latencies);
+    report.jitterMicros = summarize(jitters);
+    report.deviceCycles = summarize(cycles);
+    return report;
+}
+
+} // namespace hil
+
+#endif // TWOWHEELBOT_HIL_BRIDGE_H
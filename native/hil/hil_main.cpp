@@ -0,0 +1,196 @@
+/**
+ * Hardware-in-the-loop runner
+ *
+ * Drives the native BalancingRobot with a policy running on a
+ * microcontroller (dqn::HilDevice from DQNHil.h) over a serial port, and
+ * reports closed-loop survival, round-trip latency, send jitter and the
+ * device's tick time.
+ *
+ * Usage: hil_dqn (--port path | --loopback) [options]
+ *   --port path       Serial device of the controller (e.g. /dev/ttyUSB0)
+ *   --baud n          Line rate (default: 921600)
+ *   --loopback        Emulate the device in-process behind a pseudo-terminal
+ *                     with this build's model (DQN_MODEL_FILE)
+ *   --rate hz         Wall-clock tick rate (default: 1000)
+ *   --timestep s      Simulated time per tick (default: 0.02, the training
+ *                     timestep; 1 / rate runs in real time)
+ *   --steps n         Tick limit (default: 5000)
+ *   --start-angle rad Initial tilt (default: 0.05)
+ *   --timeout ms      Reply wait per tick (default: 20)
+ *   --seed n          Sensor drift seed (default: 1)
+ *   --no-pace         Send each state as soon as the last reply arrives
+ *   --csv file        Write one row per tick
+ *
+ * Exits 1 if the robot fell, a tick timed out or the link failed.
+ */
+
+#include DQN_MODEL_FILE
+
+#include <fcntl.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "HilBridge.h"
+
+namespace {
+
+/**
+ * The device end of a pseudo-terminal: a HilDevice on its own thread
+ */
+class LoopbackDevice {
+public:
+    LoopbackDevice() : master(-1), running(false) {}
+    ~LoopbackDevice() { stop(); }
+
+    /**
+     * @return Path of the terminal to open as the serial port, or nullptr
+     */
+    const char* start() {
+        master = posix_openpt(O_RDWR | O_NOCTTY);
+        if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) return nullptr;
+        const char* path = ptsname(master);
+        if (!path) return nullptr;
+        slavePath = path;
+        running = true;
+        worker = std::thread(&LoopbackDevice::run, this);
+        return slavePath.c_str();
+    }
+
+    void stop() {
+        running = false;
+        if (worker.joinable()) worker.join();
+        if (master >= 0) close(master);
+        master = -1;
+    }
+
+private:
+    void run() {
+        dqn::HilDevice<TwoWheelBotDQN> device;
+        while (running) {
+            fd_set readable;
+            FD_ZERO(&readable);
+            FD_SET(master, &readable);
+            timeval timeout = {0, 10000};
+            if (select(master + 1, &readable, nullptr, nullptr, &timeout) <= 0) continue;
+            uint8_t bytes[64];
+            const ssize_t n = read(master, bytes, sizeof(bytes));
+            for (ssize_t i = 0; i < n; i++) {
+                if (device.push(bytes[i]) && write(master, device.reply(), dqn::HIL_FRAME_SIZE) < 0) return;
+            }
+        }
+    }
+
+    int master;
+    std::string slavePath;
+    std::atomic<bool> running;
+    std::thread worker;
+};
+
+void printSummary(const char* name, const hil::Summary& summary, const char* units) {
+    std::printf("%-15s min %.1f, mean %.1f, p50 %.1f, p99 %.1f, max %.1f %s\n", name, summary.min, summary.mean,
+                summary.p50, summary.p99, summary.max, units);
+}
+
+int usage(const char* program) {
+    std::fprintf(stderr,
+                 "Usage: %s (--port path | --loopback) [--baud n] [--rate hz] [--timestep s] [--steps n]\n"
+                 "          [--start-angle rad] [--timeout ms] [--seed n] [--no-pace] [--csv file]\n",
+                 program);
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* portPath = nullptr;
+    const char* csvPath = nullptr;
+    bool loopback = false;
+    int baud = 921600;
+    double startAngle = 0.05;
+    uint64_t seed = 1;
+    dqn::RobotConfig config;
+    hil::HilOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--loopback") == 0) {
+            loopback = true;
+        } else if (std::strcmp(arg, "--no-pace") == 0) {
+            options.realTime = false;
+        } else if (std::strcmp(arg, "--port") == 0 && hasValue) {
+            portPath = argv[++i];
+        } else if (std::strcmp(arg, "--baud") == 0 && hasValue) {
+            baud = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--rate") == 0 && hasValue) {
+            options.rateHz = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--timestep") == 0 && hasValue) {
+            config.timestep = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--steps") == 0 && hasValue) {
+            options.steps = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--start-angle") == 0 && hasValue) {
+            startAngle = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--timeout") == 0 && hasValue) {
+            options.timeoutMillis = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--csv") == 0 && hasValue) {
+            csvPath = argv[++i];
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (loopback == (portPath != nullptr)) return usage(argv[0]);
+
+    LoopbackDevice device;
+    if (loopback && !(portPath = device.start())) {
+        std::fprintf(stderr, "Could not create a pseudo-terminal\n");
+        return 1;
+    }
+    hil::SerialPort port;
+    if (!port.open(portPath, baud)) {
+        std::fprintf(stderr, "Could not open %s at %d baud\n", portPath, baud);
+        return 1;
+    }
+    FILE* csv = csvPath ? std::fopen(csvPath, "w") : nullptr;
+    if (csvPath && !csv) {
+        std::fprintf(stderr, "Could not open %s\n", csvPath);
+        return 1;
+    }
+
+    dqn::BalancingRobot robot(config, seed);
+    robot.reset(dqn::RobotState(startAngle, 0.0));
+    std::vector<hil::HilTick> ticks;
+    ticks.reserve((size_t)std::max(options.steps, 0));
+    const hil::HilReport report = hil::runHil(port, robot, options, &ticks);
+    device.stop();
+
+    if (csv) {
+        std::fprintf(csv, "step,angle,angular_velocity,action,torque,latency_us,late_us,device_time\n");
+        for (size_t t = 0; t < ticks.size(); t++) {
+            const hil::HilTick& tick = ticks[t];
+            std::fprintf(csv, "%zu,%.9g,%.9g,%d,%.9g,%.1f,%.1f,%u\n", t, (double)tick.angle,
+                         (double)tick.angularVelocity, tick.action, (double)tick.torque, (double)tick.latencyMicros,
+                         (double)tick.lateMicros, tick.cycles);
+        }
+        std::fclose(csv);
+    }
+
+    const bool linkFailed = report.steps < options.steps && !report.failed;
+    std::printf("DQN hardware-in-the-loop (%s, %.0f Hz, %.3f s per tick%s)\n", loopback ? "loopback" : portPath,
+                options.rateHz, robot.config().timestep, options.realTime ? "" : ", unpaced");
+    std::printf("ticks %d, %s after %.2f s, mean |angle| %.4f rad, reward %.1f\n", report.steps,
+                report.failed ? "fell" : "upright", report.survivalSeconds, report.meanAbsAngle, report.totalReward);
+    std::printf("timeouts %d, missed deadlines %d, stale replies %d, skipped bytes %zu%s\n", report.timeouts,
+                report.missedDeadlines, report.staleReplies, report.skippedBytes, linkFailed ? ", link failed" : "");
+    printSummary("latency", report.latencyMicros, "us");
+    if (options.realTime) printSummary("jitter", report.jitterMicros, "us");
+    printSummary("device tick", report.deviceCycles, "device units");
+    return report.failed || report.timeouts > 0 || linkFailed ? 1 : 0;
+}
@@ -0,0 +1,392 @@
+/**
+ * Two-Wheel Balancing Robot Simulator
+ *
+ * Host-side port of src/physics/BalancingRobot.js for closed-loop testing
+ * of exported TwoWheelBotDQN models without the browser:
+ *
+ *   dqn::BalancingRobot robot(config, seed);
+ *   TwoWheelBotDQN policy;
+ *   dqn::EpisodeStats stats = dqn::runEpisode(robot, policy, 5000);
+ *
+ * - Same dynamics, parameter ranges and rewards as the JS simulator:
+ *   Euler integration of the inverted pendulum (gravity, damping, motor
+ *   reaction) and of the wheel base (motor force, ground friction), the
+ *   simple/complex/efficient/offset-adaptive rewards and the drifting
+ *   sensor angle offset
+ * - State is double precision like the JS numbers, so trajectories match
+ *   the browser to rounding; the policy still sees float inputs
+ * - Math.random is replaced by a seeded xorshift generator, so runs are
+ *   reproducible and independent simulators can run on separate threads
+ * - Nothing is allocated: a step only touches the robot object
+ *
+ * Training normalizes by the configured maxAngle and exports fold that
+ * limit into the policy's first layer, so a compiled policy sees the same
+ * inputs as the network it was trained from.
+ *
+ * Requires C++11.
+ */
+
+#ifndef DQN_BALANCING_ROBOT_H
+#define DQN_BALANCING_ROBOT_H
+
+#include <math.h>
+#include <stdint.h>
+
+#include "DQNPolicy.h"
+
+namespace dqn {
+
+static const double SIM_PI = 3.14159265358979323846;
+static const double SIM_GRAVITY = 9.81;
+// Largest sensor offset the simulator will drift to or be configured with
+static const double MAX_ANGLE_OFFSET = SIM_PI / 6.0;
+
+enum RewardType {
+    REWARD_SIMPLE,          // CartPole-style: 1 while upright, 0 on failure
+    REWARD_COMPLEX,         // Angle-proportional, -10 on failure
+    REWARD_EFFICIENT,       // Proportional with torque and chatter penalties
+    REWARD_OFFSET_ADAPTIVE  // True-angle reward with stability bonus
+};
+
+/**
+ * Robot parameters, defaulting to the BalancingRobot.js defaults
+ * Out-of-range values are clamped to the same ranges as the simulator.
+ */
+struct RobotConfig {
+    double mass;                 // kg (0.5 - 3.0)
+    double centerOfMassHeight;   // m (0.2 - 1.0)
+    double motorStrength;        // Maximum motor torque in N⋅m (2 - 20)
+    double friction;             // Ground friction coefficient (0 - 1)
+    double damping;              // Angular damping coefficient (0 - 1)
+    double timestep;             // s (0.001 - 0.1)
+    double wheelRadius;          // m (0.02 - 0.20)
+    double wheelMass;            // kg (0.1 - 1.0)
+    double wheelFriction;        // (0 - 1)
+    double maxAngle;             // Failure angle in radians (π/180 - π/3)
+    double motorTorqueRange;     // Torque per unit action in N⋅m (0.5 - 10)
+    RewardType rewardType;
+    double angleOffset;          // Initial sensor offset in radians (±π/6)
+    double offsetVariation;      // Offset noise amplitude (0 - 0.1)
+    double offsetChangeRate;     // Offset drift rate (0 - 0.01)
+    double trainingOffsetRange;  // Random offset per reset for offset-adaptive (0 - π/6)
+
+    RobotConfig()
+        : mass(1.0), centerOfMassHeight(0.4), motorStrength(5.0), friction(0.02), damping(0.01),
+          timestep(0.02), wheelRadius(0.12), wheelMass(0.2), wheelFriction(0.3), maxAngle(SIM_PI / 3.0),
+          motorTorqueRange(8.0), rewardType(REWARD_SIMPLE), angleOffset(0.0), offsetVariation(0.01),
+          offsetChangeRate(0.001), trainingOffsetRange(0.0) {}
+};
+
+struct RobotState {
+    double angle;            // Tilt in radians (0 = upright, positive = forward)
+    double angularVelocity;  // rad/s
+    double position;         // m
+    double velocity;         // m/s
+    double wheelAngle;       // rad
+    double wheelVelocity;    // rad/s
+
+    RobotState(double angle = 0.0, double angularVelocity = 0.0, double position = 0.0, double velocity = 0.0)
+        : angle(angle), angularVelocity(angularVelocity), position(position), velocity(velocity),
+          wheelAngle(0.0), wheelVelocity(0.0) {}
+};
+
+struct StepResult {
+    double reward;
+    bool done;
+};
+
+static inline double clampRange(double value, double min, double max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+/**
+ * Clamp every parameter to the simulator's range (_validateParameter)
+ */
+static inline RobotConfig clampConfig(const RobotConfig& config) {
+    RobotConfig cfg = config;
+    cfg.mass = clampRange(cfg.mass, 0.5, 3.0);
+    cfg.centerOfMassHeight = clampRange(cfg.centerOfMassHeight, 0.2, 1.0);
+    cfg.motorStrength = clampRange(cfg.motorStrength, 2.0, 20.0);
+    cfg.friction = clampRange(cfg.friction, 0.0, 1.0);
+    cfg.damping = clampRange(cfg.damping, 0.0, 1.0);
+    cfg.timestep = clampRange(cfg.timestep, 0.001, 0.1);
+    cfg.wheelRadius = clampRange(cfg.wheelRadius, 0.02, 0.20);
+    cfg.wheelMass = clampRange(cfg.wheelMass, 0.1, 1.0);
+    cfg.wheelFriction = clampRange(cfg.wheelFriction, 0.0, 1.0);
+    cfg.maxAngle = clampRange(cfg.maxAngle, SIM_PI / 180.0, SIM_PI / 3.0);
+    cfg.motorTorqueRange = clampRange(cfg.motorTorqueRange, 0.5, 10.0);
+    cfg.angleOffset = clampRange(cfg.angleOffset, -MAX_ANGLE_OFFSET, MAX_ANGLE_OFFSET);
+    cfg.offsetVariation = clampRange(cfg.offsetVariation, 0.0, 0.1);
+    cfg.offsetChangeRate = clampRange(cfg.offsetChangeRate, 0.0, 0.01);
+    cfg.trainingOffsetRange = clampRange(cfg.trainingOffsetRange, 0.0, MAX_ANGLE_OFFSET);
+    return cfg;
+}
+
+/**
+ * Reward for the state after a step (_calculateReward)
+ * @param angle True angle after the step
+ * @param angularVelocity Angular velocity after the step
+ * @param motorTorque Applied torque in N⋅m
+ * @param previousMotorTorque Torque applied the step before
+ */
+static inline double stepReward(const RobotConfig& cfg, double angle, double angularVelocity, double motorTorque,
+                                double previousMotorTorque) {
+    const bool failed = fabs(angle) > cfg.maxAngle;
+    if (cfg.rewardType == REWARD_SIMPLE) return failed ? 0.0 : 1.0;
+    if (failed) return -10.0;
+
+    const double uprightReward = 1.0 - fabs(angle) / cfg.maxAngle;
+    if (cfg.rewardType == REWARD_COMPLEX) return uprightReward;
+
+    if (cfg.rewardType == REWARD_EFFICIENT) {
+        const double maxTorque = cfg.motorStrength;
+        const double torquePenalty = 0.1 * (fabs(motorTorque) / maxTorque);
+        const double torqueChange = fabs(motorTorque - previousMotorTorque);
+        const double chatterPenalty = 0.05 * (torqueChange / maxTorque);
+        const double smoothnessBonus = torqueChange < 0.1 * maxTorque ? 0.02 : 0.0;
+        const double reward = uprightReward - torquePenalty - chatterPenalty + smoothnessBonus;
+        if (!isfinite(reward)) return uprightReward;
+        return reward > -1.0 ? reward : -1.0;
+    }
+
+    // Offset-adaptive: true angle (not the measured one) plus stability
+    // and persistence bonuses
+    const double maxStableVelocity = 3.0;
+    const double stability = 0.2 * (1.0 - fabs(angularVelocity) / maxStableVelocity);
+    const double stabilityBonus = stability > 0.0 ? stability : 0.0;
+    const double persistenceBonus = 0.1;
+    const double reward = uprightReward + stabilityBonus + persistenceBonus;
+    return reward > -1.0 ? reward : -1.0;
+}
+
+/**
+ * xorshift64 generator standing in for Math.random
+ */
+class XorShift64 {
+public:
+    explicit XorShift64(uint64_t seed = 1) { setSeed(seed); }
+
+    void setSeed(uint64_t seed) {
+        // Zero is the one state xorshift never leaves
+        state = seed != 0 ? seed : 0x9E3779B97F4A7C15ull;
+    }
+
+    uint64_t nextBits() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    /**
+     * @return Uniform double in [0, 1)
+     */
+    double next() {
+        return (double)(nextBits() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    uint64_t state;
+};
+
+/**
+ * Physics simulation for a two-wheel balancing robot
+ */
+class BalancingRobot {
+public:
+    /**
+     * @param config Robot parameters (clamped to the simulator's ranges)
+     * @param seed Seed for the offset drift and training offsets
+     */
+    explicit BalancingRobot(const RobotConfig& config = RobotConfig(), uint64_t seed = 1)
+        : random(seed), currentMotorTorque(0.0), previousMotorTorque(0.0), stepCount(0), totalReward(0.0) {
+        configure(config);
+        angleOffset = cfg.angleOffset;
+    }
+
+    /**
+     * Replace the robot parameters (updateConfig); the state is kept
+     */
+    void configure(const RobotConfig& config) {
+        cfg = clampConfig(config);
+        momentOfInertia = cfg.mass * cfg.centerOfMassHeight * cfg.centerOfMassHeight;
+    }
+
+    /**
+     * Reset the robot to an initial state
+     * Offset-adaptive robots with a training offset range draw a new
+     * sensor offset, as in the simulator.
+     */
+    void reset(const RobotState& initial = RobotState()) {
+        current = initial;
+        current.angle = normalizeAngle(initial.angle);
+        currentMotorTorque = 0.0;
+        previousMotorTorque = 0.0;
+        stepCount = 0;
+        totalReward = 0.0;
+
+        if (cfg.rewardType == REWARD_OFFSET_ADAPTIVE && cfg.trainingOffsetRange > 0.0) {
+            angleOffset = (random.next() - 0.5) * 2.0 * cfg.trainingOffsetRange;
+        }
+    }
+
+    /**
+     * Apply a motor command and advance one timestep
+     * @param motorTorque Action torque (-1.0 to 1.0), scaled by motorTorqueRange
+     *                    and clamped to ±motorStrength
+     */
+    StepResult step(double motorTorque) {
+        StepResult result;
+        if (hasFailed()) {
+            result.reward = cfg.rewardType == REWARD_SIMPLE ? 0.0 : -10.0;
+            result.done = true;
+            return result;
+        }
+
+        previousMotorTorque = currentMotorTorque;
+        currentMotorTorque = clampRange(motorTorque * cfg.motorTorqueRange, -cfg.motorStrength, cfg.motorStrength);
+
+        updatePhysics();
+        current.angle = normalizeAngle(current.angle);
+
+        result.reward = stepReward(cfg, current.angle, current.angularVelocity, currentMotorTorque, previousMotorTorque);
+        totalReward += result.reward;
+        result.done = hasFailed();
+        stepCount++;
+        return result;
+    }
+
+    /**
+     * Sensor reading: true angle plus the simulated offset
+     */
+    double measuredAngle() const { return current.angle + angleOffset; }
+
+    /**
+     * Single-timestep network inputs as BalancingRobot.getNormalizedInputs
+     * computes them (measured angle over maxAngle, angular velocity over 10)
+     * @param inputs Output [2]
+     */
+    void normalizedInputs(float* inputs) const {
+        inputs[0] = (float)clampRange(measuredAngle() / cfg.maxAngle, -1.0, 1.0);
+        inputs[1] = (float)clampRange(current.angularVelocity / 10.0, -1.0, 1.0);
+    }
+
+    bool hasFailed() const { return fabs(current.angle) > cfg.maxAngle; }
+
+    /**
+     * @return False once any state value is NaN or infinite
+     */
+    bool isStable() const {
+        return isfinite(current.angle) && isfinite(current.angularVelocity) && isfinite(current.position) &&
+               isfinite(current.velocity) && isfinite(currentMotorTorque);
+    }
+
+    const RobotState& state() const { return current; }
+    const RobotConfig& config() const { return cfg; }
+    double getAngleOffset() const { return angleOffset; }
+    void setAngleOffset(double offset) { angleOffset = clampRange(offset, -MAX_ANGLE_OFFSET, MAX_ANGLE_OFFSET); }
+    double getMotorTorque() const { return currentMotorTorque; }
+    int getStepCount() const { return stepCount; }
+    double getTotalReward() const { return totalReward; }
+    double simulationTime() const { return stepCount * cfg.timestep; }
+    void setSeed(uint64_t seed) { random.setSeed(seed); }
+
+    static double normalizeAngle(double angle) {
+        while (angle > SIM_PI) angle -= 2.0 * SIM_PI;
+        while (angle < -SIM_PI) angle += 2.0 * SIM_PI;
+        return angle;
+    }
+
+private:
+    void updatePhysics() {
+        const double dt = cfg.timestep;
+
+        // Motor torque acts on the wheels; the pendulum gets the reaction
+        const double gravityTorque = cfg.mass * SIM_GRAVITY * cfg.centerOfMassHeight * sin(current.angle);
+        const double dampingTorque = -cfg.damping * current.angularVelocity;
+        const double pendulumTorque = -currentMotorTorque + gravityTorque + dampingTorque;
+
+        const double angularAcceleration = pendulumTorque / momentOfInertia;
+        current.angularVelocity += angularAcceleration * dt;
+        current.angle += current.angularVelocity * dt;
+
+        // Wheel base: motor force against ground friction
+        const double motorForce = currentMotorTorque / cfg.wheelRadius;
+        const double normalForce = cfg.mass * SIM_GRAVITY;
+        const double frictionForce = -cfg.friction * current.velocity * normalForce;
+        const double horizontalAcceleration = (motorForce + frictionForce) / cfg.mass;
+        current.velocity += horizontalAcceleration * dt;
+        current.position += current.velocity * dt;
+
+        // Rolling without slip
+        current.wheelAngle += current.velocity * dt / cfg.wheelRadius;
+        while (current.wheelAngle > SIM_PI * 2.0) current.wheelAngle -= SIM_PI * 2.0;
+        while (current.wheelAngle < -SIM_PI * 2.0) current.wheelAngle += SIM_PI * 2.0;
+        current.wheelVelocity = current.velocity / cfg.wheelRadius;
+
+        updateAngleOffset(dt);
+    }
+
+    /**
+     * Slow sensor drift plus measurement noise, clamped to ±π/6
+     */
+    void updateAngleOffset(double dt) {
+        angleOffset += (random.next() - 0.5) * cfg.offsetChangeRate * dt;
+        angleOffset += (random.next() - 0.5) * cfg.offsetVariation * dt;
+        angleOffset = clampRange(angleOffset, -MAX_ANGLE_OFFSET, MAX_ANGLE_OFFSET);
+    }
+
+    RobotConfig cfg;
+    RobotState current;
+    XorShift64 random;
+    double momentOfInertia;
+    double angleOffset;
+    double currentMotorTorque;
+    double previousMotorTorque;
+    int stepCount;
+    double totalReward;
+};
+
+struct EpisodeStats {
+    int steps;           // Steps taken before failure or maxSteps
+    bool failed;         // True if the robot fell
+    double totalReward;
+    double meanAbsAngle; // Mean |true angle| over the episode in radians
+    double energy;       // Motor work sum(|torque * wheel velocity| * dt) in J
+};
+
+/**
+ * Run one closed-loop episode of an exported policy on the simulator
+ *
+ * The policy (TwoWheelBotDQN or TwoWheelBotDQNInt8) reads the measured
+ * angle and angular velocity every tick, and its torque for the chosen
+ * action drives the next step. The robot should already be reset; the
+ * policy's history is reset from the robot's current state.
+ * @param maxSteps Episode length limit
+ */
+template <typename Policy>
+EpisodeStats runEpisode(BalancingRobot& robot, Policy& policy, int maxSteps) {
+    EpisodeStats stats = {0, false, 0.0, 0.0, 0.0};
+    double angleSum = 0.0;
+    policy.reset((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+
+    while (stats.steps < maxSteps) {
+        const int action = policy.getAction((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+        const StepResult result = robot.step((double)policy.getMotorTorque(action));
+        stats.totalReward += result.reward;
+        angleSum += fabs(robot.state().angle);
+        stats.energy += fabs(robot.getMotorTorque() * robot.state().wheelVelocity) * robot.config().timestep;
+        stats.steps++;
+        if (result.done) {
+            stats.failed = true;
+            break;
+        }
+    }
+
+    stats.meanAbsAngle = stats.steps > 0 ? angleSum / stats.steps : 0.0;
+    return stats;
+}
+
+} // namespace dqn
+
+#endif // DQN_BALANCING_ROBOT_H
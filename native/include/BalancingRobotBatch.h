@@ -0,0 +1,297 @@
+/**
+ * Two-Wheel Balancing Robot Simulator, N robots per step
+ *
+ * Structure-of-arrays version of dqn::BalancingRobot for sweeps and
+ * throughput runs: state and physical parameters of N robots live in
+ * contiguous arrays, one step advances all of them, and a policy step
+ * scores every robot with a single batched getActions call:
+ *
+ *   static dqn::BalancingRobotBatch<256> robots(config, seed);
+ *   for (int lane = 0; lane < 256; lane++) robots.reset(lane, dqn::RobotState(startAngles[lane]));
+ *   robots.runEpisodes(policy, 5000);
+ *
+ * - Each lane has its own RobotConfig, so one batch can cover a grid of
+ *   mass / centerOfMassHeight / motorStrength values
+ * - Lane i follows exactly the trajectory of a BalancingRobot built with
+ *   the same config and laneSeed(seed, i): same expressions in the same
+ *   order, with its own xorshift stream
+ * - The dynamics pass is branch-free over plain arrays (fallen robots are
+ *   frozen by a zero timestep), so the compiler vectorizes it; sin(), the
+ *   offset RNG and the rewards run in separate per-lane passes
+ * - Nothing is allocated; the batch is a few hundred bytes per lane, so
+ *   make large batches static or allocate them once
+ *
+ * Policy steps need a single-timestep model (INPUT_SIZE = 2), since
+ * getActions scores independent states without history.
+ *
+ * Requires C++11.
+ */
+
+#ifndef DQN_BALANCING_ROBOT_BATCH_H
+#define DQN_BALANCING_ROBOT_BATCH_H
+
+#include "BalancingRobot.h"
+
+namespace dqn {
+
+template <int N>
+class BalancingRobotBatch {
+public:
+    static const int SIZE = N;
+
+    static_assert(N > 0, "batch needs at least one robot");
+
+    /**
+     * @param config Parameters for every lane (clamped to the simulator's ranges)
+     * @param seed Base seed; lane i draws from laneSeed(seed, i)
+     */
+    explicit BalancingRobotBatch(const RobotConfig& config = RobotConfig(), uint64_t seed = 1) {
+        for (int i = 0; i < N; i++) {
+            configure(i, config);
+            random[i].setSeed(laneSeed(seed, i));
+            offset[i] = configs[i].angleOffset;
+            reset(i);
+        }
+    }
+
+    /**
+     * Seed that makes a scalar BalancingRobot reproduce lane i
+     */
+    static uint64_t laneSeed(uint64_t seed, int lane) { return seed + (uint64_t)lane * 0x9E3779B97F4A7C15ull; }
+
+    /**
+     * Replace one lane's parameters (updateConfig); its state is kept
+     */
+    void configure(int lane, const RobotConfig& config) {
+        const RobotConfig cfg = clampConfig(config);
+        configs[lane] = cfg;
+        mass[lane] = cfg.mass;
+        height[lane] = cfg.centerOfMassHeight;
+        motorStrength[lane] = cfg.motorStrength;
+        friction[lane] = cfg.friction;
+        damping[lane] = cfg.damping;
+        timestep[lane] = cfg.timestep;
+        wheelRadius[lane] = cfg.wheelRadius;
+        maxAngle[lane] = cfg.maxAngle;
+        torqueRange[lane] = cfg.motorTorqueRange;
+        inertia[lane] = cfg.mass * cfg.centerOfMassHeight * cfg.centerOfMassHeight;
+    }
+
+    /**
+     * Reset one lane (BalancingRobot::reset)
+     */
+    void reset(int lane, const RobotState& initial = RobotState()) {
+        angle[lane] = BalancingRobot::normalizeAngle(initial.angle);
+        angularVelocity[lane] = initial.angularVelocity;
+        position[lane] = initial.position;
+        velocity[lane] = initial.velocity;
+        wheelAngle[lane] = initial.wheelAngle;
+        motorTorque[lane] = 0.0;
+        previousMotorTorque[lane] = 0.0;
+        reward[lane] = 0.0;
+        totalReward[lane] = 0.0;
+        absAngleSum[lane] = 0.0;
+        energy[lane] = 0.0;
+        stepCount[lane] = 0;
+        done[lane] = hasFailed(lane);
+
+        const RobotConfig& cfg = configs[lane];
+        if (cfg.rewardType == REWARD_OFFSET_ADAPTIVE && cfg.trainingOffsetRange > 0.0) {
+            offset[lane] = (random[lane].next() - 0.5) * 2.0 * cfg.trainingOffsetRange;
+        }
+    }
+
+    void resetAll(const RobotState& initial = RobotState()) {
+        for (int i = 0; i < N; i++) reset(i, initial);
+    }
+
+    /**
+     * Advance every lane one timestep
+     * Fallen lanes keep their state and report the failure reward, like
+     * BalancingRobot::step.
+     * @param motorTorques Action torque per lane (-1.0 to 1.0) [N]
+     */
+    void step(const double* motorTorques) {
+        for (int i = 0; i < N; i++) {
+            live[i] = fabs(angle[i]) > maxAngle[i] ? 0.0 : 1.0;
+            sinAngle[i] = sin(angle[i]);
+        }
+
+        // Fallen lanes integrate over a zero timestep and keep their torque,
+        // so the loop has no branches; live lanes are bit-identical to
+        // BalancingRobot::step (x * 1.0 + y * 0.0 == x for finite values)
+        for (int i = 0; i < N; i++) {
+            const double dt = timestep[i] * live[i];
+            double torque = motorTorques[i] * torqueRange[i];
+            torque = torque < -motorStrength[i] ? -motorStrength[i] : torque;
+            torque = torque > motorStrength[i] ? motorStrength[i] : torque;
+            torque = torque * live[i] + motorTorque[i] * (1.0 - live[i]);
+
+            const double gravityTorque = mass[i] * SIM_GRAVITY * height[i] * sinAngle[i];
+            const double dampingTorque = -damping[i] * angularVelocity[i];
+            const double pendulumTorque = -torque + gravityTorque + dampingTorque;
+            const double angularAcceleration = pendulumTorque / inertia[i];
+            angularVelocity[i] += angularAcceleration * dt;
+            angle[i] += angularVelocity[i] * dt;
+
+            const double motorForce = torque / wheelRadius[i];
+            const double normalForce = mass[i] * SIM_GRAVITY;
+            const double frictionForce = -friction[i] * velocity[i] * normalForce;
+            const double horizontalAcceleration = (motorForce + frictionForce) / mass[i];
+            velocity[i] += horizontalAcceleration * dt;
+            position[i] += velocity[i] * dt;
+            wheelAngle[i] += velocity[i] * dt / wheelRadius[i];
+
+            previousMotorTorque[i] = motorTorque[i] * live[i] + previousMotorTorque[i] * (1.0 - live[i]);
+            motorTorque[i] = torque;
+        }
+
+        for (int i = 0; i < N; i++) {
+            const RobotConfig& cfg = configs[i];
+            if (live[i] == 0.0) {
+                reward[i] = cfg.rewardType == REWARD_SIMPLE ? 0.0 : -10.0;
+                done[i] = 1;
+                continue;
+            }
+
+            while (wheelAngle[i] > SIM_PI * 2.0) wheelAngle[i] -= SIM_PI * 2.0;
+            while (wheelAngle[i] < -SIM_PI * 2.0) wheelAngle[i] += SIM_PI * 2.0;
+
+            // Sensor drift and noise, drawn in the scalar robot's order
+            offset[i] += (random[i].next() - 0.5) * cfg.offsetChangeRate * timestep[i];
+            offset[i] += (random[i].next() - 0.5) * cfg.offsetVariation * timestep[i];
+            offset[i] = clampRange(offset[i], -MAX_ANGLE_OFFSET, MAX_ANGLE_OFFSET);
+
+            angle[i] = BalancingRobot::normalizeAngle(angle[i]);
+            reward[i] = stepReward(cfg, angle[i], angularVelocity[i], motorTorque[i], previousMotorTorque[i]);
+            totalReward[i] += reward[i];
+            absAngleSum[i] += fabs(angle[i]);
+            energy[i] += fabs(motorTorque[i] * (velocity[i] / wheelRadius[i])) * timestep[i];
+            done[i] = hasFailed(i);
+            stepCount[i]++;
+        }
+    }
+
+    /**
+     * One closed-loop tick: every lane's measured angle and angular
+     * velocity go through one getActions call, and the chosen actions'
+     * torques drive step()
+     */
+    template <typename Policy>
+    void stepPolicy(const Policy& policy) {
+        for (int i = 0; i < N; i++) {
+            observedAngles[i] = (float)(angle[i] + offset[i]);
+            observedVelocities[i] = (float)angularVelocity[i];
+        }
+        policy.getActions(observedAngles, observedVelocities, actions, N);
+        for (int i = 0; i < N; i++) commands[i] = (double)policy.getMotorTorque(actions[i]);
+        step(commands);
+    }
+
+    /**
+     * Step the policy until every lane has fallen or maxSteps have run
+     * Lanes should already be reset.
+     * @return Steps taken by the longest-surviving lane
+     */
+    template <typename Policy>
+    int runEpisodes(const Policy& policy, int maxSteps) {
+        int steps = 0;
+        while (steps < maxSteps && !allDone()) {
+            stepPolicy(policy);
+            steps++;
+        }
+        return steps;
+    }
+
+    bool allDone() const {
+        for (int i = 0; i < N; i++) {
+            if (!done[i]) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Episode summary for one lane, as runEpisode reports it
+     */
+    EpisodeStats stats(int lane) const {
+        EpisodeStats s;
+        s.steps = stepCount[lane];
+        s.failed = done[lane] != 0;
+        s.totalReward = totalReward[lane];
+        s.meanAbsAngle = stepCount[lane] > 0 ? absAngleSum[lane] / stepCount[lane] : 0.0;
+        s.energy = energy[lane];
+        return s;
+    }
+
+    bool hasFailed(int lane) const { return fabs(angle[lane]) > maxAngle[lane]; }
+    double measuredAngle(int lane) const { return angle[lane] + offset[lane]; }
+
+    RobotState state(int lane) const {
+        RobotState s(angle[lane], angularVelocity[lane], position[lane], velocity[lane]);
+        s.wheelAngle = wheelAngle[lane];
+        s.wheelVelocity = velocity[lane] / wheelRadius[lane];
+        return s;
+    }
+
+    const RobotConfig& config(int lane) const { return configs[lane]; }
+    double getAngleOffset(int lane) const { return offset[lane]; }
+    double getMotorTorque(int lane) const { return motorTorque[lane]; }
+    double getReward(int lane) const { return reward[lane]; }
+    bool isDone(int lane) const { return done[lane] != 0; }
+    int getStepCount(int lane) const { return stepCount[lane]; }
+    double getTotalReward(int lane) const { return totalReward[lane]; }
+
+    // Contiguous per-lane state [N]
+    const double* angles() const { return angle; }
+    const double* angularVelocities() const { return angularVelocity; }
+    const double* positions() const { return position; }
+    const double* velocities() const { return velocity; }
+    const double* rewards() const { return reward; }
+    const int* lastActions() const { return actions; }
+
+private:
+    // State
+    double angle[N];
+    double angularVelocity[N];
+    double position[N];
+    double velocity[N];
+    double wheelAngle[N];
+    double offset[N];
+    double motorTorque[N];
+    double previousMotorTorque[N];
+
+    // Physical parameters
+    double mass[N];
+    double height[N];
+    double motorStrength[N];
+    double friction[N];
+    double damping[N];
+    double timestep[N];
+    double wheelRadius[N];
+    double maxAngle[N];
+    double torqueRange[N];
+    double inertia[N];
+
+    // Per-step results and episode totals
+    double reward[N];
+    double totalReward[N];
+    double absAngleSum[N];
+    double energy[N];
+    int stepCount[N];
+    uint8_t done[N];
+
+    // Scratch for one step
+    double live[N];  // 1.0 for lanes still balancing, 0.0 once fallen
+    double sinAngle[N];
+    double commands[N];
+    float observedAngles[N];
+    float observedVelocities[N];
+    int actions[N];
+
+    RobotConfig configs[N];
+    XorShift64 random[N];
+};
+
+} // namespace dqn
+
+#endif // DQN_BALANCING_ROBOT_BATCH_H
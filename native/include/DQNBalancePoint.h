@@ -0,0 +1,170 @@
+/**
+ * Two-Wheel Balancing Robot DQN Balance-Point Estimator
+ *
+ * On-device port of the simulator's balance-point estimate
+ * (BalancingRobot._updateBalancePointEstimate), so a robot with a
+ * mis-mounted IMU feeds its policy the angle it was trained on instead of
+ * leaning against the offset and driving off:
+ *
+ *   static dqn::BalancePointPolicy<TwoWheelBotDQN> bot;  // Drop-in for TwoWheelBotDQN
+ *   int action = bot.getAction(angle, angularVelocity);
+ *
+ *   // Persist the calibration (NVS, EEPROM) and restore it at boot
+ *   bot.estimator().restore(savedEstimate, savedConfidence);
+ *
+ * - Same EMA and confidence as the simulator: rate 0.02 per tick below
+ *   1 rad/s, confidence +0.001 per steady tick and -0.002 per unsteady one,
+ *   the estimate clamped to ±maxAngle / 2. Run it at the policy's tick rate
+ * - The simulator averages the measured angle. A robot that holds a lean
+ *   does so with a sustained motor torque, and once that average feeds back
+ *   into the policy's input the lean grows with it, so here the steady
+ *   samples are the measured angle minus the lean the mean torque holds
+ *   (leanPerTorque × mean action torque, small-angle pendulum balance).
+ *   That difference is the sensor offset whatever the policy does, so the
+ *   correction cannot run away
+ * - The policy sees angle - confidence × estimate, so a fresh estimator
+ *   changes nothing and the correction fades in over the first 1000
+ *   steady ticks (20 s at 50 Hz) and fades out while the robot is upset
+ * - Constant time and allocation-free: three multiply-adds, a compare and
+ *   two clamps per tick
+ */
+
+#ifndef DQN_BALANCE_POINT_H
+#define DQN_BALANCE_POINT_H
+
+#include "DQNPolicy.h"
+
+namespace dqn {
+
+// BalancingRobot.js adaptationRate and the confidence steps of _updateBalancePointEstimate
+static constexpr float BALANCE_ADAPTATION_RATE = 0.02f;   // EMA weight of each steady tick
+static constexpr float BALANCE_STEADY_RATE = 1.0f;        // |angular velocity| below this is steady, rad/s
+static constexpr float BALANCE_CONFIDENCE_GAIN = 0.001f;  // Per steady tick
+static constexpr float BALANCE_CONFIDENCE_DECAY = 0.002f; // Per unsteady tick
+
+/**
+ * Lean angle per unit of action torque: rad held by a sustained
+ * getMotorTorque() of 1, for BalancePointEstimator's leanPerTorque
+ * @param torquePerAction N⋅m per unit action (motorTorqueRange, at most motorStrength)
+ * @param mass Robot mass in kg
+ * @param centerOfMassHeight Height of the center of mass above the axle in m
+ */
+inline float balanceLeanPerTorque(float torquePerAction, float mass, float centerOfMassHeight) {
+    return torquePerAction / (mass * 9.81f * centerOfMassHeight);
+}
+
+class BalancePointEstimator {
+public:
+    /**
+     * @param maxAngle The policy's training maxAngle; the estimate stays within half of it
+     * @param leanPerTorque balanceLeanPerTorque() of the robot (default: the
+     *                      simulator's default robot, 5 N⋅m on 1 kg at 0.4 m)
+     */
+    explicit BalancePointEstimator(float maxAngle = 1.04719755f, float leanPerTorque = 1.27420998f)
+        : limit(0.5f * maxAngle), lean(leanPerTorque), meanTorque(0.0f), balancePoint(0.0f), trust(0.0f) {}
+
+    /**
+     * Fold one tick's measurement into the estimate
+     * @param torque Action torque (getMotorTorque) driving the robot into this tick
+     */
+    void update(float measuredAngle, float angularVelocity, float torque) {
+        meanTorque = (1.0f - BALANCE_ADAPTATION_RATE) * meanTorque + BALANCE_ADAPTATION_RATE * torque;
+        const bool steady = angularVelocity < BALANCE_STEADY_RATE && angularVelocity > -BALANCE_STEADY_RATE;
+        if (steady) {
+            const float balanceAngle = measuredAngle - lean * meanTorque;
+            balancePoint = (1.0f - BALANCE_ADAPTATION_RATE) * balancePoint + BALANCE_ADAPTATION_RATE * balanceAngle;
+            trust = constrain(trust + BALANCE_CONFIDENCE_GAIN, 0.0f, 1.0f);
+        } else {
+            trust = constrain(trust - BALANCE_CONFIDENCE_DECAY, 0.0f, 1.0f);
+        }
+        balancePoint = constrain(balancePoint, -limit, limit);
+    }
+
+    /**
+     * The measured angle with the confidence-weighted offset removed
+     */
+    float correct(float measuredAngle) const { return measuredAngle - trust * balancePoint; }
+
+    /**
+     * Start over from no estimate (e.g. after remounting the IMU)
+     */
+    void clear() {
+        meanTorque = 0.0f;
+        balancePoint = 0.0f;
+        trust = 0.0f;
+    }
+
+    /**
+     * Load a saved estimate (clamped to the valid ranges)
+     */
+    void restore(float estimate, float confidence) {
+        balancePoint = constrain(estimate, -limit, limit);
+        trust = constrain(confidence, 0.0f, 1.0f);
+    }
+
+    float estimate() const { return balancePoint; }
+    float confidence() const { return trust; }
+
+private:
+    float limit;
+    float lean;
+    float meanTorque;  // EMA of the action torque over every tick
+    float balancePoint;
+    float trust;
+};
+
+/**
+ * A policy fed offset-corrected angles
+ * Drop-in for the wrapped policy's reset/getAction/forward/getMotorTorque.
+ * The estimate is kept across reset(), since the mounting offset does not
+ * change when balancing restarts.
+ * @tparam Policy Any export (float, int8, lookup, blob, ...)
+ */
+template <typename Policy>
+class BalancePointPolicy {
+public:
+    /**
+     * @param maxAngle, leanPerTorque As BalancePointEstimator
+     */
+    explicit BalancePointPolicy(float maxAngle = 1.04719755f, float leanPerTorque = 1.27420998f)
+        : balance(maxAngle, leanPerTorque), torque(0.0f) {}
+
+    void reset(float angle, float angularVelocity) {
+        policy.reset(balance.correct(angle), angularVelocity);
+        torque = 0.0f;
+    }
+
+    /**
+     * Update the estimate, then run the policy on the corrected angle
+     * @param qValues Output Q-values, as the wrapped policy's forward()
+     */
+    template <typename T>
+    int forward(float angle, float angularVelocity, T* qValues) {
+        balance.update(angle, angularVelocity, torque);
+        const int action = policy.forward(balance.correct(angle), angularVelocity, qValues);
+        torque = policy.getMotorTorque(action);
+        return action;
+    }
+
+    int getAction(float angle, float angularVelocity) {
+        balance.update(angle, angularVelocity, torque);
+        const int action = policy.getAction(balance.correct(angle), angularVelocity);
+        torque = policy.getMotorTorque(action);
+        return action;
+    }
+
+    float getMotorTorque(int action) const { return policy.getMotorTorque(action); }
+
+    BalancePointEstimator& estimator() { return balance; }
+    const BalancePointEstimator& estimator() const { return balance; }
+    Policy& wrapped() { return policy; }
+
+private:
+    Policy policy;
+    BalancePointEstimator balance;
+    float torque;  // Previous tick's action torque
+};
+
+} // namespace dqn
+
+#endif // DQN_BALANCE_POINT_H
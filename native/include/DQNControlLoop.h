@@ -0,0 +1,309 @@
+/**
+ * Two-Wheel Balancing Robot DQN Control Loop
+ *
+ * Fixed-rate loop around an exported policy. Each tick reads the IMU,
+ * estimates the angle with a complementary filter, runs the policy and
+ * writes getMotorTorque(action) to the motor driver. The board supplies a
+ * Hardware type:
+ *
+ *   struct Hardware {
+ *       uint32_t micros();                      // Monotonic microseconds (wraps)
+ *       bool readImu(dqn::ImuSample& sample);   // False on a bus error
+ *       void setMotorTorque(float torque);      // Action torque, -1 to 1
+ *   };
+ *
+ *   static TwoWheelBotDQN bot;
+ *   static Hardware hardware;
+ *   static dqn::ControlLoop<TwoWheelBotDQN, Hardware> loop(bot, hardware, dqn::ControlLoopConfig(50.0f));
+ *
+ *   // Arduino: start() in setup(), then poll from loop(); a tick runs when one is due
+ *   loop.start();
+ *   loop.poll();
+ *
+ *   // ESP32: a FreeRTOS task woken by a periodic esp_timer, pinned to a core
+ *   static dqn::ControlTask<dqn::ControlLoop<TwoWheelBotDQN, Hardware> > task(loop);
+ *   task.start(20, 1);  // priority, core
+ *
+ * - The rate is 1 - 1000 Hz; the default 50 Hz is the simulator's
+ *   timestep = 0.02, which is what the exported policies were trained at
+ * - The filter integrates the gyro rate and pulls the estimate towards the
+ *   accelerometer angle atan2(accelX, accelZ) with the configured time
+ *   constant. Mount or map the IMU so that angle has the simulator's sign.
+ *   The policy's angular velocity is the gyro rate
+ * - Ticks are scheduled on fixed deadlines. A tick that starts a whole
+ *   period late skips the missed deadlines (missedTicks) rather than
+ *   running them back to back, and a tick that ends after its next
+ *   deadline counts as an overrun. Latency is measured from the IMU read
+ *   to the motor write
+ * - A failed IMU read sets the torque to 0 and counts a sensor fault; the
+ *   policy does not run on that tick
+ */
+
+#ifndef DQN_CONTROL_LOOP_H
+#define DQN_CONTROL_LOOP_H
+
+#include <math.h>
+#include <stdint.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace dqn {
+
+/**
+ * One IMU reading: pitch rate and the accelerometer's gravity components
+ */
+struct ImuSample {
+    float gyroRate;  // rad/s, positive as the angle grows
+    float accelX;    // Along the direction of travel, any unit
+    float accelZ;    // Up when the robot is upright, same unit
+};
+
+struct ControlLoopConfig {
+    float rateHz;              // Tick rate, clamped to 1 - 1000 Hz
+    float filterTimeConstant;  // Complementary filter crossover in seconds
+
+    explicit ControlLoopConfig(float rateHz = 50.0f, float filterTimeConstant = 0.5f)
+        : rateHz(rateHz < 1.0f ? 1.0f : rateHz > 1000.0f ? 1000.0f : rateHz),
+          filterTimeConstant(filterTimeConstant) {}
+
+    uint32_t periodMicros() const { return (uint32_t)(1e6f / rateHz + 0.5f); }
+    float timestep() const { return (float)periodMicros() * 1e-6f; }
+};
+
+/**
+ * Complementary filter for the tilt angle
+ * angle = alpha * (angle + gyroRate * dt) + (1 - alpha) * accelAngle, with
+ * alpha = timeConstant / (timeConstant + dt): the gyro dominates above the
+ * crossover frequency and the accelerometer (no drift) below it.
+ */
+class ComplementaryFilter {
+public:
+    ComplementaryFilter(float timeConstant, float dt)
+        : alpha(timeConstant / (timeConstant + dt)), dt(dt), estimate(0.0f) {}
+
+    void reset(float accelAngle) { estimate = accelAngle; }
+
+    float update(float gyroRate, float accelAngle) {
+        estimate = alpha * (estimate + gyroRate * dt) + (1.0f - alpha) * accelAngle;
+        return estimate;
+    }
+
+    float angle() const { return estimate; }
+
+private:
+    float alpha;
+    float dt;
+    float estimate;
+};
+
+static inline float accelAngle(const ImuSample& sample) { return atan2f(sample.accelX, sample.accelZ); }
+
+struct ControlLoopStats {
+    uint32_t ticks;             // Ticks that ran the policy
+    uint32_t missedTicks;       // Deadlines skipped because a tick started a period or more late
+    uint32_t overruns;          // Ticks that ended after the next deadline
+    uint32_t sensorFaults;      // Failed IMU reads
+    uint32_t lastLatencyMicros; // IMU read to motor write, last tick
+    uint32_t maxLatencyMicros;
+    uint32_t maxLateMicros;     // Worst start past the deadline (jitter)
+};
+
+/**
+ * Fixed-rate IMU -> filter -> policy -> motor loop
+ * @tparam Policy Any exported policy (reset, getAction, getMotorTorque)
+ * @tparam Hardware Board interface (micros, readImu, setMotorTorque)
+ */
+template <typename Policy, typename Hardware>
+class ControlLoop {
+public:
+    ControlLoop(Policy& policy, Hardware& hardware, const ControlLoopConfig& config = ControlLoopConfig())
+        : policy(policy),
+          hardware(hardware),
+          cfg(config),
+          period(config.periodMicros()),
+          filter(config.filterTimeConstant, config.timestep()),
+          deadline(0),
+          estimatedAngle(0.0f),
+          angularVelocity(0.0f),
+          action(0) {
+        clearStats();
+    }
+
+    /**
+     * Seed the filter and the policy's history from one IMU read and
+     * schedule the first tick now
+     * @return False if the IMU could not be read
+     */
+    bool start() {
+        ImuSample sample;
+        if (!hardware.readImu(sample)) {
+            counters.sensorFaults++;
+            return false;
+        }
+        filter.reset(accelAngle(sample));
+        estimatedAngle = filter.angle();
+        angularVelocity = sample.gyroRate;
+        policy.reset(estimatedAngle, angularVelocity);
+        deadline = hardware.micros();
+        return true;
+    }
+
+    /**
+     * Run a tick if its deadline has passed (cooperative scheduling from
+     * an Arduino loop() or any other polling context)
+     * @return True if a tick ran
+     */
+    bool poll() {
+        if ((int32_t)(hardware.micros() - deadline) < 0) return false;
+        tick();
+        return true;
+    }
+
+    /**
+     * Run one tick now and schedule the next deadline (timer- or
+     * task-driven loops call this once per period)
+     */
+    void tick() {
+        const uint32_t begin = hardware.micros();
+        const int32_t late = (int32_t)(begin - deadline);
+        const uint32_t lateMicros = late > 0 ? (uint32_t)late : 0;
+        const uint32_t missed = lateMicros / period;
+        const uint32_t scheduled = deadline + missed * period;
+        counters.missedTicks += missed;
+        counters.maxLateMicros = lateMicros > counters.maxLateMicros ? lateMicros : counters.maxLateMicros;
+        deadline = scheduled + period;
+
+        ImuSample sample;
+        if (hardware.readImu(sample)) {
+            estimatedAngle = filter.update(sample.gyroRate, accelAngle(sample));
+            angularVelocity = sample.gyroRate;
+            action = policy.getAction(estimatedAngle, angularVelocity);
+            hardware.setMotorTorque(policy.getMotorTorque(action));
+            counters.ticks++;
+        } else {
+            hardware.setMotorTorque(0.0f);
+            counters.sensorFaults++;
+        }
+
+        const uint32_t end = hardware.micros();
+        counters.lastLatencyMicros = end - begin;
+        counters.maxLatencyMicros =
+            counters.lastLatencyMicros > counters.maxLatencyMicros ? counters.lastLatencyMicros : counters.maxLatencyMicros;
+        if ((int32_t)(end - deadline) > 0) counters.overruns++;
+    }
+
+    /**
+     * Stop driving: torque 0 (call start() again to resume)
+     */
+    void stop() { hardware.setMotorTorque(0.0f); }
+
+    void clearStats() {
+        counters.ticks = counters.missedTicks = counters.overruns = counters.sensorFaults = 0;
+        counters.lastLatencyMicros = counters.maxLatencyMicros = counters.maxLateMicros = 0;
+    }
+
+    const ControlLoopStats& stats() const { return counters; }
+    const ControlLoopConfig& config() const { return cfg; }
+    float angle() const { return estimatedAngle; }
+    float angleRate() const { return angularVelocity; }
+    int lastAction() const { return action; }
+
+private:
+    Policy& policy;
+    Hardware& hardware;
+    ControlLoopConfig cfg;
+    uint32_t period;
+    ComplementaryFilter filter;
+    uint32_t deadline;
+    float estimatedAngle;
+    float angularVelocity;
+    int action;
+    ControlLoopStats counters;
+};
+
+#if defined(ESP_PLATFORM)
+/**
+ * ESP32 control task: a periodic esp_timer notifies a FreeRTOS task pinned
+ * to one core, which runs one ControlLoop tick per notification
+ * Keep the control core free of Wi-Fi and other high-priority work (core 1
+ * on dual-core chips) and give the task a priority above everything that
+ * shares the core.
+ * Pinning does not protect it from flash writes: an erase or write from
+ * any core (NVS, OTA, PartitionSlotStorage) disables the flash cache on
+ * both, and the task stalls for the whole operation. Do flash writes while
+ * the motors are stopped, or keep the control path in IRAM/DRAM.
+ */
+template <typename Loop>
+class ControlTask {
+public:
+    explicit ControlTask(Loop& loop) : loop(loop), task(nullptr), timer(nullptr) {}
+
+    /**
+     * @param priority FreeRTOS priority of the control task
+     * @param core Core to pin the task to
+     * @param stackBytes Task stack size
+     * @return False if the IMU, the task or the timer could not be set up
+     */
+    bool start(UBaseType_t priority, BaseType_t core, uint32_t stackBytes = 4096) {
+        if (!loop.start()) return false;
+        if (xTaskCreatePinnedToCore(run, "dqn_control", stackBytes, this, priority, &task, core) != pdPASS) {
+            return false;
+        }
+        esp_timer_create_args_t args = {};
+        args.callback = notify;
+        args.arg = this;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "dqn_control";
+        if (esp_timer_create(&args, &timer) != ESP_OK) {
+            stop();
+            return false;
+        }
+        if (esp_timer_start_periodic(timer, loop.config().periodMicros()) != ESP_OK) {
+            stop();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Stop the timer and the task, then set the torque to 0
+     */
+    void stop() {
+        if (timer) {
+            esp_timer_stop(timer);
+            esp_timer_delete(timer);
+            timer = nullptr;
+        }
+        if (task) {
+            vTaskDelete(task);
+            task = nullptr;
+        }
+        loop.stop();
+    }
+
+private:
+    static void notify(void* arg) { xTaskNotifyGive(static_cast<ControlTask*>(arg)->task); }
+
+    static void run(void* arg) {
+        ControlTask* self = static_cast<ControlTask*>(arg);
+        for (;;) {
+            // Notifications that piled up while a tick overran collapse into one tick; the
+            // loop's deadline bookkeeping counts the skipped ones
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            self->loop.tick();
+        }
+    }
+
+    Loop& loop;
+    TaskHandle_t task;
+    esp_timer_handle_t timer;
+};
+#endif
+
+} // namespace dqn
+
+#endif // DQN_CONTROL_LOOP_H
@@ -0,0 +1,227 @@
+/**
+ * Two-Wheel Balancing Robot DQN Policy Ensemble
+ *
+ * Runs several exported policies on the same state every tick, as an
+ * ensemble or to shadow-test a new model next to the one driving the
+ * robot. Exports link side by side when each is included under its own
+ * DQN_MODEL_NAMESPACE:
+ *
+ *   #define DQN_MODEL_NAMESPACE current
+ *   #include "good_two_wheel_bot_dqn.cpp"
+ *   #undef DQN_MODEL_NAMESPACE
+ *   #define DQN_MODEL_NAMESPACE candidate
+ *   #include "great_two_wheel_bot_dqn.cpp"
+ *   #undef DQN_MODEL_NAMESPACE
+ *   #include "DQNEnsemble.h"
+ *
+ *   dqn::PolicyEnsemble<dqn::ENSEMBLE_PRIMARY, current::TwoWheelBotDQN, candidate::TwoWheelBotDQN> shadow;
+ *   int action = shadow.getAction(angle, angularVelocity);  // current drives
+ *   ...
+ *   shadow.disagreements(1);  // ticks where the candidate would have acted differently
+ *
+ * - The state is normalized once (dqn::PolicyInput) and every policy runs
+ *   on it, so a tick costs the policies' network passes plus a few
+ *   compares, every tick
+ * - ENSEMBLE_PRIMARY: the first policy drives, the others are shadows
+ * - ENSEMBLE_VOTE: the action most policies pick; a tie goes to the first
+ *   policy's action if it is tied, else to the lowest action index
+ * - ENSEMBLE_AVERAGE_Q: argmax of the summed Q-values. Needs float
+ *   Q-values (float and action-difference exports, not int8 or lookup
+ *   tables); a difference policy's Q-values are offset by the same amount
+ *   for every action, which leaves the argmax of the sum unchanged
+ * - disagreements(k) counts the ticks where policy k's own action differed
+ *   from the returned one, since construction or resetCounters()
+ * - Policies are compiled exports (TwoWheelBotDQN, TwoWheelBotDQNInt8,
+ *   TwoWheelBotDQNLookup, ...) with the same OUTPUT_SIZE
+ *
+ * Requires C++11 (variadic templates; no standard library headers).
+ */
+
+#ifndef DQN_ENSEMBLE_H
+#define DQN_ENSEMBLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "DQNPolicy.h"
+
+namespace dqn {
+
+enum EnsembleMode {
+    ENSEMBLE_PRIMARY,
+    ENSEMBLE_VOTE,
+    ENSEMBLE_AVERAGE_Q
+};
+
+/**
+ * Policy instances of an ensemble, first one in `policy`, the rest in `rest`
+ */
+template <typename... Policies>
+struct EnsembleMembers {
+    static const int COUNT = 0;
+    static const int OUTPUT_SIZE = 0;
+
+    void reset(float, float) {}
+    void actions(const PolicyInput&, int*) {}
+
+    template <int Out>
+    void sumQ(const PolicyInput&, int*, float*) {}
+};
+
+template <typename Policy, typename... Rest>
+struct EnsembleMembers<Policy, Rest...> {
+    static const int COUNT = 1 + EnsembleMembers<Rest...>::COUNT;
+    static const int OUTPUT_SIZE = Policy::OUTPUT_SIZE;
+
+    static_assert(EnsembleMembers<Rest...>::COUNT == 0 || EnsembleMembers<Rest...>::OUTPUT_SIZE == OUTPUT_SIZE,
+                  "ensemble policies need the same OUTPUT_SIZE");
+
+    Policy policy;
+    EnsembleMembers<Rest...> rest;
+
+    void reset(float angle, float angularVelocity) {
+        policy.reset(angle, angularVelocity);
+        rest.reset(angle, angularVelocity);
+    }
+
+    void actions(const PolicyInput& input, int* out) {
+        out[0] = policy.getAction(input);
+        rest.actions(input, out + 1);
+    }
+
+    template <int Out>
+    void sumQ(const PolicyInput& input, int* out, float* total) {
+        float qValues[Out];
+        out[0] = policy.forward(input, qValues);
+        for (int o = 0; o < Out; o++) total[o] += qValues[o];
+        rest.template sumQ<Out>(input, out + 1, total);
+    }
+};
+
+/**
+ * Type and instance of member K
+ */
+template <int K, typename... Policies>
+struct EnsembleMember;
+
+template <typename Policy, typename... Rest>
+struct EnsembleMember<0, Policy, Rest...> {
+    typedef Policy Type;
+    static Type& get(EnsembleMembers<Policy, Rest...>& members) { return members.policy; }
+};
+
+template <int K, typename Policy, typename... Rest>
+struct EnsembleMember<K, Policy, Rest...> {
+    typedef typename EnsembleMember<K - 1, Rest...>::Type Type;
+    static Type& get(EnsembleMembers<Policy, Rest...>& members) { return EnsembleMember<K - 1, Rest...>::get(members.rest); }
+};
+
+/**
+ * K policies evaluated on one shared state per tick
+ * @tparam Mode How the returned action is chosen (see EnsembleMode)
+ * @tparam Policies Compiled policy types, first one primary
+ */
+template <EnsembleMode Mode, typename... Policies>
+class PolicyEnsemble {
+public:
+    typedef EnsembleMembers<Policies...> Members;
+
+    static const int SIZE = Members::COUNT;
+    static const int OUTPUT_SIZE = Members::OUTPUT_SIZE;
+
+    static_assert(SIZE >= 1, "an ensemble needs at least one policy");
+
+    PolicyEnsemble() { resetCounters(); }
+
+    /**
+     * Reset every policy's state history
+     */
+    void reset(float angle, float angularVelocity) { members.reset(angle, angularVelocity); }
+
+    /**
+     * Run every policy on the current state and combine their actions
+     * Multi-timestep policies record the state, so call once per tick.
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @return Combined action index (0=left, 1=brake, 2=right)
+     */
+    int getAction(float angle, float angularVelocity) {
+        DQN_PROFILE_SCOPE(PolicyEnsemble);
+        const int action = select(PolicyInput(angle, angularVelocity), ModeTag<Mode>());
+
+        ticks_++;
+        for (int k = 0; k < SIZE; k++) disagreementCounts[k] += lastActions[k] != action;
+        return action;
+    }
+
+    float getMotorTorque(int action) const {
+        return DQN_READ_FLOAT(&ACTION_TORQUES[action]);
+    }
+
+    /**
+     * Action policy k chose on the last tick
+     */
+    int action(int k) const { return lastActions[k]; }
+
+    /**
+     * Ticks where policy k's action differed from the returned action
+     */
+    uint32_t disagreements(int k) const { return disagreementCounts[k]; }
+
+    /**
+     * Ticks counted since construction or resetCounters()
+     */
+    uint32_t ticks() const { return ticks_; }
+
+    void resetCounters() {
+        ticks_ = 0;
+        for (int k = 0; k < SIZE; k++) {
+            disagreementCounts[k] = 0;
+            lastActions[k] = 0;
+        }
+    }
+
+    /**
+     * Policy instance K, e.g. to inspect Q-values outside the ensemble
+     */
+    template <int K>
+    typename EnsembleMember<K, Policies...>::Type& policy() { return EnsembleMember<K, Policies...>::get(members); }
+
+private:
+    template <EnsembleMode M>
+    struct ModeTag {};
+
+    // Only instantiated for ENSEMBLE_AVERAGE_Q, so int8 and lookup policies need no float Q-values
+    int select(const PolicyInput& input, ModeTag<ENSEMBLE_AVERAGE_Q>) {
+        float total[OUTPUT_SIZE];
+        for (int o = 0; o < OUTPUT_SIZE; o++) total[o] = 0.0f;
+        members.template sumQ<OUTPUT_SIZE>(input, lastActions, total);
+        return argmax<OUTPUT_SIZE>(total);
+    }
+
+    template <EnsembleMode M>
+    int select(const PolicyInput& input, ModeTag<M>) {
+        members.actions(input, lastActions);
+        return M == ENSEMBLE_VOTE ? vote() : lastActions[0];
+    }
+
+    // Most votes; the first policy's action wins any tie it is part of
+    int vote() const {
+        int votes[OUTPUT_SIZE];
+        for (int o = 0; o < OUTPUT_SIZE; o++) votes[o] = 0;
+        for (int k = 0; k < SIZE; k++) votes[lastActions[k]]++;
+
+        int best = lastActions[0];
+        for (int o = 0; o < OUTPUT_SIZE; o++) best = choose(votes[o] > votes[best], o, best);
+        return best;
+    }
+
+    Members members;
+    int lastActions[SIZE];
+    uint32_t disagreementCounts[SIZE];
+    uint32_t ticks_;
+};
+
+} // namespace dqn
+
+#endif // DQN_ENSEMBLE_H
@@ -0,0 +1,223 @@
+/**
+ * Two-Wheel Balancing Robot DQN Hardware-in-the-Loop Protocol
+ *
+ * Lets the firmware build of a policy drive the host's BalancingRobot over
+ * a serial link (native/hil/hil_dqn), so timing regressions show up as
+ * latency, missed deadlines or a fallen robot before they reach real
+ * hardware. The host sends one state frame per tick; the device answers
+ * with the action, its motor torque and the inference time:
+ *
+ *   static dqn::HilDevice<TwoWheelBotDQN> hil;
+ *
+ *   void loop() {
+ *       while (Serial.available() > 0) {
+ *           if (hil.push((uint8_t)Serial.read())) Serial.write(hil.reply(), dqn::HIL_FRAME_SIZE);
+ *       }
+ *   }
+ *
+ * - Frames are HIL_FRAME_SIZE (16) bytes, little-endian, with two sync
+ *   bytes and a CRC-16/CCITT over the first 14 bytes (crc16 from
+ *   DQNTelemetry.h). At 1 kHz each direction carries 16 kB/s, so use
+ *   921600 baud or a USB CDC port
+ * - State (host to device): sync, 16-bit sequence, angle and angular
+ *   velocity (float32, as the real loop would pass them to getAction),
+ *   flags (HIL_RESET: reset the policy with this state first)
+ * - Action (device to host): sync, the state's sequence, motor torque
+ *   (getMotorTorque, float32), getAction + getMotorTorque time in
+ *   CycleCounter units, action index and the state's flags
+ * - HilFrameDecoder reassembles frames of either direction one byte at a
+ *   time and resynchronizes after corrupted or missing bytes
+ *
+ * Requires C++11 and <atomic> (not AVR), through DQNTelemetry.h.
+ */
+
+#ifndef DQN_HIL_H
+#define DQN_HIL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "DQNPolicy.h"
+#include "DQNProfiler.h"
+#include "DQNTelemetry.h"
+
+namespace dqn {
+
+static const size_t HIL_FRAME_SIZE = 16;
+static const uint8_t HIL_SYNC0 = 0xA5;
+static const uint8_t HIL_STATE_SYNC1 = 0x51;   // Host to device
+static const uint8_t HIL_ACTION_SYNC1 = 0xAC;  // Device to host
+
+// State flags, echoed in the action frame
+static const uint8_t HIL_RESET = 0x01;  // Reset the policy with this state before the tick
+
+struct HilState {
+    uint16_t sequence;
+    uint8_t flags;
+    float angle;            // rad
+    float angularVelocity;  // rad/s
+};
+
+struct HilAction {
+    uint16_t sequence;  // Of the state this answers
+    uint8_t action;
+    uint8_t flags;
+    float torque;       // getMotorTorque(action)
+    uint32_t cycles;    // Tick time on the device, CycleCounter units
+};
+
+inline void finishHilFrame(uint8_t* out) {
+    const uint16_t crc = crc16(out, HIL_FRAME_SIZE - 2);
+    memcpy(out + HIL_FRAME_SIZE - 2, &crc, 2);
+}
+
+inline bool checkHilFrame(const uint8_t* in, uint8_t sync1) {
+    uint16_t crc;
+    memcpy(&crc, in + HIL_FRAME_SIZE - 2, 2);
+    return in[0] == HIL_SYNC0 && in[1] == sync1 && crc16(in, HIL_FRAME_SIZE - 2) == crc;
+}
+
+inline void encodeHilState(const HilState& state, uint8_t* out) {
+    out[0] = HIL_SYNC0;
+    out[1] = HIL_STATE_SYNC1;
+    memcpy(out + 2, &state.sequence, 2);
+    memcpy(out + 4, &state.angle, 4);
+    memcpy(out + 8, &state.angularVelocity, 4);
+    out[12] = state.flags;
+    out[13] = 0;
+    finishHilFrame(out);
+}
+
+/**
+ * @return False if the sync bytes or the checksum do not match
+ */
+inline bool decodeHilState(const uint8_t* in, HilState& state) {
+    if (!checkHilFrame(in, HIL_STATE_SYNC1)) return false;
+    memcpy(&state.sequence, in + 2, 2);
+    memcpy(&state.angle, in + 4, 4);
+    memcpy(&state.angularVelocity, in + 8, 4);
+    state.flags = in[12];
+    return true;
+}
+
+inline void encodeHilAction(const HilAction& action, uint8_t* out) {
+    out[0] = HIL_SYNC0;
+    out[1] = HIL_ACTION_SYNC1;
+    memcpy(out + 2, &action.sequence, 2);
+    memcpy(out + 4, &action.torque, 4);
+    memcpy(out + 8, &action.cycles, 4);
+    out[12] = action.action;
+    out[13] = action.flags;
+    finishHilFrame(out);
+}
+
+/**
+ * @return False if the sync bytes or the checksum do not match
+ */
+inline bool decodeHilAction(const uint8_t* in, HilAction& action) {
+    if (!checkHilFrame(in, HIL_ACTION_SYNC1)) return false;
+    memcpy(&action.sequence, in + 2, 2);
+    memcpy(&action.torque, in + 4, 4);
+    memcpy(&action.cycles, in + 8, 4);
+    action.action = in[12];
+    action.flags = in[13];
+    return true;
+}
+
+/**
+ * Reassembles frames with one sync pair from a byte stream
+ */
+class HilFrameDecoder {
+public:
+    explicit HilFrameDecoder(uint8_t sync1) : sync1(sync1), pendingSize(0), skipped(0) {}
+
+    /**
+     * Feed one byte
+     * @return The checked frame it completes, or nullptr
+     */
+    const uint8_t* push(uint8_t byte) {
+        pending[pendingSize++] = byte;
+        if (pendingSize < HIL_FRAME_SIZE) {
+            resync(0);
+            return nullptr;
+        }
+        if (!checkHilFrame(pending, sync1)) {
+            resync(1);
+            return nullptr;
+        }
+        pendingSize = 0;
+        return pending;
+    }
+
+    /**
+     * Bytes discarded while searching for a frame start
+     */
+    size_t skippedBytes() const { return skipped; }
+
+private:
+    // Drop bytes from the front until pending starts like a frame
+    void resync(size_t from) {
+        size_t start = from;
+        while (start < pendingSize &&
+               !(pending[start] == HIL_SYNC0 && (start + 1 >= pendingSize || pending[start + 1] == sync1))) {
+            start++;
+        }
+        if (start == 0) return;
+        memmove(pending, pending + start, pendingSize - start);
+        pendingSize -= start;
+        skipped += start;
+    }
+
+    uint8_t sync1;
+    uint8_t pending[HIL_FRAME_SIZE];
+    size_t pendingSize;
+    size_t skipped;
+};
+
+/**
+ * Device end of the link: runs the policy on every state frame
+ * @tparam Policy Any export (reset, getAction, getMotorTorque)
+ */
+template <typename Policy>
+class HilDevice {
+public:
+    HilDevice() : decoder(HIL_STATE_SYNC1), ticks(0) { CycleCounter::enable(); }
+
+    /**
+     * Feed one received byte
+     * @return True when a tick ran and reply() holds its action frame
+     */
+    bool push(uint8_t byte) {
+        const uint8_t* frame = decoder.push(byte);
+        HilState state;
+        if (!frame || !decodeHilState(frame, state)) return false;
+
+        const uint32_t start = CycleCounter::now();
+        if (state.flags & HIL_RESET) policy.reset(state.angle, state.angularVelocity);
+        HilAction action;
+        action.action = (uint8_t)policy.getAction(state.angle, state.angularVelocity);
+        action.torque = policy.getMotorTorque(action.action);
+        action.cycles = CycleCounter::now() - start;
+        action.sequence = state.sequence;
+        action.flags = state.flags;
+        encodeHilAction(action, out);
+        ticks++;
+        return true;
+    }
+
+    const uint8_t* reply() const { return out; }
+    uint32_t frames() const { return ticks; }
+    size_t skippedBytes() const { return decoder.skippedBytes(); }
+    Policy& wrapped() { return policy; }
+
+private:
+    Policy policy;
+    HilFrameDecoder decoder;
+    uint8_t out[HIL_FRAME_SIZE];
+    uint32_t ticks;
+};
+
+} // namespace dqn
+
+#endif // DQN_HIL_H
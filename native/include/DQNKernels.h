@@ -0,0 +1,166 @@
+/**
+ * Two-Wheel Balancing Robot DQN Kernels
+ *
+ * Optional accelerated dense-layer kernels for DQNPolicy, selected at
+ * compile time. DQNPolicy.h includes this header only when one of these
+ * is defined; otherwise the unrolled scalar path is used:
+ *
+ * - DQN_USE_CMSIS_DSP  Cortex-M with CMSIS-DSP (arm_mat_mult_f32)
+ * - DQN_USE_ESP_DSP    ESP32 / ESP32-S3 with ESP-DSP (dspm_mult_f32,
+ *                      which picks the Xtensa SIMD build on the S3)
+ * - DQN_USE_SIMD       Host or Cortex-A builds with SSE or NEON intrinsics
+ *
+ * Both layers are a row vector times a row-major matrix, which is exactly
+ * how CPUBackend lays out weightsInputHidden (In x Hidden) and
+ * weightsHiddenOutput (Hidden x Out), so no weight reordering is needed.
+ * The SSE/NEON kernel accumulates in the same order as the scalar path
+ * (bias first, then rows in order, no fused multiply-add), so its Q-values
+ * are bit-identical. The library kernels may round differently.
+ *
+ * Only the default InputMajor layout is accelerated: NeuronMajor tables
+ * keep the scalar path, whose contiguous per-neuron reads are what that
+ * layout is for.
+ *
+ * Weights must be directly addressable, so AVR PROGMEM builds cannot use
+ * these kernels.
+ */
+
+#ifndef DQN_KERNELS_H
+#define DQN_KERNELS_H
+
+#if defined(__AVR__)
+#error "DQN kernels need weights in addressable memory; AVR builds use the scalar path"
+#endif
+
+#if defined(DQN_USE_CMSIS_DSP)
+#include "arm_math.h"
+#define DQN_KERNEL_NAME "cmsis-dsp"
+#elif defined(DQN_USE_ESP_DSP)
+#include "esp_dsp.h"
+#define DQN_KERNEL_NAME "esp-dsp"
+#elif defined(DQN_USE_SIMD)
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define DQN_KERNEL_NAME "sse"
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DQN_KERNEL_NAME "neon"
+#else
+#error "DQN_USE_SIMD needs SSE or NEON"
+#endif
+#endif
+
+namespace dqn {
+
+struct InputMajor;
+
+namespace kernels {
+
+/**
+ * Kernels read the row-major CPUBackend layout; other layouts fall back
+ * to the scalar path
+ */
+template <typename Layout>
+struct Supports {
+    static const bool value = false;
+};
+
+template <>
+struct Supports<InputMajor> {
+    static const bool value = true;
+};
+
+#if defined(DQN_USE_SIMD)
+
+/**
+ * Four-lane float vector over SSE or NEON
+ */
+#if defined(__SSE__) || defined(_M_X64)
+typedef __m128 Vec4;
+static DQN_ALWAYS_INLINE Vec4 load4(const float* p) { return _mm_loadu_ps(p); }
+static DQN_ALWAYS_INLINE void store4(float* p, Vec4 v) { _mm_storeu_ps(p, v); }
+static DQN_ALWAYS_INLINE Vec4 multiplyAdd(Vec4 acc, float x, Vec4 w) {
+    return _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(x), w));
+}
+#else
+typedef float32x4_t Vec4;
+static DQN_ALWAYS_INLINE Vec4 load4(const float* p) { return vld1q_f32(p); }
+static DQN_ALWAYS_INLINE void store4(float* p, Vec4 v) { vst1q_f32(p, v); }
+static DQN_ALWAYS_INLINE Vec4 multiplyAdd(Vec4 acc, float x, Vec4 w) {
+    return vaddq_f32(acc, vmulq_f32(vdupq_n_f32(x), w));
+}
+#endif
+
+/**
+ * Load the first n (< 4) lanes, zero the rest
+ */
+static DQN_ALWAYS_INLINE Vec4 loadPartial(const float* p, int n) {
+    float lanes[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < n; i++) lanes[i] = p[i];
+    return load4(lanes);
+}
+
+static DQN_ALWAYS_INLINE void storePartial(float* p, Vec4 v, int n) {
+    float lanes[4];
+    store4(lanes, v);
+    for (int i = 0; i < n; i++) p[i] = lanes[i];
+}
+
+/**
+ * output[c] = bias[c] + sum_r input[r] * weights[r * Cols + c]
+ * Columns are processed four at a time. A partial last block (Cols = 3
+ * for the output layer) reads one row ahead, which stays inside the
+ * matrix for every row but the last.
+ */
+template <int Rows, int Cols>
+struct Dense {
+    static const int FULL_BLOCKS = Cols / 4;
+    static const int TAIL = Cols % 4;
+
+    static DQN_ALWAYS_INLINE void run(const float* input, const float* weights, const float* bias, float* output) {
+        for (int b = 0; b < FULL_BLOCKS; b++) {
+            const int c = b * 4;
+            Vec4 acc = load4(&bias[c]);
+            for (int r = 0; r < Rows; r++) acc = multiplyAdd(acc, input[r], load4(&weights[r * Cols + c]));
+            store4(&output[c], acc);
+        }
+        if (TAIL > 0) {
+            const int c = FULL_BLOCKS * 4;
+            Vec4 acc = loadPartial(&bias[c], TAIL);
+            for (int r = 0; r < Rows - 1; r++) acc = multiplyAdd(acc, input[r], load4(&weights[r * Cols + c]));
+            acc = multiplyAdd(acc, input[Rows - 1], loadPartial(&weights[(Rows - 1) * Cols + c], TAIL));
+            storePartial(&output[c], acc, TAIL);
+        }
+    }
+};
+
+#elif defined(DQN_USE_CMSIS_DSP)
+
+template <int Rows, int Cols>
+struct Dense {
+    static inline void run(const float* input, const float* weights, const float* bias, float* output) {
+        // CMSIS matrix instances take non-const data; the kernel only reads it
+        arm_matrix_instance_f32 x = {1, Rows, const_cast<float32_t*>(input)};
+        arm_matrix_instance_f32 w = {Rows, Cols, const_cast<float32_t*>(weights)};
+        arm_matrix_instance_f32 y = {1, Cols, output};
+        arm_mat_mult_f32(&x, &w, &y);
+        arm_add_f32(output, bias, output, Cols);
+    }
+};
+
+#elif defined(DQN_USE_ESP_DSP)
+
+template <int Rows, int Cols>
+struct Dense {
+    static inline void run(const float* input, const float* weights, const float* bias, float* output) {
+        dspm_mult_f32(input, weights, output, 1, Rows, Cols);
+        dsps_add_f32(output, bias, output, Cols, 1, 1, 1);
+    }
+};
+
+#endif
+
+} // namespace kernels
+} // namespace dqn
+
+#endif // DQN_KERNELS_H
@@ -0,0 +1,564 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model Blob
+ *
+ * Loads the binary model format written by src/export/ModelBlob.js and runs
+ * it without recompiling the firmware: architecture, normalization, action
+ * map and tensors all come from the blob.
+ *
+ *   dqn::MappedFile file;                        // host: mmap
+ *   file.open("models/good.dqnb");
+ *   // ESP32: dqn::MappedPartition file; file.open("policy");
+ *   dqn::ModelBlob blob;
+ *   if (blob.bind(file.data(), file.size()) != dqn::BLOB_OK) ...;
+ *   dqn::BlobPolicy policy;
+ *   policy.bind(blob);
+ *   int action = policy.getAction(angle, angularVelocity);
+ *
+ * - Tensors are used in place: nothing is copied out of the mapping, so the
+ *   blob must stay mapped while a policy is bound to it
+ * - bind() checks the magic, version, CRC-32, architecture and every tensor
+ *   bound before a policy can use the blob
+ * - BlobPolicy gives float32 blobs the actions of the DQNPolicy export of
+ *   the same network, with Q-values equal to float rounding (the blob scales
+ *   its inputs, the export folds the scale into its first layer), and runs
+ *   int8 blobs exactly like QuantizedDQNPolicy; loops have run-time trip
+ *   counts, so expect it to be slower than the unrolled templates
+ * - The format is little-endian and tensors are read through plain
+ *   pointers, so AVR (PROGMEM) is not supported; ESP32, STM32 and hosts are
+ *
+ * Requires C++11.
+ */
+
+#ifndef DQN_MODEL_BLOB_H
+#define DQN_MODEL_BLOB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "DQNPolicy.h"
+
+#if defined(ESP_PLATFORM)
+#include "esp_partition.h"
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "DQNModelBlob.h reads the little-endian blob format in place"
+#endif
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wdouble-promotion"
+#pragma GCC diagnostic error "-Wfloat-conversion"
+#endif
+
+namespace dqn {
+
+static const uint16_t MODEL_BLOB_VERSION = 1;
+
+// Largest architecture BlobPolicy sizes its stack buffers for
+static const int BLOB_MAX_TIMESTEPS = 8;
+static const int BLOB_MAX_INPUT = 2 * BLOB_MAX_TIMESTEPS;
+static const int BLOB_MAX_HIDDEN = 256;
+static const int BLOB_MAX_OUTPUT = 8;
+
+enum BlobPrecision {
+    BLOB_FLOAT32 = 0,  // float32 weights and biases
+    BLOB_INT8 = 1      // int8 weights, int32 biases (QuantizedExporter.js)
+};
+
+enum BlobStatus {
+    BLOB_OK,
+    BLOB_TOO_SMALL,          // Shorter than its header or its totalSize
+    BLOB_BAD_MAGIC,          // Not a model blob
+    BLOB_BAD_VERSION,        // Written by a newer exporter
+    BLOB_BAD_CHECKSUM,       // CRC-32 mismatch (corrupt or partly written)
+    BLOB_BAD_ARCHITECTURE,   // Unknown precision/activation or sizes out of range
+    BLOB_BAD_TENSOR,         // Tensor outside the blob or misaligned
+    BLOB_MISALIGNED,         // Blob start not 4-byte aligned
+    BLOB_BASE_MISMATCH       // Delta made against another base model (DQNModelDelta.h)
+};
+
+/**
+ * @return Short description of a bind() result
+ */
+inline const char* blobStatusName(BlobStatus status) {
+    switch (status) {
+        case BLOB_OK: return "ok";
+        case BLOB_TOO_SMALL: return "too small";
+        case BLOB_BAD_MAGIC: return "bad magic";
+        case BLOB_BAD_VERSION: return "unsupported version";
+        case BLOB_BAD_CHECKSUM: return "checksum mismatch";
+        case BLOB_BAD_ARCHITECTURE: return "bad architecture";
+        case BLOB_BAD_TENSOR: return "bad tensor";
+        case BLOB_MISALIGNED: return "misaligned";
+        case BLOB_BASE_MISMATCH: return "base model mismatch";
+    }
+    return "unknown";
+}
+
+/**
+ * Fixed 64-byte header at the start of every blob (see ModelBlob.js)
+ */
+struct ModelBlobHeader {
+    char magic[4];                  // "DQNB"
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t crc;                   // CRC-32 of bytes 12 .. totalSize
+    uint32_t totalSize;
+    uint8_t precision;              // BlobPrecision
+    uint8_t activation;             // 0 = ReLU
+    uint8_t hiddenShift;            // int8 hidden requantization shift
+    uint8_t reserved;
+    uint16_t inputSize;
+    uint16_t hiddenSize;
+    uint16_t outputSize;
+    uint16_t historyTimesteps;
+    float angleScale;               // Radians to network input units
+    float angularVelocityScale;     // rad/s to network input units
+    float weightScaleInputHidden;   // int8 weight scales (1 for float32)
+    float weightScaleHiddenOutput;
+    uint32_t actionTorquesOffset;
+    uint32_t weightsInputHiddenOffset;
+    uint32_t biasHiddenOffset;
+    uint32_t weightsHiddenOutputOffset;
+    uint32_t biasOutputOffset;
+};
+
+static_assert(sizeof(ModelBlobHeader) == 64, "ModelBlobHeader must match the 64-byte file header");
+
+// Bytes covered by the checksum start after the crc field
+static const size_t MODEL_BLOB_CRC_START = offsetof(ModelBlobHeader, totalSize);
+
+/**
+ * CRC-32 (IEEE 802.3, as zlib and ModelBlob.js), four bits at a time
+ * Pass the previous result as crc to checksum data in pieces.
+ */
+inline uint32_t crc32(const void* data, size_t size, uint32_t crc = 0) {
+    static const uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+    const uint8_t* bytes = (const uint8_t*)data;
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = TABLE[(crc ^ bytes[i]) & 0x0F] ^ (crc >> 4);
+        crc = TABLE[(crc ^ (uint32_t)(bytes[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+/**
+ * Validated view of a model blob in memory or memory-mapped flash
+ */
+class ModelBlob {
+public:
+    ModelBlob() : base(nullptr) { memset(&head, 0, sizeof(head)); }
+
+    /**
+     * Validate data and use it as the blob
+     * On failure the previous blob (if any) is dropped.
+     * @param data Blob bytes, 4-byte aligned; must outlive the view
+     * @param size Bytes available (a flash partition may be larger than the blob)
+     */
+    BlobStatus bind(const void* data, size_t size) {
+        base = nullptr;
+        const BlobStatus status = validate(data, size, head);
+        if (status == BLOB_OK) base = (const uint8_t*)data;
+        return status;
+    }
+
+    bool valid() const { return base != nullptr; }
+    const ModelBlobHeader& header() const { return head; }
+    const void* data() const { return base; }
+    size_t size() const { return head.totalSize; }
+    BlobPrecision precision() const { return (BlobPrecision)head.precision; }
+
+    /**
+     * Q-value per int8 output accumulator LSB (1 for float32 blobs)
+     */
+    float outputScale() const {
+        if (head.precision != BLOB_INT8) return 1.0f;
+        const float hiddenScale = head.weightScaleInputHidden / 127.0f * (float)((uint32_t)1 << head.hiddenShift);
+        return hiddenScale * head.weightScaleHiddenOutput;
+    }
+
+    /**
+     * Tensor at a header offset, e.g. blob.tensor<float>(blob.header().biasHiddenOffset)
+     */
+    template <typename T>
+    const T* tensor(uint32_t offset) const {
+        return reinterpret_cast<const T*>(base + offset);
+    }
+
+    const float* actionTorques() const { return tensor<float>(head.actionTorquesOffset); }
+
+    /**
+     * Check data without binding it
+     * @param header Filled with the blob header when at least 64 bytes are readable
+     */
+    static BlobStatus validate(const void* data, size_t size, ModelBlobHeader& header) {
+        if (!data || size < sizeof(ModelBlobHeader)) return BLOB_TOO_SMALL;
+        if ((uintptr_t)data % 4 != 0) return BLOB_MISALIGNED;
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, "DQNB", 4) != 0) return BLOB_BAD_MAGIC;
+        if (header.version != MODEL_BLOB_VERSION || header.headerSize < sizeof(ModelBlobHeader)) {
+            return BLOB_BAD_VERSION;
+        }
+        if (header.totalSize < header.headerSize || header.totalSize > size) return BLOB_TOO_SMALL;
+
+        const uint8_t* bytes = (const uint8_t*)data;
+        if (crc32(bytes + MODEL_BLOB_CRC_START, header.totalSize - MODEL_BLOB_CRC_START) != header.crc) {
+            return BLOB_BAD_CHECKSUM;
+        }
+
+        const int in = header.inputSize;
+        const int hidden = header.hiddenSize;
+        const int out = header.outputSize;
+        if (header.precision > BLOB_INT8 || header.activation != 0 ||
+            header.historyTimesteps < 1 || header.historyTimesteps > BLOB_MAX_TIMESTEPS ||
+            in != 2 * header.historyTimesteps || hidden < 1 || hidden > BLOB_MAX_HIDDEN ||
+            out < 2 || out > BLOB_MAX_OUTPUT || header.hiddenShift > 30) {
+            return BLOB_BAD_ARCHITECTURE;
+        }
+
+        const bool int8 = header.precision == BLOB_INT8;
+        const size_t weightBytes = int8 ? 1 : 4;
+        if (!tensorFits(header, header.actionTorquesOffset, (size_t)out * 4) ||
+            !tensorFits(header, header.weightsInputHiddenOffset, (size_t)in * hidden * weightBytes) ||
+            !tensorFits(header, header.biasHiddenOffset, (size_t)hidden * 4) ||
+            !tensorFits(header, header.weightsHiddenOutputOffset, (size_t)hidden * out * weightBytes) ||
+            !tensorFits(header, header.biasOutputOffset, (size_t)out * 4)) {
+            return BLOB_BAD_TENSOR;
+        }
+        return BLOB_OK;
+    }
+
+private:
+    static bool tensorFits(const ModelBlobHeader& header, uint32_t offset, size_t bytes) {
+        return offset >= header.headerSize && offset % 4 == 0 && offset <= header.totalSize &&
+               bytes <= header.totalSize - offset;
+    }
+
+    const uint8_t* base;
+    ModelBlobHeader head;
+};
+
+/**
+ * StateHistory with the timestep count chosen at run time
+ * Same layout and semantics as StateHistory<T, Timesteps>.
+ */
+template <typename T, int MaxTimesteps>
+class RuntimeStateHistory {
+public:
+    RuntimeStateHistory() { setTimesteps(1); }
+
+    /**
+     * Change the history length and clear it to zeros
+     */
+    void setTimesteps(int count) {
+        timesteps = count;
+        head = 0;
+        for (int i = 0; i < 2 * MaxTimesteps * 2; i++) frames[i] = 0;
+    }
+
+    void reset(const T* frame) {
+        head = 0;
+        for (int t = 0; t < 2 * timesteps; t++) {
+            frames[t * 2] = frame[0];
+            frames[t * 2 + 1] = frame[1];
+        }
+    }
+
+    const T* push(const T* frame) {
+        head = choose(head == 0, timesteps - 1, head - 1);
+        T* slot = &frames[head * 2];
+        slot[0] = slot[timesteps * 2] = frame[0];
+        slot[1] = slot[timesteps * 2 + 1] = frame[1];
+        return slot;
+    }
+
+private:
+    T frames[2 * MaxTimesteps * 2];
+    int timesteps;
+    int head;
+};
+
+/**
+ * Forward passes over a validated blob, in DQNNetwork's accumulation order
+ */
+struct BlobNetwork {
+    /**
+     * float32 blob: Q-values from normalized inputs
+     */
+    static void forward(const ModelBlob& blob, const float* input, float* output) {
+        const ModelBlobHeader& h = blob.header();
+        const int in = h.inputSize;
+        const int hiddenSize = h.hiddenSize;
+        const int out = h.outputSize;
+        const float* weightsInputHidden = blob.tensor<float>(h.weightsInputHiddenOffset);
+        const float* biasHidden = blob.tensor<float>(h.biasHiddenOffset);
+        const float* weightsHiddenOutput = blob.tensor<float>(h.weightsHiddenOutputOffset);
+        const float* biasOutput = blob.tensor<float>(h.biasOutputOffset);
+
+        // Input-major rows: each input adds to every hidden unit in turn
+        float hidden[BLOB_MAX_HIDDEN];
+        for (int j = 0; j < hiddenSize; j++) hidden[j] = biasHidden[j];
+        for (int i = 0; i < in; i++) {
+            const float* row = &weightsInputHidden[i * hiddenSize];
+            for (int j = 0; j < hiddenSize; j++) hidden[j] += input[i] * row[j];
+        }
+        for (int j = 0; j < hiddenSize; j++) hidden[j] = ReLU::apply(hidden[j]);
+
+        for (int o = 0; o < out; o++) {
+            float acc = biasOutput[o];
+            for (int j = 0; j < hiddenSize; j++) acc += hidden[j] * weightsHiddenOutput[j * out + o];
+            output[o] = acc;
+        }
+    }
+
+    /**
+     * int8 blob: output accumulators from int8 inputs
+     */
+    static void forward(const ModelBlob& blob, const int8_t* input, int32_t* output) {
+        const ModelBlobHeader& h = blob.header();
+        const int in = h.inputSize;
+        const int hiddenSize = h.hiddenSize;
+        const int out = h.outputSize;
+        const int shift = h.hiddenShift;
+        const int32_t round = shift > 0 ? (int32_t)1 << (shift - 1) : 0;
+        const int8_t* weightsInputHidden = blob.tensor<int8_t>(h.weightsInputHiddenOffset);
+        const int32_t* biasHidden = blob.tensor<int32_t>(h.biasHiddenOffset);
+        const int8_t* weightsHiddenOutput = blob.tensor<int8_t>(h.weightsHiddenOutputOffset);
+        const int32_t* biasOutput = blob.tensor<int32_t>(h.biasOutputOffset);
+
+        int32_t acc[BLOB_MAX_HIDDEN];
+        for (int j = 0; j < hiddenSize; j++) acc[j] = biasHidden[j];
+        for (int i = 0; i < in; i++) {
+            const int8_t* row = &weightsInputHidden[i * hiddenSize];
+            for (int j = 0; j < hiddenSize; j++) acc[j] += (int16_t)input[i] * (int16_t)row[j];
+        }
+        int16_t hidden[BLOB_MAX_HIDDEN];
+        for (int j = 0; j < hiddenSize; j++) {
+            hidden[j] = (int16_t)((ReLU::apply(acc[j]) + round) >> shift);
+        }
+
+        for (int o = 0; o < out; o++) {
+            int32_t sum = biasOutput[o];
+            for (int j = 0; j < hiddenSize; j++) sum += (int32_t)hidden[j] * weightsHiddenOutput[j * out + o];
+            output[o] = sum;
+        }
+    }
+};
+
+/**
+ * Policy over a bound model blob, API compatible with DQNPolicy
+ * Works with dqn::runEpisode and anything else templated on a policy.
+ */
+class BlobPolicy {
+public:
+    BlobPolicy() : model(nullptr) {}
+
+    /**
+     * Use a validated blob; clears the state history
+     * @return False if the blob is not valid
+     */
+    bool bind(const ModelBlob& blob) {
+        if (!blob.valid()) return false;
+        model = &blob;
+        const int timesteps = blob.header().historyTimesteps;
+        floatHistory.setTimesteps(timesteps);
+        quantizedHistory.setTimesteps(timesteps);
+        return true;
+    }
+
+    const ModelBlob* blob() const { return model; }
+    int inputSize() const { return model->header().inputSize; }
+    int hiddenSize() const { return model->header().hiddenSize; }
+    int outputSize() const { return model->header().outputSize; }
+
+    /**
+     * Fill the state history with one state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     */
+    void reset(float angle, float angularVelocity) {
+        if (model->precision() == BLOB_INT8) {
+            int8_t frame[2];
+            quantize(angle, angularVelocity, frame);
+            quantizedHistory.reset(frame);
+        } else {
+            float frame[2];
+            normalize(angle, angularVelocity, frame);
+            floatHistory.reset(frame);
+        }
+    }
+
+    /**
+     * Run the network on the current state (records it in the history)
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @param qValues Output Q-values [outputSize()]; int8 blobs report the
+     *                accumulators times ModelBlob::outputScale()
+     * @return Action index
+     */
+    int forward(float angle, float angularVelocity, float* qValues) {
+        DQN_PROFILE_SCOPE(BlobPolicy);
+        const int out = model->header().outputSize;
+        if (model->precision() == BLOB_INT8) {
+            int8_t frame[2];
+            quantize(angle, angularVelocity, frame);
+            int32_t accumulators[BLOB_MAX_OUTPUT];
+            BlobNetwork::forward(*model, quantizedHistory.push(frame), accumulators);
+            const float scale = model->outputScale();
+            for (int o = 0; o < out; o++) qValues[o] = (float)accumulators[o] * scale;
+            return firstMax(accumulators, out);
+        }
+        float frame[2];
+        normalize(angle, angularVelocity, frame);
+        BlobNetwork::forward(*model, floatHistory.push(frame), qValues);
+        return firstMax(qValues, out);
+    }
+
+    int getAction(float angle, float angularVelocity) {
+        float qValues[BLOB_MAX_OUTPUT];
+        return forward(angle, angularVelocity, qValues);
+    }
+
+    /**
+     * Motor torque for an action, from the blob's action map
+     */
+    float getMotorTorque(int action) const { return model->actionTorques()[action]; }
+
+private:
+    template <typename T>
+    static int firstMax(const T* values, int count) {
+        T maxValue = values[0];
+        int best = 0;
+        for (int o = 1; o < count; o++) {
+            const bool better = values[o] > maxValue;
+            maxValue = choose(better, values[o], maxValue);
+            best = choose(better, o, best);
+        }
+        return best;
+    }
+
+    void normalize(float angle, float angularVelocity, float* frame) const {
+        const ModelBlobHeader& h = model->header();
+        frame[0] = constrain(angle * h.angleScale, -1.0f, 1.0f);
+        frame[1] = constrain(angularVelocity * h.angularVelocityScale, -1.0f, 1.0f);
+    }
+
+    void quantize(float angle, float angularVelocity, int8_t* frame) const {
+        const ModelBlobHeader& h = model->header();
+        frame[0] = quantizeInput(angle * h.angleScale);
+        frame[1] = quantizeInput(angularVelocity * h.angularVelocityScale);
+    }
+
+    const ModelBlob* model;
+    RuntimeStateHistory<float, BLOB_MAX_TIMESTEPS> floatHistory;
+    RuntimeStateHistory<int8_t, BLOB_MAX_TIMESTEPS> quantizedHistory;
+};
+
+#if defined(ESP_PLATFORM)
+/**
+ * Data partition memory-mapped through the flash cache (ESP-IDF 5)
+ * Flash the blob with e.g. `parttool.py write_partition --partition-name policy`.
+ */
+class MappedPartition {
+public:
+    MappedPartition() : address(nullptr), length(0), handle(0) {}
+    ~MappedPartition() { close(); }
+
+    MappedPartition(const MappedPartition&) = delete;
+    MappedPartition& operator=(const MappedPartition&) = delete;
+
+    /**
+     * @param label Partition name from the partition table
+     * @return False if the partition is missing or cannot be mapped
+     */
+    bool open(const char* label) {
+        close();
+        const esp_partition_t* partition =
+            esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+        if (!partition) return false;
+        if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &address, &handle) != ESP_OK) {
+            address = nullptr;
+            return false;
+        }
+        length = partition->size;
+        return true;
+    }
+
+    void close() {
+        if (address) esp_partition_munmap(handle);
+        address = nullptr;
+        length = 0;
+    }
+
+    const void* data() const { return address; }
+    size_t size() const { return length; }
+
+private:
+    const void* address;
+    size_t length;
+    esp_partition_mmap_handle_t handle;
+};
+#elif defined(__unix__) || defined(__APPLE__)
+/**
+ * Read-only memory-mapped file (host)
+ */
+class MappedFile {
+public:
+    MappedFile() : address(nullptr), length(0) {}
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @return False if the file cannot be opened or mapped
+     */
+    bool open(const char* path) {
+        close();
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) return false;
+        address = mapped;
+        length = (size_t)info.st_size;
+        return true;
+    }
+
+    void close() {
+        if (address) munmap(address, length);
+        address = nullptr;
+        length = 0;
+    }
+
+    const void* data() const { return address; }
+    size_t size() const { return length; }
+
+private:
+    void* address;
+    size_t length;
+};
+#endif
+
+} // namespace dqn
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // DQN_MODEL_BLOB_H
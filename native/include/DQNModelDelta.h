@@ -0,0 +1,229 @@
+/**
+ * Two-Wheel Balancing Robot DQN Model Deltas
+ *
+ * Applies the delta format written by src/export/ModelDelta.js: only the
+ * bytes of a new model blob that differ from a base blob, so a fine-tune
+ * crosses a slow radio link in tens of bytes instead of the whole blob.
+ * DoubleBufferedPolicy (DQNPolicySlots.h) rebuilds the new blob in its
+ * inactive slot from the active one:
+ *
+ *   policy.beginDeltaUpdate(deltaSize);
+ *   policy.writeUpdate(chunk, chunkSize);           // repeat
+ *   if (policy.commitUpdate() != dqn::BLOB_OK) ...  // rejected, old policy stays
+ *
+ * - The delta names its base by model ID, the CRC-32 field of the base
+ *   blob; a delta for any other blob is refused before the slot is erased
+ *   (BLOB_BASE_MISMATCH)
+ * - ModelDeltaPatcher streams: the slot is written front to back as the
+ *   delta arrives, base bytes between records are copied through a small
+ *   stack buffer, and nothing is held beyond the current record header
+ * - The delta's CRC-32 catches transfer errors; the rebuilt blob is then
+ *   bound like any other update, so its own CRC-32 catches a wrong base or
+ *   a bad write
+ *
+ * Requires C++11.
+ */
+
+#ifndef DQN_MODEL_DELTA_H
+#define DQN_MODEL_DELTA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "DQNModelBlob.h"
+
+namespace dqn {
+
+static const uint16_t MODEL_DELTA_VERSION = 1;
+
+/**
+ * Fixed 24-byte header at the start of every delta (see ModelDelta.js)
+ * Records follow: uint32 offset, uint32 length, then length bytes of the
+ * new blob at that offset, ascending and non-overlapping.
+ */
+struct ModelDeltaHeader {
+    char magic[4];        // "DQND"
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t crc;         // CRC-32 of bytes 12 .. totalSize
+    uint32_t totalSize;
+    uint32_t baseId;      // crc field of the base blob
+    uint32_t targetSize;  // Size of the blob the delta produces
+};
+
+static_assert(sizeof(ModelDeltaHeader) == 24, "ModelDeltaHeader must match the 24-byte file header");
+
+static const size_t MODEL_DELTA_RECORD_SIZE = 8;
+
+/**
+ * Streaming delta application into one storage slot
+ * @tparam Storage As DoubleBufferedPolicy (begin, write)
+ */
+template <typename Storage>
+class ModelDeltaPatcher {
+public:
+    ModelDeltaPatcher()
+        : storage(nullptr), slot(-1), base(nullptr), baseSize(0), baseId(0), capacity(0), deltaSize(0),
+          consumed(0), written(0), remaining(0), buffered(0), crc(0), status(BLOB_TOO_SMALL) {
+        memset(&head, 0, sizeof(head));
+    }
+
+    /**
+     * Prepare for a delta of size bytes into targetSlot
+     * The slot is erased once the header has arrived and checked out.
+     * @param targetCapacity Largest blob the slot holds
+     * @param baseBlob Bound base blob (the active slot); must stay readable
+     */
+    void start(Storage& target, int targetSlot, size_t targetCapacity, const ModelBlob& baseBlob, size_t size) {
+        storage = &target;
+        slot = targetSlot;
+        capacity = targetCapacity;
+        base = (const uint8_t*)baseBlob.data();
+        baseSize = baseBlob.size();
+        baseId = baseBlob.header().crc;
+        deltaSize = size;
+        consumed = 0;
+        written = 0;
+        remaining = 0;
+        buffered = 0;
+        crc = 0;
+        status = size < sizeof(ModelDeltaHeader) ? BLOB_TOO_SMALL : BLOB_OK;
+    }
+
+    /**
+     * Consume the next delta bytes
+     * @return BLOB_OK, or the first error (which sticks until start())
+     */
+    BlobStatus write(const void* data, size_t size) {
+        if (status != BLOB_OK) return status;
+        if (size > deltaSize - consumed) return fail(BLOB_TOO_SMALL);
+        const uint8_t* bytes = (const uint8_t*)data;
+        consumed += size;
+        while (size > 0 && status == BLOB_OK) {
+            if (consumed - size < sizeof(ModelDeltaHeader)) {
+                // Header
+                const size_t n = take(bytes, size, sizeof(ModelDeltaHeader));
+                if (buffered == sizeof(ModelDeltaHeader)) readHeader();
+                bytes += n;
+                size -= n;
+            } else if (remaining > 0) {
+                // Record data
+                const size_t n = size < remaining ? size : remaining;
+                crc = crc32(bytes, n, crc);
+                if (!storage->write(slot, written, bytes, n)) return fail(BLOB_TOO_SMALL);
+                written += n;
+                remaining -= n;
+                bytes += n;
+                size -= n;
+            } else {
+                // Record header
+                const size_t n = take(bytes, size, MODEL_DELTA_RECORD_SIZE);
+                if (buffered == MODEL_DELTA_RECORD_SIZE) readRecord();
+                bytes += n;
+                size -= n;
+            }
+        }
+        return status;
+    }
+
+    /**
+     * Copy the base bytes after the last record and check the delta
+     * @param targetSize Size of the rebuilt blob
+     * @return BLOB_OK once every delta byte arrived and the CRC matches
+     */
+    BlobStatus finish(size_t& targetSize) {
+        if (status != BLOB_OK) return status;
+        if (consumed != deltaSize || remaining > 0 || buffered > 0) return fail(BLOB_TOO_SMALL);
+        if (crc != head.crc) return fail(BLOB_BAD_CHECKSUM);
+        if (!copyBase(head.targetSize)) return status;
+        targetSize = head.targetSize;
+        return BLOB_OK;
+    }
+
+private:
+    // Buffer up to want bytes of a fixed-size header; checksum what lands after the crc field
+    size_t take(const uint8_t* bytes, size_t size, size_t want) {
+        const size_t n = size < want - buffered ? size : want - buffered;
+        for (size_t i = 0; i < n; i++) {
+            if (want == sizeof(ModelDeltaHeader) && buffered + i < MODEL_BLOB_CRC_START) continue;
+            crc = crc32(bytes + i, 1, crc);
+        }
+        memcpy(pending + buffered, bytes, n);
+        buffered += n;
+        return n;
+    }
+
+    void readHeader() {
+        memcpy(&head, pending, sizeof(head));
+        buffered = 0;
+        if (memcmp(head.magic, "DQND", 4) != 0) {
+            fail(BLOB_BAD_MAGIC);
+        } else if (head.version != MODEL_DELTA_VERSION || head.headerSize != sizeof(ModelDeltaHeader)) {
+            fail(BLOB_BAD_VERSION);
+        } else if (head.totalSize != deltaSize) {
+            fail(BLOB_TOO_SMALL);
+        } else if (head.baseId != baseId) {
+            fail(BLOB_BASE_MISMATCH);
+        } else if (head.targetSize < sizeof(ModelBlobHeader) || head.targetSize > capacity ||
+                   !storage->begin(slot, head.targetSize)) {
+            fail(BLOB_TOO_SMALL);
+        }
+    }
+
+    void readRecord() {
+        uint32_t offset, length;
+        memcpy(&offset, pending, 4);
+        memcpy(&length, pending + 4, 4);
+        buffered = 0;
+        if (offset < written || offset > head.targetSize || length > head.targetSize - offset) {
+            fail(BLOB_BAD_TENSOR);
+            return;
+        }
+        if (copyBase(offset)) remaining = length;
+    }
+
+    // Fill the slot from the base up to end
+    bool copyBase(size_t end) {
+        if (written < end && end > baseSize) {
+            fail(BLOB_BAD_TENSOR);
+            return false;
+        }
+        uint8_t chunk[64];
+        while (written < end) {
+            const size_t n = end - written < sizeof(chunk) ? end - written : sizeof(chunk);
+            memcpy(chunk, base + written, n);
+            if (!storage->write(slot, written, chunk, n)) {
+                fail(BLOB_TOO_SMALL);
+                return false;
+            }
+            written += n;
+        }
+        return true;
+    }
+
+    BlobStatus fail(BlobStatus error) {
+        status = error;
+        return status;
+    }
+
+    Storage* storage;
+    int slot;
+    const uint8_t* base;
+    size_t baseSize;
+    uint32_t baseId;
+    size_t capacity;
+    size_t deltaSize;
+    size_t consumed;    // Delta bytes received
+    size_t written;     // Slot bytes written
+    size_t remaining;   // Data bytes left in the current record
+    size_t buffered;    // Bytes of the header or record header in pending
+    uint32_t crc;       // Running CRC-32 of delta bytes 12 onwards
+    BlobStatus status;
+    ModelDeltaHeader head;
+    uint8_t pending[sizeof(ModelDeltaHeader)];
+};
+
+} // namespace dqn
+
+#endif // DQN_MODEL_DELTA_H
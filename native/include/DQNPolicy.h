@@ -0,0 +1,994 @@
+/**
+ * Two-Wheel Balancing Robot DQN Policy
+ *
+ * Shared inference code for every exported TwoWheelBotDQN model. An export
+ * only defines its weight tables and instantiates DQNPolicy with them, so
+ * adding a model does not duplicate the network code in the firmware image.
+ *
+ * - Architecture is a set of template parameters, so every loop has a
+ *   compile-time trip count and is fully unrolled (define DQN_NO_UNROLL to
+ *   keep plain loops when flash is tighter than cycles)
+ * - Define DQN_USE_SIMD (SSE/NEON), DQN_USE_CMSIS_DSP or DQN_USE_ESP_DSP
+ *   to run the float layers through the kernels in DQNKernels.h
+ * - Weight tables are static flash data: PROGMEM on AVR (read back with
+ *   pgm_read_*), constexpr .rodata elsewhere
+ * - Single-timestep policy instances hold no data; multi-timestep models
+ *   (INPUT_SIZE = 2 * historyTimesteps) keep a fixed-size state history
+ * - Single-timestep models can also be exported as an action lookup table
+ *   (DQNLookupPolicy): one table read per tick, no network at all
+ * - Define DQN_PROFILE to time every forward()/getAction call into
+ *   dqn::executionProfile<Policy>() (DQNProfiler.h); without it the hook
+ *   compiles to nothing
+ * - Inference is single-precision only: with GCC/Clang any implicit double
+ *   promotion in this header is a compile error. To confirm the object
+ *   code has no double-precision helpers, check that
+ *     nm model.o | grep -E '__(add|sub|mul|div|extendsf|truncdf)[sd]f|__aeabi_d'
+ *   prints nothing.
+ *
+ * Requires C++11.
+ */
+
+#ifndef DQN_POLICY_H
+#define DQN_POLICY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define DQN_FLASH const
+#define DQN_PROGMEM PROGMEM
+#define DQN_READ_FLOAT(addr) pgm_read_float(addr)
+#define DQN_READ_INT8(addr) ((int8_t)pgm_read_byte(addr))
+#define DQN_READ_UINT8(addr) ((uint8_t)pgm_read_byte(addr))
+#define DQN_READ_INT32(addr) ((int32_t)pgm_read_dword(addr))
+#else
+#define DQN_FLASH constexpr
+#define DQN_PROGMEM
+#define DQN_READ_FLOAT(addr) (*(addr))
+#define DQN_READ_INT8(addr) (*(addr))
+#define DQN_READ_UINT8(addr) (*(addr))
+#define DQN_READ_INT32(addr) (*(addr))
+#endif
+
+#if defined(__GNUC__)
+#define DQN_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define DQN_ALWAYS_INLINE inline
+#endif
+
+#if defined(DQN_USE_CMSIS_DSP) || defined(DQN_USE_ESP_DSP) || defined(DQN_USE_SIMD)
+#include "DQNKernels.h"
+#else
+#define DQN_KERNEL_NAME "scalar"
+#endif
+
+#if defined(DQN_PROFILE)
+#include "DQNProfiler.h"
+#define DQN_PROFILE_SCOPE(Policy) dqn::ProfileScope dqnProfileScope(dqn::executionProfile<Policy>())
+#else
+#define DQN_PROFILE_SCOPE(Policy)
+#endif
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wdouble-promotion"
+#pragma GCC diagnostic error "-Wfloat-conversion"
+#endif
+
+namespace dqn {
+
+// Input normalization as multiplies: 1 / (PI / 3) and 1 / 10 rad/s
+static constexpr float ANGLE_SCALE = 0.95492965f;
+static constexpr float ANGULAR_VELOCITY_SCALE = 0.100000001f;
+
+// Same normalization folded with the int8 input scale (127)
+static constexpr float QUANTIZED_ANGLE_SCALE = 121.27607f;
+static constexpr float QUANTIZED_ANGULAR_VELOCITY_SCALE = 12.6999998f;
+
+// Motor torque for each action index (left, brake, right)
+static DQN_FLASH float ACTION_TORQUES[3] DQN_PROGMEM = {-1.0f, 0.0f, 1.0f};
+
+/**
+ * CPUBackend weight layout
+ * weightsInputHidden is input-major (i * Hidden + h),
+ * weightsHiddenOutput is hidden-major (h * Out + o)
+ */
+struct InputMajor {
+    template <int In, int Hidden, int Out>
+    struct Dims {
+        static const int INPUT_HIDDEN_SIZE = In * Hidden;
+        static const int HIDDEN_OUTPUT_SIZE = Hidden * Out;
+
+        static constexpr int inputHidden(int i, int h) { return i * Hidden + h; }
+        static constexpr int hiddenOutput(int h, int o) { return h * Out + o; }
+    };
+};
+
+/**
+ * Transposed layout: each neuron's weights are contiguous
+ * weightsInputHidden is hidden-major (h * INPUT_STRIDE + i),
+ * weightsHiddenOutput is output-major (o * HIDDEN_STRIDE + h).
+ * Rows are zero-padded to a multiple of Align floats.
+ */
+template <int Align = 1>
+struct NeuronMajor {
+    template <int In, int Hidden, int Out>
+    struct Dims {
+        static const int INPUT_STRIDE = (In + Align - 1) / Align * Align;
+        static const int HIDDEN_STRIDE = (Hidden + Align - 1) / Align * Align;
+        static const int INPUT_HIDDEN_SIZE = Hidden * INPUT_STRIDE;
+        static const int HIDDEN_OUTPUT_SIZE = Out * HIDDEN_STRIDE;
+
+        static constexpr int inputHidden(int i, int h) { return h * INPUT_STRIDE + i; }
+        static constexpr int hiddenOutput(int h, int o) { return o * HIDDEN_STRIDE + h; }
+    };
+};
+
+/**
+ * Float weight tables (CPUBackend layout unless Layout says otherwise)
+ */
+template <int In, int Hidden, int Out, typename Layout = InputMajor>
+struct DQNWeights {
+    typedef typename Layout::template Dims<In, Hidden, Out> Dims;
+
+    float weightsInputHidden[Dims::INPUT_HIDDEN_SIZE];
+    float biasHidden[Hidden];
+    float weightsHiddenOutput[Dims::HIDDEN_OUTPUT_SIZE];
+    float biasOutput[Out];
+};
+
+/**
+ * Quantized weight tables: int8 weights, int32 biases in accumulator units
+ */
+template <int In, int Hidden, int Out>
+struct DQNQuantizedWeights {
+    int8_t weightsInputHidden[In * Hidden];
+    int32_t biasHidden[Hidden];
+    int8_t weightsHiddenOutput[Hidden * Out];
+    int32_t biasOutput[Out];
+};
+
+/**
+ * Branch-free selection: condition ? a : b as a compare and a bit mask
+ * Keeps data-dependent branches out of the inference path, so every call
+ * runs the same instruction sequence (compare/select, cmov or csel).
+ */
+template <typename T>
+static DQN_ALWAYS_INLINE T choose(bool condition, T a, T b) {
+    const T mask = (T)((T)0 - (T)condition);
+    return (T)((a & mask) | (b & (T)~mask));
+}
+
+static DQN_ALWAYS_INLINE float choose(bool condition, float a, float b) {
+    uint32_t bitsA, bitsB;
+    memcpy(&bitsA, &a, sizeof(bitsA));
+    memcpy(&bitsB, &b, sizeof(bitsB));
+    const uint32_t bits = choose<uint32_t>(condition, bitsA, bitsB);
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/**
+ * Rectified linear activation (float and integer accumulators)
+ */
+struct ReLU {
+    static DQN_ALWAYS_INLINE float apply(float x) { return choose(x > 0.0f, x, 0.0f); }
+    // Sign mask: negative accumulators shift to all ones (arithmetic shift)
+    static DQN_ALWAYS_INLINE int32_t apply(int32_t x) { return x & ~(x >> 31); }
+};
+
+/**
+ * Compile-time loop: calls f(0) ... f(N - 1)
+ */
+#if defined(DQN_NO_UNROLL)
+template <int N>
+struct Unroll {
+    template <typename F>
+    static DQN_ALWAYS_INLINE void run(F& f) {
+        for (int i = 0; i < N; i++) f(i);
+    }
+};
+#else
+template <int N>
+struct Unroll {
+    template <typename F>
+    static DQN_ALWAYS_INLINE void run(F& f) {
+        Unroll<N - 1>::run(f);
+        f(N - 1);
+    }
+};
+
+template <>
+struct Unroll<0> {
+    template <typename F>
+    static DQN_ALWAYS_INLINE void run(F&) {}
+};
+#endif
+
+static DQN_ALWAYS_INLINE float constrain(float value, float min, float max) {
+    value = choose(value < min, min, value);
+    return choose(value > max, max, value);
+}
+
+/**
+ * Index of the first maximum, without data-dependent branches
+ */
+template <int Out, typename T>
+static DQN_ALWAYS_INLINE int argmax(const T* values) {
+    T maxValue = values[0];
+    int bestAction = 0;
+    for (int o = 1; o < Out; o++) {
+        const bool better = values[o] > maxValue;
+        maxValue = choose(better, values[o], maxValue);
+        bestAction = choose(better, o, bestAction);
+    }
+    return bestAction;
+}
+
+/**
+ * Gap between the best and second-best value (confidence of the argmax)
+ * @param values Q-values or accumulators [Out], Out >= 2
+ * @return top-1 minus top-2, zero on a tie
+ */
+template <int Out, typename T>
+static DQN_ALWAYS_INLINE T margin(const T* values) {
+    static_assert(Out >= 2, "margin needs at least two outputs");
+    T best = values[0] > values[1] ? values[0] : values[1];
+    T second = values[0] > values[1] ? values[1] : values[0];
+    for (int o = 2; o < Out; o++) {
+        if (values[o] > best) {
+            second = best;
+            best = values[o];
+        } else if (values[o] > second) {
+            second = values[o];
+        }
+    }
+    return best - second;
+}
+
+/**
+ * Float forward pass over normalized inputs
+ */
+template <int In, int Hidden, int Out, typename Activation, typename Layout = InputMajor>
+struct DQNNetwork {
+    typedef DQNWeights<In, Hidden, Out, Layout> Weights;
+    typedef typename Weights::Dims Dims;
+
+    struct HiddenUnit {
+        const Weights& w;
+        const float* input;
+        float* hidden;
+        int h;
+
+        DQN_ALWAYS_INLINE void operator()(int i) {
+            hidden[h] += input[i] * DQN_READ_FLOAT(&w.weightsInputHidden[Dims::inputHidden(i, h)]);
+        }
+    };
+
+    struct HiddenLayer {
+        const Weights& w;
+        const float* input;
+        float* hidden;
+
+        DQN_ALWAYS_INLINE void operator()(int h) {
+            hidden[h] = DQN_READ_FLOAT(&w.biasHidden[h]);
+            HiddenUnit unit = {w, input, hidden, h};
+            Unroll<In>::run(unit);
+            hidden[h] = Activation::apply(hidden[h]);
+        }
+    };
+
+    struct ActivateHidden {
+        float* hidden;
+
+        DQN_ALWAYS_INLINE void operator()(int h) { hidden[h] = Activation::apply(hidden[h]); }
+    };
+
+    struct OutputUnit {
+        const Weights& w;
+        const float* hidden;
+        float* output;
+        int o;
+
+        DQN_ALWAYS_INLINE void operator()(int h) {
+            output[o] += hidden[h] * DQN_READ_FLOAT(&w.weightsHiddenOutput[Dims::hiddenOutput(h, o)]);
+        }
+    };
+
+    struct OutputLayer {
+        const Weights& w;
+        const float* hidden;
+        float* output;
+
+        DQN_ALWAYS_INLINE void operator()(int o) {
+            output[o] = DQN_READ_FLOAT(&w.biasOutput[o]);
+            OutputUnit unit = {w, hidden, output, o};
+            Unroll<Hidden>::run(unit);
+        }
+    };
+
+    /**
+     * Compute Q-values
+     * @param w Weight tables
+     * @param input Normalized inputs [In]
+     * @param output Q-values [Out]
+     */
+    static DQN_ALWAYS_INLINE void forward(const Weights& w, const float* input, float* output) {
+        float hidden[Hidden];
+#if defined(DQN_KERNELS_H)
+        // Kernels work on the row-major CPUBackend layout
+        if (kernels::Supports<Layout>::value) {
+            kernels::Dense<In, Hidden>::run(input, w.weightsInputHidden, w.biasHidden, hidden);
+            ActivateHidden activate = {hidden};
+            Unroll<Hidden>::run(activate);
+
+            kernels::Dense<Hidden, Out>::run(hidden, w.weightsHiddenOutput, w.biasOutput, output);
+            return;
+        }
+#endif
+        HiddenLayer hiddenLayer = {w, input, hidden};
+        Unroll<Hidden>::run(hiddenLayer);
+
+        OutputLayer outputLayer = {w, hidden, output};
+        Unroll<Out>::run(outputLayer);
+    }
+
+    // Rows evaluated per weight load by forwardBlock
+    static const int BLOCK_ROWS = 4;
+
+    /**
+     * Compute Q-values for BLOCK_ROWS states at once
+     * Each weight is read once per block and applied to every row, and the
+     * fixed-width row loops vectorize across rows. Rows accumulate in the
+     * same order as forward(), so results are bit-identical to it.
+     * Uses Hidden * BLOCK_ROWS floats of stack (host-oriented).
+     * @param w Weight tables
+     * @param input Normalized inputs, structure of arrays [In][BLOCK_ROWS]
+     * @param output Q-values, structure of arrays [Out][BLOCK_ROWS]
+     */
+    static void forwardBlock(const Weights& w, const float* input, float* output) {
+        float hidden[Hidden * BLOCK_ROWS];
+        for (int h = 0; h < Hidden; h++) {
+            float* acc = &hidden[h * BLOCK_ROWS];
+            const float bias = DQN_READ_FLOAT(&w.biasHidden[h]);
+            for (int r = 0; r < BLOCK_ROWS; r++) acc[r] = bias;
+            for (int i = 0; i < In; i++) {
+                const float weight = DQN_READ_FLOAT(&w.weightsInputHidden[Dims::inputHidden(i, h)]);
+                for (int r = 0; r < BLOCK_ROWS; r++) acc[r] += input[i * BLOCK_ROWS + r] * weight;
+            }
+            for (int r = 0; r < BLOCK_ROWS; r++) acc[r] = Activation::apply(acc[r]);
+        }
+
+        for (int o = 0; o < Out; o++) {
+            float* acc = &output[o * BLOCK_ROWS];
+            const float bias = DQN_READ_FLOAT(&w.biasOutput[o]);
+            for (int r = 0; r < BLOCK_ROWS; r++) acc[r] = bias;
+            for (int h = 0; h < Hidden; h++) {
+                const float weight = DQN_READ_FLOAT(&w.weightsHiddenOutput[Dims::hiddenOutput(h, o)]);
+                for (int r = 0; r < BLOCK_ROWS; r++) acc[r] += hidden[h * BLOCK_ROWS + r] * weight;
+            }
+        }
+    }
+};
+
+/**
+ * Integer forward pass over int8 inputs
+ * Hidden activations are requantized to int16 as (acc + round) >> HiddenShift
+ */
+template <int In, int Hidden, int Out, typename Activation, int HiddenShift>
+struct DQNQuantizedNetwork {
+    typedef DQNQuantizedWeights<In, Hidden, Out> Weights;
+
+    static const int32_t HIDDEN_ROUND = HiddenShift > 0 ? (int32_t)1 << (HiddenShift > 0 ? HiddenShift - 1 : 0) : 0;
+
+    struct HiddenUnit {
+        const Weights& w;
+        const int8_t* input;
+        int32_t& acc;
+        int h;
+
+        DQN_ALWAYS_INLINE void operator()(int i) {
+            acc += (int16_t)input[i] * (int16_t)DQN_READ_INT8(&w.weightsInputHidden[i * Hidden + h]);
+        }
+    };
+
+    struct HiddenLayer {
+        const Weights& w;
+        const int8_t* input;
+        int16_t* hidden;
+
+        DQN_ALWAYS_INLINE void operator()(int h) {
+            int32_t acc = DQN_READ_INT32(&w.biasHidden[h]);
+            HiddenUnit unit = {w, input, acc, h};
+            Unroll<In>::run(unit);
+            acc = Activation::apply(acc);
+            hidden[h] = (int16_t)((acc + HIDDEN_ROUND) >> HiddenShift);
+        }
+    };
+
+    struct OutputUnit {
+        const Weights& w;
+        const int16_t* hidden;
+        int32_t* output;
+        int o;
+
+        DQN_ALWAYS_INLINE void operator()(int h) {
+            output[o] += (int32_t)hidden[h] * DQN_READ_INT8(&w.weightsHiddenOutput[h * Out + o]);
+        }
+    };
+
+    struct OutputLayer {
+        const Weights& w;
+        const int16_t* hidden;
+        int32_t* output;
+
+        DQN_ALWAYS_INLINE void operator()(int o) {
+            output[o] = DQN_READ_INT32(&w.biasOutput[o]);
+            OutputUnit unit = {w, hidden, output, o};
+            Unroll<Hidden>::run(unit);
+        }
+    };
+
+    /**
+     * Compute output accumulators (Q-values in units of the output scale)
+     * @param w Weight tables
+     * @param input int8 inputs [In]
+     * @param output Accumulators [Out]
+     */
+    static DQN_ALWAYS_INLINE void forward(const Weights& w, const int8_t* input, int32_t* output) {
+        int16_t hidden[Hidden];
+        HiddenLayer hiddenLayer = {w, input, hidden};
+        Unroll<Hidden>::run(hiddenLayer);
+
+        OutputLayer outputLayer = {w, hidden, output};
+        Unroll<Out>::run(outputLayer);
+    }
+};
+
+/**
+ * Clamp to [-127, 127] and round half away from zero
+ */
+static DQN_ALWAYS_INLINE int8_t quantizeInput(float value) {
+    value = constrain(value, -127.0f, 127.0f);
+    return (int8_t)(value + choose(value < 0.0f, -0.5f, 0.5f));
+}
+
+/**
+ * One state, normalized once for every policy that reads it
+ * All exported policies take it in place of (angle, angularVelocity), so
+ * several policies evaluated on the same tick (PolicyEnsemble) share the
+ * normalization. Members a policy does not read compile away.
+ */
+struct PolicyInput {
+    float angle;
+    float angularVelocity;
+    // Clamped to [-1, 1] (float policies)
+    float frame[2];
+    // Quantized to [-127, 127] (int8 policies)
+    int8_t quantized[2];
+
+    DQN_ALWAYS_INLINE PolicyInput(float angle, float angularVelocity) : angle(angle), angularVelocity(angularVelocity) {
+        frame[0] = constrain(angle * ANGLE_SCALE, -1.0f, 1.0f);
+        frame[1] = constrain(angularVelocity * ANGULAR_VELOCITY_SCALE, -1.0f, 1.0f);
+        quantized[0] = quantizeInput(angle * QUANTIZED_ANGLE_SCALE);
+        quantized[1] = quantizeInput(angularVelocity * QUANTIZED_ANGULAR_VELOCITY_SCALE);
+    }
+};
+
+/**
+ * Input stages: how a policy turns a PolicyInput into network inputs
+ * frame() feeds float networks, quantized() int8 networks and normalized()
+ * lookup tables; each returns either a PolicyInput member or storage.
+ */
+
+/**
+ * Fixed normalization (maxAngle = PI / 3, 10 rad/s), shared through
+ * PolicyInput; exports without their own input stage use it
+ */
+struct NormalizedInput {
+    static DQN_ALWAYS_INLINE const float* frame(const PolicyInput& input, float*) { return input.frame; }
+    static DQN_ALWAYS_INLINE const int8_t* quantized(const PolicyInput& input, int8_t*) { return input.quantized; }
+    static DQN_ALWAYS_INLINE const float* normalized(const PolicyInput& input, float*) { return input.frame; }
+};
+
+/**
+ * Normalization folded into the first layer of a float export
+ * The network reads the raw state clamped to +/-Limits::maxAngle() rad and
+ * +/-Limits::maxAngularVelocity() rad/s; its input weights hold the 1 / limit
+ * scale, which leaves the clamp as the only per-tick input work.
+ */
+template <typename Limits>
+struct FoldedInput {
+    static DQN_ALWAYS_INLINE const float* frame(const PolicyInput& input, float* storage) {
+        storage[0] = constrain(input.angle, -Limits::maxAngle(), Limits::maxAngle());
+        storage[1] = constrain(input.angularVelocity, -Limits::maxAngularVelocity(), Limits::maxAngularVelocity());
+        return storage;
+    }
+};
+
+/**
+ * Per-model normalization constants of int8 and lookup-table exports
+ * Scales::angleScale() and angularVelocityScale() map radians and rad/s to
+ * the policy's input units: LSBs (127 / limit) for int8, [-1, 1] (1 / limit)
+ * for lookup tables.
+ */
+template <typename Scales>
+struct ScaledInput {
+    static DQN_ALWAYS_INLINE const int8_t* quantized(const PolicyInput& input, int8_t* storage) {
+        storage[0] = quantizeInput(input.angle * Scales::angleScale());
+        storage[1] = quantizeInput(input.angularVelocity * Scales::angularVelocityScale());
+        return storage;
+    }
+
+    static DQN_ALWAYS_INLINE const float* normalized(const PolicyInput& input, float* storage) {
+        storage[0] = constrain(input.angle * Scales::angleScale(), -1.0f, 1.0f);
+        storage[1] = constrain(input.angularVelocity * Scales::angularVelocityScale(), -1.0f, 1.0f);
+        return storage;
+    }
+};
+
+/**
+ * Rolling buffer of past normalized frames for multi-timestep models
+ *
+ * Matches the simulator's StateHistory: newest frame first, laid out as
+ * [angle0, angVel0, angle1, angVel1, ...]. A default-constructed buffer
+ * holds zeros (StateHistory padding); reset() fills every slot with one
+ * frame, as BalancingRobot.reset does.
+ *
+ * Each frame is stored twice, at slot and slot + Timesteps, so the window
+ * starting at the newest frame is always contiguous: a push is two frame
+ * writes and no shifting.
+ */
+template <typename T, int Timesteps>
+class StateHistory {
+public:
+    StateHistory() : head(0) {
+        for (int i = 0; i < 2 * Timesteps * 2; i++) frames[i] = 0;
+    }
+
+    /**
+     * Fill every timestep with one frame
+     * @param frame Normalized [angle, angVel]
+     */
+    void reset(const T* frame) {
+        head = 0;
+        for (int t = 0; t < 2 * Timesteps; t++) {
+            frames[t * 2] = frame[0];
+            frames[t * 2 + 1] = frame[1];
+        }
+    }
+
+    /**
+     * Add the newest frame
+     * @param frame Normalized [angle, angVel]
+     * @return Network input window [Timesteps * 2], newest first
+     */
+    const T* push(const T* frame) {
+        head = choose(head == 0, Timesteps - 1, head - 1);
+        T* slot = &frames[head * 2];
+        slot[0] = slot[Timesteps * 2] = frame[0];
+        slot[1] = slot[Timesteps * 2 + 1] = frame[1];
+        return slot;
+    }
+
+private:
+    T frames[2 * Timesteps * 2];
+    int head;
+};
+
+/**
+ * Single-timestep models need no history: the current frame is the input
+ */
+template <typename T>
+class StateHistory<T, 1> {
+public:
+    void reset(const T*) {}
+    const T* push(const T* frame) { return frame; }
+};
+
+/**
+ * Float policy bound to a weight table in flash, in any weight layout
+ *
+ * Usage:
+ *   static DQN_FLASH dqn::DQNWeights<2, 64, 3, dqn::NeuronMajor<4> > weights DQN_PROGMEM = {...};
+ *   typedef dqn::DQNLayoutPolicy<2, 64, 3, dqn::ReLU, dqn::NeuronMajor<4>, weights> TwoWheelBotDQN;
+ *
+ * Input is the input stage: NormalizedInput, or FoldedInput<Limits> for
+ * exports whose first layer holds the normalization.
+ */
+template <int In, int Hidden, int Out, typename Activation, typename Layout,
+          const DQNWeights<In, Hidden, Out, Layout>& W, typename Input = NormalizedInput>
+class DQNLayoutPolicy : private StateHistory<float, In / 2> {
+public:
+    static const int INPUT_SIZE = In;
+    static const int HIDDEN_SIZE = Hidden;
+    static const int OUTPUT_SIZE = Out;
+    static const int HISTORY_TIMESTEPS = In / 2;
+
+    static_assert(In % 2 == 0 && In / 2 >= 1 && In / 2 <= 8,
+                  "INPUT_SIZE must be 2 * historyTimesteps (1-8)");
+
+    typedef DQNNetwork<In, Hidden, Out, Activation, Layout> Network;
+    typedef StateHistory<float, In / 2> History;
+
+    /**
+     * Fill the state history with one state (call when the robot starts
+     * balancing; without it the history starts as zeros)
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     */
+    void reset(float angle, float angularVelocity) {
+        float frame[2];
+        History::reset(Input::frame(PolicyInput(angle, angularVelocity), frame));
+    }
+
+    /**
+     * Run the network on the current state
+     * Multi-timestep models also record the state in their history, so call
+     * this (or getAction) once per control tick.
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @param qValues Output Q-values [OUTPUT_SIZE]; pass to dqn::margin<OUTPUT_SIZE>
+     *                for the top-1/top-2 gap
+     * @return Action index (0=left, 1=brake, 2=right)
+     */
+    int forward(float angle, float angularVelocity, float* qValues) {
+        return forward(PolicyInput(angle, angularVelocity), qValues);
+    }
+
+    /**
+     * Run the network on an already normalized state
+     */
+    int forward(const PolicyInput& input, float* qValues) {
+        DQN_PROFILE_SCOPE(DQNLayoutPolicy);
+        float frame[2];
+        Network::forward(W, History::push(Input::frame(input, frame)), qValues);
+        return argmax<Out>(qValues);
+    }
+
+    /**
+     * Get action from current state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @return Action index (0=left, 1=brake, 2=right)
+     */
+    int getAction(float angle, float angularVelocity) {
+        return getAction(PolicyInput(angle, angularVelocity));
+    }
+
+    int getAction(const PolicyInput& input) {
+        float qValues[Out];
+        return forward(input, qValues);
+    }
+
+    /**
+     * Get actions for many independent states (offline scoring of logs)
+     * Evaluates Network::BLOCK_ROWS rows per weight load; actions match
+     * getAction row for row. Does not touch the state history.
+     * @param angles Robot angles in radians [n]
+     * @param angularVelocities Angular velocities in rad/s [n]
+     * @param actions Output action indices [n]
+     * @param n Number of states
+     */
+    void getActions(const float* angles, const float* angularVelocities, int* actions, size_t n) const {
+        static_assert(In == 2, "getActions evaluates independent states and needs a single-timestep model");
+        const int B = Network::BLOCK_ROWS;
+
+        float input[In * B];
+        float output[Out * B];
+        for (size_t start = 0; start < n; start += B) {
+            const int rows = n - start < (size_t)B ? (int)(n - start) : B;
+            // A short last block repeats its first row in the unused lanes
+            for (int r = 0; r < B; r++) {
+                const size_t row = start + (r < rows ? r : 0);
+                float storage[2];
+                const float* frame = Input::frame(PolicyInput(angles[row], angularVelocities[row]), storage);
+                input[r] = frame[0];
+                input[B + r] = frame[1];
+            }
+
+            Network::forwardBlock(W, input, output);
+
+            for (int r = 0; r < rows; r++) {
+                float q[Out];
+                for (int o = 0; o < Out; o++) q[o] = output[o * B + r];
+                actions[start + r] = argmax<Out>(q);
+            }
+        }
+    }
+
+    /**
+     * Get motor torque for action
+     * @param action Action index
+     * @return Motor torque (-1.0 to 1.0)
+     */
+    float getMotorTorque(int action) const {
+        return DQN_READ_FLOAT(&ACTION_TORQUES[action]);
+    }
+};
+
+/**
+ * Float policy over CPUBackend-layout weights
+ *
+ * Usage:
+ *   static DQN_FLASH dqn::DQNWeights<2, 64, 3> weights DQN_PROGMEM = {...};
+ *   typedef dqn::DQNPolicy<2, 64, 3, dqn::ReLU, weights> TwoWheelBotDQN;
+ */
+template <int In, int Hidden, int Out, typename Activation, const DQNWeights<In, Hidden, Out>& W,
+          typename Input = NormalizedInput>
+using DQNPolicy = DQNLayoutPolicy<In, Hidden, Out, Activation, InputMajor, W, Input>;
+
+/**
+ * Float policy over action-difference weights
+ *
+ * The output layer holds Out - 1 rows: row o computes Q[o + 1] - Q[0]
+ * (weights and bias differences of the CPUBackend tables). Q[0] is taken
+ * as zero, so the argmax and the top-1/top-2 margin are those of the full
+ * network, from Out - 1 output dot products instead of Out. Differences
+ * are rounded once at export, so an action can differ from DQNPolicy's
+ * only where two Q-values tie to within float rounding.
+ *
+ * Usage:
+ *   static DQN_FLASH dqn::DQNWeights<2, 64, 2> weights DQN_PROGMEM = {...};
+ *   typedef dqn::DQNDifferencePolicy<2, 64, 3, dqn::ReLU, weights> TwoWheelBotDQN;
+ */
+template <int In, int Hidden, int Out, typename Activation, const DQNWeights<In, Hidden, Out - 1>& W,
+          typename Input = NormalizedInput>
+class DQNDifferencePolicy : private StateHistory<float, In / 2> {
+public:
+    static const int INPUT_SIZE = In;
+    static const int HIDDEN_SIZE = Hidden;
+    static const int OUTPUT_SIZE = Out;
+    static const int HISTORY_TIMESTEPS = In / 2;
+
+    static_assert(In % 2 == 0 && In / 2 >= 1 && In / 2 <= 8,
+                  "INPUT_SIZE must be 2 * historyTimesteps (1-8)");
+    static_assert(Out >= 2, "difference outputs need at least two actions");
+
+    typedef DQNNetwork<In, Hidden, Out - 1, Activation> Network;
+    typedef StateHistory<float, In / 2> History;
+
+    void reset(float angle, float angularVelocity) {
+        float frame[2];
+        History::reset(Input::frame(PolicyInput(angle, angularVelocity), frame));
+    }
+
+    /**
+     * Run the network on the current state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @param qValues Output Q-values relative to action 0 [OUTPUT_SIZE]
+     *                (qValues[0] = 0)
+     * @return Action index (0=left, 1=brake, 2=right)
+     */
+    int forward(float angle, float angularVelocity, float* qValues) {
+        return forward(PolicyInput(angle, angularVelocity), qValues);
+    }
+
+    int forward(const PolicyInput& input, float* qValues) {
+        DQN_PROFILE_SCOPE(DQNDifferencePolicy);
+        qValues[0] = 0.0f;
+        float frame[2];
+        Network::forward(W, History::push(Input::frame(input, frame)), qValues + 1);
+        return argmax<Out>(qValues);
+    }
+
+    int getAction(float angle, float angularVelocity) {
+        return getAction(PolicyInput(angle, angularVelocity));
+    }
+
+    int getAction(const PolicyInput& input) {
+        float qValues[Out];
+        return forward(input, qValues);
+    }
+
+    /**
+     * Get actions for many independent states (see DQNLayoutPolicy)
+     */
+    void getActions(const float* angles, const float* angularVelocities, int* actions, size_t n) const {
+        static_assert(In == 2, "getActions evaluates independent states and needs a single-timestep model");
+        const int B = Network::BLOCK_ROWS;
+
+        float input[In * B];
+        float output[(Out - 1) * B];
+        for (size_t start = 0; start < n; start += B) {
+            const int rows = n - start < (size_t)B ? (int)(n - start) : B;
+            for (int r = 0; r < B; r++) {
+                const size_t row = start + (r < rows ? r : 0);
+                float storage[2];
+                const float* frame = Input::frame(PolicyInput(angles[row], angularVelocities[row]), storage);
+                input[r] = frame[0];
+                input[B + r] = frame[1];
+            }
+
+            Network::forwardBlock(W, input, output);
+
+            for (int r = 0; r < rows; r++) {
+                float q[Out];
+                q[0] = 0.0f;
+                for (int o = 1; o < Out; o++) q[o] = output[(o - 1) * B + r];
+                actions[start + r] = argmax<Out>(q);
+            }
+        }
+    }
+
+    float getMotorTorque(int action) const {
+        return DQN_READ_FLOAT(&ACTION_TORQUES[action]);
+    }
+};
+
+/**
+ * Integer-only policy bound to a quantized weight table in flash
+ * API compatible with DQNPolicy. Input is NormalizedInput or
+ * ScaledInput<Scales> with the export's own 127 / limit scales.
+ */
+template <int In, int Hidden, int Out, typename Activation, int HiddenShift,
+          const DQNQuantizedWeights<In, Hidden, Out>& W, typename Input = NormalizedInput>
+class QuantizedDQNPolicy : private StateHistory<int8_t, In / 2> {
+public:
+    static const int INPUT_SIZE = In;
+    static const int HIDDEN_SIZE = Hidden;
+    static const int OUTPUT_SIZE = Out;
+    static const int HISTORY_TIMESTEPS = In / 2;
+
+    static_assert(In % 2 == 0 && In / 2 >= 1 && In / 2 <= 8,
+                  "INPUT_SIZE must be 2 * historyTimesteps (1-8)");
+
+    typedef DQNQuantizedNetwork<In, Hidden, Out, Activation, HiddenShift> Network;
+    typedef StateHistory<int8_t, In / 2> History;
+
+    /**
+     * Fill the state history with one state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     */
+    void reset(float angle, float angularVelocity) {
+        int8_t frame[2];
+        History::reset(Input::quantized(PolicyInput(angle, angularVelocity), frame));
+    }
+
+    /**
+     * Run the network on the current state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @param accumulators Output accumulators [OUTPUT_SIZE]: Q-values in units
+     *                     of the export's output scale
+     * @return Action index (0=left, 1=brake, 2=right)
+     */
+    int forward(float angle, float angularVelocity, int32_t* accumulators) {
+        return forward(PolicyInput(angle, angularVelocity), accumulators);
+    }
+
+    int forward(const PolicyInput& input, int32_t* accumulators) {
+        DQN_PROFILE_SCOPE(QuantizedDQNPolicy);
+        // Argmax directly on accumulators (single output scale)
+        int8_t frame[2];
+        Network::forward(W, History::push(Input::quantized(input, frame)), accumulators);
+        return argmax<Out>(accumulators);
+    }
+
+    /**
+     * Get action from current state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @return Action index (0=left, 1=brake, 2=right)
+     */
+    int getAction(float angle, float angularVelocity) {
+        return getAction(PolicyInput(angle, angularVelocity));
+    }
+
+    int getAction(const PolicyInput& input) {
+        int32_t accumulators[Out];
+        return forward(input, accumulators);
+    }
+
+    /**
+     * Get motor torque for action
+     * @param action Action index
+     * @return Motor torque (-1.0 to 1.0)
+     */
+    float getMotorTorque(int action) const {
+        return DQN_READ_FLOAT(&ACTION_TORQUES[action]);
+    }
+};
+
+
+/**
+ * Packed action table over the normalized (angle, angularVelocity) square
+ * Rows split the angle and columns the angular velocity, both over
+ * [-1, 1]. Cell k = row * Cols + col sits at bits
+ * (k % CELLS_PER_BYTE) * CELL_BITS of cells[k / CELLS_PER_BYTE].
+ */
+template <int Rows, int Cols, int Out>
+struct DQNActionGrid {
+    static_assert(Rows >= 1 && Cols >= 1 && Out >= 2 && Out <= 256, "grid needs cells and 2-256 actions");
+
+    static const int CELL_BITS = Out <= 2 ? 1 : Out <= 4 ? 2 : Out <= 16 ? 4 : 8;
+    static const int CELLS_PER_BYTE = 8 / CELL_BITS;
+    static const int BYTES = (Rows * Cols + CELLS_PER_BYTE - 1) / CELLS_PER_BYTE;
+
+    uint8_t cells[BYTES];
+};
+
+/**
+ * Single-timestep policy as an action lookup table in flash
+ * API compatible with DQNPolicy for getAction, getActions and
+ * getMotorTorque; a table has no Q-values, so there is no forward().
+ * Input is NormalizedInput or ScaledInput<Scales> with the export's own
+ * 1 / limit scales.
+ *
+ * Usage:
+ *   static DQN_FLASH dqn::DQNActionGrid<32, 32, 3> table DQN_PROGMEM = {...};
+ *   typedef dqn::DQNLookupPolicy<32, 32, 3, table> TwoWheelBotDQNLookup;
+ */
+template <int Rows, int Cols, int Out, const DQNActionGrid<Rows, Cols, Out>& G, typename Input = NormalizedInput>
+class DQNLookupPolicy {
+public:
+    static const int INPUT_SIZE = 2;
+    static const int OUTPUT_SIZE = Out;
+    static const int HISTORY_TIMESTEPS = 1;
+    static const int ROWS = Rows;
+    static const int COLS = Cols;
+
+    typedef DQNActionGrid<Rows, Cols, Out> Grid;
+
+    void reset(float, float) {}
+
+    /**
+     * Get action from current state
+     * @param angle Robot angle in radians
+     * @param angularVelocity Angular velocity in rad/s
+     * @return Action index (0=left, 1=brake, 2=right)
+     */
+    int getAction(float angle, float angularVelocity) const {
+        return getAction(PolicyInput(angle, angularVelocity));
+    }
+
+    int getAction(const PolicyInput& input) const {
+        DQN_PROFILE_SCOPE(DQNLookupPolicy);
+        float frame[2];
+        return lookup(Input::normalized(input, frame));
+    }
+
+    /**
+     * Get actions for many independent states
+     */
+    void getActions(const float* angles, const float* angularVelocities, int* actions, size_t n) const {
+        for (size_t i = 0; i < n; i++) {
+            float frame[2];
+            actions[i] = lookup(Input::normalized(PolicyInput(angles[i], angularVelocities[i]), frame));
+        }
+    }
+
+    float getMotorTorque(int action) const {
+        return DQN_READ_FLOAT(&ACTION_TORQUES[action]);
+    }
+
+private:
+    // Cell along one axis. constrain() lets NaN through and converting it
+    // to int is undefined (x86 gives INT_MIN, Cortex-M saturates to 0), so
+    // NaN is replaced by 1 first: it reads the last cell on every target.
+    // The unsigned compare keeps an input of exactly 1 in the last cell.
+    static DQN_ALWAYS_INLINE int cell(float value, int count) {
+        value = choose(value == value, value, 1.0f);
+        const int index = (int)((value + 1.0f) * (0.5f * (float)count));
+        return choose((unsigned)index < (unsigned)count, index, count - 1);
+    }
+
+    static DQN_ALWAYS_INLINE int lookup(const float* frame) {
+        const int k = cell(frame[0], Rows) * Cols + cell(frame[1], Cols);
+        const uint8_t bits = DQN_READ_UINT8(&G.cells[k / Grid::CELLS_PER_BYTE]);
+        return (bits >> ((k % Grid::CELLS_PER_BYTE) * Grid::CELL_BITS)) & ((1 << Grid::CELL_BITS) - 1);
+    }
+};
+
+} // namespace dqn
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // DQN_POLICY_H
@@ -0,0 +1,368 @@
+/**
+ * Two-Wheel Balancing Robot DQN Policy Slots
+ *
+ * Double-buffered model blobs for replacing a policy while the robot keeps
+ * balancing. One slot holds the active blob; a new blob (from serial,
+ * Wi-Fi, ...) is streamed into the other slot in the background, verified
+ * with the blob's CRC-32 as stored, and swapped in at the next control
+ * tick:
+ *
+ *   static dqn::RamSlotStorage<4096> storage;  // ESP32: PartitionSlotStorage
+ *   static dqn::DoubleBufferedPolicy<dqn::RamSlotStorage<4096> > policy(storage);
+ *
+ *   // Update task, any pace and chunk size
+ *   policy.beginUpdate(blobSize);
+ *   policy.writeUpdate(chunk, chunkSize);          // repeat
+ *   if (policy.commitUpdate() != dqn::BLOB_OK) ...  // rejected, old policy stays
+ *
+ *   // Or only the changed bytes (ModelDelta.js), against the active blob
+ *   policy.beginDeltaUpdate(deltaSize);
+ *   policy.writeUpdate(chunk, chunkSize);          // repeat
+ *   policy.commitUpdate();
+ *
+ *   // Control loop, unchanged
+ *   int action = policy.getAction(angle, angularVelocity);
+ *
+ * - The swap is one atomic flip at the start of forward()/getAction(): a
+ *   tick runs entirely on the old policy or entirely on the new one, and
+ *   the new policy's history starts from that tick's state
+ * - Updates never touch the active slot, so a failed, corrupt or aborted
+ *   transfer leaves the running policy as it was
+ * - One update task and one control task may run concurrently; each API
+ *   side must stay on its own task
+ * - Storage: RamSlotStorage keeps both slots in RAM (host, PSRAM);
+ *   PartitionSlotStorage writes two ESP32 data partitions and reads them
+ *   through the flash cache. Persist activeSlot() (e.g. in NVS) and pass
+ *   it to boot() so a restart resumes the newest policy.
+ * - ESP-IDF disables the flash cache on both cores while a partition is
+ *   erased or written, so every task running from flash or reading mapped
+ *   weights, the control task included, stalls until the operation ends.
+ *   A sector erase takes tens of milliseconds, several 50 Hz ticks. For
+ *   swaps while the robot is balancing, use RamSlotStorage (in PSRAM for
+ *   large blobs) and copy the committed blob to a partition only while
+ *   the motors are stopped. The alternative is a control path (task, IMU
+ *   and motor drivers, weights) placed in IRAM/DRAM.
+ * - Delta updates rebuild the new blob in the inactive slot from the
+ *   active one (DQNModelDelta.h), then verify and swap it like a full blob
+ *
+ * Requires C++11 and <atomic> (not AVR).
+ */
+
+#ifndef DQN_POLICY_SLOTS_H
+#define DQN_POLICY_SLOTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+
+#include "DQNModelBlob.h"
+#include "DQNModelDelta.h"
+
+namespace dqn {
+
+/**
+ * Both slots in RAM, Capacity bytes each
+ */
+template <size_t Capacity>
+class RamSlotStorage {
+public:
+    RamSlotStorage() { memset(bytes, 0xFF, sizeof(bytes)); }
+
+    size_t capacity() const { return Capacity; }
+
+    /**
+     * Prepare a slot for size bytes (erase)
+     */
+    bool begin(int slot, size_t size) {
+        if (size > Capacity) return false;
+        memset(bytes[slot], 0xFF, Capacity);
+        return true;
+    }
+
+    bool write(int slot, size_t offset, const void* data, size_t size) {
+        if (offset > Capacity || size > Capacity - offset) return false;
+        memcpy(&bytes[slot][offset], data, size);
+        return true;
+    }
+
+    /**
+     * @return Readable slot contents, or null
+     */
+    const void* data(int slot) { return bytes[slot]; }
+
+private:
+    alignas(16) uint8_t bytes[2][Capacity];
+};
+
+#if defined(ESP_PLATFORM)
+/**
+ * Two ESP32 data partitions (e.g. "policy_a" and "policy_b"), each mapped
+ * through the flash cache for reading. A slot is unmapped while it is
+ * erased and written, and mapped again afterwards.
+ * begin() and write() suspend the flash cache on both cores (see the file
+ * comment), so call them only while a control loop can miss ticks.
+ */
+class PartitionSlotStorage {
+public:
+    PartitionSlotStorage(const char* labelA, const char* labelB) {
+        const char* labels[2] = {labelA, labelB};
+        for (int s = 0; s < 2; s++) {
+            partitions[s] = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, labels[s]);
+            mapped[s] = nullptr;
+            handles[s] = 0;
+        }
+    }
+
+    ~PartitionSlotStorage() {
+        unmap(0);
+        unmap(1);
+    }
+
+    PartitionSlotStorage(const PartitionSlotStorage&) = delete;
+    PartitionSlotStorage& operator=(const PartitionSlotStorage&) = delete;
+
+    size_t capacity() const {
+        if (!partitions[0] || !partitions[1]) return 0;
+        return partitions[0]->size < partitions[1]->size ? partitions[0]->size : partitions[1]->size;
+    }
+
+    bool begin(int slot, size_t size) {
+        const esp_partition_t* partition = partitions[slot];
+        if (!partition || size > partition->size) return false;
+        unmap(slot);
+        const size_t sectors = (size + partition->erase_size - 1) / partition->erase_size;
+        return esp_partition_erase_range(partition, 0, sectors * partition->erase_size) == ESP_OK;
+    }
+
+    bool write(int slot, size_t offset, const void* data, size_t size) {
+        return partitions[slot] && esp_partition_write(partitions[slot], offset, data, size) == ESP_OK;
+    }
+
+    const void* data(int slot) {
+        if (!mapped[slot] && partitions[slot] &&
+            esp_partition_mmap(partitions[slot], 0, partitions[slot]->size, ESP_PARTITION_MMAP_DATA, &mapped[slot],
+                               &handles[slot]) != ESP_OK) {
+            mapped[slot] = nullptr;
+        }
+        return mapped[slot];
+    }
+
+private:
+    void unmap(int slot) {
+        if (mapped[slot]) esp_partition_munmap(handles[slot]);
+        mapped[slot] = nullptr;
+    }
+
+    const esp_partition_t* partitions[2];
+    const void* mapped[2];
+    esp_partition_mmap_handle_t handles[2];
+};
+#endif
+
+/**
+ * BlobPolicy over two storage slots with tick-boundary swaps
+ * @tparam Storage RamSlotStorage, PartitionSlotStorage or anything with
+ *         capacity(), begin(slot, size), write(slot, offset, data, size)
+ *         and data(slot)
+ */
+template <typename Storage>
+class DoubleBufferedPolicy {
+public:
+    explicit DoubleBufferedPolicy(Storage& storage)
+        : storage(storage), active(-1), pending(-1), swaps(0), updateSlot(-1), updateSize(0), updateWritten(0),
+          updateDelta(false) {}
+
+    DoubleBufferedPolicy(const DoubleBufferedPolicy&) = delete;
+    DoubleBufferedPolicy& operator=(const DoubleBufferedPolicy&) = delete;
+
+    /**
+     * Activate the blob already in storage at startup
+     * Tries preferredSlot first and falls back to the other slot.
+     * Call before the control loop starts.
+     * @return False if neither slot holds a valid blob
+     */
+    bool boot(int preferredSlot = 0) {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            const int slot = attempt == 0 ? preferredSlot : 1 - preferredSlot;
+            const void* data = storage.data(slot);
+            if (data && blobs[slot].bind(data, storage.capacity()) == BLOB_OK) {
+                policy.bind(blobs[slot]);
+                active.store(slot, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ---- Update task ----
+
+    /**
+     * Start writing a blob of size bytes into the inactive slot
+     * @return False while the previous update waits for its swap, or if
+     *         the blob does not fit or the slot cannot be erased
+     */
+    bool beginUpdate(size_t size) {
+        if (pending.load(std::memory_order_acquire) >= 0 || size > storage.capacity()) return false;
+        const int slot = active.load(std::memory_order_acquire) == 0 ? 1 : 0;
+        updateSlot = -1;
+        if (!storage.begin(slot, size)) return false;
+        updateSlot = slot;
+        updateSize = size;
+        updateWritten = 0;
+        updateDelta = false;
+        return true;
+    }
+
+    /**
+     * Start applying a delta of deltaSize bytes against the active blob
+     * The inactive slot is erased once the delta's header names the active
+     * blob as its base; writeUpdate() then takes the delta bytes.
+     * @return False while the previous update waits for its swap, or
+     *         without an active blob to patch
+     */
+    bool beginDeltaUpdate(size_t deltaSize) {
+        const int base = active.load(std::memory_order_acquire);
+        if (pending.load(std::memory_order_acquire) >= 0 || base < 0) return false;
+        updateSlot = 1 - base;
+        updateSize = deltaSize;
+        updateWritten = 0;
+        updateDelta = true;
+        patcher.start(storage, updateSlot, storage.capacity(), blobs[base], deltaSize);
+        return true;
+    }
+
+    /**
+     * Append the next bytes of the blob (or delta)
+     * @return False without an update in progress, past the declared size
+     *         or once a delta has been rejected
+     */
+    bool writeUpdate(const void* data, size_t size) {
+        if (updateSlot < 0 || size > updateSize - updateWritten) return false;
+        if (updateDelta) {
+            if (patcher.write(data, size) != BLOB_OK) return false;
+            updateWritten += size;
+            return true;
+        }
+        if (!storage.write(updateSlot, updateWritten, data, size)) {
+            updateSlot = -1;
+            return false;
+        }
+        updateWritten += size;
+        return true;
+    }
+
+    /**
+     * Verify the written slot and schedule the swap for the next tick
+     * The blob is validated as stored (CRC-32 over the slot contents), so
+     * transfer and write errors are both caught. A delta is checked against
+     * its own CRC-32 first, and the base bytes after its last record are
+     * copied in.
+     * @return BLOB_OK if the swap is scheduled; otherwise the update is
+     *         dropped and the active policy is unchanged
+     */
+    BlobStatus commitUpdate() {
+        const int slot = updateSlot;
+        updateSlot = -1;
+        if (slot < 0) return BLOB_TOO_SMALL;
+        size_t size = updateSize;
+        if (updateDelta) {
+            const BlobStatus patched = patcher.finish(size);
+            if (patched != BLOB_OK) return patched;
+        } else if (updateWritten != updateSize) {
+            return BLOB_TOO_SMALL;
+        }
+        const void* data = storage.data(slot);
+        const BlobStatus status = data ? blobs[slot].bind(data, size) : BLOB_TOO_SMALL;
+        if (status == BLOB_OK) pending.store(slot, std::memory_order_release);
+        return status;
+    }
+
+    /**
+     * Drop an update in progress (the slot keeps whatever was written)
+     */
+    void abortUpdate() { updateSlot = -1; }
+
+    /**
+     * True from commitUpdate() until the control loop picks the blob up
+     */
+    bool swapPending() const { return pending.load(std::memory_order_acquire) >= 0; }
+
+    // ---- Control task (DQNPolicy API) ----
+
+    void reset(float angle, float angularVelocity) {
+        applyPendingSwap(angle, angularVelocity);
+        if (hasPolicy()) policy.reset(angle, angularVelocity);
+    }
+
+    /**
+     * Run the active policy, swapping first if a new blob was committed
+     * @param qValues Output Q-values [outputSize()]
+     * @return Action index; -1 before any blob has been activated
+     */
+    int forward(float angle, float angularVelocity, float* qValues) {
+        applyPendingSwap(angle, angularVelocity);
+        if (!hasPolicy()) return -1;
+        return policy.forward(angle, angularVelocity, qValues);
+    }
+
+    int getAction(float angle, float angularVelocity) {
+        float qValues[BLOB_MAX_OUTPUT];
+        return forward(angle, angularVelocity, qValues);
+    }
+
+    /**
+     * Motor torque for an action of the active policy (0 without one)
+     */
+    float getMotorTorque(int action) const { return action >= 0 ? policy.getMotorTorque(action) : 0.0f; }
+
+    bool hasPolicy() const { return active.load(std::memory_order_acquire) >= 0; }
+
+    /**
+     * Slot of the active blob (-1 before boot or the first update)
+     */
+    int activeSlot() const { return active.load(std::memory_order_acquire); }
+
+    /**
+     * Swaps applied since construction
+     */
+    uint32_t swapCount() const { return swaps.load(std::memory_order_acquire); }
+
+    const BlobPolicy& activePolicy() const { return policy; }
+
+    /**
+     * Output count of the active blob (0 without one)
+     */
+    int outputSize() const { return hasPolicy() ? policy.outputSize() : 0; }
+
+private:
+    void applyPendingSwap(float angle, float angularVelocity) {
+        const int slot = pending.load(std::memory_order_acquire);
+        if (slot < 0) return;
+        policy.bind(blobs[slot]);
+        policy.reset(angle, angularVelocity);
+        active.store(slot, std::memory_order_release);
+        swaps.store(swaps.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        // Clearing pending last lets the next update reuse the old slot
+        pending.store(-1, std::memory_order_release);
+    }
+
+    Storage& storage;
+    ModelBlob blobs[2];
+    BlobPolicy policy;
+    std::atomic<int> active;
+    std::atomic<int> pending;
+    std::atomic<uint32_t> swaps;
+
+    // Update task only
+    int updateSlot;
+    size_t updateSize;
+    size_t updateWritten;
+    bool updateDelta;
+    ModelDeltaPatcher<Storage> patcher;
+};
+
+} // namespace dqn
+
+#endif // DQN_POLICY_SLOTS_H
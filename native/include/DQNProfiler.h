@@ -0,0 +1,252 @@
+/**
+ * Two-Wheel Balancing Robot DQN Execution Profiler
+ *
+ * Worst-case execution time and jitter of policy inference, for checking
+ * control-loop deadlines on the target. Build with DQN_PROFILE defined and
+ * every policy type (TwoWheelBotDQN, its int8 sibling, BlobPolicy, ...)
+ * times each forward()/getAction call into its own ExecutionProfile:
+ *
+ *   #define DQN_PROFILE
+ *   #include "two_wheel_bot_dqn.cpp"
+ *
+ *   int action = bot.getAction(angle, angularVelocity);  // timed
+ *   ...
+ *   dqn::executionProfile<TwoWheelBotDQN>().printTo(Serial);  // or stdout
+ *
+ * - Counters: DWT->CYCCNT on Cortex-M3/M4/M7/M33, esp_cpu_get_cycle_count
+ *   on ESP32, the time-stamp counter on x86, the virtual counter on
+ *   AArch64, micros() on other Arduino boards and std::chrono nanoseconds
+ *   elsewhere (CycleCounter::units() names the unit)
+ * - Each profile keeps count, min, max, mean and a linear histogram of
+ *   DQN_PROFILE_BUCKETS buckets DQN_PROFILE_BUCKET_CYCLES wide; the last
+ *   bucket also counts everything above it. Pick the width so the expected
+ *   worst case lands in the upper half.
+ * - Profiles are static, so policy instances stay zero-size. Read them
+ *   from the control task (or with it paused); record() is not atomic.
+ * - Without DQN_PROFILE, DQN_PROFILE_SCOPE expands to nothing: no counter
+ *   reads, no storage, identical object code.
+ *
+ * Requires C++11.
+ */
+
+#ifndef DQN_PROFILER_H
+#define DQN_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_cpu.h>
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || \
+    defined(__ARM_ARCH_8_1M_MAIN__)
+#define DQN_PROFILE_DWT 1
+#elif defined(ARDUINO)
+#include <Arduino.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <chrono>
+#endif
+
+#if !defined(DQN_PROFILE_BUCKETS)
+#define DQN_PROFILE_BUCKETS 16
+#endif
+
+#if !defined(DQN_PROFILE_BUCKET_CYCLES)
+#if defined(ESP_PLATFORM) || defined(DQN_PROFILE_DWT)
+#define DQN_PROFILE_BUCKET_CYCLES 1024
+#else
+#define DQN_PROFILE_BUCKET_CYCLES 64
+#endif
+#endif
+
+namespace dqn {
+
+/**
+ * Free-running 32-bit counter; differences are wrap-safe
+ */
+struct CycleCounter {
+#if defined(ESP_PLATFORM) || defined(DQN_PROFILE_DWT) || defined(__x86_64__) || defined(__i386__)
+    static const char* units() { return "cycles"; }
+#elif defined(ARDUINO)
+    static const char* units() { return "us"; }
+#elif defined(__aarch64__)
+    static const char* units() { return "ticks"; }
+#else
+    static const char* units() { return "ns"; }
+#endif
+
+    /**
+     * Start the counter where it needs enabling (Cortex-M DWT)
+     */
+    static void enable() {
+#if defined(DQN_PROFILE_DWT)
+        volatile uint32_t* const DEMCR = (volatile uint32_t*)0xE000EDFCu;
+        volatile uint32_t* const DWT_CTRL = (volatile uint32_t*)0xE0001000u;
+        volatile uint32_t* const DWT_LAR = (volatile uint32_t*)0xE0001FB0u;
+        *DEMCR |= 1u << 24;     // TRCENA
+        *DWT_LAR = 0xC5ACCE55u; // Unlock (Cortex-M7; ignored elsewhere)
+        *DWT_CTRL |= 1u;        // CYCCNTENA
+#endif
+    }
+
+    static inline uint32_t now() {
+#if defined(ESP_PLATFORM)
+        return (uint32_t)esp_cpu_get_cycle_count();
+#elif defined(DQN_PROFILE_DWT)
+        return *(volatile uint32_t*)0xE0001004u;
+#elif defined(ARDUINO)
+        return (uint32_t)micros();
+#elif defined(__x86_64__) || defined(__i386__)
+        return (uint32_t)__rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return (uint32_t)ticks;
+#else
+        return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+};
+
+/**
+ * Min/max/mean and histogram of measured durations
+ * @tparam Buckets Histogram buckets (the last one is open-ended)
+ * @tparam BucketCycles Width of each bucket in counter units
+ */
+template <int Buckets = DQN_PROFILE_BUCKETS, uint32_t BucketCycles = DQN_PROFILE_BUCKET_CYCLES>
+class ExecutionProfile {
+public:
+    static_assert(Buckets >= 2 && BucketCycles >= 1, "need at least two buckets of nonzero width");
+
+    static const int BUCKETS = Buckets;
+    static const uint32_t BUCKET_CYCLES = BucketCycles;
+
+    // Longest report line, with its terminator
+    static const size_t LINE_SIZE = 80;
+
+    ExecutionProfile() {
+        CycleCounter::enable();
+        reset();
+    }
+
+    void reset() {
+        samples = 0;
+        minimum = UINT32_MAX;
+        maximum = 0;
+        total = 0;
+        for (int b = 0; b < Buckets; b++) histogram[b] = 0;
+    }
+
+    void record(uint32_t cycles) {
+        samples++;
+        minimum = cycles < minimum ? cycles : minimum;
+        maximum = cycles > maximum ? cycles : maximum;
+        total += cycles;
+        const uint32_t bucket = cycles / BucketCycles;
+        histogram[bucket < (uint32_t)Buckets ? bucket : (uint32_t)Buckets - 1]++;
+    }
+
+    uint32_t count() const { return samples; }
+    uint32_t min() const { return samples ? minimum : 0; }
+    uint32_t max() const { return maximum; }
+    uint32_t mean() const { return samples ? (uint32_t)(total / samples) : 0; }
+
+    /**
+     * Max minus min: the spread a deadline budget has to cover
+     */
+    uint32_t jitter() const { return max() - min(); }
+
+    /**
+     * Samples in [b * BucketCycles, (b + 1) * BucketCycles), or at or
+     * above (Buckets - 1) * BucketCycles for the last bucket
+     */
+    uint32_t bucket(int b) const { return histogram[b]; }
+
+    /**
+     * Write the report line by line
+     * @param stream Anything with print(const char*): Arduino Serial, ...
+     */
+    template <typename Stream>
+    void printTo(Stream& stream) const {
+        char line[LINE_SIZE];
+        for (int i = 0; i <= Buckets; i++) {
+            formatLine(i, line, sizeof(line));
+            stream.print(line);
+        }
+    }
+
+    /**
+     * Write the report to a C stream (stdout is the UART console on ESP-IDF)
+     */
+    void printTo(FILE* file) const {
+        char line[LINE_SIZE];
+        for (int i = 0; i <= Buckets; i++) {
+            formatLine(i, line, sizeof(line));
+            fputs(line, file);
+        }
+    }
+
+    /**
+     * Format report line i: 0 is the summary, 1..Buckets the histogram
+     * @return Characters written (excluding the terminator), as snprintf
+     */
+    int formatLine(int i, char* buffer, size_t size) const {
+        if (i == 0) {
+            return snprintf(buffer, size, "n=%lu min=%lu mean=%lu max=%lu %s\n", (unsigned long)count(),
+                            (unsigned long)min(), (unsigned long)mean(), (unsigned long)max(), CycleCounter::units());
+        }
+        const int b = i - 1;
+        const unsigned long low = (unsigned long)b * BucketCycles;
+        if (b == Buckets - 1) return snprintf(buffer, size, "%8lu+         %10lu\n", low, (unsigned long)histogram[b]);
+        return snprintf(buffer, size, "%8lu-%-8lu %10lu\n", low, low + BucketCycles - 1, (unsigned long)histogram[b]);
+    }
+
+private:
+    uint32_t samples;
+    uint32_t minimum;
+    uint32_t maximum;
+    uint64_t total;
+    uint32_t histogram[Buckets];
+};
+
+/**
+ * One profile per policy type, shared by its instances
+ */
+template <typename Policy>
+struct PolicyProfile {
+    static ExecutionProfile<> profile;
+};
+
+template <typename Policy>
+ExecutionProfile<> PolicyProfile<Policy>::profile;
+
+/**
+ * Profile of a policy type, e.g. dqn::executionProfile<TwoWheelBotDQN>()
+ */
+template <typename Policy>
+ExecutionProfile<>& executionProfile() {
+    return PolicyProfile<Policy>::profile;
+}
+
+/**
+ * Times its enclosing scope into a profile
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(ExecutionProfile<>& profile) : profile(profile), start(CycleCounter::now()) {}
+    ~ProfileScope() { profile.record(CycleCounter::now() - start); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ExecutionProfile<>& profile;
+    const uint32_t start;
+};
+
+} // namespace dqn
+
+#endif // DQN_PROFILER_H
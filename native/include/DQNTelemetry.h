@@ -0,0 +1,388 @@
+/**
+ * Two-Wheel Balancing Robot DQN Telemetry
+ *
+ * Per-tick records (angle, angular velocity, Q-values, action, inference
+ * cycles) streamed off the robot without stalling the control loop. The
+ * control task pushes fixed-size binary records into a lock-free ring; a
+ * UART/DMA driver or a low-priority task drains it at its own pace:
+ *
+ *   static dqn::TelemetryPolicy<TwoWheelBotDQN, 256> bot;
+ *
+ *   // Control loop: a drop-in for TwoWheelBotDQN
+ *   int action = bot.getAction(angle, angularVelocity);
+ *
+ *   // Drain task (or DMA completion interrupt)
+ *   const uint8_t* bytes;
+ *   size_t size = bot.telemetry().peek(&bytes);
+ *   size = Serial.write(bytes, size) / dqn::TELEMETRY_RECORD_SIZE * dqn::TELEMETRY_RECORD_SIZE;
+ *   bot.telemetry().consume(size);
+ *
+ * - A record is TELEMETRY_RECORD_SIZE (32) bytes, little-endian: sync
+ *   bytes, 16-bit sequence number, angle and angular velocity (float32,
+ *   as passed to the policy), three float32 Q-values, uint32 inference
+ *   time in CycleCounter units, action, flags (TELEMETRY_RESET on the
+ *   first tick after reset()) and a CRC-16/CCITT over the first 30 bytes
+ * - push() never blocks: when the ring is full the record is dropped and
+ *   counted. Sequence numbers count every push, so gaps show the receiver
+ *   where records were lost
+ * - peek() returns the encoded records up to the end of the ring in one
+ *   contiguous span, ready for a DMA transfer; consume() frees them after
+ *   the transfer completes
+ * - One producer and one consumer task; each side must stay on its own task
+ * - Records hold three Q-values, so TelemetryPolicy only takes 3-action
+ *   policies. Compiled exports with another OUTPUT_SIZE fail to compile;
+ *   blob policies can change architecture at run time, so their ticks with
+ *   another output count run unlogged and count as rejectedTicks()
+ * - TelemetryDecoder reassembles records from any byte stream, one byte at
+ *   a time, and resynchronizes on corrupted or missing bytes. Host tools
+ *   (train/TelemetryLog.h) turn logs into arrays for getActions and into
+ *   replay transitions for the native trainer
+ *
+ * Requires C++11 and <atomic> (not AVR).
+ */
+
+#ifndef DQN_TELEMETRY_H
+#define DQN_TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+
+#include "DQNModelBlob.h"
+#include "DQNPolicy.h"
+#include "DQNProfiler.h"
+
+namespace dqn {
+
+static const size_t TELEMETRY_RECORD_SIZE = 32;
+static const int TELEMETRY_Q_VALUES = 3;
+static const uint8_t TELEMETRY_SYNC0 = 0xA5;
+static const uint8_t TELEMETRY_SYNC1 = 0x7E;
+
+// Record flags
+static const uint8_t TELEMETRY_RESET = 0x01;  // First tick after the policy was reset
+
+/**
+ * One control tick, decoded
+ */
+struct TelemetryRecord {
+    uint16_t sequence;
+    uint8_t action;
+    uint8_t flags;
+    float angle;            // rad, as passed to the policy
+    float angularVelocity;  // rad/s
+    float qValues[TELEMETRY_Q_VALUES];
+    uint32_t cycles;        // Inference time, CycleCounter units
+};
+
+/**
+ * CRC-16/CCITT-FALSE (polynomial 0x1021, initial 0xFFFF), four bits at a time
+ */
+inline uint16_t crc16(const uint8_t* data, size_t size) {
+    static const uint16_t TABLE[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc = (uint16_t)(TABLE[((crc >> 12) ^ (data[i] >> 4)) & 0x0F] ^ (crc << 4));
+        crc = (uint16_t)(TABLE[((crc >> 12) ^ data[i]) & 0x0F] ^ (crc << 4));
+    }
+    return crc;
+}
+
+/**
+ * Write a record in the wire format (TELEMETRY_RECORD_SIZE bytes)
+ * Fields are copied in memory order, which is the little-endian wire order
+ * on every supported target (Cortex-M, ESP32, x86, AArch64).
+ */
+inline void encodeTelemetry(const TelemetryRecord& record, uint8_t* out) {
+    out[0] = TELEMETRY_SYNC0;
+    out[1] = TELEMETRY_SYNC1;
+    memcpy(out + 2, &record.sequence, 2);
+    memcpy(out + 4, &record.angle, 4);
+    memcpy(out + 8, &record.angularVelocity, 4);
+    memcpy(out + 12, record.qValues, 4 * TELEMETRY_Q_VALUES);
+    memcpy(out + 24, &record.cycles, 4);
+    out[28] = record.action;
+    out[29] = record.flags;
+    const uint16_t crc = crc16(out, TELEMETRY_RECORD_SIZE - 2);
+    memcpy(out + 30, &crc, 2);
+}
+
+/**
+ * Read a record in the wire format
+ * @return False if the sync bytes or the checksum do not match
+ */
+inline bool decodeTelemetry(const uint8_t* in, TelemetryRecord& record) {
+    uint16_t crc;
+    memcpy(&crc, in + 30, 2);
+    if (in[0] != TELEMETRY_SYNC0 || in[1] != TELEMETRY_SYNC1 || crc16(in, TELEMETRY_RECORD_SIZE - 2) != crc) {
+        return false;
+    }
+    memcpy(&record.sequence, in + 2, 2);
+    memcpy(&record.angle, in + 4, 4);
+    memcpy(&record.angularVelocity, in + 8, 4);
+    memcpy(record.qValues, in + 12, 4 * TELEMETRY_Q_VALUES);
+    memcpy(&record.cycles, in + 24, 4);
+    record.action = in[28];
+    record.flags = in[29];
+    return true;
+}
+
+/**
+ * Single-producer, single-consumer ring of encoded records
+ * @tparam Capacity Records held (a power of two)
+ */
+template <size_t Capacity>
+class TelemetryRing {
+public:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "ring capacity must be a power of two");
+
+    static const size_t CAPACITY = Capacity;
+
+    TelemetryRing() : head(0), tail(0), drops(0), sequence(0) {}
+
+    TelemetryRing(const TelemetryRing&) = delete;
+    TelemetryRing& operator=(const TelemetryRing&) = delete;
+
+    // ---- Producer (control task) ----
+
+    /**
+     * Encode and queue a record; its sequence number is assigned here
+     * @return False if the ring was full and the record was dropped
+     */
+    bool push(TelemetryRecord record) {
+        record.sequence = sequence++;
+        const uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == Capacity) {
+            drops.store(drops.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            return false;
+        }
+        encodeTelemetry(record, slots[h & (Capacity - 1)]);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ---- Consumer (drain task) ----
+
+    /**
+     * Encoded records ready to send, up to the end of the ring
+     * @param data Set to the first queued byte
+     * @return Contiguous bytes available (a multiple of TELEMETRY_RECORD_SIZE)
+     */
+    size_t peek(const uint8_t** data) const {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        const size_t queued = head.load(std::memory_order_acquire) - t;
+        const size_t index = t & (Capacity - 1);
+        *data = slots[index];
+        return (queued < Capacity - index ? queued : Capacity - index) * TELEMETRY_RECORD_SIZE;
+    }
+
+    /**
+     * Release sent bytes returned by peek() (whole records)
+     */
+    void consume(size_t bytes) {
+        tail.store(tail.load(std::memory_order_relaxed) + (uint32_t)(bytes / TELEMETRY_RECORD_SIZE),
+                   std::memory_order_release);
+    }
+
+    /**
+     * Copy whole records out of the ring and release them
+     * @return Bytes written to out (at most maxBytes)
+     */
+    size_t read(uint8_t* out, size_t maxBytes) {
+        size_t written = 0;
+        const uint8_t* data;
+        size_t available;
+        while (written + TELEMETRY_RECORD_SIZE <= maxBytes && (available = peek(&data)) > 0) {
+            const size_t room = (maxBytes - written) / TELEMETRY_RECORD_SIZE * TELEMETRY_RECORD_SIZE;
+            const size_t n = available < room ? available : room;
+            memcpy(out + written, data, n);
+            consume(n);
+            written += n;
+        }
+        return written;
+    }
+
+    /**
+     * Records queued and not yet consumed
+     */
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Records dropped because the ring was full
+     */
+    uint32_t dropped() const { return drops.load(std::memory_order_acquire); }
+
+private:
+    alignas(4) uint8_t slots[Capacity][TELEMETRY_RECORD_SIZE];
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;
+    std::atomic<uint32_t> drops;
+
+    // Producer only
+    uint16_t sequence;
+};
+
+template <typename T>
+struct TelemetryVoid {
+    typedef void type;
+};
+
+/**
+ * Output count of a wrapped policy: outputSize() for run-time architectures
+ * (BlobPolicy, DoubleBufferedPolicy), OUTPUT_SIZE for compiled exports
+ */
+template <typename Policy, typename = void>
+struct TelemetryOutputs {
+    static int count(const Policy& policy) { return policy.outputSize(); }
+};
+
+template <typename Policy>
+struct TelemetryOutputs<Policy, typename TelemetryVoid<decltype(Policy::OUTPUT_SIZE)>::type> {
+    static_assert(Policy::OUTPUT_SIZE == TELEMETRY_Q_VALUES, "telemetry records hold three Q-values");
+    static int count(const Policy&) { return Policy::OUTPUT_SIZE; }
+};
+
+/**
+ * A float policy that logs every tick into a TelemetryRing
+ * Drop-in for the wrapped policy's reset/getAction/forward/getMotorTorque.
+ * @tparam Policy Float or action-difference export (TwoWheelBotDQN, BlobPolicy, ...)
+ * @tparam Capacity Ring capacity in records (a power of two)
+ */
+template <typename Policy, size_t Capacity>
+class TelemetryPolicy {
+public:
+    TelemetryPolicy() : flags(TELEMETRY_RESET), rejected(0) { CycleCounter::enable(); }
+
+    void reset(float angle, float angularVelocity) {
+        policy.reset(angle, angularVelocity);
+        flags = TELEMETRY_RESET;
+    }
+
+    /**
+     * Run the policy and queue the tick's record
+     * @param qValues Output: the policy's first TELEMETRY_Q_VALUES Q-values
+     * @return Action index
+     */
+    int forward(float angle, float angularVelocity, float* qValues) {
+        // Sized for any blob; a swap can change the output count between ticks
+        float outputs[BLOB_MAX_OUTPUT];
+        const uint32_t start = CycleCounter::now();
+        const int action = policy.forward(angle, angularVelocity, outputs);
+        const uint32_t cycles = CycleCounter::now() - start;
+        const int count = TelemetryOutputs<Policy>::count(policy);
+        for (int o = 0; o < TELEMETRY_Q_VALUES; o++) qValues[o] = o < count ? outputs[o] : 0.0f;
+        if (count != TELEMETRY_Q_VALUES) {
+            rejected++;
+            return action;
+        }
+
+        TelemetryRecord record;
+        record.action = (uint8_t)action;
+        record.flags = flags;
+        record.angle = angle;
+        record.angularVelocity = angularVelocity;
+        for (int o = 0; o < TELEMETRY_Q_VALUES; o++) record.qValues[o] = qValues[o];
+        record.cycles = cycles;
+        ring.push(record);
+        flags = 0;
+        return action;
+    }
+
+    int getAction(float angle, float angularVelocity) {
+        float qValues[TELEMETRY_Q_VALUES];
+        return forward(angle, angularVelocity, qValues);
+    }
+
+    float getMotorTorque(int action) const { return policy.getMotorTorque(action); }
+
+    TelemetryRing<Capacity>& telemetry() { return ring; }
+    Policy& wrapped() { return policy; }
+
+    /**
+     * Ticks not logged because the policy's output count was not TELEMETRY_Q_VALUES
+     */
+    uint32_t rejectedTicks() const { return rejected; }
+
+private:
+    Policy policy;
+    TelemetryRing<Capacity> ring;
+    uint8_t flags;
+    uint32_t rejected;
+};
+
+/**
+ * Reassembles records from a byte stream (UART capture, log file, ...)
+ * Bytes that do not start a record with a valid checksum are skipped, so
+ * the decoder locks back on after lost or corrupted bytes.
+ */
+class TelemetryDecoder {
+public:
+    TelemetryDecoder() : pendingSize(0), skipped(0), decoded(0), lost(0), haveSequence(false), lastSequence(0) {}
+
+    /**
+     * Feed one byte
+     * @param record Set when a record completes
+     * @return True when record holds a newly decoded record
+     */
+    bool push(uint8_t byte, TelemetryRecord& record) {
+        pending[pendingSize++] = byte;
+        if (pendingSize < TELEMETRY_RECORD_SIZE) {
+            resync(0);
+            return false;
+        }
+        if (!decodeTelemetry(pending, record)) {
+            resync(1);
+            return false;
+        }
+        pendingSize = 0;
+        if (haveSequence) lost += (uint16_t)(record.sequence - lastSequence - 1);
+        haveSequence = true;
+        lastSequence = record.sequence;
+        decoded++;
+        return true;
+    }
+
+    /**
+     * Bytes discarded while searching for a record start
+     */
+    size_t skippedBytes() const { return skipped; }
+
+    size_t records() const { return decoded; }
+
+    /**
+     * Records missing from the sequence (dropped on the robot or lost in transit)
+     */
+    size_t lostRecords() const { return lost; }
+
+private:
+    // Drop bytes from the front until pending starts like a record
+    void resync(size_t from) {
+        size_t start = from;
+        while (start < pendingSize &&
+               !(pending[start] == TELEMETRY_SYNC0 && (start + 1 >= pendingSize || pending[start + 1] == TELEMETRY_SYNC1))) {
+            start++;
+        }
+        if (start == 0) return;
+        memmove(pending, pending + start, pendingSize - start);
+        pendingSize -= start;
+        skipped += start;
+    }
+
+    uint8_t pending[TELEMETRY_RECORD_SIZE];
+    size_t pendingSize;
+    size_t skipped;
+    size_t decoded;
+    size_t lost;
+    bool haveSequence;
+    uint16_t lastSequence;
+};
+
+} // namespace dqn
+
+#endif // DQN_TELEMETRY_H
@@ -0,0 +1,347 @@
+/**
+ * Parallel hyperparameter search over the native trainer
+ *
+ * Samples QLearning.js Hyperparameters, trains every candidate with its
+ * own train::DQNTrainer and prunes them by successive halving:
+ *
+ *   search::SearchOptions options;               // 27 trials, 20 - 540 episodes, eta 3
+ *   sweep::WorkStealingPool pool(threads);
+ *   search::HyperSearch hyperSearch(options);
+ *   const search::Trial& best = hyperSearch.run(pool);
+ *   train::writeCppModel(path, best.trainer->network(), timestamp);
+ *
+ * - Rung k trains every surviving trial up to minEpisodes × eta^k
+ *   episodes (continuing where it stopped, replay memory included), scores
+ *   it and keeps the best 1 / eta for the next rung, until one is left or
+ *   maxEpisodes is reached
+ * - Early stopping: a trial whose average reward over the last
+ *   convergenceWindow episodes reaches convergenceThreshold is converged
+ *   (TrainingMetrics.checkConvergence) and trains no further; it keeps
+ *   competing on its score
+ * - Score: greedy closed-loop reward of the online network, mean over
+ *   EVAL_LANES robots of a BalancingRobotBatch started across ±evalAngle,
+ *   all scored by one batched forward pass per step. Every trial sees the
+ *   same starts and sensor drift
+ * - Trials run on a sweep::WorkStealingPool, one job per trial and rung.
+ *   Each trial owns its trainer and robot, and seeds derive from the
+ *   trial index, so results do not depend on the thread count
+ * - Pruned trials release their trainer; a rung's survivors can be
+ *   checkpointed as float32 model blobs (ModelBlobWriter.h)
+ *
+ * Host only (needs <thread>); C++11.
+ */
+
+#ifndef TWOWHEELBOT_HYPER_SEARCH_H
+#define TWOWHEELBOT_HYPER_SEARCH_H
+
+#include <math.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "BalancingRobotBatch.h"
+#include "DQNTrainer.h"
+#include "SweepRunner.h"
+
+namespace search {
+
+static const int EVAL_LANES = 16;
+
+/**
+ * Sampled ranges, inside the QLearning.js ranges; rates and periods are
+ * drawn log-uniformly, gamma log-uniformly in 1 - gamma
+ */
+struct SearchSpace {
+    double learningRateMin, learningRateMax;
+    double gammaMin, gammaMax;
+    double epsilonMinMin, epsilonMinMax;
+    int epsilonDecayMin, epsilonDecayMax;
+    int batchSizeMin, batchSizeMax;          // Powers of two in between
+    int targetUpdateMin, targetUpdateMax;
+
+    SearchSpace()
+        : learningRateMin(1e-4),
+          learningRateMax(3e-3),
+          gammaMin(0.95),
+          gammaMax(0.999),
+          epsilonMinMin(0.0),
+          epsilonMinMax(0.1),
+          epsilonDecayMin(1000),
+          epsilonDecayMax(10000),
+          batchSizeMin(32),
+          batchSizeMax(256),
+          targetUpdateMin(10),
+          targetUpdateMax(1000) {}
+};
+
+/**
+ * Draw one candidate; fields outside the space (episodes, steps, hidden
+ * size, initial epsilon) come from base
+ */
+inline train::Hyperparameters sampleHyperparameters(const SearchSpace& space, const train::Hyperparameters& base,
+                                                    dqn::XorShift64& random) {
+    const auto logUniform = [&random](double min, double max) {
+        const double u = random.next();
+        return min > 0.0 ? min * pow(max / min, u) : min + (max - min) * u;
+    };
+    train::Hyperparameters params = base;
+    params.learningRate = logUniform(space.learningRateMin, space.learningRateMax);
+    params.gamma = 1.0 - logUniform(1.0 - space.gammaMax, 1.0 - space.gammaMin);
+    params.epsilonMin = space.epsilonMinMin + (space.epsilonMinMax - space.epsilonMinMin) * random.next();
+    params.epsilonDecay = (int)logUniform(space.epsilonDecayMin, space.epsilonDecayMax);
+    std::vector<int> batchSizes;
+    for (int b = 16; b <= 256; b *= 2) {
+        if (b >= space.batchSizeMin && b <= space.batchSizeMax) batchSizes.push_back(b);
+    }
+    if (batchSizes.empty()) batchSizes.push_back(base.batchSize);
+    params.batchSize = batchSizes[std::min((size_t)(random.next() * (double)batchSizes.size()), batchSizes.size() - 1)];
+    params.targetUpdateFreq = (int)logUniform(space.targetUpdateMin, space.targetUpdateMax);
+    return train::clampHyperparameters(params);
+}
+
+struct SearchOptions {
+    int trials;                   // Candidates at the first rung
+    int minEpisodes;              // Training budget of the first rung
+    int maxEpisodes;              // Budget cap of the last rung
+    int eta;                      // Each rung keeps 1 / eta of its trials and multiplies the budget by eta
+    int convergenceWindow;        // QLearning.js convergenceWindow (10 - 500)
+    double convergenceThreshold;  // QLearning.js convergenceThreshold (50 - 1000)
+    int evalSteps;                // Greedy evaluation length
+    double evalAngle;             // Evaluation starts spread over ±evalAngle rad
+    uint64_t seed;
+    train::Hyperparameters base;  // maxStepsPerEpisode, hiddenSize and epsilon of every trial
+    SearchSpace space;
+    dqn::RobotConfig robot;
+
+    SearchOptions()
+        : trials(27),
+          minEpisodes(20),
+          maxEpisodes(540),
+          eta(3),
+          convergenceWindow(100),
+          convergenceThreshold(200.0),
+          evalSteps(2000),
+          evalAngle(0.3),
+          seed(1) {
+        base.maxStepsPerEpisode = 2000;
+    }
+};
+
+/**
+ * Episode budget of every rung: minEpisodes × eta^k up to maxEpisodes,
+ * the last rung capped at maxEpisodes
+ */
+inline std::vector<int> rungBudgets(const SearchOptions& options) {
+    const int eta = std::max(options.eta, 2);
+    std::vector<int> budgets;
+    int target = std::max(options.minEpisodes, 1);
+    while (target < options.maxEpisodes) {
+        budgets.push_back(target);
+        target = (int)std::min((long)target * eta, (long)options.maxEpisodes);
+    }
+    budgets.push_back(std::max(options.maxEpisodes, 1));
+    return budgets;
+}
+
+/**
+ * Seed for one trial, independent of which worker runs it
+ */
+inline uint64_t trialSeed(uint64_t seed, int trial) { return sweep::cellSeed(seed, (size_t)trial); }
+
+/**
+ * train::Network behind the getActions API of BalancingRobotBatch
+ * Inputs are normalized like train::InputHistory (single timestep).
+ */
+class NetworkPolicy {
+public:
+    NetworkPolicy(const train::Network& network, double maxAngle)
+        : network(network),
+          maxAngle(maxAngle),
+          inputs((size_t)EVAL_LANES * 2),
+          hidden((size_t)EVAL_LANES * network.hiddenSize),
+          outputs((size_t)EVAL_LANES * network.outputSize) {}
+
+    /**
+     * Scratch holds EVAL_LANES rows, so larger batches run EVAL_LANES states per forward pass
+     */
+    void getActions(const float* angles, const float* angularVelocities, int* actions, size_t n) const {
+        for (size_t start = 0; start < n; start += EVAL_LANES) {
+            const size_t rows = std::min(n - start, (size_t)EVAL_LANES);
+            for (size_t i = 0; i < rows; i++) {
+                inputs[i * 2] = (float)dqn::clampRange((double)angles[start + i] / maxAngle, -1.0, 1.0);
+                inputs[i * 2 + 1] = (float)dqn::clampRange((double)angularVelocities[start + i] / 10.0, -1.0, 1.0);
+            }
+            network.forward(inputs.data(), (int)rows, hidden.data(), outputs.data());
+            for (size_t i = 0; i < rows; i++) {
+                const float* q = &outputs[i * (size_t)network.outputSize];
+                int best = 0;
+                for (int a = 1; a < network.outputSize; a++) {
+                    if (q[a] > q[best]) best = a;
+                }
+                actions[start + i] = best;
+            }
+        }
+    }
+
+    float getMotorTorque(int action) const { return train::ACTIONS[action]; }
+
+private:
+    const train::Network& network;
+    double maxAngle;
+    mutable std::vector<float> inputs;
+    mutable std::vector<float> hidden;
+    mutable std::vector<float> outputs;
+};
+
+/**
+ * Greedy evaluation of one network
+ */
+struct Evaluation {
+    double score;         // Mean total reward per robot
+    double survival;      // Fraction of robots upright for every step
+    double meanAbsAngle;  // rad, mean over robots
+};
+
+inline Evaluation evaluateNetwork(const train::Network& network, const SearchOptions& options) {
+    dqn::BalancingRobotBatch<EVAL_LANES> robots(options.robot, options.seed);
+    const std::vector<double> starts = sweep::linspace(-options.evalAngle, options.evalAngle, EVAL_LANES);
+    for (int lane = 0; lane < EVAL_LANES; lane++) robots.reset(lane, dqn::RobotState(starts[lane]));
+    robots.runEpisodes(NetworkPolicy(network, robots.config(0).maxAngle), options.evalSteps);
+
+    Evaluation evaluation = {0.0, 0.0, 0.0};
+    for (int lane = 0; lane < EVAL_LANES; lane++) {
+        const dqn::EpisodeStats stats = robots.stats(lane);
+        evaluation.score += stats.totalReward / EVAL_LANES;
+        evaluation.survival += stats.failed ? 0.0 : 1.0 / EVAL_LANES;
+        evaluation.meanAbsAngle += stats.meanAbsAngle / EVAL_LANES;
+    }
+    return evaluation;
+}
+
+/**
+ * One candidate and its training state
+ */
+struct Trial {
+    int id;
+    train::Hyperparameters params;
+    std::unique_ptr<train::DQNTrainer> trainer;  // Released once pruned
+    std::unique_ptr<dqn::BalancingRobot> robot;
+    std::vector<double> rewards;                 // Training reward per episode
+    bool converged;
+    int convergenceEpisode;                      // 0 unless converged
+    int rung;                                    // Last rung reached
+    Evaluation evaluation;
+
+    int episodes() const { return (int)rewards.size(); }
+
+    /**
+     * Mean training reward over the last window episodes (getAverageReward)
+     */
+    double averageReward(int window) const {
+        if (rewards.empty()) return 0.0;
+        const size_t count = std::min(rewards.size(), (size_t)std::max(window, 1));
+        double sum = 0.0;
+        for (size_t i = rewards.size() - count; i < rewards.size(); i++) sum += rewards[i];
+        return sum / (double)count;
+    }
+};
+
+/**
+ * Successive-halving search; see the file comment
+ */
+class HyperSearch {
+public:
+    /**
+     * Called on the calling thread after each rung with its trials, best first
+     */
+    typedef std::function<void(int rung, int budget, const std::vector<const Trial*>& ranked)> RungCallback;
+
+    explicit HyperSearch(const SearchOptions& options) : options(options) {
+        this->options.convergenceWindow = train::clampValue(options.convergenceWindow, 10, 500);
+        this->options.convergenceThreshold = train::clampValue(options.convergenceThreshold, 50.0, 1000.0);
+        this->options.trials = std::max(options.trials, 1);
+        dqn::XorShift64 random(options.seed);
+        for (int t = 0; t < this->options.trials; t++) {
+            std::unique_ptr<Trial> trial(new Trial());
+            trial->id = t;
+            trial->params = sampleHyperparameters(options.space, options.base, random);
+            trial->converged = false;
+            trial->convergenceEpisode = 0;
+            trial->rung = -1;
+            trial->evaluation = Evaluation{0.0, 0.0, 0.0};
+            trials.push_back(std::move(trial));
+        }
+    }
+
+    /**
+     * Run every rung
+     * @return The best trial of the last rung (its trainer is kept)
+     */
+    const Trial& run(sweep::WorkStealingPool& pool, const RungCallback& onRung = RungCallback()) {
+        const std::vector<int> budgets = rungBudgets(options);
+        std::vector<Trial*> alive;
+        for (const std::unique_ptr<Trial>& trial : trials) alive.push_back(trial.get());
+
+        for (size_t k = 0; k < budgets.size(); k++) {
+            const int budget = budgets[k];
+            pool.run(alive.size(), [&](size_t index, int) { advance(*alive[index], budget, (int)k); });
+
+            std::stable_sort(alive.begin(), alive.end(), [](const Trial* a, const Trial* b) {
+                return a->evaluation.score > b->evaluation.score;
+            });
+            if (onRung) onRung((int)k, budget, std::vector<const Trial*>(alive.begin(), alive.end()));
+
+            const size_t eta = (size_t)std::max(options.eta, 2);
+            const size_t keep = k + 1 < budgets.size() ? std::max<size_t>(1, alive.size() / eta) : 1;
+            for (size_t i = keep; i < alive.size(); i++) {
+                alive[i]->trainer.reset();
+                alive[i]->robot.reset();
+            }
+            alive.resize(keep);
+            if (keep == 1 && k + 1 < budgets.size() && alive[0]->converged) break;
+        }
+        return *alive[0];
+    }
+
+    const std::vector<std::unique_ptr<Trial> >& allTrials() const { return trials; }
+    const SearchOptions& searchOptions() const { return options; }
+
+    /**
+     * Training episodes run across all trials
+     */
+    long totalEpisodes() const {
+        long total = 0;
+        for (const std::unique_ptr<Trial>& trial : trials) total += trial->episodes();
+        return total;
+    }
+
+private:
+    // Train one trial up to budget episodes unless it converged, then score it
+    void advance(Trial& trial, int budget, int rung) {
+        const uint64_t seed = trialSeed(options.seed, trial.id);
+        if (!trial.trainer) {
+            trial.trainer.reset(new train::DQNTrainer(2, trial.params, seed));
+            trial.robot.reset(new dqn::BalancingRobot(options.robot, seed));
+        }
+        while (!trial.converged && trial.episodes() < budget) {
+            trial.rewards.push_back(trial.trainer->runEpisode(*trial.robot).reward);
+            if (trial.episodes() >= options.convergenceWindow &&
+                trial.averageReward(options.convergenceWindow) >= options.convergenceThreshold) {
+                trial.converged = true;
+                trial.convergenceEpisode = trial.episodes();
+            }
+        }
+        trial.rung = rung;
+        trial.evaluation = evaluateNetwork(trial.trainer->network(), options);
+    }
+
+    SearchOptions options;
+    std::vector<std::unique_ptr<Trial> > trials;
+};
+
+} // namespace search
+
+#endif // TWOWHEELBOT_HYPER_SEARCH_H
@@ -0,0 +1,206 @@
+/**
+ * Hyperparameter search for TwoWheelBotDQN models
+ *
+ * Trains many candidates concurrently with the native trainer, prunes
+ * them by successive halving (HyperSearch.h) and writes the winner in the
+ * simulator's export format, plus its float32 model blob.
+ *
+ * Usage: search_dqn [options]
+ *   --trials n                 Candidates (default: 27)
+ *   --min-episodes n           First-rung budget (default: 20)
+ *   --max-episodes n           Last-rung budget (default: 540)
+ *   --eta n                    Keep 1 / eta per rung, budget × eta (default: 3)
+ *   --steps n                  Step limit per training episode (default: 2000)
+ *   --hidden n                 Hidden neurons of every trial (64 - 256, default: 128)
+ *   --learning-rate min:max, --gamma min:max, --epsilon-min min:max,
+ *   --epsilon-decay min:max, --batch min:max, --target-update min:max
+ *                              Sampled ranges (defaults: SearchSpace)
+ *   --convergence-threshold x  Average training reward that stops a trial (default: 200)
+ *   --convergence-window n     Episodes averaged (default: 100)
+ *   --eval-steps n             Greedy evaluation length (default: 2000)
+ *   --eval-angle rad           Evaluation starts over ±rad (default: 0.3)
+ *   --reward name              simple, complex, efficient or offset-adaptive (default: simple)
+ *   --threads n                Worker threads (default: all cores)
+ *   --seed n                   Seeds sampling, training and evaluation (default: 1)
+ *   --out file                 Winner (default: two_wheel_bot_dqn_<timestamp>.cpp; the
+ *                              blob goes next to it as .dqnb)
+ *   --checkpoint-dir dir       Write every trial's network after each rung (trial_<id>.dqnb)
+ *   --csv file                 One row per trial and rung
+ */
+
+#include <errno.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "CppModelWriter.h"
+#include "HyperSearch.h"
+#include "ModelBlobWriter.h"
+
+namespace {
+
+bool parseReward(const char* name, dqn::RewardType& type) {
+    if (std::strcmp(name, "simple") == 0) type = dqn::REWARD_SIMPLE;
+    else if (std::strcmp(name, "complex") == 0) type = dqn::REWARD_COMPLEX;
+    else if (std::strcmp(name, "efficient") == 0) type = dqn::REWARD_EFFICIENT;
+    else if (std::strcmp(name, "offset-adaptive") == 0) type = dqn::REWARD_OFFSET_ADAPTIVE;
+    else return false;
+    return true;
+}
+
+/**
+ * Parse "min:max"
+ */
+template <typename T>
+bool parseRange(const char* text, T& min, T& max) {
+    double low, high;
+    char tail;
+    if (std::sscanf(text, "%lf:%lf%c", &low, &high, &tail) != 2 || low < 0.0 || high < low) return false;
+    min = (T)low;
+    max = (T)high;
+    return true;
+}
+
+int usage(const char* program) {
+    std::fprintf(stderr,
+                 "Usage: %s [--trials n] [--min-episodes n] [--max-episodes n] [--eta n] [--steps n] [--hidden n]\n"
+                 "          [--learning-rate min:max] [--gamma min:max] [--epsilon-min min:max]\n"
+                 "          [--epsilon-decay min:max] [--batch min:max] [--target-update min:max]\n"
+                 "          [--convergence-threshold x] [--convergence-window n] [--eval-steps n]\n"
+                 "          [--eval-angle rad] [--reward simple|complex|efficient|offset-adaptive]\n"
+                 "          [--threads n] [--seed n] [--out file] [--checkpoint-dir dir] [--csv file]\n",
+                 program);
+    return 1;
+}
+
+std::string describe(const search::Trial& trial) {
+    char text[160];
+    std::snprintf(text, sizeof(text), "lr %.2e, gamma %.4f, epsilon-min %.3f, decay %d, batch %d, target %d",
+                  trial.params.learningRate, trial.params.gamma, trial.params.epsilonMin, trial.params.epsilonDecay,
+                  trial.params.batchSize, trial.params.targetUpdateFreq);
+    return text;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    search::SearchOptions options;
+    int threads = (int)std::thread::hardware_concurrency();
+    std::string outPath;
+    std::string checkpointDir;
+    const char* csvPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (i + 1 >= argc) return usage(argv[0]);
+        const char* value = argv[++i];
+        search::SearchSpace& space = options.space;
+        bool ok = true;
+        if (std::strcmp(arg, "--trials") == 0) options.trials = std::atoi(value);
+        else if (std::strcmp(arg, "--min-episodes") == 0) options.minEpisodes = std::atoi(value);
+        else if (std::strcmp(arg, "--max-episodes") == 0) options.maxEpisodes = std::atoi(value);
+        else if (std::strcmp(arg, "--eta") == 0) options.eta = std::atoi(value);
+        else if (std::strcmp(arg, "--steps") == 0) options.base.maxStepsPerEpisode = std::atoi(value);
+        else if (std::strcmp(arg, "--hidden") == 0) options.base.hiddenSize = std::atoi(value);
+        else if (std::strcmp(arg, "--learning-rate") == 0) ok = parseRange(value, space.learningRateMin, space.learningRateMax);
+        else if (std::strcmp(arg, "--gamma") == 0) ok = parseRange(value, space.gammaMin, space.gammaMax);
+        else if (std::strcmp(arg, "--epsilon-min") == 0) ok = parseRange(value, space.epsilonMinMin, space.epsilonMinMax);
+        else if (std::strcmp(arg, "--epsilon-decay") == 0) ok = parseRange(value, space.epsilonDecayMin, space.epsilonDecayMax);
+        else if (std::strcmp(arg, "--batch") == 0) ok = parseRange(value, space.batchSizeMin, space.batchSizeMax);
+        else if (std::strcmp(arg, "--target-update") == 0) ok = parseRange(value, space.targetUpdateMin, space.targetUpdateMax);
+        else if (std::strcmp(arg, "--convergence-threshold") == 0) options.convergenceThreshold = std::atof(value);
+        else if (std::strcmp(arg, "--convergence-window") == 0) options.convergenceWindow = std::atoi(value);
+        else if (std::strcmp(arg, "--eval-steps") == 0) options.evalSteps = std::atoi(value);
+        else if (std::strcmp(arg, "--eval-angle") == 0) options.evalAngle = std::atof(value);
+        else if (std::strcmp(arg, "--reward") == 0) ok = parseReward(value, options.robot.rewardType);
+        else if (std::strcmp(arg, "--threads") == 0) threads = std::atoi(value);
+        else if (std::strcmp(arg, "--seed") == 0) options.seed = std::strtoull(value, nullptr, 10);
+        else if (std::strcmp(arg, "--out") == 0) outPath = value;
+        else if (std::strcmp(arg, "--checkpoint-dir") == 0) checkpointDir = value;
+        else if (std::strcmp(arg, "--csv") == 0) csvPath = value;
+        else ok = false;
+        if (!ok) return usage(argv[0]);
+    }
+    // Gamma is sampled through 1 - gamma, which must stay positive
+    if (options.space.gammaMax >= 1.0) return usage(argv[0]);
+
+    if (!checkpointDir.empty() && mkdir(checkpointDir.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::fprintf(stderr, "Could not create %s\n", checkpointDir.c_str());
+        return 1;
+    }
+    FILE* csv = csvPath ? std::fopen(csvPath, "w") : nullptr;
+    if (csvPath && !csv) {
+        std::fprintf(stderr, "Could not open %s\n", csvPath);
+        return 1;
+    }
+    if (csv) {
+        std::fprintf(csv, "rung,budget,rank,trial,episodes,learning_rate,gamma,epsilon_min,epsilon_decay,batch,"
+                          "target_update,avg_reward,converged_episode,score,survival,mean_abs_angle\n");
+    }
+
+    const std::string timestamp = train::exportTimestamp();
+    if (outPath.empty()) outPath = "two_wheel_bot_dqn_" + timestamp + ".cpp";
+    const train::Normalization normalization(dqn::clampConfig(options.robot).maxAngle);
+
+    sweep::WorkStealingPool pool(threads);
+    search::HyperSearch hyperSearch(options);
+    options = hyperSearch.searchOptions();
+    const std::vector<int> budgets = search::rungBudgets(options);
+    std::printf("Searching %d trials of 2-%d-%d over %zu rungs (%d - %d episodes, eta %d) on %d threads\n",
+                options.trials, train::clampHyperparameters(options.base).hiddenSize, train::NUM_ACTIONS,
+                budgets.size(), budgets.front(), budgets.back(), options.eta, pool.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    bool checkpointsWritten = true;
+    const search::Trial& best = hyperSearch.run(pool, [&](int rung, int budget, const std::vector<const search::Trial*>& ranked) {
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const search::Trial& leader = *ranked.front();
+        std::printf("rung %d: %zu trials to %d episodes, best #%d score %.1f (survival %.0f%%, %d episodes%s), %.1f s\n",
+                    rung, ranked.size(), budget, leader.id, leader.evaluation.score, leader.evaluation.survival * 100.0,
+                    leader.episodes(), leader.converged ? ", converged" : "", elapsed);
+        std::printf("        %s\n", describe(leader).c_str());
+        std::fflush(stdout);
+        for (size_t r = 0; r < ranked.size(); r++) {
+            const search::Trial& trial = *ranked[r];
+            if (csv) {
+                std::fprintf(csv, "%d,%d,%zu,%d,%d,%.9g,%.9g,%.9g,%d,%d,%d,%.9g,%d,%.9g,%.9g,%.9g\n", rung, budget, r,
+                             trial.id, trial.episodes(), trial.params.learningRate, trial.params.gamma,
+                             trial.params.epsilonMin, trial.params.epsilonDecay, trial.params.batchSize,
+                             trial.params.targetUpdateFreq, trial.averageReward(options.convergenceWindow),
+                             trial.convergenceEpisode, trial.evaluation.score, trial.evaluation.survival,
+                             trial.evaluation.meanAbsAngle);
+            }
+            if (!checkpointDir.empty()) {
+                const std::string path = checkpointDir + "/trial_" + std::to_string(trial.id) + ".dqnb";
+                checkpointsWritten = train::writeModelBlob(path.c_str(), trial.trainer->network(), normalization) &&
+                                     checkpointsWritten;
+            }
+        }
+    });
+    if (csv) std::fclose(csv);
+    if (!checkpointsWritten) std::fprintf(stderr, "Could not write every checkpoint to %s\n", checkpointDir.c_str());
+
+    std::string blobPath = outPath;
+    if (blobPath.size() > 4 && blobPath.compare(blobPath.size() - 4, 4, ".cpp") == 0) blobPath.resize(blobPath.size() - 4);
+    blobPath += ".dqnb";
+    if (!train::writeCppModel(outPath.c_str(), best.trainer->network(), timestamp, normalization) ||
+        !train::writeModelBlob(blobPath.c_str(), best.trainer->network(), normalization)) {
+        std::fprintf(stderr, "Could not write %s\n", outPath.c_str());
+        return 1;
+    }
+
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const long exhaustive = (long)options.trials * budgets.back();
+    std::printf("Best trial #%d: score %.1f, survival %.0f%%, mean |angle| %.4f rad after %d episodes\n", best.id,
+                best.evaluation.score, best.evaluation.survival * 100.0, best.evaluation.meanAbsAngle, best.episodes());
+    std::printf("  %s\n", describe(best).c_str());
+    std::printf("%ld training episodes in %.1f s (%.0f%% of training every trial to %d)\n", hyperSearch.totalEpisodes(),
+                elapsed, 100.0 * (double)hyperSearch.totalEpisodes() / (double)exhaustive, budgets.back());
+    std::printf("Wrote %s and %s\n", outPath.c_str(), blobPath.c_str());
+    return checkpointsWritten ? 0 : 1;
+}
@@ -0,0 +1,293 @@
+/**
+ * Parameter-sweep runner
+ *
+ * Evaluates an exported policy closed-loop on every cell of a grid of
+ * robot configs and start angles. Cells are spread over a work-stealing
+ * thread pool; each episode builds its own BalancingRobot and policy on
+ * the worker's stack, so workers share nothing but the job counters.
+ *
+ * Results do not depend on the thread count: every cell's seed derives
+ * from its index, and results are written in cell order.
+ *
+ * Host only (needs <thread>); C++11.
+ */
+
+#ifndef TWOWHEELBOT_SWEEP_RUNNER_H
+#define TWOWHEELBOT_SWEEP_RUNNER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BalancingRobot.h"
+
+namespace sweep {
+
+/**
+ * One swept parameter: a RobotConfig field (or the start angle) and the
+ * values it takes
+ */
+struct Axis {
+    std::string name;
+    std::vector<double> values;
+};
+
+/**
+ * @return count values evenly spaced over [min, max] (just min for count 1)
+ */
+inline std::vector<double> linspace(double min, double max, int count) {
+    std::vector<double> values;
+    for (int i = 0; i < count; i++) values.push_back(count > 1 ? min + (max - min) * i / (count - 1) : min);
+    return values;
+}
+
+/**
+ * Set a RobotConfig field by its BalancingRobot.updateConfig name
+ * wheelMass and wheelFriction are accepted like updateConfig does, but
+ * neither simulator's dynamics read them (the JS wheelInertia is never
+ * used), so those axes leave the trajectory unchanged. Anything derived
+ * from the config is recomputed by BalancingRobot::configure.
+ * @return False for names that are not sweepable
+ */
+inline bool setParameter(dqn::RobotConfig& config, const std::string& name, double value) {
+    if (name == "mass") config.mass = value;
+    else if (name == "centerOfMassHeight") config.centerOfMassHeight = value;
+    else if (name == "motorStrength") config.motorStrength = value;
+    else if (name == "friction") config.friction = value;
+    else if (name == "damping") config.damping = value;
+    else if (name == "timestep") config.timestep = value;
+    else if (name == "wheelRadius") config.wheelRadius = value;
+    else if (name == "wheelMass") config.wheelMass = value;
+    else if (name == "wheelFriction") config.wheelFriction = value;
+    else if (name == "maxAngle") config.maxAngle = value;
+    else if (name == "motorTorqueRange") config.motorTorqueRange = value;
+    else if (name == "angleOffset") config.angleOffset = value;
+    else if (name == "offsetVariation") config.offsetVariation = value;
+    else if (name == "offsetChangeRate") config.offsetChangeRate = value;
+    else if (name == "trainingOffsetRange") config.trainingOffsetRange = value;
+    else return false;
+    return true;
+}
+
+/**
+ * Cartesian product of the axes over a base config; the last axis varies
+ * fastest. The "startAngle" axis sets the reset angle instead of a
+ * config field.
+ */
+class Grid {
+public:
+    explicit Grid(const dqn::RobotConfig& base = dqn::RobotConfig()) : base(base) {}
+
+    /**
+     * @return False if the name is neither a config field nor startAngle
+     */
+    bool addAxis(const std::string& name, const std::vector<double>& values) {
+        dqn::RobotConfig probe;
+        if (name != "startAngle" && !setParameter(probe, name, 0.0)) return false;
+        if (values.empty()) return false;
+        axes.push_back(Axis{name, values});
+        return true;
+    }
+
+    size_t size() const {
+        size_t n = 1;
+        for (const Axis& axis : axes) n *= axis.values.size();
+        return n;
+    }
+
+    const std::vector<Axis>& getAxes() const { return axes; }
+
+    /**
+     * Config, start angle and per-axis values of one cell
+     * @param values Output, one value per axis (may be null)
+     */
+    void cell(size_t index, dqn::RobotConfig& config, double& startAngle, double* values) const {
+        config = base;
+        startAngle = 0.0;
+        for (size_t a = axes.size(); a-- > 0;) {
+            const Axis& axis = axes[a];
+            const double value = axis.values[index % axis.values.size()];
+            index /= axis.values.size();
+            if (values) values[a] = value;
+            if (axis.name == "startAngle") startAngle = value;
+            else setParameter(config, axis.name, value);
+        }
+    }
+
+private:
+    dqn::RobotConfig base;
+    std::vector<Axis> axes;
+};
+
+/**
+ * Fixed set of workers over job indices [0, jobCount)
+ *
+ * Each worker starts with an equal contiguous share and claims jobs from
+ * the front of it; a worker that runs dry steals the back half of the
+ * largest remaining share. Episodes that fall early make shares uneven, so
+ * stealing keeps every core busy until the grid is done.
+ */
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int threads) : threads(threads > 0 ? threads : 1) {}
+
+    /**
+     * Run job(index, worker) once for every index; returns when all are done
+     */
+    void run(size_t jobCount, const std::function<void(size_t, int)>& job) {
+        stolenJobs = 0;
+        std::vector<Share> shares(threads);
+        for (int w = 0; w < threads; w++) {
+            shares[w].begin = jobCount * w / threads;
+            shares[w].end = jobCount * (w + 1) / threads;
+        }
+
+        std::vector<std::thread> workers;
+        for (int w = 1; w < threads; w++) {
+            workers.push_back(std::thread(&WorkStealingPool::work, this, std::ref(shares), w, std::cref(job)));
+        }
+        work(shares, 0, job);
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    int size() const { return threads; }
+
+    /**
+     * Jobs moved between workers by the last run()
+     */
+    size_t stolen() const { return stolenJobs.load(); }
+
+private:
+    struct Share {
+        std::mutex lock;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    void work(std::vector<Share>& shares, int self, const std::function<void(size_t, int)>& job) {
+        size_t index;
+        while (claim(shares[self], index) || (steal(shares, self) && claim(shares[self], index))) {
+            job(index, self);
+        }
+    }
+
+    static bool claim(Share& share, size_t& index) {
+        std::lock_guard<std::mutex> guard(share.lock);
+        if (share.begin >= share.end) return false;
+        index = share.begin++;
+        return true;
+    }
+
+    bool steal(std::vector<Share>& shares, int self) {
+        for (;;) {
+            int victim = -1;
+            size_t largest = 0;
+            for (int w = 0; w < threads; w++) {
+                if (w == self) continue;
+                std::lock_guard<std::mutex> guard(shares[w].lock);
+                const size_t remaining = shares[w].end - shares[w].begin;
+                if (remaining > largest) {
+                    largest = remaining;
+                    victim = w;
+                }
+            }
+            if (victim < 0) return false;
+
+            size_t begin, end;
+            {
+                std::lock_guard<std::mutex> guard(shares[victim].lock);
+                const size_t remaining = shares[victim].end - shares[victim].begin;
+                if (remaining == 0) continue;  // Drained meanwhile; look again
+                end = shares[victim].end;
+                begin = end - (remaining + 1) / 2;
+                shares[victim].end = begin;
+            }
+            std::lock_guard<std::mutex> guard(shares[self].lock);
+            shares[self].begin = begin;
+            shares[self].end = end;
+            stolenJobs += end - begin;
+            return true;
+        }
+    }
+
+    int threads;
+    std::atomic<size_t> stolenJobs{0};
+};
+
+/**
+ * Outcome of one grid cell
+ */
+struct Result {
+    size_t index;
+    dqn::EpisodeStats stats;
+    double survivalTime;  // steps * timestep in seconds
+};
+
+/**
+ * Seed for one cell, independent of which worker runs it
+ */
+inline uint64_t cellSeed(uint64_t seed, size_t index) {
+    return seed + (uint64_t)(index + 1) * 0x9E3779B97F4A7C15ull;
+}
+
+/**
+ * Closed-loop episode for one cell with a fresh policy instance
+ */
+template <typename Policy>
+Result evaluate(const Grid& grid, size_t index, int maxSteps, uint64_t seed) {
+    dqn::RobotConfig config;
+    double startAngle;
+    grid.cell(index, config, startAngle, nullptr);
+
+    dqn::BalancingRobot robot(config, cellSeed(seed, index));
+    robot.reset(dqn::RobotState(startAngle));
+    Policy policy;
+
+    Result result;
+    result.index = index;
+    result.stats = dqn::runEpisode(robot, policy, maxSteps);
+    result.survivalTime = result.stats.steps * robot.config().timestep;
+    return result;
+}
+
+/**
+ * Evaluate every cell on the pool, handing results to sink in cell order
+ * as soon as each prefix of the grid is complete
+ * @param sink Called on the calling thread
+ */
+template <typename Policy>
+void runSweep(const Grid& grid, int maxSteps, uint64_t seed, WorkStealingPool& pool,
+              const std::function<void(const Result&)>& sink) {
+    const size_t count = grid.size();
+    std::vector<Result> results(count);
+    std::unique_ptr<std::atomic<bool>[]> ready(new std::atomic<bool>[count]);
+    for (size_t i = 0; i < count; i++) ready[i] = false;
+
+    std::thread runner([&]() {
+        pool.run(count, [&](size_t index, int) {
+            results[index] = evaluate<Policy>(grid, index, maxSteps, seed);
+            ready[index].store(true, std::memory_order_release);
+        });
+    });
+
+    size_t next = 0;
+    while (next < count) {
+        if (ready[next].load(std::memory_order_acquire)) {
+            sink(results[next++]);
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    runner.join();
+}
+
+} // namespace sweep
+
+#endif // TWOWHEELBOT_SWEEP_RUNNER_H
@@ -0,0 +1,204 @@
+/**
+ * Parameter sweep for one exported TwoWheelBotDQN model
+ *
+ * Built once per model in models/ with DQN_MODEL_FILE and
+ * DQN_INT8_MODEL_FILE. Runs the model closed-loop on the BalancingRobot
+ * simulator for every cell of a grid of configs and start angles, and
+ * reports survival time, mean |angle| and motor energy per cell.
+ *
+ * Usage: sweep_dqn_<model> [options] [--<parameter> min:max:count | value]...
+ *   --<parameter>  Sweep a BalancingRobot.updateConfig field (mass,
+ *                  centerOfMassHeight, motorStrength, friction, damping,
+ *                  wheelRadius, wheelMass, maxAngle, motorTorqueRange,
+ *                  angleOffset, trainingOffsetRange, ...) or startAngle;
+ *                  radians for angles. Without any, a default
+ *                  qualification grid runs.
+ *   --int8         Evaluate the int8 export instead of the float one
+ *   --steps n      Episode length limit (default: 5000)
+ *   --threads n    Worker threads (default: all cores)
+ *   --seed n       Base seed for sensor drift (default: 1)
+ *   --csv file     Write one row per cell
+ *   --binary file  Write the same table as float64 records (see writeBinaryHeader)
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "SweepRunner.h"
+
+namespace {
+
+const char* const RESULT_COLUMNS[] = {"steps", "failed", "survival_s", "mean_abs_angle", "energy_j", "total_reward"};
+const int RESULT_COLUMN_COUNT = 6;
+
+/**
+ * Parse "min:max:count" or a single value
+ */
+bool parseAxis(const char* text, std::vector<double>& values) {
+    double min, max;
+    int count;
+    char tail;
+    if (std::sscanf(text, "%lf:%lf:%d%c", &min, &max, &count, &tail) == 3 && count > 0) {
+        values = sweep::linspace(min, max, count);
+        return true;
+    }
+    if (std::sscanf(text, "%lf%c", &min, &tail) == 1) {
+        values.assign(1, min);
+        return true;
+    }
+    return false;
+}
+
+void addDefaultAxes(sweep::Grid& grid) {
+    grid.addAxis("mass", sweep::linspace(0.5, 3.0, 6));
+    grid.addAxis("friction", sweep::linspace(0.0, 0.2, 3));
+    grid.addAxis("damping", sweep::linspace(0.0, 0.1, 3));
+    grid.addAxis("angleOffset", sweep::linspace(-0.05, 0.05, 3));
+    grid.addAxis("startAngle", sweep::linspace(-0.3, 0.3, 7));
+}
+
+/**
+ * Binary layout (little-endian):
+ *   char[8]  "DQNSWEEP"
+ *   uint32   format version (1)
+ *   uint32   column count C
+ *   uint64   row count
+ *   C NUL-terminated column names (the CSV header)
+ *   rows of C float64 values
+ */
+void writeBinaryHeader(FILE* file, const std::vector<std::string>& columns, uint64_t rows) {
+    const uint32_t version = 1;
+    const uint32_t columnCount = (uint32_t)columns.size();
+    std::fwrite("DQNSWEEP", 1, 8, file);
+    std::fwrite(&version, sizeof(version), 1, file);
+    std::fwrite(&columnCount, sizeof(columnCount), 1, file);
+    std::fwrite(&rows, sizeof(rows), 1, file);
+    for (const std::string& column : columns) std::fwrite(column.c_str(), 1, column.size() + 1, file);
+}
+
+int usage(const char* program) {
+    std::fprintf(stderr,
+                 "Usage: %s [--int8] [--steps n] [--threads n] [--seed n] [--csv file] [--binary file]\n"
+                 "          [--<parameter> min:max:count | value]...\n",
+                 program);
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool int8 = false;
+    int maxSteps = 5000;
+    int threads = (int)std::thread::hardware_concurrency();
+    uint64_t seed = 1;
+    const char* csvPath = nullptr;
+    const char* binaryPath = nullptr;
+    sweep::Grid grid;
+    bool customGrid = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--int8") == 0) {
+            int8 = true;
+        } else if (std::strcmp(arg, "--steps") == 0 && hasValue) {
+            maxSteps = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--csv") == 0 && hasValue) {
+            csvPath = argv[++i];
+        } else if (std::strcmp(arg, "--binary") == 0 && hasValue) {
+            binaryPath = argv[++i];
+        } else if (std::strncmp(arg, "--", 2) == 0 && hasValue) {
+            std::vector<double> values;
+            if (!parseAxis(argv[++i], values) || !grid.addAxis(arg + 2, values)) {
+                std::fprintf(stderr, "Invalid sweep axis %s %s\n", arg, argv[i]);
+                return usage(argv[0]);
+            }
+            customGrid = true;
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (!customGrid) addDefaultAxes(grid);
+    if (threads < 1) threads = 1;
+
+    std::vector<std::string> columns(1, "index");
+    for (const sweep::Axis& axis : grid.getAxes()) columns.push_back(axis.name);
+    for (int c = 0; c < RESULT_COLUMN_COUNT; c++) columns.push_back(RESULT_COLUMNS[c]);
+
+    FILE* csv = csvPath ? std::fopen(csvPath, "w") : nullptr;
+    FILE* binary = binaryPath ? std::fopen(binaryPath, "wb") : nullptr;
+    if ((csvPath && !csv) || (binaryPath && !binary)) {
+        std::fprintf(stderr, "Could not open %s\n", csvPath && !csv ? csvPath : binaryPath);
+        return 1;
+    }
+    if (csv) {
+        for (size_t c = 0; c < columns.size(); c++) std::fprintf(csv, "%s%s", c ? "," : "", columns[c].c_str());
+        std::fprintf(csv, "\n");
+    }
+    if (binary) writeBinaryHeader(binary, columns, grid.size());
+
+    size_t cells = 0, survived = 0;
+    double survivalSum = 0.0, angleSum = 0.0, energySum = 0.0;
+    long steps = 0;
+    std::vector<double> row(columns.size());
+    const size_t axisCount = grid.getAxes().size();
+
+    const auto sink = [&](const sweep::Result& result) {
+        dqn::RobotConfig config;
+        double startAngle;
+        row[0] = (double)result.index;
+        grid.cell(result.index, config, startAngle, &row[1]);
+        double* out = &row[1 + axisCount];
+        out[0] = result.stats.steps;
+        out[1] = result.stats.failed ? 1.0 : 0.0;
+        out[2] = result.survivalTime;
+        out[3] = result.stats.meanAbsAngle;
+        out[4] = result.stats.energy;
+        out[5] = result.stats.totalReward;
+
+        if (csv) {
+            for (size_t c = 0; c < row.size(); c++) std::fprintf(csv, "%s%.10g", c ? "," : "", row[c]);
+            std::fprintf(csv, "\n");
+        }
+        if (binary) std::fwrite(row.data(), sizeof(double), row.size(), binary);
+
+        cells++;
+        survived += !result.stats.failed;
+        survivalSum += result.survivalTime;
+        angleSum += result.stats.meanAbsAngle;
+        energySum += result.stats.energy;
+        steps += result.stats.steps;
+    };
+
+    sweep::WorkStealingPool pool(threads);
+    const auto start = std::chrono::steady_clock::now();
+    if (int8) {
+        sweep::runSweep<TwoWheelBotDQNInt8>(grid, maxSteps, seed, pool, sink);
+    } else {
+        sweep::runSweep<TwoWheelBotDQN>(grid, maxSteps, seed, pool, sink);
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (csv) std::fclose(csv);
+    if (binary) std::fclose(binary);
+
+    std::printf("DQN parameter sweep (%s policy, %d threads, %d steps max)\n", int8 ? "int8" : "float", pool.size(),
+                maxSteps);
+    std::printf("cells %zu, survived %zu (%.1f%%), mean survival %.2f s, mean |angle| %.4f rad, mean energy %.3f J\n",
+                cells, survived, cells ? 100.0 * survived / cells : 0.0, cells ? survivalSum / cells : 0.0,
+                cells ? angleSum / cells : 0.0, cells ? energySum / cells : 0.0);
+    std::printf("%ld steps in %.3f s (%.2fM steps/s, %zu jobs stolen)\n", steps, elapsed,
+                elapsed > 0.0 ? steps / elapsed / 1e6 : 0.0, pool.stolen());
+    return 0;
+}
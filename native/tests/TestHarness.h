@@ -0,0 +1,56 @@
+/**
+ * Minimal test harness for native tests
+ *
+ * Mirrors the JS test suites: each test reports "✓ PASS" / "✗ FAIL" with a
+ * message, and the process exits non-zero if any test failed.
+ */
+
+#ifndef TWOWHEELBOT_TEST_HARNESS_H
+#define TWOWHEELBOT_TEST_HARNESS_H
+
+#include <cstdio>
+#include <string>
+
+namespace test {
+
+struct Results {
+    int total = 0;
+    int failed = 0;
+};
+
+inline Results& results() {
+    static Results r;
+    return r;
+}
+
+struct Failure {
+    std::string message;
+};
+
+inline void check(bool condition, const std::string& message) {
+    if (!condition) throw Failure{message};
+}
+
+template <typename F>
+void run(const char* name, F body) {
+    Results& r = results();
+    r.total++;
+    try {
+        std::string message = body();
+        std::printf("✓ PASS: %s - %s\n", name, message.c_str());
+    } catch (const Failure& failure) {
+        r.failed++;
+        std::printf("✗ FAIL: %s - Assertion failed: %s\n", name, failure.message.c_str());
+    }
+}
+
+inline int summarize() {
+    const Results& r = results();
+    std::printf("\n--- Test Summary ---\n");
+    std::printf("Total Tests: %d\nPassed: %d\nFailed: %d\n", r.total, r.total - r.failed, r.failed);
+    return r.failed == 0 ? 0 : 1;
+}
+
+} // namespace test
+
+#endif // TWOWHEELBOT_TEST_HARNESS_H
@@ -0,0 +1,131 @@
+/**
+ * Balance-point estimator tests
+ *
+ * Checks the simulator's EMA and confidence steps, the lean compensation
+ * and the saved-calibration API, and that the first model (DQN_MODEL_FILE)
+ * with a mis-mounted IMU finds the offset and spends less motor energy
+ * than without the estimator.
+ */
+
+#include DQN_MODEL_FILE
+
+#include "BalancingRobot.h"
+#include "DQNBalancePoint.h"
+
+#include <cmath>
+#include <string>
+
+#include "TestHarness.h"
+
+namespace {
+
+typedef dqn::BalancePointPolicy<TwoWheelBotDQN> CorrectedDQN;
+
+dqn::RobotConfig mountedConfig(double offset) {
+    dqn::RobotConfig config;
+    config.angleOffset = offset;
+    config.offsetVariation = 0.0;
+    config.offsetChangeRate = 0.0;
+    return config;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Balance Point Tests (%s)...\n\n", DQN_MODEL_FILE);
+
+    test::run("Simulator Update Rule", []() {
+        // Without lean compensation this is _updateBalancePointEstimate step for step
+        dqn::BalancePointEstimator estimator(1.0f, 0.0f);
+        double estimate = 0.0, confidence = 0.0;
+        for (int i = 0; i < 1500; i++) {
+            const float angle = 0.05f + 0.01f * std::sin(0.1f * (float)i);
+            const float angularVelocity = (i / 100) % 3 == 0 ? 2.0f : 0.5f;
+            estimator.update(angle, angularVelocity, 0.0f);
+            if (std::fabs(angularVelocity) < 1.0f) {
+                estimate = 0.98 * estimate + 0.02 * (double)angle;
+                confidence = std::fmin(1.0, confidence + 0.001);
+            } else {
+                confidence = std::fmax(0.0, confidence - 0.002);
+            }
+            test::check(std::fabs((double)estimator.estimate() - estimate) < 1e-5 &&
+                            std::fabs((double)estimator.confidence() - confidence) < 1e-5,
+                        "Tick " + std::to_string(i) + " matches the simulator");
+        }
+        test::check(std::fabs(estimator.correct(0.05f) - (0.05f - estimator.confidence() * estimator.estimate())) < 1e-7f,
+                    "Correction is confidence-weighted");
+
+        for (int i = 0; i < 500; i++) estimator.update(2.0f, 0.0f, 0.0f);
+        test::check(estimator.estimate() == 0.5f, "Estimate clamped to maxAngle / 2");
+        return "Estimate " + std::to_string(estimate) + ", confidence " + std::to_string(confidence);
+    });
+
+    test::run("Lean Compensation", []() {
+        // A robot holding a 0.08 rad true lean with the torque that balances gravity
+        const float lean = dqn::balanceLeanPerTorque(5.0f, 1.0f, 0.4f);
+        test::check(std::fabs(lean - 1.27421f) < 1e-4f, "Default robot leans 1.274 rad per unit torque");
+        dqn::BalancePointEstimator estimator(1.04719755f, lean);
+        const float offset = -0.06f, trueLean = 0.08f;
+        for (int i = 0; i < 2000; i++) {
+            // The policy chatters between full and no torque around the held mean
+            const float torque = i % 2 == 0 ? 2.0f * trueLean / lean : 0.0f;
+            estimator.update(trueLean + offset, 0.1f, torque);
+        }
+        test::check(std::fabs(estimator.estimate() - offset) < 0.005f,
+                    "Estimate is the offset, not the lean (" + std::to_string(estimator.estimate()) + ")");
+        return "Offset " + std::to_string(offset) + " rad found under a " + std::to_string(trueLean) + " rad lean";
+    });
+
+    test::run("Saved Calibration", []() {
+        CorrectedDQN bot;
+        bot.estimator().restore(0.1f, 2.0f);
+        test::check(bot.estimator().estimate() == 0.1f && bot.estimator().confidence() == 1.0f,
+                    "Restore clamps the confidence");
+        bot.reset(0.1f, 0.0f);
+        test::check(bot.estimator().estimate() == 0.1f, "Policy reset keeps the estimate");
+
+        TwoWheelBotDQN plain;
+        plain.reset(0.0f, 0.0f);
+        bot.estimator().restore(0.1f, 1.0f);
+        const float angles[] = {0.1f, 0.12f, 0.05f, 0.2f};
+        for (float angle : angles) {
+            const int expected = plain.getAction(bot.estimator().correct(angle), 0.0f);
+            test::check(bot.getAction(angle, 0.0f) == expected, "Policy sees the corrected angle");
+            bot.estimator().restore(0.1f, 1.0f);
+        }
+        bot.estimator().clear();
+        test::check(bot.estimator().estimate() == 0.0f && bot.estimator().confidence() == 0.0f, "Clear forgets");
+        return std::string("Restored, kept across reset, cleared");
+    });
+
+    test::run("Mis-Mounted IMU", []() {
+        std::string message;
+        const double offsets[] = {0.0, 0.05, 0.1};
+        for (double offset : offsets) {
+            dqn::BalancingRobot rawRobot(mountedConfig(offset));
+            rawRobot.reset(dqn::RobotState(0.02, 0.0));
+            TwoWheelBotDQN raw;
+            const dqn::EpisodeStats uncorrected = dqn::runEpisode(rawRobot, raw, 5000);
+
+            dqn::BalancingRobot robot(mountedConfig(offset));
+            robot.reset(dqn::RobotState(0.02, 0.0));
+            CorrectedDQN bot;
+            const dqn::EpisodeStats corrected = dqn::runEpisode(robot, bot, 5000);
+
+            const std::string label = "Offset " + std::to_string(offset) + ": ";
+            test::check(!corrected.failed, label + "balances");
+            test::check(std::fabs((double)bot.estimator().estimate() - offset) < 0.02,
+                        label + "estimate " + std::to_string(bot.estimator().estimate()));
+            test::check(bot.estimator().confidence() == 1.0f, label + "full confidence");
+            if (offset > 0.0) {
+                test::check(corrected.energy < uncorrected.energy, label + "energy " + std::to_string(corrected.energy) +
+                                                                       " vs " + std::to_string(uncorrected.energy));
+            }
+            message += (message.empty() ? "" : ", ") + std::to_string(offset) + " rad: energy " +
+                       std::to_string((int)uncorrected.energy) + " -> " + std::to_string((int)corrected.energy);
+        }
+        return message;
+    });
+
+    return test::summarize();
+}
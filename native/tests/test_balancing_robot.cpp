@@ -0,0 +1,262 @@
+/**
+ * BalancingRobot simulator tests for one exported model
+ *
+ * Checks the C++ port against trajectories recorded from
+ * src/physics/BalancingRobot.js, then closes the loop with the model's
+ * float and int8 policies, one robot at a time and as a
+ * BalancingRobotBatch. Built once per model in models/ with
+ * DQN_MODEL_FILE and DQN_INT8_MODEL_FILE.
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+
+#include "BalancingRobotBatch.h"
+
+#include <cmath>
+#include <string>
+
+#include "TestHarness.h"
+
+namespace {
+
+/**
+ * Final state of a JS run (node, BalancingRobot.js) with the config from
+ * trajectoryConfig(), reset to angle 0.05 / angular velocity 0.3 and
+ * stepped for at most 400 steps
+ */
+struct Trajectory {
+    dqn::RewardType rewardType;
+    bool feedback;  // Proportional controller instead of a fixed action pattern
+    int steps;
+    bool done;
+    double totalReward;
+    double angle;
+    double angularVelocity;
+    double position;
+    double velocity;
+    double wheelAngle;
+};
+
+const Trajectory JS_TRAJECTORIES[] = {
+    {dqn::REWARD_SIMPLE, false, 17, true, 16.000000000000000, 0.81932257386935869, 5.3632655836663563, -0.37218578553001802, -2.4609473083629108, -3.1015482127501510},
+    {dqn::REWARD_SIMPLE, true, 400, false, 400.00000000000000, -0.036216027486512023, -1.3182147202628244e-16, -6.4180711908249686, -1.0553115931655404, -3.2184441327713391},
+    {dqn::REWARD_COMPLEX, false, 17, true, 0.0059823640089327057, 0.81932257386935869, 5.3632655836663563, -0.37218578553001802, -2.4609473083629108, -3.1015482127501510},
+    {dqn::REWARD_COMPLEX, true, 400, false, 382.24315992920145, -0.036216027486512023, -1.3182147202628244e-16, -6.4180711908249686, -1.0553115931655404, -3.2184441327713391},
+    {dqn::REWARD_EFFICIENT, false, 17, true, -1.9840176359910657, 0.81932257386935869, 5.3632655836663563, -0.37218578553001802, -2.4609473083629108, -3.1015482127501510},
+    {dqn::REWARD_EFFICIENT, true, 400, false, 388.52047011502981, -0.036216027486512023, -1.3182147202628244e-16, -6.4180711908249686, -1.0553115931655404, -3.2184441327713391},
+    {dqn::REWARD_OFFSET_ADAPTIVE, false, 17, true, 2.8100322913627735, 0.81932257386935869, 5.3632655836663563, -0.37218578553001802, -2.4609473083629108, -3.1015482127501510},
+    {dqn::REWARD_OFFSET_ADAPTIVE, true, 400, false, 501.95577317091340, -0.036216027486512023, -1.3182147202628244e-16, -6.4180711908249686, -1.0553115931655404, -3.2184441327713391},
+};
+
+// Fixed offset with no drift, so the JS run needs no Math.random
+dqn::RobotConfig trajectoryConfig(dqn::RewardType rewardType) {
+    dqn::RobotConfig config;
+    config.mass = 1.2;
+    config.centerOfMassHeight = 0.35;
+    config.motorStrength = 4.0;
+    config.friction = 0.1;
+    config.damping = 0.05;
+    config.motorTorqueRange = 6.0;
+    config.maxAngle = dqn::SIM_PI / 4.0;
+    config.rewardType = rewardType;
+    config.angleOffset = 0.03;
+    config.offsetVariation = 0.0;
+    config.offsetChangeRate = 0.0;
+    return config;
+}
+
+bool near(double actual, double expected) {
+    return std::fabs(actual - expected) <= 1e-9 * (1.0 + std::fabs(expected));
+}
+
+const int CLOSED_LOOP_STEPS = 2000;
+
+template <typename Policy>
+dqn::EpisodeStats closedLoop(double startAngle, uint64_t seed) {
+    dqn::BalancingRobot robot(dqn::RobotConfig(), seed);
+    robot.reset(dqn::RobotState(startAngle));
+    Policy policy;
+    return dqn::runEpisode(robot, policy, CLOSED_LOOP_STEPS);
+}
+
+const int BATCH = 37;  // Not a multiple of the getActions block
+typedef dqn::BalancingRobotBatch<BATCH> RobotBatch;
+
+// Lane i of the sweep: mass, height and motor strength vary per lane
+dqn::RobotConfig sweepConfig(int lane) {
+    dqn::RobotConfig config;
+    config.mass = 0.6 + 0.06 * lane;
+    config.centerOfMassHeight = 0.25 + 0.02 * (lane % 11);
+    config.motorStrength = 3.0 + 0.5 * (lane % 7);
+    config.rewardType = (dqn::RewardType)(lane % 4);
+    config.trainingOffsetRange = 0.05;
+    config.offsetVariation = 0.1;
+    config.offsetChangeRate = 0.01;
+    return config;
+}
+
+double sweepStart(int lane) {
+    return 0.3 * ((lane % 9) - 4) / 4.0;
+}
+
+bool sameState(const dqn::RobotState& a, const dqn::RobotState& b) {
+    return a.angle == b.angle && a.angularVelocity == b.angularVelocity && a.position == b.position &&
+           a.velocity == b.velocity && a.wheelAngle == b.wheelAngle && a.wheelVelocity == b.wheelVelocity;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running BalancingRobot Tests...\n\n");
+
+    test::run("Matches Simulator Trajectories", []() {
+        for (const Trajectory& expected : JS_TRAJECTORIES) {
+            dqn::BalancingRobot robot(trajectoryConfig(expected.rewardType));
+            robot.reset(dqn::RobotState(0.05, 0.3));
+            bool done = false;
+            for (int i = 0; i < 400 && !done; i++) {
+                double torque;
+                if (expected.feedback) {
+                    torque = 4.0 * (robot.measuredAngle() + 0.2 * robot.state().angularVelocity);
+                    torque = torque < -1.0 ? -1.0 : (torque > 1.0 ? 1.0 : torque);
+                } else {
+                    torque = (double)dqn::ACTION_TORQUES[(i * 5 + (i >> 2)) % 3];
+                }
+                done = robot.step(torque).done;
+            }
+
+            const std::string run = "reward type " + std::to_string((int)expected.rewardType) +
+                                    (expected.feedback ? " (feedback)" : " (open loop)");
+            const dqn::RobotState& s = robot.state();
+            test::check(robot.getStepCount() == expected.steps && done == expected.done, "Episode length for " + run);
+            test::check(near(robot.getTotalReward(), expected.totalReward), "Total reward for " + run);
+            test::check(near(s.angle, expected.angle) && near(s.angularVelocity, expected.angularVelocity),
+                        "Pendulum state for " + run);
+            test::check(near(s.position, expected.position) && near(s.velocity, expected.velocity) &&
+                        near(s.wheelAngle, expected.wheelAngle), "Wheel state for " + run);
+        }
+        return std::string("8 runs match BalancingRobot.js across all reward types");
+    });
+
+    test::run("Failed Robot Stays Done", []() {
+        dqn::RobotConfig config;
+        config.rewardType = dqn::REWARD_COMPLEX;
+        dqn::BalancingRobot robot(config);
+        robot.reset(dqn::RobotState(1.2));
+        const dqn::StepResult result = robot.step(1.0);
+        test::check(result.done && result.reward == -10.0, "Fallen robot reports failure");
+        test::check(robot.getStepCount() == 0 && robot.state().angle == 1.2, "Fallen robot does not move");
+        return std::string("Steps past failure are no-ops with the failure reward");
+    });
+
+    test::run("Config Clamped To Simulator Ranges", []() {
+        dqn::RobotConfig config;
+        config.mass = 10.0;
+        config.timestep = 0.0;
+        config.maxAngle = 2.0;
+        config.angleOffset = -1.0;
+        dqn::BalancingRobot robot(config);
+        test::check(robot.config().mass == 3.0 && robot.config().timestep == 0.001, "Physics parameters clamped");
+        test::check(robot.config().maxAngle == dqn::SIM_PI / 3.0, "maxAngle clamped to 60 degrees");
+        test::check(robot.getAngleOffset() == -dqn::MAX_ANGLE_OFFSET, "Offset clamped to 30 degrees");
+        return std::string("Out-of-range values clamped like _validateParameter");
+    });
+
+    test::run("Offset Drift Is Seeded", []() {
+        dqn::RobotConfig config;
+        config.rewardType = dqn::REWARD_OFFSET_ADAPTIVE;
+        config.trainingOffsetRange = 0.1;
+        config.offsetVariation = 0.1;
+        config.offsetChangeRate = 0.01;
+        dqn::BalancingRobot a(config, 42), b(config, 42), c(config, 7);
+        a.reset();
+        b.reset();
+        c.reset();
+        test::check(a.getAngleOffset() == b.getAngleOffset(), "Same seed, same training offset");
+        test::check(a.getAngleOffset() != c.getAngleOffset(), "Different seed, different training offset");
+        test::check(std::fabs(a.getAngleOffset()) <= 0.1, "Training offset within range");
+        for (int i = 0; i < 100; i++) {
+            a.step(0.0);
+            b.step(0.0);
+        }
+        test::check(a.measuredAngle() == b.measuredAngle(), "Drift reproduces");
+        return std::string("Offsets reproducible per seed");
+    });
+
+    test::run("Closed Loop Balances", []() {
+        const double starts[] = {0.05, -0.1};
+        std::string message;
+        for (double start : starts) {
+            const dqn::EpisodeStats f = closedLoop<TwoWheelBotDQN>(start, 1);
+            const dqn::EpisodeStats q = closedLoop<TwoWheelBotDQNInt8>(start, 1);
+            test::check(!f.failed && f.steps == CLOSED_LOOP_STEPS, "Float policy balances from " + std::to_string(start));
+            test::check(!q.failed && q.steps == CLOSED_LOOP_STEPS, "int8 policy balances from " + std::to_string(start));
+
+            const dqn::EpisodeStats again = closedLoop<TwoWheelBotDQN>(start, 1);
+            test::check(again.meanAbsAngle == f.meanAbsAngle && again.totalReward == f.totalReward,
+                        "Closed loop is deterministic");
+            message += (message.empty() ? "" : ", ") + std::to_string(start).substr(0, 5) + " rad: mean |angle| " +
+                       std::to_string(f.meanAbsAngle).substr(0, 6) + " / " + std::to_string(q.meanAbsAngle).substr(0, 6);
+        }
+        return std::to_string(CLOSED_LOOP_STEPS) + " steps float/int8 from " + message;
+    });
+
+    test::run("Batch Matches Scalar Robots", []() {
+        static RobotBatch batch(dqn::RobotConfig(), 7);
+        dqn::BalancingRobot robots[BATCH];
+        for (int i = 0; i < BATCH; i++) {
+            batch.configure(i, sweepConfig(i));
+            batch.reset(i, dqn::RobotState(sweepStart(i), 0.2));
+            robots[i] = dqn::BalancingRobot(sweepConfig(i), RobotBatch::laneSeed(7, i));
+            robots[i].reset(dqn::RobotState(sweepStart(i), 0.2));
+        }
+
+        double torques[BATCH];
+        int fallen = 0;
+        for (int tick = 0; tick < 300; tick++) {
+            // Proportional control; lanes with zero gain fall
+            for (int i = 0; i < BATCH; i++) {
+                const double gain = 2.0 * (i % 3);
+                const double torque = gain * (batch.measuredAngle(i) + 0.2 * batch.state(i).angularVelocity);
+                torques[i] = torque < -1.0 ? -1.0 : (torque > 1.0 ? 1.0 : torque);
+            }
+            batch.step(torques);
+            for (int i = 0; i < BATCH; i++) {
+                const dqn::StepResult expected = robots[i].step(torques[i]);
+                const std::string where = "lane " + std::to_string(i) + " tick " + std::to_string(tick);
+                test::check(sameState(batch.state(i), robots[i].state()), "State at " + where);
+                test::check(batch.getReward(i) == expected.reward && batch.isDone(i) == expected.done,
+                            "Reward and done at " + where);
+                test::check(batch.measuredAngle(i) == robots[i].measuredAngle(), "Measured angle at " + where);
+            }
+        }
+        for (int i = 0; i < BATCH; i++) fallen += batch.isDone(i);
+        test::check(fallen > 0 && fallen < BATCH, "Sweep has fallen and balancing lanes");
+        return "37 heterogeneous lanes bit-identical over 300 steps (" + std::to_string(fallen) + " fell)";
+    });
+
+    test::run("Batch Policy Steps Match runEpisode", []() {
+        static RobotBatch batch(dqn::RobotConfig(), 3);
+        for (int i = 0; i < BATCH; i++) batch.reset(i, dqn::RobotState(sweepStart(i) * 2.0));
+        const TwoWheelBotDQN policy;
+        const int steps = batch.runEpisodes(policy, 500);
+
+        int balanced = 0;
+        for (int i = 0; i < BATCH; i++) {
+            dqn::BalancingRobot robot(dqn::RobotConfig(), RobotBatch::laneSeed(3, i));
+            robot.reset(dqn::RobotState(sweepStart(i) * 2.0));
+            TwoWheelBotDQN single;
+            const dqn::EpisodeStats expected = dqn::runEpisode(robot, single, 500);
+            const dqn::EpisodeStats actual = batch.stats(i);
+            const std::string lane = "lane " + std::to_string(i);
+            test::check(actual.steps == expected.steps && actual.failed == expected.failed, "Episode length for " + lane);
+            test::check(actual.totalReward == expected.totalReward && actual.meanAbsAngle == expected.meanAbsAngle &&
+                        actual.energy == expected.energy, "Episode stats for " + lane);
+            balanced += !actual.failed;
+        }
+        return std::to_string(balanced) + "/37 lanes balance " + std::to_string(steps) + " steps, matching runEpisode";
+    });
+
+    return test::summarize();
+}
@@ -0,0 +1,198 @@
+/**
+ * Golden-vector conformance tests for one exported model
+ *
+ * Runs every precision of the model (float export, batched getActions,
+ * int8 export, lookup table, float and int8 blobs) on the vectors of its
+ * _golden.h file (DQN_GOLDEN_FILE, written by reexport.js --golden) and
+ * compares with the simulator's outputs. Built with the unrolled, plain-loop
+ * and SIMD kernels, and once more with -ffast-math, so compiler and kernel
+ * changes show up here before they reach a robot:
+ * - Float Q-values within MAX_ULPS units in the last place of the vector's
+ *   largest |Q| (at least 1.0); the folded normalization and other
+ *   summation orders round differently from CPUBackend.forward
+ * - Float actions equal the simulator's, unless the simulator's Q-value for
+ *   the returned action is within the same tolerance of its best (a tie)
+ * - int8 accumulators and actions, and lookup-table actions, exact
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+#include DQN_LOOKUP_MODEL_FILE
+#include DQN_GOLDEN_FILE
+
+#include "DQNModelBlob.h"
+
+#include <cmath>
+#include <string>
+
+#include "TestHarness.h"
+
+namespace {
+
+typedef TwoWheelBotDQNGolden::Vector Golden;
+const Golden* const vectors = TwoWheelBotDQNGolden::vectors;
+const int COUNT = TwoWheelBotDQNGolden::COUNT;
+const int OUT = TwoWheelBotDQN::OUTPUT_SIZE;
+
+static_assert(TwoWheelBotDQNGolden::INPUT_SIZE == TwoWheelBotDQN::INPUT_SIZE &&
+                  TwoWheelBotDQNGolden::OUTPUT_SIZE == OUT,
+              "Golden vectors belong to another architecture");
+
+const float MAX_ULPS = 128.0f;
+
+/**
+ * One ULP of the vector's largest reference |Q| (at least 1.0)
+ */
+float ulpOf(const Golden& golden) {
+    float scale = 1.0f;
+    for (int o = 0; o < OUT; o++) scale = std::fmax(scale, std::fabs(golden.qValues[o]));
+    int exponent;
+    std::frexp(scale, &exponent);
+    return std::ldexp(1.0f, exponent - 24);
+}
+
+float ulpError(const Golden& golden, const float* qValues) {
+    float error = 0.0f;
+    for (int o = 0; o < OUT; o++) error = std::fmax(error, std::fabs(qValues[o] - golden.qValues[o]));
+    return error / ulpOf(golden);
+}
+
+/**
+ * The golden action, or an action the reference Q-values tie with it
+ */
+bool actionConforms(const Golden& golden, int action) {
+    if (action == golden.action) return true;
+    if (action < 0 || action >= OUT) return false;
+    return golden.qValues[golden.action] - golden.qValues[action] <= MAX_ULPS * ulpOf(golden);
+}
+
+/**
+ * Float checks shared by the export and the float blob
+ * @return Max ULP error; counts the tie-tolerated actions
+ */
+template <typename Policy>
+float checkFloatPolicy(Policy& policy, int& ties) {
+    float maxUlps = 0.0f;
+    ties = 0;
+    for (int i = 0; i < COUNT; i++) {
+        const Golden& golden = vectors[i];
+        if (golden.reset) policy.reset(golden.angle, golden.angularVelocity);
+        float q[OUT];
+        const int action = policy.forward(golden.angle, golden.angularVelocity, q);
+        const float ulps = ulpError(golden, q);
+        maxUlps = std::fmax(maxUlps, ulps);
+        test::check(ulps <= MAX_ULPS, "Vector " + std::to_string(i) + ": Q-values " + std::to_string(ulps) +
+                                          " ULPs from the simulator (tolerance " + std::to_string(MAX_ULPS) + ")");
+        test::check(actionConforms(golden, action), "Vector " + std::to_string(i) + ": action " +
+                                                        std::to_string(action) + ", simulator " +
+                                                        std::to_string(golden.action));
+        ties += action != golden.action;
+    }
+    return maxUlps;
+}
+
+std::string floatSummary(float maxUlps, int ties) {
+    return std::to_string(COUNT) + " vectors, max " + std::to_string(maxUlps) + " ULPs, " + std::to_string(ties) +
+           " tied actions";
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Conformance Tests (%s, %s kernel%s)...\n\n", DQN_GOLDEN_FILE, DQN_KERNEL_NAME,
+#if defined(__FAST_MATH__)
+                ", -ffast-math"
+#else
+                ""
+#endif
+    );
+
+    test::run("Float Export", []() {
+        TwoWheelBotDQN bot;
+        int ties;
+        const float maxUlps = checkFloatPolicy(bot, ties);
+        return floatSummary(maxUlps, ties);
+    });
+
+    test::run("Batched Float Actions", []() {
+        // A batch has no history: single-timestep models only
+        if (TwoWheelBotDQN::INPUT_SIZE != 2) return std::string("Skipped: multi-timestep model");
+        static float angles[TwoWheelBotDQNGolden::COUNT];
+        static float velocities[TwoWheelBotDQNGolden::COUNT];
+        static int actions[TwoWheelBotDQNGolden::COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            angles[i] = vectors[i].angle;
+            velocities[i] = vectors[i].angularVelocity;
+        }
+        TwoWheelBotDQN bot;
+        bot.getActions(angles, velocities, actions, COUNT);
+        for (int i = 0; i < COUNT; i++) {
+            test::check(actionConforms(vectors[i], actions[i]), "Vector " + std::to_string(i) + ": action matches");
+        }
+        return std::to_string(COUNT) + " rows";
+    });
+
+    test::run("Int8 Export", []() {
+        TwoWheelBotDQNInt8 bot;
+        for (int i = 0; i < COUNT; i++) {
+            const Golden& golden = vectors[i];
+            if (golden.reset) bot.reset(golden.angle, golden.angularVelocity);
+            int32_t acc[OUT];
+            const int action = bot.forward(golden.angle, golden.angularVelocity, acc);
+            for (int o = 0; o < OUT; o++) {
+                test::check(acc[o] == golden.int8Accumulators[o], "Vector " + std::to_string(i) + ": accumulator " +
+                                                                      std::to_string(o) + " exact");
+            }
+            test::check(action == golden.int8Action, "Vector " + std::to_string(i) + ": action exact");
+        }
+        return std::to_string(COUNT) + " vectors bit-exact";
+    });
+
+    test::run("Lookup Table", []() {
+        TwoWheelBotDQNLookup bot;
+        int checked = 0;
+        for (int i = 0; i < COUNT; i++) {
+            if (vectors[i].lookupAction < 0) continue;
+            test::check(bot.getAction(vectors[i].angle, vectors[i].angularVelocity) == vectors[i].lookupAction,
+                        "Vector " + std::to_string(i) + ": cell action exact");
+            checked++;
+        }
+        return std::to_string(checked) + " vectors exact";
+    });
+
+    test::run("Float Blob", []() {
+        dqn::MappedFile file;
+        test::check(file.open(DQN_MODEL_BLOB_FILE), "Blob file maps");
+        dqn::ModelBlob blob;
+        test::check(blob.bind(file.data(), file.size()) == dqn::BLOB_OK, "Blob binds");
+        dqn::BlobPolicy policy;
+        test::check(policy.bind(blob), "Policy binds");
+        int ties;
+        const float maxUlps = checkFloatPolicy(policy, ties);
+        return floatSummary(maxUlps, ties);
+    });
+
+    test::run("Int8 Blob", []() {
+        dqn::MappedFile file;
+        test::check(file.open(DQN_INT8_MODEL_BLOB_FILE), "Blob file maps");
+        dqn::ModelBlob blob;
+        test::check(blob.bind(file.data(), file.size()) == dqn::BLOB_OK, "Blob binds");
+        dqn::BlobPolicy policy;
+        test::check(policy.bind(blob), "Policy binds");
+        const float scale = blob.outputScale();
+        for (int i = 0; i < COUNT; i++) {
+            const Golden& golden = vectors[i];
+            if (golden.reset) policy.reset(golden.angle, golden.angularVelocity);
+            float q[OUT];
+            const int action = policy.forward(golden.angle, golden.angularVelocity, q);
+            for (int o = 0; o < OUT; o++) {
+                test::check(q[o] == (float)golden.int8Accumulators[o] * scale,
+                            "Vector " + std::to_string(i) + ": accumulator " + std::to_string(o) + " exact");
+            }
+            test::check(action == golden.int8Action, "Vector " + std::to_string(i) + ": action exact");
+        }
+        return std::to_string(COUNT) + " vectors bit-exact";
+    });
+
+    return test::summarize();
+}
@@ -0,0 +1,234 @@
+/**
+ * Control loop tests
+ *
+ * Checks the complementary filter's convergence and gyro-bias error, the
+ * rate clamp, deadline scheduling (missed ticks, overruns, latency, clock
+ * wrap) and sensor-fault handling on a scripted board, and that the first
+ * model (DQN_MODEL_FILE) balances the simulated robot through a biased,
+ * noisy IMU at 50 Hz.
+ */
+
+#include DQN_MODEL_FILE
+
+#include "BalancingRobot.h"
+#include "DQNControlLoop.h"
+
+#include <cmath>
+#include <string>
+
+#include "TestHarness.h"
+
+namespace {
+
+/**
+ * Scripted board: a fixed tilt, a clock that advances with every IMU read
+ * and motor write, and reads that fail on request
+ */
+struct BenchBoard {
+    uint32_t now;
+    uint32_t readMicros;
+    uint32_t writeMicros;
+    float tilt;
+    bool failReads;
+    int writes;
+    float torque;
+
+    explicit BenchBoard(uint32_t start = 0)
+        : now(start), readMicros(0), writeMicros(0), tilt(0.05f), failReads(false), writes(0), torque(99.0f) {}
+
+    uint32_t micros() { return now; }
+
+    bool readImu(dqn::ImuSample& sample) {
+        now += readMicros;
+        if (failReads) return false;
+        sample.gyroRate = 0.0f;
+        sample.accelX = std::sin(tilt);
+        sample.accelZ = std::cos(tilt);
+        return true;
+    }
+
+    void setMotorTorque(float value) {
+        now += writeMicros;
+        torque = value;
+        writes++;
+    }
+};
+
+/**
+ * Simulated robot behind an IMU: the gyro reads the angular velocity plus a
+ * bias, the accelerometer the measured angle with noise. Every motor write
+ * advances the physics one timestep, so run it at the simulator's rate.
+ */
+struct SimulatedBoard {
+    dqn::BalancingRobot robot;
+    dqn::XorShift64 random;
+    uint32_t now;
+    float gyroBias;
+    float accelNoise;
+
+    SimulatedBoard(const dqn::RobotConfig& config, float gyroBias, float accelNoise)
+        : robot(config), random(7), now(0), gyroBias(gyroBias), accelNoise(accelNoise) {}
+
+    uint32_t micros() { return now; }
+
+    bool readImu(dqn::ImuSample& sample) {
+        const double angle = robot.measuredAngle() + (random.next() - 0.5) * 2.0 * (double)accelNoise;
+        sample.gyroRate = (float)robot.state().angularVelocity + gyroBias;
+        sample.accelX = (float)std::sin(angle);
+        sample.accelZ = (float)std::cos(angle);
+        return true;
+    }
+
+    void setMotorTorque(float torque) { robot.step(torque); }
+};
+
+typedef dqn::ControlLoop<TwoWheelBotDQN, BenchBoard> BenchLoop;
+
+/**
+ * Poll every step microseconds until the loop has run ticks ticks
+ */
+template <typename Loop, typename Board>
+void pollTicks(Loop& loop, Board& board, uint32_t ticks, uint32_t step) {
+    const uint32_t target = loop.stats().ticks + loop.stats().sensorFaults + ticks;
+    while (loop.stats().ticks + loop.stats().sensorFaults < target) {
+        if (!loop.poll()) board.now += step;
+    }
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Control Loop Tests (%s)...\n\n", DQN_MODEL_FILE);
+
+    test::run("Rate Clamp", []() {
+        test::check(dqn::ControlLoopConfig().periodMicros() == 20000, "Default is 50 Hz, the simulator's timestep");
+        test::check(dqn::ControlLoopConfig(5000.0f).rateHz == 1000.0f, "Rates above 1 kHz clamp");
+        test::check(dqn::ControlLoopConfig(1000.0f).periodMicros() == 1000, "1 kHz is 1000 us");
+        test::check(dqn::ControlLoopConfig(0.0f).periodMicros() == 1000000, "Rates below 1 Hz clamp");
+        test::check(dqn::ControlLoopConfig(333.0f).periodMicros() == 3003, "Periods round to the microsecond");
+        return std::string("1 Hz - 1 kHz");
+    });
+
+    test::run("Complementary Filter", []() {
+        const float dt = 0.02f;
+        const float tau = 0.5f;
+
+        // Still robot: converges on the accelerometer, offset by bias * tau
+        dqn::ComplementaryFilter filter(tau, dt);
+        filter.reset(0.0f);
+        const float bias = 0.01f;
+        for (int i = 0; i < 500; i++) filter.update(bias, 0.1f);
+        test::check(std::fabs(filter.angle() - (0.1f + bias * tau)) < 1e-4f,
+                    "Steady state is accel angle + bias * tau (" + std::to_string(filter.angle()) + ")");
+
+        // Swinging robot with a noisy accelerometer: tracks within the noise
+        dqn::XorShift64 random(3);
+        filter.reset(0.0f);
+        float maxError = 0.0f;
+        for (int i = 0; i < 1000; i++) {
+            const float t = (float)(i + 1) * dt;
+            const float angle = 0.1f * std::sin(2.0f * t);
+            const float rate = 0.2f * std::cos(2.0f * t);
+            const float noisy = angle + (float)(random.next() - 0.5) * 0.1f;
+            filter.update(rate, noisy);
+            if (i >= 100) maxError = std::fmax(maxError, std::fabs(filter.angle() - angle));
+        }
+        test::check(maxError < 0.02f, "Tracks a swing through ±0.05 rad of accel noise (" +
+                                          std::to_string(maxError) + " rad)");
+        return "Bias error " + std::to_string(bias * tau) + " rad, tracking error " + std::to_string(maxError) + " rad";
+    });
+
+    test::run("Deadline Scheduling", []() {
+        // Clock starts just before the 32-bit wrap, which the deadlines must survive
+        BenchBoard board(0xFFFFFFFFu - 50000u);
+        TwoWheelBotDQN bot;
+        BenchLoop loop(bot, board, dqn::ControlLoopConfig(100.0f));
+        test::check(loop.start(), "Starts");
+        const uint32_t started = board.now;
+
+        pollTicks(loop, board, 200, 10);
+        test::check(loop.stats().ticks == 200, "200 ticks");
+        test::check(board.now - started >= 199u * 10000u && board.now - started < 199u * 10000u + 10u,
+                    "Ticks are a period apart across the wrap");
+        test::check(loop.stats().missedTicks == 0 && loop.stats().overruns == 0, "No misses or overruns");
+        test::check(loop.stats().maxLateMicros < 10, "Late by at most the poll step");
+        test::check(!loop.poll(), "Nothing due right after a tick");
+
+        // A stall of 3.5 periods since the last tick skips two deadlines, then the schedule resumes on the grid
+        board.now += 35000;
+        test::check(loop.poll(), "Late tick runs");
+        test::check(loop.stats().missedTicks == 2, "Two deadlines skipped");
+        const uint32_t resumed = board.now;
+        pollTicks(loop, board, 1, 10);
+        test::check(board.now - resumed == 5000, "Next tick back on the original grid");
+
+        // Reads and writes that take longer than a period at 1 kHz
+        BenchBoard slow;
+        slow.readMicros = 1600;
+        slow.writeMicros = 600;
+        dqn::ControlLoop<TwoWheelBotDQN, BenchBoard> fast(bot, slow, dqn::ControlLoopConfig(1000.0f));
+        test::check(fast.start(), "Fast loop starts");
+        fast.clearStats();
+        fast.tick();
+        test::check(fast.stats().lastLatencyMicros == 2200 && fast.stats().maxLatencyMicros == 2200,
+                    "Latency covers the tick's read and write (" + std::to_string(fast.stats().lastLatencyMicros) +
+                        " us)");
+        test::check(fast.stats().overruns == 1, "Overrun counted");
+        fast.tick();
+        test::check(fast.stats().missedTicks == 1, "The overrun's next deadline is missed");
+        return std::to_string(loop.stats().ticks) + " ticks at 100 Hz, stall and overrun accounted";
+    });
+
+    test::run("Sensor Fault", []() {
+        BenchBoard board;
+        TwoWheelBotDQN bot;
+        BenchLoop loop(bot, board);
+        board.failReads = true;
+        test::check(!loop.start(), "Start fails without the IMU");
+        board.failReads = false;
+        test::check(loop.start(), "Start succeeds once it reads");
+        test::check(std::fabs(loop.angle() - board.tilt) < 1e-6f, "Filter seeded with the accelerometer angle");
+
+        loop.tick();
+        test::check(board.torque == bot.getMotorTorque(loop.lastAction()), "Policy torque written");
+        board.failReads = true;
+        const int writes = board.writes;
+        loop.tick();
+        test::check(board.writes == writes + 1 && board.torque == 0.0f, "Failed read writes zero torque");
+        test::check(loop.stats().sensorFaults == 2 && loop.stats().ticks == 1, "Faults counted apart from ticks");
+
+        board.failReads = false;
+        loop.tick();
+        loop.stop();
+        test::check(board.torque == 0.0f, "Stop writes zero torque");
+        return std::to_string(loop.stats().sensorFaults) + " faults";
+    });
+
+    test::run("Closed-Loop Balance", []() {
+        dqn::RobotConfig config;
+        SimulatedBoard board(config, 0.02f, 0.02f);
+        board.robot.reset(dqn::RobotState(0.05, 0.0));
+        TwoWheelBotDQN bot;
+        const dqn::ControlLoopConfig loopConfig(50.0f, 0.5f);
+        test::check(loopConfig.timestep() == (float)config.timestep, "Loop runs at the simulator's timestep");
+        dqn::ControlLoop<TwoWheelBotDQN, SimulatedBoard> loop(bot, board, loopConfig);
+        test::check(loop.start(), "Starts");
+
+        // 20 s at 50 Hz
+        const uint32_t ticks = 1000;
+        double maxEstimateError = 0.0;
+        while (loop.stats().ticks < ticks && !board.robot.hasFailed()) {
+            if (!loop.poll()) {
+                board.now += 100;
+                continue;
+            }
+            maxEstimateError = std::fmax(maxEstimateError, std::fabs((double)loop.angle() - board.robot.measuredAngle()));
+        }
+        test::check(!board.robot.hasFailed(), "Balances (fell after " + std::to_string(loop.stats().ticks) + " ticks)");
+        test::check(loop.stats().missedTicks == 0 && loop.stats().overruns == 0, "No misses or overruns");
+        return std::to_string(ticks) + " ticks upright, max angle estimate error " + std::to_string(maxEstimateError) +
+               " rad";
+    });
+
+    return test::summarize();
+}
@@ -0,0 +1,334 @@
+/**
+ * DQNPolicy tests for one exported model
+ *
+ * Built once per model in models/ with DQN_MODEL_FILE (float export),
+ * DQN_INT8_MODEL_FILE (its _int8 sibling) and DQN_LOOKUP_MODEL_FILE (its
+ * _lut sibling), and again with DQN_NO_UNROLL and DQN_USE_SIMD so every
+ * float kernel is covered.
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+#include DQN_LOOKUP_MODEL_FILE
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+
+#include "TestHarness.h"
+
+namespace {
+
+typedef TwoWheelBotDQN::Network FloatNetwork;
+const int IN = TwoWheelBotDQN::INPUT_SIZE;
+const int HIDDEN = TwoWheelBotDQN::HIDDEN_SIZE;
+const int OUT = TwoWheelBotDQN::OUTPUT_SIZE;
+
+/**
+ * Plain-loop forward pass straight from the weight tables
+ */
+void referenceForward(const float* input, float* output) {
+    const dqn::DQNWeights<IN, HIDDEN, OUT>& w = TwoWheelBotDQNWeights::weights;
+    float hidden[HIDDEN];
+    for (int h = 0; h < HIDDEN; h++) {
+        hidden[h] = w.biasHidden[h];
+        for (int i = 0; i < IN; i++) hidden[h] += input[i] * w.weightsInputHidden[i * HIDDEN + h];
+        hidden[h] = hidden[h] > 0.0f ? hidden[h] : 0.0f;
+    }
+    for (int o = 0; o < OUT; o++) {
+        output[o] = w.biasOutput[o];
+        for (int h = 0; h < HIDDEN; h++) output[o] += hidden[h] * w.weightsHiddenOutput[h * OUT + o];
+    }
+}
+
+// The export folds the normalization into the first layer, so its network takes clamped raw inputs
+typedef dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> ExportInput;
+
+void normalize(float angle, float angularVelocity, float* input) {
+    ExportInput::frame(dqn::PolicyInput(angle, angularVelocity), input);
+}
+
+// Same model in the padded neuron-major layout, filled by transposing at startup
+typedef dqn::NeuronMajor<4> PaddedLayout;
+typedef dqn::DQNWeights<IN, HIDDEN, OUT, PaddedLayout> PaddedWeights;
+PaddedWeights neuronMajorWeights;
+typedef dqn::DQNLayoutPolicy<IN, HIDDEN, OUT, dqn::ReLU, PaddedLayout, neuronMajorWeights, ExportInput> NeuronMajorDQN;
+
+void transposeWeights() {
+    const dqn::DQNWeights<IN, HIDDEN, OUT>& w = TwoWheelBotDQNWeights::weights;
+    for (int i = 0; i < PaddedWeights::Dims::INPUT_HIDDEN_SIZE; i++) neuronMajorWeights.weightsInputHidden[i] = 0.0f;
+    for (int i = 0; i < PaddedWeights::Dims::HIDDEN_OUTPUT_SIZE; i++) neuronMajorWeights.weightsHiddenOutput[i] = 0.0f;
+    for (int h = 0; h < HIDDEN; h++) {
+        for (int i = 0; i < IN; i++) {
+            neuronMajorWeights.weightsInputHidden[PaddedWeights::Dims::inputHidden(i, h)] = w.weightsInputHidden[i * HIDDEN + h];
+        }
+        for (int o = 0; o < OUT; o++) {
+            neuronMajorWeights.weightsHiddenOutput[PaddedWeights::Dims::hiddenOutput(h, o)] = w.weightsHiddenOutput[h * OUT + o];
+        }
+        neuronMajorWeights.biasHidden[h] = w.biasHidden[h];
+    }
+    for (int o = 0; o < OUT; o++) neuronMajorWeights.biasOutput[o] = w.biasOutput[o];
+}
+
+// Same model with an action-difference output layer: row o is Q[o + 1] - Q[0]
+typedef dqn::DQNWeights<IN, HIDDEN, OUT - 1> DifferenceWeights;
+DifferenceWeights differenceWeights;
+typedef dqn::DQNDifferencePolicy<IN, HIDDEN, OUT, dqn::ReLU, differenceWeights, ExportInput> DifferenceDQN;
+
+void subtractFirstAction() {
+    const dqn::DQNWeights<IN, HIDDEN, OUT>& w = TwoWheelBotDQNWeights::weights;
+    for (int i = 0; i < IN * HIDDEN; i++) differenceWeights.weightsInputHidden[i] = w.weightsInputHidden[i];
+    for (int h = 0; h < HIDDEN; h++) {
+        differenceWeights.biasHidden[h] = w.biasHidden[h];
+        for (int o = 1; o < OUT; o++) {
+            differenceWeights.weightsHiddenOutput[h * (OUT - 1) + o - 1] =
+                w.weightsHiddenOutput[h * OUT + o] - w.weightsHiddenOutput[h * OUT];
+        }
+    }
+    for (int o = 1; o < OUT; o++) differenceWeights.biasOutput[o - 1] = w.biasOutput[o] - w.biasOutput[0];
+}
+
+const int GRID = 61;
+const float MAX_ANGLE = 1.04719755f;
+
+float gridAngle(int a) { return -MAX_ANGLE + 2.0f * MAX_ANGLE * (float)a / (float)(GRID - 1); }
+float gridVelocity(int v) { return -10.0f + 20.0f * (float)v / (float)(GRID - 1); }
+
+} // namespace
+
+int main() {
+    std::printf("Running DQNPolicy Tests (%s, %s kernel)...\n\n", DQN_MODEL_FILE, DQN_KERNEL_NAME);
+
+    test::run("Zero-Size Policy", []() {
+        static_assert(std::is_empty<TwoWheelBotDQN>::value, "float policy holds no data");
+        static_assert(std::is_empty<TwoWheelBotDQNInt8>::value, "int8 policy holds no data");
+        static_assert(std::is_empty<TwoWheelBotDQNLookup>::value, "lookup policy holds no data");
+        return std::string("Policy instances hold no per-instance weights");
+    });
+
+    test::run("Forward Matches Reference", []() {
+        float maxError = 0.0f;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                float input[IN], expected[OUT], actual[OUT];
+                normalize(gridAngle(a), gridVelocity(v), input);
+                referenceForward(input, expected);
+                FloatNetwork::forward(TwoWheelBotDQNWeights::weights, input, actual);
+                for (int o = 0; o < OUT; o++) {
+                    maxError = std::fmax(maxError, std::fabs(expected[o] - actual[o]));
+                }
+            }
+        }
+        test::check(maxError <= 1e-4f, "Q-values within 1e-4 of plain loops (max " + std::to_string(maxError) + ")");
+        return "Max |Q error| " + std::to_string(maxError);
+    });
+
+    test::run("getAction Matches Reference Argmax", []() {
+        TwoWheelBotDQN bot;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                float input[IN], q[OUT];
+                normalize(gridAngle(a), gridVelocity(v), input);
+                referenceForward(input, q);
+                test::check(bot.getAction(gridAngle(a), gridVelocity(v)) == dqn::argmax<OUT>(q),
+                            "Action matches at grid point " + std::to_string(a) + "," + std::to_string(v));
+            }
+        }
+        test::check(bot.getMotorTorque(0) == -1.0f && bot.getMotorTorque(2) == 1.0f, "Action torques are {-1, 0, 1}");
+        return std::to_string(GRID * GRID) + " states agree";
+    });
+
+    test::run("Forward Exposes Q-Values And Margin", []() {
+        TwoWheelBotDQN bot;
+        TwoWheelBotDQNInt8 int8Bot;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                float input[IN], expected[OUT], q[OUT];
+                normalize(gridAngle(a), gridVelocity(v), input);
+                referenceForward(input, expected);
+                const int action = bot.forward(gridAngle(a), gridVelocity(v), q);
+                test::check(action == dqn::argmax<OUT>(expected), "forward returns the argmax");
+                test::check(action == bot.getAction(gridAngle(a), gridVelocity(v)), "getAction agrees with forward");
+
+                // Margin is best minus the largest of the others
+                float runnerUp = -1e30f;
+                for (int o = 0; o < OUT; o++) {
+                    test::check(std::fabs(q[o] - expected[o]) <= 1e-4f, "Q-values match reference");
+                    if (o != action) runnerUp = std::fmax(runnerUp, q[o]);
+                }
+                test::check(dqn::margin<OUT>(q) == q[action] - runnerUp, "Margin is top-1 minus top-2");
+
+                int32_t acc[OUT];
+                const int int8Action = int8Bot.forward(gridAngle(a), gridVelocity(v), acc);
+                test::check(int8Action == dqn::argmax<OUT>(acc) && dqn::margin<OUT>(acc) >= 0, "int8 forward exposes accumulators");
+            }
+        }
+        const float tie[3] = {2.0f, 2.0f, 1.0f};
+        test::check(dqn::margin<3>(tie) == 0.0f, "Tied Q-values have zero margin");
+        return std::string("Action, Q-values and margin from one pass");
+    });
+
+    test::run("Batched getActions Matches getAction", []() {
+        static float angles[GRID * GRID + 3];
+        static float velocities[GRID * GRID + 3];
+        static int actions[GRID * GRID + 3];
+        const size_t n = GRID * GRID;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                angles[a * GRID + v] = gridAngle(a);
+                velocities[a * GRID + v] = gridVelocity(v);
+            }
+        }
+        // Out-of-range sentinel past the end must survive the short last block
+        actions[n] = -7;
+
+        TwoWheelBotDQN bot;
+        bot.getActions(angles, velocities, actions, n);
+        test::check(actions[n] == -7, "No write past n");
+        for (size_t i = 0; i < n; i++) {
+            test::check(actions[i] == bot.getAction(angles[i], velocities[i]), "Row " + std::to_string(i) + " matches");
+        }
+
+        // Block sizes below and at the block width
+        for (size_t count = 0; count <= 5; count++) {
+            int small[5] = {-1, -1, -1, -1, -1};
+            bot.getActions(&angles[100], &velocities[100], small, count);
+            for (size_t i = 0; i < 5; i++) {
+                test::check(small[i] == (i < count ? actions[100 + i] : -1), "n=" + std::to_string(count) + " writes exactly n rows");
+            }
+        }
+        return std::to_string(n) + " rows in blocks of " + std::to_string(FloatNetwork::BLOCK_ROWS);
+    });
+
+    test::run("Neuron-Major Layout Matches", []() {
+        static_assert(PaddedWeights::Dims::INPUT_HIDDEN_SIZE == HIDDEN * 4, "input rows padded to 4 floats");
+        transposeWeights();
+        TwoWheelBotDQN inputMajorBot;
+        NeuronMajorDQN neuronMajorBot;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                float input[IN], expected[OUT], actual[OUT];
+                normalize(gridAngle(a), gridVelocity(v), input);
+                FloatNetwork::forward(TwoWheelBotDQNWeights::weights, input, expected);
+                NeuronMajorDQN::Network::forward(neuronMajorWeights, input, actual);
+                for (int o = 0; o < OUT; o++) {
+                    test::check(expected[o] == actual[o], "Q-values identical at grid point " + std::to_string(a) + "," + std::to_string(v));
+                }
+                test::check(inputMajorBot.getAction(gridAngle(a), gridVelocity(v)) ==
+                            neuronMajorBot.getAction(gridAngle(a), gridVelocity(v)), "Actions identical");
+            }
+        }
+        return std::string("Padded neuron-major tables give identical Q-values");
+    });
+
+    test::run("Difference Policy Matches", []() {
+        static_assert(std::is_empty<DifferenceDQN>::value == std::is_empty<TwoWheelBotDQN>::value,
+                      "difference policy holds no weights");
+        subtractFirstAction();
+        TwoWheelBotDQN bot;
+        DifferenceDQN differenceBot;
+        int agreements = 0;
+        float maxError = 0.0f;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                float input[IN], expected[OUT], q[OUT];
+                normalize(gridAngle(a), gridVelocity(v), input);
+                referenceForward(input, expected);
+                const int action = differenceBot.forward(gridAngle(a), gridVelocity(v), q);
+                test::check(q[0] == 0.0f && action == dqn::argmax<OUT>(q), "Action is the argmax of the relative Q-values");
+                for (int o = 1; o < OUT; o++) {
+                    maxError = std::fmax(maxError, std::fabs(q[o] - (expected[o] - expected[0])));
+                }
+                agreements += action == bot.getAction(gridAngle(a), gridVelocity(v));
+            }
+        }
+        const double rate = (double)agreements / (GRID * GRID);
+        test::check(maxError <= 1e-3f, "Differences within 1e-3 of Q[o] - Q[0] (max " + std::to_string(maxError) + ")");
+        test::check(rate >= 0.99, "Difference argmax agrees with float on >=99% of states");
+
+        int actions[8];
+        const float angles[8] = {-0.9f, -0.3f, -0.05f, 0.0f, 0.02f, 0.2f, 0.6f, 1.0f};
+        const float velocities[8] = {3.0f, -1.0f, 0.5f, 0.0f, -0.2f, 1.5f, -4.0f, 9.0f};
+        differenceBot.getActions(angles, velocities, actions, 8);
+        for (int i = 0; i < 8; i++) {
+            test::check(actions[i] == differenceBot.getAction(angles[i], velocities[i]), "getActions matches getAction");
+        }
+        return "Agreement " + std::to_string(rate * 100.0) + "%, " + std::to_string(OUT - 1) + " output rows";
+    });
+
+    test::run("Argmax Takes The First Maximum", []() {
+        const float ties[4][3] = {{1.0f, 1.0f, 1.0f}, {0.0f, 2.0f, 2.0f}, {-1.0f, -3.0f, -1.0f}, {-2.0f, -1.0f, -0.5f}};
+        const int expected[4] = {0, 1, 0, 2};
+        for (int t = 0; t < 4; t++) test::check(dqn::argmax<3>(ties[t]) == expected[t], "float tie case " + std::to_string(t));
+        const int32_t acc[5] = {-7, 4, 4, -2147483647, 3};
+        test::check(dqn::argmax<5>(acc) == 1, "int32 tie picks the first");
+        test::check(dqn::choose(true, 1.5f, -2.0f) == 1.5f && dqn::choose(false, 1.5f, -2.0f) == -2.0f, "choose selects");
+        test::check(dqn::ReLU::apply(-0.0f) == 0.0f && !std::signbit(dqn::ReLU::apply(-0.0f)), "ReLU of -0 is +0");
+        test::check(dqn::ReLU::apply((int32_t)-5) == 0 && dqn::ReLU::apply((int32_t)5) == 5, "Integer ReLU");
+        return std::string("Branch-free selection keeps first-max ties");
+    });
+
+    test::run("Quantized Policy Agreement", []() {
+        TwoWheelBotDQN floatBot;
+        TwoWheelBotDQNInt8 int8Bot;
+        int agreements = 0;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                agreements += floatBot.getAction(gridAngle(a), gridVelocity(v)) ==
+                              int8Bot.getAction(gridAngle(a), gridVelocity(v));
+            }
+        }
+        const double rate = (double)agreements / (GRID * GRID);
+        test::check(rate > 0.9, "int8 argmax agrees with float on >90% of states");
+        return "Agreement " + std::to_string(rate * 100.0) + "%";
+    });
+
+
+    test::run("Lookup Policy Agreement", []() {
+        typedef TwoWheelBotDQNLookup::Grid Grid;
+        const int ROWS = TwoWheelBotDQNLookup::ROWS;
+        const int COLS = TwoWheelBotDQNLookup::COLS;
+        static_assert(sizeof(Grid) == Grid::BYTES, "table is just the packed cells");
+        TwoWheelBotDQN floatBot;
+        TwoWheelBotDQNLookup lookupBot;
+
+        // Cell centers read back the packed entry for that cell
+        for (int r = 0; r < ROWS; r++) {
+            for (int c = 0; c < COLS; c++) {
+                const float angle = (-1.0f + (2.0f * (float)r + 1.0f) / (float)ROWS) / dqn::ANGLE_SCALE;
+                const float velocity = (-1.0f + (2.0f * (float)c + 1.0f) / (float)COLS) / dqn::ANGULAR_VELOCITY_SCALE;
+                const int k = r * COLS + c;
+                const int stored = (TwoWheelBotDQNLookupTable::table.cells[k / Grid::CELLS_PER_BYTE] >>
+                                    (k % Grid::CELLS_PER_BYTE * Grid::CELL_BITS)) & ((1 << Grid::CELL_BITS) - 1);
+                test::check(lookupBot.getAction(angle, velocity) == stored, "Cell " + std::to_string(k) + " indexed");
+            }
+        }
+
+        int agreements = 0;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                agreements += floatBot.getAction(gridAngle(a), gridVelocity(v)) ==
+                              lookupBot.getAction(gridAngle(a), gridVelocity(v));
+            }
+        }
+        const double rate = (double)agreements / (GRID * GRID);
+        test::check(rate > 0.95, "Lookup table agrees with the float network on >95% of states");
+
+        // Out-of-range states clamp to the edge cells like the network inputs
+        test::check(lookupBot.getAction(5.0f, -100.0f) == lookupBot.getAction(MAX_ANGLE, -10.0f), "Inputs clamp to the box");
+        const int nanAction = lookupBot.getAction(std::nanf(""), 0.0f);
+        test::check(nanAction == lookupBot.getAction(5.0f, 0.0f), "NaN reads the last row, like a saturated input");
+
+        int actions[8];
+        const float angles[8] = {-0.9f, -0.3f, -0.05f, 0.0f, 0.02f, 0.2f, 0.6f, 1.0f};
+        const float velocities[8] = {3.0f, -1.0f, 0.5f, 0.0f, -0.2f, 1.5f, -4.0f, 9.0f};
+        lookupBot.getActions(angles, velocities, actions, 8);
+        for (int i = 0; i < 8; i++) {
+            test::check(actions[i] == lookupBot.getAction(angles[i], velocities[i]), "getActions matches getAction");
+        }
+        test::check(lookupBot.getMotorTorque(2) == floatBot.getMotorTorque(2), "Same action torques");
+        return "Agreement " + std::to_string(rate * 100.0) + "%, " + std::to_string(Grid::BYTES) + "-byte table";
+    });
+
+    return test::summarize();
+}
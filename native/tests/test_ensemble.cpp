@@ -0,0 +1,136 @@
+/**
+ * Policy ensemble tests
+ *
+ * Built once from the first model in models/ (DQN_MODEL_FILE,
+ * DQN_INT8_MODEL_FILE and DQN_LOOKUP_MODEL_FILE, linked under namespace
+ * first) and the second one (DQN_SECOND_MODEL_FILE, namespace second), and
+ * checks every ensemble mode against the policies called one by one.
+ */
+
+#define DQN_MODEL_NAMESPACE first
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+#include DQN_LOOKUP_MODEL_FILE
+#undef DQN_MODEL_NAMESPACE
+
+#define DQN_MODEL_NAMESPACE second
+#include DQN_SECOND_MODEL_FILE
+#undef DQN_MODEL_NAMESPACE
+
+#include "DQNEnsemble.h"
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+
+#include "TestHarness.h"
+
+namespace {
+
+float tickAngle(int t) { return 0.8f * std::sin(0.07f * (float)t); }
+float tickVelocity(int t) { return 6.0f * std::cos(0.11f * (float)t); }
+
+const int TICKS = 2000;
+
+} // namespace
+
+int main() {
+    std::printf("Running Ensemble Tests (%s + %s)...\n\n", DQN_MODEL_FILE, DQN_SECOND_MODEL_FILE);
+
+    test::run("Namespaced Exports Link Side By Side", []() {
+        static_assert(!std::is_same<first::TwoWheelBotDQN, second::TwoWheelBotDQN>::value,
+                      "each namespace has its own policy type");
+        first::TwoWheelBotDQN a;
+        second::TwoWheelBotDQN b;
+        float qa[first::TwoWheelBotDQN::OUTPUT_SIZE], qb[second::TwoWheelBotDQN::OUTPUT_SIZE];
+        int differing = 0;
+        for (int t = 0; t < TICKS; t++) {
+            a.forward(tickAngle(t), tickVelocity(t), qa);
+            b.forward(tickAngle(t), tickVelocity(t), qb);
+            differing += qa[0] != qb[0];
+        }
+        test::check(&first::TwoWheelBotDQNWeights::weights != (const void*)&second::TwoWheelBotDQNWeights::weights,
+                    "Separate weight tables");
+        test::check(differing > 0, "Different models give different Q-values");
+        return std::to_string(differing) + "/" + std::to_string(TICKS) + " ticks with different Q-values";
+    });
+
+    test::run("Primary Mode Shadows The Others", []() {
+        dqn::PolicyEnsemble<dqn::ENSEMBLE_PRIMARY, first::TwoWheelBotDQN, second::TwoWheelBotDQN> shadow;
+        first::TwoWheelBotDQN primary;
+        second::TwoWheelBotDQN candidate;
+        uint32_t expectedDisagreements = 0;
+        for (int t = 0; t < TICKS; t++) {
+            const int expected = primary.getAction(tickAngle(t), tickVelocity(t));
+            const int candidateAction = candidate.getAction(tickAngle(t), tickVelocity(t));
+            expectedDisagreements += candidateAction != expected;
+            test::check(shadow.getAction(tickAngle(t), tickVelocity(t)) == expected, "Primary drives");
+            test::check(shadow.action(0) == expected && shadow.action(1) == candidateAction, "Per-policy actions");
+        }
+        test::check(shadow.ticks() == TICKS, "Every tick counted");
+        test::check(shadow.disagreements(0) == 0, "Primary never disagrees with itself");
+        test::check(shadow.disagreements(1) == expectedDisagreements, "Candidate disagreements counted");
+        test::check(shadow.getMotorTorque(2) == primary.getMotorTorque(2), "Same torque table");
+
+        shadow.resetCounters();
+        test::check(shadow.ticks() == 0 && shadow.disagreements(1) == 0, "Counters reset");
+        return "candidate disagrees on " + std::to_string(expectedDisagreements) + "/" + std::to_string(TICKS) +
+               " ticks";
+    });
+
+    test::run("Vote Mode Takes The Majority", []() {
+        dqn::PolicyEnsemble<dqn::ENSEMBLE_VOTE, first::TwoWheelBotDQNInt8, first::TwoWheelBotDQNLookup,
+                            second::TwoWheelBotDQN> ensemble;
+        first::TwoWheelBotDQNInt8 a;
+        first::TwoWheelBotDQNLookup b;
+        second::TwoWheelBotDQN c;
+        uint32_t expectedDisagreements[3] = {0, 0, 0};
+        for (int t = 0; t < TICKS; t++) {
+            const int votes[3] = {a.getAction(tickAngle(t), tickVelocity(t)), b.getAction(tickAngle(t), tickVelocity(t)),
+                                  c.getAction(tickAngle(t), tickVelocity(t))};
+            // Three voters: any pair wins, else the first policy's action
+            const int expected = votes[1] == votes[2] ? votes[1] : votes[0];
+            const int action = ensemble.getAction(tickAngle(t), tickVelocity(t));
+            test::check(action == expected, "Majority action");
+            for (int k = 0; k < 3; k++) expectedDisagreements[k] += votes[k] != action;
+        }
+        for (int k = 0; k < 3; k++) {
+            test::check(ensemble.disagreements(k) == expectedDisagreements[k], "Disagreements counted per policy");
+        }
+        return "first policy overruled on " + std::to_string(expectedDisagreements[0]) + "/" + std::to_string(TICKS) +
+               " ticks";
+    });
+
+    test::run("Vote Ties Go To The First Policy", []() {
+        dqn::PolicyEnsemble<dqn::ENSEMBLE_VOTE, first::TwoWheelBotDQN, second::TwoWheelBotDQN> pair;
+        first::TwoWheelBotDQN a;
+        for (int t = 0; t < TICKS; t++) {
+            test::check(pair.getAction(tickAngle(t), tickVelocity(t)) == a.getAction(tickAngle(t), tickVelocity(t)),
+                        "Two voters: the first one decides");
+        }
+        test::check(pair.disagreements(0) == 0, "First policy never outvoted");
+        return std::to_string(pair.disagreements(1)) + " ties resolved";
+    });
+
+    test::run("Average Mode Sums Q-Values", []() {
+        dqn::PolicyEnsemble<dqn::ENSEMBLE_AVERAGE_Q, first::TwoWheelBotDQN, second::TwoWheelBotDQN> ensemble;
+        first::TwoWheelBotDQN a;
+        second::TwoWheelBotDQN b;
+        float qa[first::TwoWheelBotDQN::OUTPUT_SIZE], qb[second::TwoWheelBotDQN::OUTPUT_SIZE];
+        float total[first::TwoWheelBotDQN::OUTPUT_SIZE];
+        int overruledBoth = 0;
+        for (int t = 0; t < TICKS; t++) {
+            const int actionA = a.forward(tickAngle(t), tickVelocity(t), qa);
+            const int actionB = b.forward(tickAngle(t), tickVelocity(t), qb);
+            for (int o = 0; o < first::TwoWheelBotDQN::OUTPUT_SIZE; o++) total[o] = qa[o] + qb[o];
+            const int expected = dqn::argmax<first::TwoWheelBotDQN::OUTPUT_SIZE>(total);
+            test::check(ensemble.getAction(tickAngle(t), tickVelocity(t)) == expected, "Argmax of the summed Q-values");
+            test::check(ensemble.action(0) == actionA && ensemble.action(1) == actionB, "Own argmax per policy");
+            overruledBoth += expected != actionA && expected != actionB;
+        }
+        return std::to_string(ensemble.disagreements(0)) + "/" + std::to_string(ensemble.disagreements(1)) +
+               " disagreements, " + std::to_string(overruledBoth) + " ticks against both";
+    });
+
+    return test::summarize();
+}
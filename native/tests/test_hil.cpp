@@ -0,0 +1,202 @@
+/**
+ * Hardware-in-the-loop tests
+ *
+ * Checks the frame format and checksum, the decoder's resync on damaged
+ * streams, that HilDevice answers like the policy it wraps, and that
+ * runHil over an in-memory link reproduces runEpisode with the first
+ * model (DQN_MODEL_FILE) and counts timeouts and stale replies when the
+ * link drops or delays frames.
+ */
+
+#include DQN_MODEL_FILE
+
+#include "BalancingRobot.h"
+#include "DQNHil.h"
+#include "HilBridge.h"
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "TestHarness.h"
+
+namespace {
+
+/**
+ * A device on the same thread: every write is answered before read()
+ * @param dropEvery Lose every n-th reply (0: none)
+ * @param delayEvery Hold every n-th reply back until the next state (0: none)
+ */
+struct MemoryLink {
+    dqn::HilDevice<TwoWheelBotDQN> device;
+    std::deque<uint8_t> replies;
+    std::vector<uint8_t> held;
+    int dropEvery;
+    int delayEvery;
+    int frames;
+
+    explicit MemoryLink(int dropEvery = 0, int delayEvery = 0) : dropEvery(dropEvery), delayEvery(delayEvery), frames(0) {}
+
+    bool write(const uint8_t* bytes, size_t size) {
+        replies.insert(replies.end(), held.begin(), held.end());
+        held.clear();
+        for (size_t i = 0; i < size; i++) {
+            if (!device.push(bytes[i])) continue;
+            frames++;
+            const uint8_t* reply = device.reply();
+            if (dropEvery && frames % dropEvery == 0) continue;
+            if (delayEvery && frames % delayEvery == 0) {
+                held.assign(reply, reply + dqn::HIL_FRAME_SIZE);
+                continue;
+            }
+            // A noise byte ahead of every reply, which the host must skip
+            replies.push_back(0x00);
+            replies.insert(replies.end(), reply, reply + dqn::HIL_FRAME_SIZE);
+        }
+        return true;
+    }
+
+    int read(uint8_t* bytes, size_t capacity, long) {
+        size_t n = 0;
+        while (n < capacity && !replies.empty()) {
+            bytes[n++] = replies.front();
+            replies.pop_front();
+        }
+        return (int)n;
+    }
+};
+
+/**
+ * Unpaced run over a MemoryLink
+ * Replies are queued by write, so the timeout only decides how long an empty
+ * read spins: generous by default so exact trajectories never race the
+ * scheduler, short where the test expects lost replies.
+ */
+hil::HilOptions unpaced(int steps, double timeoutMillis = 1000.0) {
+    hil::HilOptions options;
+    options.realTime = false;
+    options.steps = steps;
+    options.timeoutMillis = timeoutMillis;
+    return options;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running HIL Tests (%s)...\n\n", DQN_MODEL_FILE);
+
+    test::run("Frame Format", []() {
+        dqn::HilState state = {0xBEEF, dqn::HIL_RESET, 0.125f, -3.5f};
+        uint8_t bytes[dqn::HIL_FRAME_SIZE];
+        dqn::encodeHilState(state, bytes);
+        test::check(bytes[0] == dqn::HIL_SYNC0 && bytes[1] == dqn::HIL_STATE_SYNC1, "Sync bytes first");
+        test::check(bytes[2] == 0xEF && bytes[3] == 0xBE, "Little-endian sequence");
+        dqn::HilState decoded;
+        test::check(dqn::decodeHilState(bytes, decoded), "State decodes");
+        test::check(decoded.sequence == state.sequence && decoded.flags == state.flags && decoded.angle == state.angle &&
+                        decoded.angularVelocity == state.angularVelocity,
+                    "Every state field survives");
+        dqn::HilAction action;
+        test::check(!dqn::decodeHilAction(bytes, action), "A state frame is not an action frame");
+        for (size_t i = 0; i < dqn::HIL_FRAME_SIZE; i++) {
+            bytes[i] ^= 0x04;
+            test::check(!dqn::decodeHilState(bytes, decoded), "Flipped bit in byte " + std::to_string(i) + " rejected");
+            bytes[i] ^= 0x04;
+        }
+
+        const dqn::HilAction sent = {7, 2, dqn::HIL_RESET, 1.0f, 123456};
+        dqn::encodeHilAction(sent, bytes);
+        test::check(dqn::decodeHilAction(bytes, action), "Action decodes");
+        test::check(action.sequence == sent.sequence && action.action == sent.action && action.flags == sent.flags &&
+                        action.torque == sent.torque && action.cycles == sent.cycles,
+                    "Every action field survives");
+        return std::to_string(dqn::HIL_FRAME_SIZE) + "-byte frames, every single-bit error detected";
+    });
+
+    test::run("Decoder Resynchronizes", []() {
+        std::vector<uint8_t> stream;
+        uint8_t frame[dqn::HIL_FRAME_SIZE];
+        for (uint16_t s = 0; s < 20; s++) {
+            const dqn::HilAction action = {s, (uint8_t)(s % 3), 0, 0.0f, s};
+            dqn::encodeHilAction(action, frame);
+            if (s == 5) frame[9] ^= 0xFF;                         // Corrupted
+            if (s == 9) stream.push_back(dqn::HIL_SYNC0);         // Stray sync byte
+            const size_t keep = s == 13 ? 7 : sizeof(frame);     // Truncated
+            stream.insert(stream.end(), frame, frame + keep);
+        }
+        dqn::HilFrameDecoder decoder(dqn::HIL_ACTION_SYNC1);
+        std::vector<uint16_t> received;
+        for (uint8_t byte : stream) {
+            const uint8_t* bytes = decoder.push(byte);
+            dqn::HilAction action;
+            if (bytes && dqn::decodeHilAction(bytes, action)) received.push_back(action.sequence);
+        }
+        test::check(received.size() == 18, "18 of 20 frames decoded (" + std::to_string(received.size()) + ")");
+        for (uint16_t s : received) test::check(s != 5 && s != 13, "Damaged frames dropped");
+        test::check(decoder.skippedBytes() > 0, "Skipped bytes counted");
+        return std::to_string(decoder.skippedBytes()) + " bytes skipped";
+    });
+
+    test::run("Device Answers Like The Policy", []() {
+        dqn::HilDevice<TwoWheelBotDQN> device;
+        TwoWheelBotDQN bot;
+        uint8_t frame[dqn::HIL_FRAME_SIZE];
+        for (uint16_t s = 0; s < 50; s++) {
+            const float angle = 0.02f * (float)(s % 11) - 0.1f, angularVelocity = 0.3f * (float)(s % 7) - 1.0f;
+            const dqn::HilState state = {s, s == 0 ? dqn::HIL_RESET : (uint8_t)0, angle, angularVelocity};
+            dqn::encodeHilState(state, frame);
+            bool replied = false;
+            for (size_t i = 0; i < sizeof(frame); i++) replied = device.push(frame[i]);
+            test::check(replied, "Tick " + std::to_string(s) + " answered on the last byte");
+
+            if (s == 0) bot.reset(angle, angularVelocity);
+            const int expected = bot.getAction(angle, angularVelocity);
+            dqn::HilAction action;
+            test::check(dqn::decodeHilAction(device.reply(), action), "Reply decodes");
+            test::check(action.sequence == s && action.flags == state.flags, "Sequence and flags echoed");
+            test::check(action.action == expected && action.torque == bot.getMotorTorque(expected),
+                        "Tick " + std::to_string(s) + ": action and torque of the policy");
+        }
+        test::check(device.frames() == 50, "50 ticks");
+        return std::to_string(device.frames()) + " ticks match getAction";
+    });
+
+    test::run("Closed Loop Matches runEpisode", []() {
+        dqn::RobotConfig config;
+        dqn::BalancingRobot reference(config, 3);
+        reference.reset(dqn::RobotState(0.05, 0.0));
+        TwoWheelBotDQN bot;
+        const dqn::EpisodeStats expected = dqn::runEpisode(reference, bot, 2000);
+
+        dqn::BalancingRobot robot(config, 3);
+        robot.reset(dqn::RobotState(0.05, 0.0));
+        MemoryLink link;
+        std::vector<hil::HilTick> ticks;
+        const hil::HilReport report = hil::runHil(link, robot, unpaced(2000), &ticks);
+        test::check(report.steps == expected.steps && report.failed == expected.failed, "Same survival");
+        test::check(report.totalReward == expected.totalReward && report.meanAbsAngle == expected.meanAbsAngle,
+                    "Same trajectory");
+        test::check(report.timeouts == 0 && report.staleReplies == 0, "Every tick answered");
+        test::check(report.skippedBytes == (size_t)report.steps, "Noise bytes skipped");
+        test::check(ticks.size() == (size_t)report.steps && report.latencyMicros.max >= report.latencyMicros.min,
+                    "Per-tick log and latency summary");
+        return std::to_string(report.steps) + " ticks, reward " + std::to_string(report.totalReward);
+    });
+
+    test::run("Lost And Late Replies", []() {
+        dqn::BalancingRobot robot;
+        robot.reset(dqn::RobotState(0.02, 0.0));
+        MemoryLink link(10, 7);
+        std::vector<hil::HilTick> ticks;
+        const hil::HilReport report = hil::runHil(link, robot, unpaced(140, 1.0), &ticks);
+        test::check(report.steps == 140, "Runs through the losses");
+        // Frames 7, 14, ... are held until the next state; 10, 20, ... lost; 70 and 140 both
+        test::check(report.timeouts == 20 + 14 - 2, "Timeouts counted (" + std::to_string(report.timeouts) + ")");
+        test::check(report.staleReplies == 20 - 2, "Late replies are stale (" + std::to_string(report.staleReplies) + ")");
+        test::check(ticks[9].action == -1 && ticks[9].torque == 0.0f, "A timed-out tick drives zero torque");
+        return std::to_string(report.timeouts) + " timeouts, " + std::to_string(report.staleReplies) + " stale";
+    });
+
+    return test::summarize();
+}
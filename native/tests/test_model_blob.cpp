@@ -0,0 +1,300 @@
+/**
+ * Model blob tests for one exported model
+ *
+ * Built once per model in models/ with DQN_MODEL_FILE / DQN_INT8_MODEL_FILE
+ * and the blobs reexport.js --blob wrote next to them
+ * (DQN_MODEL_BLOB_FILE / DQN_INT8_MODEL_BLOB_FILE). The blob policy must
+ * act exactly like the compiled export of the same network. Float blobs
+ * keep the normalization in their header while the compiled export folds
+ * it into the first layer, so their Q-values agree to float rounding.
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+
+#include "BalancingRobot.h"
+#include "DQNModelBlob.h"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TestHarness.h"
+
+namespace {
+
+const int IN = TwoWheelBotDQN::INPUT_SIZE;
+const int HIDDEN = TwoWheelBotDQN::HIDDEN_SIZE;
+const int OUT = TwoWheelBotDQN::OUTPUT_SIZE;
+
+const int GRID = 81;
+
+// Past the normalization range on both axes, so clamping is covered
+float gridAngle(int a) { return -1.5f + 3.0f * (float)a / (float)(GRID - 1); }
+float gridVelocity(int v) { return -15.0f + 30.0f * (float)v / (float)(GRID - 1); }
+
+/**
+ * 4-byte aligned writable copy of a blob, for corruption tests
+ */
+std::vector<uint32_t> copyBlob(const dqn::MappedFile& file) {
+    std::vector<uint32_t> words((file.size() + 3) / 4, 0);
+    std::memcpy(words.data(), file.data(), file.size());
+    return words;
+}
+
+void rewriteChecksum(std::vector<uint32_t>& words) {
+    dqn::ModelBlobHeader header;
+    std::memcpy(&header, words.data(), sizeof(header));
+    const uint8_t* bytes = (const uint8_t*)words.data();
+    header.crc = dqn::crc32(bytes + dqn::MODEL_BLOB_CRC_START, header.totalSize - dqn::MODEL_BLOB_CRC_START);
+    std::memcpy(words.data(), &header, sizeof(header));
+}
+
+/**
+ * Float blob for a compiled weight table, laid out as ModelBlob.js does
+ */
+template <int In, int Hidden, int Out>
+std::vector<uint32_t> buildFloatBlob(const dqn::DQNWeights<In, Hidden, Out>& w) {
+    const float torques[Out] = {-1.0f, 0.0f, 1.0f};
+    const struct { const float* values; size_t count; } tensors[5] = {
+        {torques, Out},
+        {w.weightsInputHidden, In * Hidden},
+        {w.biasHidden, Hidden},
+        {w.weightsHiddenOutput, Hidden * Out},
+        {w.biasOutput, Out}};
+
+    dqn::ModelBlobHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "DQNB", 4);
+    header.version = dqn::MODEL_BLOB_VERSION;
+    header.headerSize = sizeof(header);
+    header.inputSize = In;
+    header.hiddenSize = Hidden;
+    header.outputSize = Out;
+    header.historyTimesteps = In / 2;
+    header.angleScale = dqn::ANGLE_SCALE;
+    header.angularVelocityScale = dqn::ANGULAR_VELOCITY_SCALE;
+    header.weightScaleInputHidden = header.weightScaleHiddenOutput = 1.0f;
+
+    uint32_t* offsets[5] = {&header.actionTorquesOffset, &header.weightsInputHiddenOffset, &header.biasHiddenOffset,
+                            &header.weightsHiddenOutputOffset, &header.biasOutputOffset};
+    size_t size = sizeof(header);
+    for (int t = 0; t < 5; t++) {
+        size = (size + 15) / 16 * 16;
+        *offsets[t] = (uint32_t)size;
+        size += tensors[t].count * sizeof(float);
+    }
+    header.totalSize = (uint32_t)size;
+
+    std::vector<uint32_t> words((size + 3) / 4, 0);
+    unsigned char* bytes = (unsigned char*)words.data();
+    std::memcpy(bytes, &header, sizeof(header));
+    for (int t = 0; t < 5; t++) std::memcpy(bytes + *offsets[t], tensors[t].values, tensors[t].count * sizeof(float));
+    rewriteChecksum(words);
+    return words;
+}
+
+// Synthetic 3-timestep model: older frames change the argmax
+const int HISTORY_IN = 6;
+const int HISTORY_HIDDEN = 8;
+static DQN_FLASH dqn::DQNWeights<HISTORY_IN, HISTORY_HIDDEN, 3> historyWeights DQN_PROGMEM = {
+    {0.9f, -0.4f, 0.3f, 0.7f, -0.8f, 0.2f, 0.5f, -0.6f,
+     0.4f, 0.6f, -0.7f, 0.1f, 0.3f, -0.5f, 0.8f, 0.2f,
+     -0.6f, 0.5f, 0.4f, -0.3f, 0.7f, 0.6f, -0.2f, 0.9f,
+     0.2f, -0.8f, 0.6f, 0.5f, -0.4f, 0.3f, 0.1f, -0.7f,
+     0.7f, 0.3f, -0.5f, -0.6f, 0.2f, 0.8f, -0.3f, 0.4f,
+     -0.2f, 0.4f, 0.8f, 0.3f, -0.7f, -0.1f, 0.6f, 0.5f},
+    {0.05f, -0.1f, 0.1f, 0.0f, 0.2f, -0.05f, 0.15f, -0.2f},
+    {0.6f, -0.3f, 0.2f, -0.5f, 0.1f, 0.7f, 0.3f, 0.4f, -0.6f, 0.8f, -0.2f, -0.4f,
+     -0.7f, 0.5f, 0.3f, 0.2f, -0.1f, 0.6f, 0.4f, 0.3f, -0.8f, -0.3f, 0.7f, 0.1f},
+    {0.01f, 0.0f, -0.01f}
+};
+typedef dqn::DQNPolicy<HISTORY_IN, HISTORY_HIDDEN, 3, dqn::ReLU, historyWeights> HistoryPolicy;
+
+} // namespace
+
+int main() {
+    std::printf("Running Model Blob Tests (%s)...\n\n", DQN_MODEL_BLOB_FILE);
+
+    test::run("CRC-32 Check Value", []() {
+        const char* text = "123456789";
+        test::check(dqn::crc32(text, 9) == 0xCBF43926u, "crc32(\"123456789\") is the IEEE check value");
+        test::check(dqn::crc32(text + 4, 5, dqn::crc32(text, 4)) == 0xCBF43926u, "Checksums continue across pieces");
+        test::check(dqn::crc32(text, 0) == 0, "Empty input checksums to 0");
+        return std::string("Matches zlib and ModelBlob.js");
+    });
+
+    test::run("Float Blob Matches Export", []() {
+        dqn::MappedFile file;
+        test::check(file.open(DQN_MODEL_BLOB_FILE), "Blob file maps");
+        dqn::ModelBlob blob;
+        const dqn::BlobStatus status = blob.bind(file.data(), file.size());
+        test::check(status == dqn::BLOB_OK, std::string("Blob binds: ") + dqn::blobStatusName(status));
+        test::check(blob.header().inputSize == IN && blob.header().hiddenSize == HIDDEN &&
+                    blob.header().outputSize == OUT, "Architecture matches the export");
+        test::check(blob.header().angleScale == dqn::ANGLE_SCALE &&
+                    blob.header().angularVelocityScale == dqn::ANGULAR_VELOCITY_SCALE, "Normalization matches DQNPolicy.h");
+
+        dqn::BlobPolicy policy;
+        test::check(policy.bind(blob), "Policy binds");
+        TwoWheelBotDQN bot;
+        float maxError = 0.0f;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                float expected[OUT], actual[OUT];
+                const int expectedAction = bot.forward(gridAngle(a), gridVelocity(v), expected);
+                const int action = policy.forward(gridAngle(a), gridVelocity(v), actual);
+                test::check(action == expectedAction, "Action matches at " + std::to_string(a) + "," + std::to_string(v));
+                for (int o = 0; o < OUT; o++) {
+                    maxError = std::fmax(maxError, std::fabs(actual[o] - expected[o]) / (1.0f + std::fabs(expected[o])));
+                }
+            }
+        }
+        test::check(maxError <= 1e-4f, "Q-values agree to rounding (max relative error " + std::to_string(maxError) + ")");
+        for (int action = 0; action < OUT; action++) {
+            test::check(policy.getMotorTorque(action) == bot.getMotorTorque(action), "Action map matches ACTION_TORQUES");
+        }
+        return std::to_string(GRID * GRID) + " states agree, max relative Q error " + std::to_string(maxError) + ", " +
+               std::to_string(file.size()) + " bytes mapped";
+    });
+
+    test::run("Int8 Blob Matches Int8 Export", []() {
+        dqn::MappedFile file;
+        test::check(file.open(DQN_INT8_MODEL_BLOB_FILE), "Blob file maps");
+        dqn::ModelBlob blob;
+        test::check(blob.bind(file.data(), file.size()) == dqn::BLOB_OK, "Blob binds");
+        test::check(blob.precision() == dqn::BLOB_INT8, "Blob is int8");
+        test::check(blob.header().hiddenShift == TwoWheelBotDQNInt8Weights::HIDDEN_SHIFT, "Hidden shift matches the export");
+        test::check(blob.header().angleScale == dqn::QUANTIZED_ANGLE_SCALE, "Input scale folds the int8 range");
+
+        dqn::BlobPolicy policy;
+        policy.bind(blob);
+        TwoWheelBotDQNInt8 bot;
+        for (int a = 0; a < GRID; a++) {
+            for (int v = 0; v < GRID; v++) {
+                int32_t accumulators[OUT];
+                float q[OUT];
+                const int expectedAction = bot.forward(gridAngle(a), gridVelocity(v), accumulators);
+                test::check(policy.forward(gridAngle(a), gridVelocity(v), q) == expectedAction, "Action matches");
+                for (int o = 0; o < OUT; o++) {
+                    test::check(q[o] == (float)accumulators[o] * blob.outputScale(), "Accumulators match");
+                }
+            }
+        }
+        return std::to_string(GRID * GRID) + " states agree, " + std::to_string(file.size()) + " bytes";
+    });
+
+    test::run("Closed Loop Matches Compiled Policy", []() {
+        dqn::MappedFile file;
+        file.open(DQN_MODEL_BLOB_FILE);
+        dqn::ModelBlob blob;
+        blob.bind(file.data(), file.size());
+        dqn::BlobPolicy policy;
+        policy.bind(blob);
+        TwoWheelBotDQN bot;
+
+        for (uint64_t seed = 1; seed <= 4; seed++) {
+            dqn::BalancingRobot robotA(dqn::RobotConfig(), seed);
+            dqn::BalancingRobot robotB(dqn::RobotConfig(), seed);
+            robotA.reset(dqn::RobotState(0.1 * (double)seed - 0.25));
+            robotB.reset(dqn::RobotState(0.1 * (double)seed - 0.25));
+            const dqn::EpisodeStats expected = dqn::runEpisode(robotA, bot, 2000);
+            const dqn::EpisodeStats actual = dqn::runEpisode(robotB, policy, 2000);
+            test::check(actual.steps == expected.steps && actual.totalReward == expected.totalReward &&
+                        actual.meanAbsAngle == expected.meanAbsAngle, "Episode " + std::to_string(seed) + " identical");
+        }
+        return std::string("4 episodes step for step identical");
+    });
+
+    test::run("History Blob Matches Template Policy", []() {
+        std::vector<uint32_t> words = buildFloatBlob(historyWeights);
+        dqn::ModelBlob blob;
+        test::check(blob.bind(words.data(), words.size() * 4) == dqn::BLOB_OK, "In-memory blob binds");
+        test::check(blob.header().historyTimesteps == 3, "3 history timesteps");
+
+        dqn::BlobPolicy policy;
+        policy.bind(blob);
+        HistoryPolicy bot;
+        int actionsSeen[3] = {0, 0, 0};
+        for (int episode = 0; episode < 3; episode++) {
+            // First episode runs on the zero-padded history, later ones reset
+            if (episode > 0) {
+                const float angle = 0.2f * (float)episode - 0.3f;
+                bot.reset(angle, -1.0f);
+                policy.reset(angle, -1.0f);
+            }
+            for (int t = 0; t < 40; t++) {
+                const float angle = 0.6f * std::sin(0.37f * (float)(t + 11 * episode));
+                const float velocity = 6.0f * std::cos(0.23f * (float)(t * 3 + episode));
+                float expected[3], actual[3];
+                const int action = bot.forward(angle, velocity, expected);
+                test::check(policy.forward(angle, velocity, actual) == action, "Action matches at step " + std::to_string(t));
+                for (int o = 0; o < 3; o++) test::check(actual[o] == expected[o], "Q-values bit-identical");
+                actionsSeen[action]++;
+            }
+        }
+        test::check(actionsSeen[0] > 0 && actionsSeen[2] > 0, "Sequence exercises more than one action");
+        return std::string("120 steps across resets identical");
+    });
+
+    test::run("Rejects Corrupt Blobs", []() {
+        dqn::MappedFile file;
+        file.open(DQN_MODEL_BLOB_FILE);
+        const std::vector<uint32_t> good = copyBlob(file);
+        const size_t size = file.size();
+        dqn::ModelBlob blob;
+
+        // A flash partition is larger than the blob it holds
+        std::vector<uint32_t> partition(good);
+        partition.resize(partition.size() + 1024, 0xFFFFFFFFu);
+        test::check(blob.bind(partition.data(), partition.size() * 4) == dqn::BLOB_OK, "Trailing erased flash is ignored");
+
+        std::vector<uint32_t> words(good);
+        ((uint8_t*)words.data())[size - 1] ^= 0x40;
+        test::check(blob.bind(words.data(), size) == dqn::BLOB_BAD_CHECKSUM, "Flipped weight bit fails the CRC");
+        test::check(!blob.valid(), "Failed bind drops the previous blob");
+
+        test::check(blob.bind(good.data(), size - 4) == dqn::BLOB_TOO_SMALL, "Truncated blob is rejected");
+        test::check(blob.bind(good.data(), 16) == dqn::BLOB_TOO_SMALL, "Partial header is rejected");
+        test::check(blob.bind((const uint8_t*)good.data() + 1, size - 1) == dqn::BLOB_MISALIGNED, "Unaligned start is rejected");
+
+        words = good;
+        ((uint8_t*)words.data())[0] = 'X';
+        test::check(blob.bind(words.data(), size) == dqn::BLOB_BAD_MAGIC, "Bad magic is rejected");
+
+        dqn::ModelBlobHeader header;
+        words = good;
+        std::memcpy(&header, words.data(), sizeof(header));
+        header.version = 2;
+        std::memcpy(words.data(), &header, sizeof(header));
+        test::check(blob.bind(words.data(), size) == dqn::BLOB_BAD_VERSION, "Newer version is rejected");
+
+        // Structural errors with a valid checksum
+        words = good;
+        std::memcpy(&header, words.data(), sizeof(header));
+        header.hiddenSize = dqn::BLOB_MAX_HIDDEN + 1;
+        std::memcpy(words.data(), &header, sizeof(header));
+        rewriteChecksum(words);
+        test::check(blob.bind(words.data(), size) == dqn::BLOB_BAD_ARCHITECTURE, "Oversized hidden layer is rejected");
+
+        words = good;
+        std::memcpy(&header, words.data(), sizeof(header));
+        header.biasOutputOffset = header.totalSize - 4;
+        std::memcpy(words.data(), &header, sizeof(header));
+        rewriteChecksum(words);
+        test::check(blob.bind(words.data(), size) == dqn::BLOB_BAD_TENSOR, "Tensor past the end is rejected");
+
+        words = good;
+        std::memcpy(&header, words.data(), sizeof(header));
+        header.biasHiddenOffset += 2;
+        std::memcpy(words.data(), &header, sizeof(header));
+        rewriteChecksum(words);
+        test::check(blob.bind(words.data(), size) == dqn::BLOB_BAD_TENSOR, "Misaligned tensor is rejected");
+
+        test::check(!dqn::BlobPolicy().bind(blob), "Policy refuses an unbound blob");
+        return std::string("Checksum, size, alignment, magic, version and bounds checked");
+    });
+
+    return test::summarize();
+}
@@ -0,0 +1,378 @@
+/**
+ * DoubleBufferedPolicy tests
+ *
+ * Streams the blobs of two exported models (DQN_MODEL_BLOB_FILE and
+ * DQN_SECOND_MODEL_BLOB_FILE) into RAM slots while a control loop keeps
+ * running, and checks that every tick runs wholly on one of the two
+ * models and that bad transfers never reach the active slot. Delta
+ * updates patch model A into a fine-tuned copy of itself.
+ */
+
+#include "DQNPolicySlots.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestHarness.h"
+
+namespace {
+
+typedef dqn::RamSlotStorage<4096> Storage;
+typedef dqn::DoubleBufferedPolicy<Storage> SlotPolicy;
+
+/**
+ * A blob file kept mapped, plus a reference policy bound to it
+ */
+struct Model {
+    dqn::MappedFile file;
+    dqn::ModelBlob blob;
+    dqn::BlobPolicy policy;
+
+    bool load(const char* path) {
+        return file.open(path) && blob.bind(file.data(), file.size()) == dqn::BLOB_OK && policy.bind(blob);
+    }
+
+    const uint8_t* bytes() const { return (const uint8_t*)file.data(); }
+    size_t size() const { return file.size(); }
+};
+
+Model modelA;
+Model modelB;
+
+/**
+ * Stream a blob in fixed-size chunks, calling between() after each one
+ */
+template <typename F>
+bool streamBlob(SlotPolicy& slots, const uint8_t* bytes, size_t size, size_t chunk, F between) {
+    if (!slots.beginUpdate(size)) return false;
+    for (size_t offset = 0; offset < size; offset += chunk) {
+        const size_t n = size - offset < chunk ? size - offset : chunk;
+        if (!slots.writeUpdate(bytes + offset, n)) return false;
+        between();
+    }
+    return true;
+}
+
+bool streamBlob(SlotPolicy& slots, const Model& model) {
+    return streamBlob(slots, model.bytes(), model.size(), 256, []() {});
+}
+
+/**
+ * Model A with its output biases moved, as a small fine-tune would
+ */
+std::vector<uint8_t> fineTuned(const Model& model) {
+    std::vector<uint8_t> bytes(model.bytes(), model.bytes() + model.size());
+    const uint32_t offset = model.blob.header().biasOutputOffset;
+    for (int o = 0; o < 3; o++) {
+        float bias;
+        std::memcpy(&bias, &bytes[offset + 4 * (size_t)o], 4);
+        bias += 0.05f * (float)(o + 1);
+        std::memcpy(&bytes[offset + 4 * (size_t)o], &bias, 4);
+    }
+    const uint32_t crc = dqn::crc32(&bytes[dqn::MODEL_BLOB_CRC_START], bytes.size() - dqn::MODEL_BLOB_CRC_START);
+    std::memcpy(&bytes[8], &crc, 4);
+    return bytes;
+}
+
+void append32(std::vector<uint8_t>& out, uint32_t value) {
+    const uint8_t* bytes = (const uint8_t*)&value;
+    out.insert(out.end(), bytes, bytes + 4);
+}
+
+/**
+ * A delta in ModelDelta.js's format: one record per run of changed bytes
+ */
+std::vector<uint8_t> makeDelta(const uint8_t* base, size_t baseSize, const std::vector<uint8_t>& target) {
+    std::vector<uint8_t> delta = {'D', 'Q', 'N', 'D', 1, 0, 24, 0};
+    append32(delta, 0);
+    append32(delta, 0);
+    uint32_t baseId;
+    std::memcpy(&baseId, base + 8, 4);
+    append32(delta, baseId);
+    append32(delta, (uint32_t)target.size());
+    for (size_t i = 0; i < target.size();) {
+        if (i < baseSize && base[i] == target[i]) {
+            i++;
+            continue;
+        }
+        size_t end = i;
+        while (end < target.size() && (end >= baseSize || base[end] != target[end])) end++;
+        append32(delta, (uint32_t)i);
+        append32(delta, (uint32_t)(end - i));
+        delta.insert(delta.end(), target.begin() + (long)i, target.begin() + (long)end);
+        i = end;
+    }
+    const uint32_t size = (uint32_t)delta.size();
+    std::memcpy(&delta[12], &size, 4);
+    const uint32_t crc = dqn::crc32(&delta[12], delta.size() - 12);
+    std::memcpy(&delta[8], &crc, 4);
+    return delta;
+}
+
+/**
+ * Stream a delta in fixed-size chunks
+ * @return False as soon as a write is refused
+ */
+bool streamDelta(SlotPolicy& slots, const std::vector<uint8_t>& delta, size_t chunk) {
+    if (!slots.beginDeltaUpdate(delta.size())) return false;
+    for (size_t offset = 0; offset < delta.size(); offset += chunk) {
+        const size_t n = delta.size() - offset < chunk ? delta.size() - offset : chunk;
+        if (!slots.writeUpdate(&delta[offset], n)) return false;
+    }
+    return true;
+}
+
+float tickAngle(int t) { return 0.5f * std::sin(0.013f * (float)t); }
+float tickVelocity(int t) { return 4.0f * std::cos(0.029f * (float)t); }
+
+/**
+ * Q-values of a single-timestep model are a pure function of the state
+ */
+bool sameQ(const float* a, const float* b) {
+    for (int o = 0; o < 3; o++) {
+        if (a[o] != b[o]) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Policy Slot Tests (%s, %s)...\n\n", DQN_MODEL_BLOB_FILE, DQN_SECOND_MODEL_BLOB_FILE);
+
+    if (!modelA.load(DQN_MODEL_BLOB_FILE) || !modelB.load(DQN_SECOND_MODEL_BLOB_FILE)) {
+        std::printf("✗ FAIL: could not map the model blobs\n");
+        return 1;
+    }
+
+    test::run("First Update Activates At Next Tick", []() {
+        static Storage storage;
+        SlotPolicy slots(storage);
+        test::check(!slots.hasPolicy() && slots.getAction(0.1f, 0.0f) == -1, "No policy before the first blob");
+        test::check(!slots.boot(0), "Erased storage does not boot");
+
+        test::check(streamBlob(slots, modelA), "Blob streams in");
+        test::check(!slots.swapPending(), "Nothing is scheduled before commit");
+        test::check(slots.commitUpdate() == dqn::BLOB_OK, "Blob verifies");
+        test::check(slots.swapPending() && !slots.hasPolicy(), "Swap waits for the next tick");
+
+        float q[3], expected[3];
+        const int action = slots.forward(0.2f, -1.0f, q);
+        test::check(action == modelA.policy.forward(0.2f, -1.0f, expected) && sameQ(q, expected), "Tick runs model A");
+        test::check(slots.activeSlot() == 0 && slots.swapCount() == 1 && !slots.swapPending(), "Slot 0 active after one swap");
+        return std::string("Committed blob takes over on the following tick");
+    });
+
+    test::run("Swap Happens Between Ticks", []() {
+        static Storage storage;
+        SlotPolicy slots(storage);
+        streamBlob(slots, modelA);
+        slots.commitUpdate();
+        slots.getAction(0.0f, 0.0f);
+
+        // Control ticks keep running model A while B trickles in
+        int tick = 0;
+        bool allA = true;
+        const bool streamed = streamBlob(slots, modelB.bytes(), modelB.size(), 37, [&]() {
+            float q[3], expected[3];
+            slots.forward(tickAngle(tick), tickVelocity(tick), q);
+            modelA.policy.forward(tickAngle(tick), tickVelocity(tick), expected);
+            allA = allA && sameQ(q, expected);
+            tick++;
+        });
+        test::check(streamed && allA, "Every tick during the transfer runs model A");
+        test::check(slots.activeSlot() == 0, "Active slot untouched by the transfer");
+
+        test::check(slots.commitUpdate() == dqn::BLOB_OK, "Model B verifies");
+        test::check(!slots.beginUpdate(modelA.size()), "No new update while the swap is pending");
+
+        float q[3], expected[3];
+        slots.forward(tickAngle(tick), tickVelocity(tick), q);
+        modelB.policy.forward(tickAngle(tick), tickVelocity(tick), expected);
+        test::check(sameQ(q, expected), "First tick after commit runs model B");
+        test::check(slots.activeSlot() == 1 && slots.swapCount() == 2, "Slot 1 active");
+        test::check(slots.beginUpdate(modelA.size()), "Old slot is free for the next update");
+        slots.abortUpdate();
+        return std::to_string(tick) + " ticks on model A during a 37-byte-chunk transfer";
+    });
+
+    test::run("Bad Transfers Keep The Active Policy", []() {
+        static Storage storage;
+        SlotPolicy slots(storage);
+        streamBlob(slots, modelA);
+        slots.commitUpdate();
+        slots.getAction(0.0f, 0.0f);
+
+        // One corrupted byte in transit
+        std::vector<uint8_t> corrupt(modelB.bytes(), modelB.bytes() + modelB.size());
+        corrupt[corrupt.size() / 2] ^= 0x10;
+        streamBlob(slots, corrupt.data(), corrupt.size(), 64, []() {});
+        test::check(slots.commitUpdate() == dqn::BLOB_BAD_CHECKSUM, "Corrupt blob fails its CRC");
+
+        // Transfer cut short
+        slots.beginUpdate(modelB.size());
+        slots.writeUpdate(modelB.bytes(), modelB.size() / 2);
+        test::check(slots.commitUpdate() == dqn::BLOB_TOO_SMALL, "Partial blob is rejected");
+
+        test::check(!slots.beginUpdate(storage.capacity() + 1), "Oversized blob is refused up front");
+        slots.beginUpdate(16);
+        test::check(!slots.writeUpdate(modelB.bytes(), 17), "Writes past the declared size are refused");
+        slots.abortUpdate();
+        test::check(!slots.writeUpdate(modelB.bytes(), 1) && slots.commitUpdate() != dqn::BLOB_OK,
+                    "Aborted update accepts nothing");
+
+        float q[3], expected[3];
+        slots.forward(0.3f, 2.0f, q);
+        modelA.policy.forward(0.3f, 2.0f, expected);
+        test::check(!slots.swapPending() && slots.swapCount() == 1 && sameQ(q, expected), "Model A still runs");
+        return std::string("CRC, truncation, size and abort checked");
+    });
+
+    test::run("Boot Falls Back To Valid Slot", []() {
+        static Storage storage;
+        {
+            SlotPolicy slots(storage);
+            streamBlob(slots, modelA);
+            slots.commitUpdate();
+            slots.getAction(0.0f, 0.0f);
+            streamBlob(slots, modelB);
+            slots.commitUpdate();
+            slots.getAction(0.0f, 0.0f);
+            test::check(slots.activeSlot() == 1, "Model B active in slot 1");
+        }
+
+        SlotPolicy restarted(storage);
+        test::check(restarted.boot(1) && restarted.activeSlot() == 1, "Boots the persisted slot");
+
+        // An interrupted update erased slot 1 before the restart
+        storage.begin(1, 16);
+        SlotPolicy recovered(storage);
+        test::check(recovered.boot(1) && recovered.activeSlot() == 0, "Falls back to slot 0");
+        float q[3], expected[3];
+        recovered.forward(0.1f, 0.5f, q);
+        modelA.policy.forward(0.1f, 0.5f, expected);
+        test::check(sameQ(q, expected), "Recovered policy is model A");
+        return std::string("Restart resumes the newest valid blob");
+    });
+
+    test::run("Delta Update Patches The Active Blob", []() {
+        static Storage storage;
+        SlotPolicy slots(storage);
+        test::check(!slots.beginDeltaUpdate(64), "No delta without an active blob");
+        streamBlob(slots, modelA);
+        slots.commitUpdate();
+        slots.getAction(0.0f, 0.0f);
+
+        const std::vector<uint8_t> tuned = fineTuned(modelA);
+        dqn::ModelBlob tunedBlob;
+        dqn::BlobPolicy tunedPolicy;
+        test::check(tunedBlob.bind(tuned.data(), tuned.size()) == dqn::BLOB_OK && tunedPolicy.bind(tunedBlob),
+                    "Fine-tuned blob is valid");
+
+        const std::vector<uint8_t> delta = makeDelta(modelA.bytes(), modelA.size(), tuned);
+        test::check(delta.size() * 10 < tuned.size(), "Delta carries only the changes (" + std::to_string(delta.size()) + " bytes)");
+        test::check(streamDelta(slots, delta, 5), "Delta streams in 5-byte chunks");
+        float q[3], expected[3];
+        slots.forward(0.2f, -1.0f, q);
+        modelA.policy.forward(0.2f, -1.0f, expected);
+        test::check(sameQ(q, expected), "Model A runs until the commit");
+
+        test::check(slots.commitUpdate() == dqn::BLOB_OK, "Patched blob verifies");
+        slots.forward(0.2f, -1.0f, q);
+        tunedPolicy.forward(0.2f, -1.0f, expected);
+        test::check(slots.activeSlot() == 1 && sameQ(q, expected), "Fine-tuned model runs from slot 1");
+        test::check(std::memcmp(storage.data(1), tuned.data(), tuned.size()) == 0, "Slot holds the fine-tuned blob");
+
+        // A delta to an unrelated model rewrites nearly every byte and still applies
+        const std::vector<uint8_t> toB = makeDelta(tuned.data(), tuned.size(),
+                                                   std::vector<uint8_t>(modelB.bytes(), modelB.bytes() + modelB.size()));
+        test::check(streamDelta(slots, toB, 100) && slots.commitUpdate() == dqn::BLOB_OK, "Delta to model B applies");
+        slots.forward(0.2f, -1.0f, q);
+        modelB.policy.forward(0.2f, -1.0f, expected);
+        test::check(slots.activeSlot() == 0 && sameQ(q, expected), "Model B runs from slot 0");
+        return std::to_string(delta.size()) + "-byte delta instead of a " + std::to_string(tuned.size()) + "-byte blob";
+    });
+
+    test::run("Bad Deltas Keep The Active Policy", []() {
+        static Storage storage;
+        SlotPolicy slots(storage);
+        streamBlob(slots, modelA);
+        slots.commitUpdate();
+        slots.getAction(0.0f, 0.0f);
+        const std::vector<uint8_t> tuned = fineTuned(modelA);
+        const std::vector<uint8_t> delta = makeDelta(modelA.bytes(), modelA.size(), tuned);
+
+        // Made against model B, which the device does not run
+        const std::vector<uint8_t> wrongBase = makeDelta(modelB.bytes(), modelB.size(), tuned);
+        test::check(!streamDelta(slots, wrongBase, 16), "Writes stop at the header");
+        test::check(slots.commitUpdate() == dqn::BLOB_BASE_MISMATCH, "Delta for another base is refused");
+
+        std::vector<uint8_t> corrupt = delta;
+        corrupt[corrupt.size() - 2] ^= 0x08;
+        streamDelta(slots, corrupt, 16);
+        test::check(slots.commitUpdate() == dqn::BLOB_BAD_CHECKSUM, "Corrupt record fails the delta CRC");
+
+        slots.beginDeltaUpdate(delta.size());
+        slots.writeUpdate(delta.data(), delta.size() - 3);
+        test::check(slots.commitUpdate() == dqn::BLOB_TOO_SMALL, "Partial delta is rejected");
+
+        std::vector<uint8_t> outside = delta;
+        const uint32_t offset = (uint32_t)tuned.size();
+        std::memcpy(&outside[24], &offset, 4);
+        test::check(!streamDelta(slots, outside, 16) && slots.commitUpdate() == dqn::BLOB_BAD_TENSOR,
+                    "Record past the blob is rejected");
+
+        float q[3], expected[3];
+        slots.forward(0.3f, 2.0f, q);
+        modelA.policy.forward(0.3f, 2.0f, expected);
+        test::check(!slots.swapPending() && slots.swapCount() == 1 && sameQ(q, expected), "Model A still runs");
+        test::check(streamDelta(slots, delta, 16) && slots.commitUpdate() == dqn::BLOB_OK, "The good delta still applies");
+        return std::string("Base ID, CRC, truncation and bounds checked");
+    });
+
+    test::run("Concurrent Updates Never Tear A Tick", []() {
+        static Storage storage;
+        SlotPolicy slots(storage);
+        streamBlob(slots, modelA);
+        slots.commitUpdate();
+        slots.getAction(0.0f, 0.0f);
+
+        std::atomic<bool> running(true);
+        std::atomic<int> commits(0);
+        std::thread updater([&]() {
+            for (int i = 0; running.load(); i++) {
+                const Model& next = i % 2 == 0 ? modelB : modelA;
+                if (!streamBlob(slots, next.bytes(), next.size(), 100, []() { std::this_thread::yield(); })) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (slots.commitUpdate() == dqn::BLOB_OK) commits++;
+                while (running.load() && slots.swapPending()) std::this_thread::yield();
+            }
+        });
+
+        // Each tick must match model A or model B exactly
+        int mismatches = 0;
+        int ticks = 0;
+        for (; ticks < 200000 && (ticks < 20000 || commits.load() < 20); ticks++) {
+            float q[3], expectedA[3], expectedB[3];
+            slots.forward(tickAngle(ticks), tickVelocity(ticks), q);
+            modelA.policy.forward(tickAngle(ticks), tickVelocity(ticks), expectedA);
+            modelB.policy.forward(tickAngle(ticks), tickVelocity(ticks), expectedB);
+            mismatches += !sameQ(q, expectedA) && !sameQ(q, expectedB);
+            if (ticks % 64 == 0) std::this_thread::yield();
+        }
+        running = false;
+        updater.join();
+
+        test::check(mismatches == 0, std::to_string(mismatches) + " ticks matched neither model");
+        test::check(commits.load() >= 2 && slots.swapCount() >= 2, "Updates were swapped in during the run");
+        return std::to_string(ticks) + " ticks, " + std::to_string(slots.swapCount()) + " swaps, 0 torn ticks";
+    });
+
+    return test::summarize();
+}
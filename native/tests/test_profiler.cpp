@@ -0,0 +1,131 @@
+/**
+ * Execution profiler tests
+ *
+ * Built once with DQN_PROFILE defined, from the first model in models/
+ * (DQN_MODEL_FILE, DQN_INT8_MODEL_FILE and DQN_MODEL_BLOB_FILE), and
+ * checks that every policy type records its own inference timings.
+ */
+
+#define DQN_PROFILE
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+
+#include "DQNModelBlob.h"
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+
+#include "TestHarness.h"
+
+namespace {
+
+/**
+ * Serial-like sink: anything with print(const char*)
+ */
+struct StringStream {
+    std::string text;
+    void print(const char* line) { text += line; }
+};
+
+float tickAngle(int t) { return 0.8f * std::sin(0.07f * (float)t); }
+float tickVelocity(int t) { return 6.0f * std::cos(0.11f * (float)t); }
+
+} // namespace
+
+int main() {
+    std::printf("Running Profiler Tests (%s, %s)...\n\n", DQN_MODEL_FILE, dqn::CycleCounter::units());
+
+    test::run("Every Inference Is Recorded", []() {
+        static_assert(std::is_empty<TwoWheelBotDQN>::value, "profiled policy still holds no data");
+        dqn::ExecutionProfile<>& profile = dqn::executionProfile<TwoWheelBotDQN>();
+        dqn::ExecutionProfile<>& int8Profile = dqn::executionProfile<TwoWheelBotDQNInt8>();
+        profile.reset();
+        int8Profile.reset();
+
+        TwoWheelBotDQN bot;
+        TwoWheelBotDQNInt8 int8Bot;
+        for (int t = 0; t < 1000; t++) bot.getAction(tickAngle(t), tickVelocity(t));
+        float q[TwoWheelBotDQN::OUTPUT_SIZE];
+        for (int t = 0; t < 10; t++) bot.forward(tickAngle(t), tickVelocity(t), q);
+        for (int t = 0; t < 500; t++) int8Bot.getAction(tickAngle(t), tickVelocity(t));
+
+        test::check(profile.count() == 1010, "One sample per getAction or forward call");
+        test::check(int8Profile.count() == 500, "int8 policy has its own profile");
+        test::check(profile.min() <= profile.mean() && profile.mean() <= profile.max(), "min <= mean <= max");
+        test::check(profile.max() > 0 && profile.jitter() == profile.max() - profile.min(), "Counter advances");
+
+        uint32_t histogramTotal = 0;
+        for (int b = 0; b < dqn::ExecutionProfile<>::BUCKETS; b++) histogramTotal += profile.bucket(b);
+        test::check(histogramTotal == profile.count(), "Histogram holds every sample");
+        return "float min/mean/max " + std::to_string(profile.min()) + "/" + std::to_string(profile.mean()) + "/" +
+               std::to_string(profile.max()) + " " + dqn::CycleCounter::units();
+    });
+
+    test::run("Profiling Leaves Actions Unchanged", []() {
+        TwoWheelBotDQN bot;
+        for (int t = 0; t < 1000; t++) {
+            float input[2], q[TwoWheelBotDQN::OUTPUT_SIZE], expected[TwoWheelBotDQN::OUTPUT_SIZE];
+            // The export's first layer holds the normalization; its network reads the clamped raw state
+            dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits>::frame(dqn::PolicyInput(tickAngle(t), tickVelocity(t)), input);
+            TwoWheelBotDQN::Network::forward(TwoWheelBotDQNWeights::weights, input, expected);
+            const int action = bot.forward(tickAngle(t), tickVelocity(t), q);
+            test::check(action == dqn::argmax<TwoWheelBotDQN::OUTPUT_SIZE>(expected), "Same action as the bare network");
+        }
+        return std::string("1000 profiled ticks match the network");
+    });
+
+    test::run("Blob Policies Are Profiled", []() {
+        dqn::MappedFile file;
+        dqn::ModelBlob blob;
+        dqn::BlobPolicy policy;
+        test::check(file.open(DQN_MODEL_BLOB_FILE) && blob.bind(file.data(), file.size()) == dqn::BLOB_OK &&
+                    policy.bind(blob), "Blob binds");
+        dqn::executionProfile<dqn::BlobPolicy>().reset();
+        for (int t = 0; t < 200; t++) policy.getAction(tickAngle(t), tickVelocity(t));
+        test::check(dqn::executionProfile<dqn::BlobPolicy>().count() == 200, "BlobPolicy records each tick");
+        return "BlobPolicy mean " + std::to_string(dqn::executionProfile<dqn::BlobPolicy>().mean()) + " " +
+               dqn::CycleCounter::units();
+    });
+
+    test::run("Histogram Buckets And Overflow", []() {
+        dqn::ExecutionProfile<4, 10> profile;
+        test::check(profile.count() == 0 && profile.min() == 0 && profile.mean() == 0, "Empty profile reads zero");
+        const uint32_t samples[5] = {0, 9, 10, 35, 1000};
+        for (int i = 0; i < 5; i++) profile.record(samples[i]);
+        test::check(profile.bucket(0) == 2 && profile.bucket(1) == 1 && profile.bucket(2) == 0, "Linear buckets");
+        test::check(profile.bucket(3) == 2, "Last bucket counts 30 and everything above");
+        test::check(profile.min() == 0 && profile.max() == 1000 && profile.mean() == 210, "Summary statistics");
+
+        profile.reset();
+        profile.record(UINT32_MAX);
+        profile.record(UINT32_MAX);
+        test::check(profile.mean() == UINT32_MAX && profile.bucket(3) == 2, "64-bit total does not overflow");
+        return std::string("4 buckets of 10 cycles");
+    });
+
+    test::run("Report Prints Over Serial", []() {
+        dqn::ExecutionProfile<4, 10> profile;
+        const uint32_t samples[5] = {0, 9, 10, 35, 1000};
+        for (int i = 0; i < 5; i++) profile.record(samples[i]);
+
+        StringStream serial;
+        profile.printTo(serial);
+        const std::string summary = "n=5 min=0 mean=210 max=1000 " + std::string(dqn::CycleCounter::units()) + "\n";
+        test::check(serial.text.compare(0, summary.size(), summary) == 0, "Summary line first");
+        test::check(serial.text.find("       0-9                 2\n") != std::string::npos, "First bucket line");
+        test::check(serial.text.find("      30+                  2\n") != std::string::npos, "Open-ended last bucket");
+
+        size_t lines = 0;
+        for (char c : serial.text) lines += c == '\n';
+        test::check(lines == 5, "Summary plus one line per bucket");
+        return std::to_string(serial.text.size()) + "-byte report";
+    });
+
+    std::printf("TwoWheelBotDQN getAction profile:\n");
+    dqn::executionProfile<TwoWheelBotDQN>().printTo(stdout);
+    std::printf("\n");
+
+    return test::summarize();
+}
@@ -0,0 +1,189 @@
+/**
+ * Hyperparameter search tests
+ *
+ * Checks the rung schedule and the sampled ranges, that the model blob
+ * writer matches ModelBlob.js byte for byte on the first model's blob
+ * (DQN_MODEL_BLOB_FILE), that search results do not depend on the thread
+ * count, that converged trials stop training, and that the winner's blob
+ * runs like the network it was written from.
+ */
+
+#include "CppModelWriter.h"
+#include "DQNModelBlob.h"
+#include "HyperSearch.h"
+#include "ModelBlobWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TestHarness.h"
+
+namespace {
+
+/**
+ * A search small enough for a unit test: 6 trials over rungs of 4, 8 and 16 episodes
+ */
+search::SearchOptions smallSearch() {
+    search::SearchOptions options;
+    options.trials = 6;
+    options.minEpisodes = 4;
+    options.maxEpisodes = 16;
+    options.eta = 2;
+    options.evalSteps = 200;
+    options.base.maxStepsPerEpisode = 100;
+    options.base.hiddenSize = 64;
+    options.space.batchSizeMin = 16;
+    options.space.batchSizeMax = 32;
+    return options;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Hyperparameter Search Tests (%s)...\n\n", DQN_MODEL_BLOB_FILE);
+
+    test::run("Rung Budgets", []() {
+        search::SearchOptions options;
+        test::check(search::rungBudgets(options) == std::vector<int>({20, 60, 180, 540}), "20 x 3^k up to 540");
+        options.maxEpisodes = 100;
+        test::check(search::rungBudgets(options) == std::vector<int>({20, 60, 100}), "Last rung capped");
+        options.minEpisodes = 200;
+        test::check(search::rungBudgets(options) == std::vector<int>({100}), "A single rung at the cap");
+        return std::string("Budgets multiply by eta up to maxEpisodes");
+    });
+
+    test::run("Sampled Hyperparameters Stay In Range", []() {
+        const search::SearchSpace space;
+        const train::Hyperparameters base;
+        dqn::XorShift64 random(7), again(7);
+        double lrMin = 1.0, lrMax = 0.0;
+        for (int i = 0; i < 500; i++) {
+            const train::Hyperparameters p = search::sampleHyperparameters(space, base, random);
+            const train::Hyperparameters q = search::sampleHyperparameters(space, base, again);
+            test::check(p.learningRate >= space.learningRateMin && p.learningRate <= space.learningRateMax,
+                        "Learning rate in range");
+            test::check(p.gamma >= space.gammaMin && p.gamma <= space.gammaMax, "Gamma in range");
+            test::check(p.epsilonMin >= space.epsilonMinMin && p.epsilonMin <= space.epsilonMinMax, "epsilonMin in range");
+            test::check(p.epsilonDecay >= space.epsilonDecayMin && p.epsilonDecay <= space.epsilonDecayMax,
+                        "epsilonDecay in range");
+            test::check(p.batchSize >= 32 && p.batchSize <= 256 && (p.batchSize & (p.batchSize - 1)) == 0,
+                        "Batch size a power of two in range");
+            test::check(p.targetUpdateFreq >= space.targetUpdateMin && p.targetUpdateFreq <= space.targetUpdateMax,
+                        "Target update in range");
+            test::check(p.hiddenSize == base.hiddenSize && p.maxEpisodes == base.maxEpisodes, "Other fields from base");
+            test::check(p.learningRate == q.learningRate && p.batchSize == q.batchSize, "Same seed, same samples");
+            lrMin = std::min(lrMin, p.learningRate);
+            lrMax = std::max(lrMax, p.learningRate);
+        }
+        test::check(lrMin < 2e-4 && lrMax > 1.5e-3, "Learning rates cover the log range");
+        return "learning rates " + std::to_string(lrMin) + " - " + std::to_string(lrMax);
+    });
+
+    test::run("Blob Writer Matches ModelBlob.js", []() {
+        dqn::MappedFile file;
+        dqn::ModelBlob blob;
+        test::check(file.open(DQN_MODEL_BLOB_FILE) && blob.bind(file.data(), file.size()) == dqn::BLOB_OK,
+                    "Reference blob loads");
+        const dqn::ModelBlobHeader& header = blob.header();
+        train::Network network(header.inputSize, header.hiddenSize, header.outputSize);
+        const auto load = [&](std::vector<float>& tensor, uint32_t offset) {
+            std::memcpy(tensor.data(), blob.tensor<float>(offset), tensor.size() * sizeof(float));
+        };
+        load(network.weightsInputHidden, header.weightsInputHiddenOffset);
+        load(network.biasHidden, header.biasHiddenOffset);
+        load(network.weightsHiddenOutput, header.weightsHiddenOutputOffset);
+        load(network.biasOutput, header.biasOutputOffset);
+
+        const std::vector<uint8_t> written = train::formatModelBlob(network);
+        test::check(written.size() == blob.size(), "Same size");
+        test::check(std::memcmp(written.data(), blob.data(), written.size()) == 0, "Same bytes as generateModelBlob");
+        return std::to_string(written.size()) + " bytes, identical";
+    });
+
+    test::run("Search Is Thread-Count Independent", []() {
+        sweep::WorkStealingPool serial(1), parallel(3);
+        search::HyperSearch first(smallSearch()), second(smallSearch());
+        std::vector<size_t> survivors;
+        const search::Trial& a = first.run(serial, [&](int, int, const std::vector<const search::Trial*>& ranked) {
+            survivors.push_back(ranked.size());
+            for (size_t r = 1; r < ranked.size(); r++) {
+                test::check(ranked[r - 1]->evaluation.score >= ranked[r]->evaluation.score, "Ranked best first");
+            }
+        });
+        const search::Trial& b = second.run(parallel);
+
+        test::check(survivors == std::vector<size_t>({6, 3, 1}), "6, 3 and 1 trials per rung");
+        test::check(a.id == b.id && a.evaluation.score == b.evaluation.score, "Same winner and score");
+        for (size_t t = 0; t < first.allTrials().size(); t++) {
+            const search::Trial& x = *first.allTrials()[t];
+            const search::Trial& y = *second.allTrials()[t];
+            test::check(x.rewards == y.rewards && x.evaluation.score == y.evaluation.score,
+                        "Trial " + std::to_string(t) + " trains identically");
+            test::check((x.trainer != nullptr) == (x.id == a.id), "Only the winner keeps its trainer");
+        }
+        test::check(a.episodes() == 16 && first.totalEpisodes() == 6 * 4 + 3 * 4 + 1 * 8, "Pruned trials stop early");
+        return "winner #" + std::to_string(a.id) + ", " + std::to_string(first.totalEpisodes()) + " of " +
+               std::to_string(6 * 16) + " episodes";
+    });
+
+    test::run("Converged Trials Stop Training", []() {
+        search::SearchOptions options = smallSearch();
+        options.trials = 4;
+        options.minEpisodes = 20;
+        options.maxEpisodes = 80;
+        options.convergenceWindow = 10;
+        options.convergenceThreshold = 50.0;  // Simple reward: half of a 100-step episode upright
+        sweep::WorkStealingPool pool(2);
+        search::HyperSearch hyperSearch(options);
+        hyperSearch.run(pool);
+        int converged = 0;
+        for (const std::unique_ptr<search::Trial>& trial : hyperSearch.allTrials()) {
+            if (!trial->converged) continue;
+            converged++;
+            test::check(trial->episodes() == trial->convergenceEpisode && trial->episodes() >= 10,
+                        "Training stops at convergence");
+            test::check(trial->convergenceEpisode < options.maxEpisodes, "Before the last rung's budget");
+            test::check(trial->averageReward(10) >= 50.0, "Converged on the windowed average");
+        }
+        test::check(converged > 0, "Some trial converged");
+        return std::to_string(converged) + " of 4 trials converged";
+    });
+
+    test::run("Winner Blob Runs Like The Network", []() {
+        sweep::WorkStealingPool pool(2);
+        search::HyperSearch hyperSearch(smallSearch());
+        const search::Trial& best = hyperSearch.run(pool);
+        const train::Network& network = best.trainer->network();
+
+        const std::vector<uint8_t> bytes = train::formatModelBlob(network);
+        dqn::ModelBlob blob;
+        dqn::BlobPolicy policy;
+        test::check(blob.bind(bytes.data(), bytes.size()) == dqn::BLOB_OK && policy.bind(blob), "Checkpoint binds");
+
+        // One call over 31 x 16 states: more than the policy's EVAL_LANES scratch rows
+        const search::NetworkPolicy reference(network, dqn::RobotConfig().maxAngle);
+        std::vector<float> angles, velocities;
+        for (int i = 0; i < 31; i++) {
+            for (int j = 0; j < search::EVAL_LANES; j++) {
+                angles.push_back(-0.6f + 0.04f * (float)i);
+                velocities.push_back(-3.0f + 0.4f * (float)j);
+            }
+        }
+        std::vector<int> actions(angles.size(), -1);
+        reference.getActions(angles.data(), velocities.data(), actions.data(), angles.size());
+        int disagreements = 0, states = 0;
+        for (size_t k = 0; k < angles.size(); k++, states++) {
+            policy.reset(angles[k], velocities[k]);
+            disagreements += policy.getAction(angles[k], velocities[k]) != actions[k];
+        }
+        // The blob folds the input scale into float32 products, so only near-ties may flip
+        test::check(disagreements * 100 <= states, std::to_string(disagreements) + " of 496 actions differ");
+        test::check(train::formatCppModel(network, "2026-10-14T06-00-00").find("Architecture: 2-64-3") != std::string::npos,
+                    "Winner exports as C++");
+        return std::to_string(states - disagreements) + " of " + std::to_string(states) + " actions agree";
+    });
+
+    return test::summarize();
+}
@@ -0,0 +1,187 @@
+/**
+ * StateHistory tests
+ *
+ * Checks the policy's ring buffer against a direct port of the simulator's
+ * StateHistory (unshift on add, zero padding, BalancingRobot.reset prefill)
+ * using a synthetic 3-timestep model.
+ */
+
+#include "DQNPolicy.h"
+
+#include <cmath>
+#include <deque>
+#include <string>
+#include <type_traits>
+
+#include "TestHarness.h"
+
+namespace {
+
+const int TIMESTEPS = 3;
+const int IN = TIMESTEPS * 2;
+const int HIDDEN = 8;
+const int OUT = 3;
+
+// Weights chosen so older timesteps change the argmax
+static DQN_FLASH dqn::DQNWeights<IN, HIDDEN, OUT> weights DQN_PROGMEM = {
+    {0.9f, -0.4f, 0.3f, 0.7f, -0.8f, 0.2f, 0.5f, -0.6f,
+     0.4f, 0.6f, -0.7f, 0.1f, 0.3f, -0.5f, 0.8f, 0.2f,
+     -0.6f, 0.5f, 0.4f, -0.3f, 0.7f, 0.6f, -0.2f, 0.9f,
+     0.2f, -0.8f, 0.6f, 0.5f, -0.4f, 0.3f, 0.1f, -0.7f,
+     0.7f, 0.3f, -0.5f, -0.6f, 0.2f, 0.8f, -0.3f, 0.4f,
+     -0.2f, 0.4f, 0.8f, 0.3f, -0.7f, -0.1f, 0.6f, 0.5f},
+    {0.05f, -0.1f, 0.1f, 0.0f, 0.2f, -0.05f, 0.15f, -0.2f},
+    {0.6f, -0.3f, 0.2f, -0.5f, 0.1f, 0.7f, 0.3f, 0.4f, -0.6f, 0.8f, -0.2f, -0.4f,
+     -0.7f, 0.5f, 0.3f, 0.2f, -0.1f, 0.6f, 0.4f, 0.3f, -0.8f, -0.3f, 0.7f, 0.1f},
+    {0.01f, 0.0f, -0.01f}
+};
+
+static DQN_FLASH dqn::DQNQuantizedWeights<IN, HIDDEN, OUT> quantizedWeights DQN_PROGMEM = {
+    {115, -51, 38, 89, -102, 25, 64, -76, 51, 76, -89, 13, 38, -64, 102, 25,
+     -76, 64, 51, -38, 89, 76, -25, 115, 25, -102, 76, 64, -51, 38, 13, -89,
+     89, 38, -64, -76, 25, 102, -38, 51, -25, 51, 102, 38, -89, -13, 76, 64},
+    {100, -200, 200, 0, 400, -100, 300, -400},
+    {76, -38, 25, -64, 13, 89, 38, 51, -76, 102, -25, -51,
+     -89, 64, 38, 25, -13, 76, 51, 38, -102, -38, 89, 13},
+    {20, 0, -20}
+};
+
+typedef dqn::DQNPolicy<IN, HIDDEN, OUT, dqn::ReLU, weights> HistoryPolicy;
+typedef dqn::QuantizedDQNPolicy<IN, HIDDEN, OUT, dqn::ReLU, 4, quantizedWeights> QuantizedHistoryPolicy;
+
+/**
+ * Port of src/physics/StateHistory.js (raw states, normalized on read)
+ */
+struct SimulatorHistory {
+    std::deque<float> angles;
+    std::deque<float> velocities;
+
+    void reset(float angle, float angularVelocity) {
+        angles.clear();
+        velocities.clear();
+        for (int i = 0; i < 8; i++) addState(angle, angularVelocity);
+    }
+
+    void addState(float angle, float angularVelocity) {
+        angles.push_front(angle);
+        velocities.push_front(angularVelocity);
+        if (angles.size() > 8) {
+            angles.pop_back();
+            velocities.pop_back();
+        }
+    }
+
+    void getNormalizedInputs(float* inputs) const {
+        for (int i = 0; i < TIMESTEPS; i++) {
+            const bool known = i < (int)angles.size();
+            inputs[i * 2] = dqn::constrain((known ? angles[i] : 0.0f) * dqn::ANGLE_SCALE, -1.0f, 1.0f);
+            inputs[i * 2 + 1] = dqn::constrain((known ? velocities[i] : 0.0f) * dqn::ANGULAR_VELOCITY_SCALE, -1.0f, 1.0f);
+        }
+    }
+};
+
+/**
+ * Deterministic pseudo-random states spanning the clamp range
+ */
+struct StateSequence {
+    uint32_t seed;
+
+    float next(float range) {
+        seed = seed * 1664525u + 1013904223u;
+        return range * ((float)(seed >> 8) / 8388608.0f - 1.0f);
+    }
+};
+
+int referenceAction(const SimulatorHistory& sim) {
+    float input[IN], q[OUT];
+    sim.getNormalizedInputs(input);
+    HistoryPolicy::Network::forward(weights, input, q);
+    return dqn::argmax<OUT>(q);
+}
+
+int referenceQuantizedAction(const SimulatorHistory& sim) {
+    float input[IN];
+    int8_t quantized[IN];
+    int32_t q[OUT];
+    sim.getNormalizedInputs(input);
+    for (int i = 0; i < IN; i++) quantized[i] = dqn::quantizeInput(input[i] * 127.0f);
+    QuantizedHistoryPolicy::Network::forward(quantizedWeights, quantized, q);
+    return dqn::argmax<OUT>(q);
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running StateHistory Tests...\n\n");
+
+    test::run("Window Order And Padding", []() {
+        dqn::StateHistory<float, TIMESTEPS> history;
+        std::deque<float> expected(TIMESTEPS * 2, 0.0f);
+        for (int tick = 0; tick < 10; tick++) {
+            const float frame[2] = {(float)tick, -(float)tick};
+            const float* window = history.push(frame);
+            expected.push_front(frame[1]);
+            expected.push_front(frame[0]);
+            expected.resize(TIMESTEPS * 2);
+            for (int i = 0; i < TIMESTEPS * 2; i++) {
+                test::check(window[i] == expected[i], "Window matches at tick " + std::to_string(tick));
+            }
+        }
+        return std::string("Newest first, zero padded, wraps without shifting");
+    });
+
+    test::run("Single Timestep Stays Stateless", []() {
+        static_assert(std::is_empty<dqn::StateHistory<float, 1> >::value, "no buffer for one timestep");
+        static_assert(sizeof(HistoryPolicy) == sizeof(dqn::StateHistory<float, TIMESTEPS>), "history is the only state");
+        return "History policy holds " + std::to_string(sizeof(HistoryPolicy)) + " bytes";
+    });
+
+    test::run("Policy Matches Simulator History", []() {
+        StateSequence states = {12345u};
+        int actionChanges = 0;
+        for (int episode = 0; episode < 20; episode++) {
+            HistoryPolicy bot;
+            QuantizedHistoryPolicy int8Bot;
+            SimulatorHistory sim;
+            const float angle = states.next(1.2f);
+            const float angularVelocity = states.next(12.0f);
+            if (episode > 0) {
+                // Episode 0 checks the zero-padded start without reset
+                bot.reset(angle, angularVelocity);
+                int8Bot.reset(angle, angularVelocity);
+                sim.reset(angle, angularVelocity);
+            }
+            int previous = -1;
+            for (int tick = 0; tick < 50; tick++) {
+                const float a = states.next(1.2f);
+                const float v = states.next(12.0f);
+                sim.addState(a, v);
+                const int action = bot.getAction(a, v);
+                test::check(action == referenceAction(sim), "Float action matches at tick " + std::to_string(tick));
+                test::check(int8Bot.getAction(a, v) == referenceQuantizedAction(sim),
+                            "int8 action matches at tick " + std::to_string(tick));
+                actionChanges += previous >= 0 && action != previous;
+                previous = action;
+            }
+        }
+        test::check(actionChanges > 0, "Sequence exercises more than one action");
+        return "1000 ticks agree (" + std::to_string(actionChanges) + " action changes)";
+    });
+
+    test::run("History Affects Action", []() {
+        // Same current state after different histories must be able to differ
+        HistoryPolicy calm, swinging;
+        int differing = 0;
+        StateSequence states = {777u};
+        for (int i = 0; i < 200; i++) {
+            const float a = states.next(1.0f), v = states.next(10.0f);
+            calm.reset(0.0f, 0.0f);
+            swinging.reset(-0.8f, -8.0f);
+            differing += calm.getAction(a, v) != swinging.getAction(a, v);
+        }
+        test::check(differing > 0, "Older timesteps reach the network");
+        return std::to_string(differing) + "/200 states depend on history";
+    });
+
+    return test::summarize();
+}
@@ -0,0 +1,116 @@
+/**
+ * Parameter-sweep runner tests
+ *
+ * Checks grid indexing, that the work-stealing pool runs every job exactly
+ * once, and that sweep results do not depend on the thread count. Built
+ * with the first model in models/ (DQN_MODEL_FILE, DQN_INT8_MODEL_FILE).
+ */
+
+#include DQN_MODEL_FILE
+#include DQN_INT8_MODEL_FILE
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SweepRunner.h"
+#include "TestHarness.h"
+
+namespace {
+
+sweep::Grid smallGrid() {
+    sweep::Grid grid;
+    grid.addAxis("mass", sweep::linspace(0.5, 3.0, 3));
+    grid.addAxis("angleOffset", sweep::linspace(-0.05, 0.05, 2));
+    grid.addAxis("startAngle", sweep::linspace(-0.3, 0.3, 5));
+    return grid;
+}
+
+template <typename Policy>
+std::vector<sweep::Result> collect(const sweep::Grid& grid, int threads) {
+    sweep::WorkStealingPool pool(threads);
+    std::vector<sweep::Result> results;
+    sweep::runSweep<Policy>(grid, 300, 9, pool, [&](const sweep::Result& result) { results.push_back(result); });
+    return results;
+}
+
+bool sameStats(const dqn::EpisodeStats& a, const dqn::EpisodeStats& b) {
+    return a.steps == b.steps && a.failed == b.failed && a.totalReward == b.totalReward &&
+           a.meanAbsAngle == b.meanAbsAngle && a.energy == b.energy;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Sweep Tests...\n\n");
+
+    test::run("Grid Indexing", []() {
+        const sweep::Grid grid = smallGrid();
+        test::check(grid.size() == 30, "Size is the product of the axes");
+        sweep::Grid invalid;
+        test::check(!invalid.addAxis("gravity", sweep::linspace(9.0, 10.0, 2)), "Unknown parameters are rejected");
+        dqn::RobotConfig wheels;
+        test::check(sweep::setParameter(wheels, "wheelMass", 0.5) && sweep::setParameter(wheels, "wheelFriction", 0.1) &&
+                        wheels.wheelMass == 0.5 && wheels.wheelFriction == 0.1,
+                    "Every updateConfig field is sweepable");
+
+        dqn::RobotConfig config;
+        double startAngle, values[3];
+        grid.cell(13, config, startAngle, values);
+        // 13 = mass 1 * 10 + offset 0 * 5 + start 3
+        test::check(values[0] == 1.75 && config.mass == 1.75, "First axis varies slowest");
+        test::check(values[1] == -0.05 && config.angleOffset == -0.05, "Middle axis");
+        test::check(std::fabs(startAngle - 0.15) < 1e-12 && values[2] == startAngle, "startAngle sets the reset angle");
+        return std::string("30 cells, last axis fastest");
+    });
+
+    test::run("Pool Runs Every Job Once", []() {
+        const size_t jobs = 64;
+        std::vector<std::atomic<int>> runs(jobs);
+        for (std::atomic<int>& r : runs) r = 0;
+        sweep::WorkStealingPool pool(4);
+        // Worker 0's share is slow, so the others must steal from it
+        pool.run(jobs, [&](size_t index, int) {
+            if (index < jobs / 4) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            runs[index]++;
+        });
+        for (size_t i = 0; i < jobs; i++) test::check(runs[i] == 1, "Job " + std::to_string(i) + " ran once");
+        test::check(pool.stolen() > 0, "Idle workers steal");
+        return "64 jobs on 4 workers, " + std::to_string(pool.stolen()) + " stolen";
+    });
+
+    test::run("Results Independent Of Thread Count", []() {
+        const sweep::Grid grid = smallGrid();
+        const std::vector<sweep::Result> serial = collect<TwoWheelBotDQN>(grid, 1);
+        const std::vector<sweep::Result> parallel = collect<TwoWheelBotDQN>(grid, 3);
+        test::check(serial.size() == grid.size() && parallel.size() == grid.size(), "Every cell reported");
+        int failed = 0;
+        for (size_t i = 0; i < serial.size(); i++) {
+            test::check(serial[i].index == i && parallel[i].index == i, "Results arrive in cell order");
+            test::check(sameStats(serial[i].stats, parallel[i].stats), "Cell " + std::to_string(i) + " matches");
+            failed += serial[i].stats.failed;
+        }
+        return "30 cells identical on 1 and 3 threads (" + std::to_string(failed) + " fell)";
+    });
+
+    test::run("Cells Match runEpisode", []() {
+        const sweep::Grid grid = smallGrid();
+        const std::vector<sweep::Result> results = collect<TwoWheelBotDQNInt8>(grid, 2);
+        for (size_t i = 0; i < results.size(); i++) {
+            dqn::RobotConfig config;
+            double startAngle;
+            grid.cell(i, config, startAngle, nullptr);
+            dqn::BalancingRobot robot(config, sweep::cellSeed(9, i));
+            robot.reset(dqn::RobotState(startAngle));
+            TwoWheelBotDQNInt8 policy;
+            const dqn::EpisodeStats expected = dqn::runEpisode(robot, policy, 300);
+            test::check(sameStats(results[i].stats, expected), "Cell " + std::to_string(i) + " matches");
+            test::check(results[i].survivalTime == expected.steps * config.timestep, "Survival time in seconds");
+        }
+        return std::string("Sweep cells are plain closed-loop episodes");
+    });
+
+    return test::summarize();
+}
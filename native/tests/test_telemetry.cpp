@@ -0,0 +1,368 @@
+/**
+ * Telemetry tests
+ *
+ * Checks the record format and checksum, the ring's drop and wrap
+ * behaviour with a concurrent drain task, the decoder's resync on damaged
+ * streams, that blob policies without three outputs run unlogged, and
+ * that logs of closed-loop runs of the first model (DQN_MODEL_FILE) replay
+ * through getActions and into the trainer's replay memory exactly as they
+ * were recorded.
+ */
+
+#include DQN_MODEL_FILE
+
+#include "BalancingRobot.h"
+#include "DQNTelemetry.h"
+#include "TelemetryLog.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestHarness.h"
+
+namespace {
+
+dqn::TelemetryRecord makeRecord(uint32_t i) {
+    dqn::TelemetryRecord record;
+    record.sequence = 0;
+    record.action = (uint8_t)(i % 3);
+    record.flags = i == 0 ? dqn::TELEMETRY_RESET : 0;
+    record.angle = 0.001f * (float)i;
+    record.angularVelocity = -0.5f * (float)i;
+    for (int o = 0; o < dqn::TELEMETRY_Q_VALUES; o++) record.qValues[o] = (float)(i * 3 + (uint32_t)o);
+    record.cycles = i;
+    return record;
+}
+
+std::vector<uint8_t> drain(dqn::TelemetryRing<4096>& ring) {
+    std::vector<uint8_t> bytes;
+    const uint8_t* data;
+    size_t size;
+    while ((size = ring.peek(&data)) > 0) {
+        bytes.insert(bytes.end(), data, data + size);
+        ring.consume(size);
+    }
+    return bytes;
+}
+
+typedef dqn::TelemetryPolicy<TwoWheelBotDQN, 4096> LoggedDQN;
+
+/**
+ * Float 2-4-Out blob with arbitrary weights, laid out as ModelBlob.js does
+ */
+std::vector<uint32_t> buildBlob(int outputs) {
+    const int in = 2, hidden = 4;
+    std::vector<float> tensors[5] = {std::vector<float>((size_t)outputs), std::vector<float>((size_t)(in * hidden)),
+                                     std::vector<float>((size_t)hidden), std::vector<float>((size_t)(hidden * outputs)),
+                                     std::vector<float>((size_t)outputs)};
+    for (int t = 0; t < 5; t++) {
+        for (size_t i = 0; i < tensors[t].size(); i++) tensors[t][i] = 0.25f * (float)((i * 7 + (size_t)t) % 9) - 1.0f;
+    }
+
+    dqn::ModelBlobHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "DQNB", 4);
+    header.version = dqn::MODEL_BLOB_VERSION;
+    header.headerSize = sizeof(header);
+    header.inputSize = (uint16_t)in;
+    header.hiddenSize = (uint16_t)hidden;
+    header.outputSize = (uint16_t)outputs;
+    header.historyTimesteps = 1;
+    header.angleScale = dqn::ANGLE_SCALE;
+    header.angularVelocityScale = dqn::ANGULAR_VELOCITY_SCALE;
+    header.weightScaleInputHidden = header.weightScaleHiddenOutput = 1.0f;
+    uint32_t* offsets[5] = {&header.actionTorquesOffset, &header.weightsInputHiddenOffset, &header.biasHiddenOffset,
+                            &header.weightsHiddenOutputOffset, &header.biasOutputOffset};
+    size_t size = sizeof(header);
+    for (int t = 0; t < 5; t++) {
+        size = (size + 15) / 16 * 16;
+        *offsets[t] = (uint32_t)size;
+        size += tensors[t].size() * sizeof(float);
+    }
+    header.totalSize = (uint32_t)size;
+
+    std::vector<uint32_t> words((size + 3) / 4, 0);
+    uint8_t* bytes = (uint8_t*)words.data();
+    std::memcpy(bytes, &header, sizeof(header));
+    for (int t = 0; t < 5; t++) std::memcpy(bytes + *offsets[t], tensors[t].data(), tensors[t].size() * sizeof(float));
+    header.crc = dqn::crc32(bytes + dqn::MODEL_BLOB_CRC_START, size - dqn::MODEL_BLOB_CRC_START);
+    std::memcpy(bytes, &header, sizeof(header));
+    return words;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Telemetry Tests (%s)...\n\n", DQN_MODEL_FILE);
+
+    test::run("Record Format", []() {
+        test::check(dqn::crc16((const uint8_t*)"123456789", 9) == 0x29B1, "CRC-16/CCITT-FALSE check value");
+
+        dqn::TelemetryRecord record = makeRecord(7);
+        record.sequence = 0xBEEF;
+        uint8_t bytes[dqn::TELEMETRY_RECORD_SIZE];
+        dqn::encodeTelemetry(record, bytes);
+        test::check(bytes[0] == dqn::TELEMETRY_SYNC0 && bytes[1] == dqn::TELEMETRY_SYNC1, "Sync bytes first");
+        test::check(bytes[2] == 0xEF && bytes[3] == 0xBE, "Little-endian sequence");
+
+        dqn::TelemetryRecord decoded;
+        test::check(dqn::decodeTelemetry(bytes, decoded), "Decodes");
+        test::check(decoded.sequence == record.sequence && decoded.action == record.action &&
+                        decoded.flags == record.flags && decoded.angle == record.angle &&
+                        decoded.angularVelocity == record.angularVelocity && decoded.cycles == record.cycles &&
+                        std::memcmp(decoded.qValues, record.qValues, sizeof(record.qValues)) == 0,
+                    "Every field survives");
+        for (size_t i = 0; i < dqn::TELEMETRY_RECORD_SIZE; i++) {
+            bytes[i] ^= 0x10;
+            test::check(!dqn::decodeTelemetry(bytes, decoded), "Flipped bit in byte " + std::to_string(i) + " rejected");
+            bytes[i] ^= 0x10;
+        }
+        return std::to_string(dqn::TELEMETRY_RECORD_SIZE) + "-byte records, every single-bit error detected";
+    });
+
+    test::run("Ring Drops When Full And Wraps", []() {
+        dqn::TelemetryRing<8> ring;
+        int accepted = 0;
+        for (uint32_t i = 0; i < 10; i++) accepted += ring.push(makeRecord(i));
+        test::check(accepted == 8 && ring.dropped() == 2 && ring.size() == 8, "Full ring drops without blocking");
+
+        const uint8_t* data;
+        test::check(ring.peek(&data) == 8 * dqn::TELEMETRY_RECORD_SIZE, "Whole ring contiguous");
+        ring.consume(3 * dqn::TELEMETRY_RECORD_SIZE);
+        for (uint32_t i = 10; i < 13; i++) test::check(ring.push(makeRecord(i)), "Freed slots accepted");
+        test::check(ring.peek(&data) == 5 * dqn::TELEMETRY_RECORD_SIZE, "Span stops at the end of the ring");
+
+        uint8_t out[16 * dqn::TELEMETRY_RECORD_SIZE];
+        const size_t n = ring.read(out, sizeof(out) - 1);
+        test::check(n == 8 * dqn::TELEMETRY_RECORD_SIZE && ring.size() == 0, "read() copies across the wrap");
+
+        const uint32_t expected[8] = {3, 4, 5, 6, 7, 10, 11, 12};
+        for (int r = 0; r < 8; r++) {
+            dqn::TelemetryRecord record;
+            test::check(dqn::decodeTelemetry(out + r * dqn::TELEMETRY_RECORD_SIZE, record), "Valid record");
+            test::check(record.cycles == expected[r] && record.sequence == expected[r], "Oldest first, numbered per push");
+        }
+        return std::string("2 drops counted, sequence numbers 8 and 9 missing");
+    });
+
+    test::run("Concurrent Drain", []() {
+        static dqn::TelemetryRing<256> ring;
+        const uint32_t TOTAL = 200000;
+        std::atomic<bool> done(false);
+        std::vector<uint8_t> received;
+
+        std::thread consumer([&]() {
+            const uint8_t* data;
+            size_t chunk = 1;
+            for (;;) {
+                const bool finished = done.load(std::memory_order_acquire);
+                size_t size = ring.peek(&data);
+                // Partial sends, as a UART driver would report them
+                chunk = chunk % 7 + 1;
+                const size_t limit = chunk * dqn::TELEMETRY_RECORD_SIZE;
+                size = size < limit ? size : limit;
+                received.insert(received.end(), data, data + size);
+                ring.consume(size);
+                if (finished && size == 0) break;
+                if (size == 0) std::this_thread::yield();
+            }
+        });
+        for (uint32_t i = 0; i < TOTAL; i++) {
+            ring.push(makeRecord(i));
+            if (i % 16 == 0) std::this_thread::yield();  // Control ticks are spaced out
+        }
+        done.store(true, std::memory_order_release);
+        consumer.join();
+
+        dqn::TelemetryDecoder decoder;
+        dqn::TelemetryRecord record;
+        uint32_t last = 0;
+        bool ordered = true, consistent = true;
+        for (uint8_t byte : received) {
+            if (!decoder.push(byte, record)) continue;
+            ordered = ordered && (decoder.records() == 1 || record.cycles > last);
+            consistent = consistent && record.sequence == (uint16_t)record.cycles &&
+                         record.angularVelocity == -0.5f * (float)record.cycles;
+            last = record.cycles;
+        }
+        test::check(decoder.skippedBytes() == 0, "No torn records");
+        test::check(decoder.records() + ring.dropped() == TOTAL, "Every push delivered or counted as dropped");
+        test::check(ordered && consistent, "Records in order with their own payload");
+        test::check(decoder.lostRecords() == ring.dropped() || last != TOTAL - 1,
+                    "Sequence gaps account for the drops");
+        return std::to_string(decoder.records()) + " delivered, " + std::to_string(ring.dropped()) + " dropped";
+    });
+
+    test::run("Decoder Resynchronizes", []() {
+        dqn::TelemetryRing<16> ring;
+        for (uint32_t i = 0; i < 10; i++) ring.push(makeRecord(i));
+        uint8_t clean[16 * dqn::TELEMETRY_RECORD_SIZE];
+        const size_t size = ring.read(clean, sizeof(clean));
+
+        // Noise before the stream, a corrupted record 2, record 5 cut short, stray sync bytes before record 8
+        const size_t R = dqn::TELEMETRY_RECORD_SIZE;
+        std::vector<uint8_t> stream = {0x00, dqn::TELEMETRY_SYNC0, 0x13, dqn::TELEMETRY_SYNC0};
+        for (size_t r = 0; r < size / R; r++) {
+            std::vector<uint8_t> bytes(clean + r * R, clean + (r + 1) * R);
+            if (r == 2) bytes[9] ^= 0xFF;
+            if (r == 5) bytes.resize(R / 2);
+            if (r == 8) stream.insert(stream.end(), {dqn::TELEMETRY_SYNC0, dqn::TELEMETRY_SYNC1, 0x01});
+            stream.insert(stream.end(), bytes.begin(), bytes.end());
+        }
+
+        dqn::TelemetryDecoder decoder;
+        dqn::TelemetryRecord record;
+        std::vector<uint32_t> seen;
+        for (uint8_t byte : stream) {
+            if (decoder.push(byte, record)) seen.push_back(record.cycles);
+        }
+        const std::vector<uint32_t> expected = {0, 1, 3, 4, 6, 7, 8, 9};
+        test::check(seen == expected, "Every intact record recovered, in order");
+        test::check(decoder.lostRecords() == 2, "Damaged records show up as sequence gaps");
+        test::check(decoder.skippedBytes() > 0, "Damaged bytes skipped");
+        return std::to_string(seen.size()) + "/10 records recovered, " + std::to_string(decoder.skippedBytes()) +
+               " bytes skipped";
+    });
+
+    test::run("Logged Run Replays Through getActions", []() {
+        static LoggedDQN logged;
+        TwoWheelBotDQN plain;
+        train::TelemetryLog log;
+        size_t expectedRecords = 0;
+
+        for (uint64_t seed = 1; seed <= 2; seed++) {
+            dqn::BalancingRobot robotA(dqn::RobotConfig(), seed);
+            dqn::BalancingRobot robotB(dqn::RobotConfig(), seed);
+            robotA.reset(dqn::RobotState(0.15 * (double)seed, -0.4));
+            robotB.reset(dqn::RobotState(0.15 * (double)seed, -0.4));
+            const dqn::EpisodeStats expected = dqn::runEpisode(robotA, plain, 1500);
+            const dqn::EpisodeStats actual = dqn::runEpisode(robotB, logged, 1500);
+            test::check(actual.steps == expected.steps && actual.totalReward == expected.totalReward,
+                        "Logging leaves the episode unchanged");
+            expectedRecords += (size_t)actual.steps;
+
+            // Odd-sized chunks: records span append() calls
+            const std::vector<uint8_t> bytes = drain(logged.telemetry());
+            for (size_t offset = 0; offset < bytes.size(); offset += 45) {
+                log.append(bytes.data() + offset, bytes.size() - offset < 45 ? bytes.size() - offset : 45);
+            }
+        }
+        test::check(logged.telemetry().dropped() == 0 && log.size() == expectedRecords, "Every tick logged");
+        test::check(log.lostRecords() == 0 && log.skippedBytes() == 0, "Clean stream");
+        size_t runs = 0;
+        for (size_t i = 0; i < log.size(); i++) runs += !log.continuesRun(i);
+        test::check(runs == 2, "Runs start at resets");
+
+        std::vector<int> actions(log.size());
+        plain.getActions(log.angles().data(), log.angularVelocities().data(), actions.data(), log.size());
+        test::check(actions == log.actions(), "Batched evaluation reproduces every logged action");
+
+        uint32_t maxCycles = 0;
+        for (const dqn::TelemetryRecord& record : log.records()) {
+            float q[TwoWheelBotDQN::OUTPUT_SIZE];
+            plain.forward(record.angle, record.angularVelocity, q);
+            test::check(std::memcmp(q, record.qValues, sizeof(q)) == 0, "Logged Q-values bit-identical");
+            maxCycles = record.cycles > maxCycles ? record.cycles : maxCycles;
+        }
+        test::check(maxCycles > 0, "Inference time recorded");
+        return std::to_string(log.size()) + " ticks, worst inference " + std::to_string(maxCycles) + " " +
+               dqn::CycleCounter::units();
+    });
+
+    test::run("Blobs Without Three Outputs Are Not Logged", []() {
+        const std::vector<uint32_t> threeWords = buildBlob(3), fiveWords = buildBlob(5);
+        dqn::ModelBlob three, five;
+        test::check(three.bind(threeWords.data(), threeWords.size() * 4) == dqn::BLOB_OK &&
+                        five.bind(fiveWords.data(), fiveWords.size() * 4) == dqn::BLOB_OK,
+                    "Blobs bind");
+        static dqn::TelemetryPolicy<dqn::BlobPolicy, 64> logged;
+        dqn::BlobPolicy plain;
+
+        // The wrapped blob swaps from 3 to 5 outputs, like a DoubleBufferedPolicy update
+        int mismatches = 0;
+        for (const dqn::ModelBlob* blob : {&three, &five}) {
+            logged.wrapped().bind(*blob);
+            plain.bind(*blob);
+            logged.reset(0.1f, 0.0f);
+            plain.reset(0.1f, 0.0f);
+            for (int i = 0; i < 20; i++) {
+                const float angle = 0.05f * (float)(i - 10), velocity = 0.3f * (float)(i % 7) - 1.0f;
+                float q[dqn::TELEMETRY_Q_VALUES], expected[dqn::BLOB_MAX_OUTPUT];
+                mismatches += logged.forward(angle, velocity, q) != plain.forward(angle, velocity, expected);
+                mismatches += std::memcmp(q, expected, sizeof(q)) != 0;
+            }
+        }
+        test::check(mismatches == 0, "Actions and the first Q-values unchanged");
+        test::check(logged.telemetry().size() == 20 && logged.rejectedTicks() == 20,
+                    "3-output ticks logged, 5-output ticks rejected");
+        return std::to_string(logged.telemetry().size()) + " logged, " + std::to_string(logged.rejectedTicks()) +
+               " rejected";
+    });
+
+    test::run("Log Seeds The Replay Memory", []() {
+        static LoggedDQN logged;
+        dqn::RobotConfig config;
+        config.rewardType = dqn::REWARD_COMPLEX;
+        config.motorTorqueRange = 0.5;  // Too weak to catch the start angle, so the run ends in a fall
+        config.offsetChangeRate = 0.0;  // No sensor drift: measured angle == true angle, so the
+        config.offsetVariation = 0.0;   // rewards from the log are the simulator's
+        dqn::BalancingRobot robot(config, 3);
+        robot.reset(dqn::RobotState(0.6, 0.5));
+
+        // The transitions DQNTrainer::runEpisode would store for the same run
+        std::vector<float> states, nextStates, rewards;
+        std::vector<int> actions;
+        std::vector<bool> dones;
+        float state[2], next[2];
+        robot.normalizedInputs(state);
+        logged.reset((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+        for (int step = 0; step < 1000; step++) {
+            const int action = logged.getAction((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+            const dqn::StepResult result = robot.step((double)train::ACTIONS[action]);
+            robot.normalizedInputs(next);
+            states.insert(states.end(), state, state + 2);
+            nextStates.insert(nextStates.end(), next, next + 2);
+            actions.push_back(action);
+            rewards.push_back((float)result.reward);
+            dones.push_back(result.done);
+            state[0] = next[0];
+            state[1] = next[1];
+            if (result.done) break;
+        }
+        // The control loop keeps ticking after the fall, so the fallen state is logged too
+        logged.getAction((float)robot.measuredAngle(), (float)robot.state().angularVelocity);
+        test::check(robot.hasFailed(), "Run ends in a fall");
+
+        train::TelemetryLog log;
+        const std::vector<uint8_t> bytes = drain(logged.telemetry());
+        log.append(bytes.data(), bytes.size());
+
+        train::Hyperparameters params;
+        params.hiddenSize = 64;
+        train::DQNTrainer trainer(2, params, 1);
+        const int stored = train::replayTelemetry(trainer, log, config);
+        const train::ReplayBuffer& replay = trainer.replayBuffer();
+        test::check(stored == (int)actions.size() && replay.size() == stored, "One transition per step");
+        test::check(trainer.getStepCount() == 0 && trainer.getBatchCount() == 0, "Stored without training");
+
+        float maxError = 0.0f;
+        for (int k = 0; k < stored; k++) {
+            test::check(replay.action(k) == actions[k] && replay.done(k) == dones[k], "Action and terminal flag");
+            for (int i = 0; i < 2; i++) {
+                maxError = std::fmax(maxError, std::fabs(replay.state(k)[i] - states[k * 2 + i]));
+                maxError = std::fmax(maxError, std::fabs(replay.nextState(k)[i] - nextStates[k * 2 + i]));
+            }
+            maxError = std::fmax(maxError, std::fabs(replay.reward(k) - rewards[k]));
+        }
+        // Logged angles are float32, the simulator's are double
+        test::check(maxError < 1e-5f, "Same states and rewards as live training (max error " +
+                                          std::to_string(maxError) + ")");
+        return std::to_string(stored) + " transitions, max error " + std::to_string(maxError);
+    });
+
+    return test::summarize();
+}
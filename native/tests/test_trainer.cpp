@@ -0,0 +1,397 @@
+/**
+ * Native trainer tests
+ *
+ * Checks the replay ring, the batched forward and backward passes against
+ * per-sample reference code, the QLearning.js schedules, and that exports
+ * match CppExporter.generateCppCode byte for byte. Counts heap allocations
+ * to hold training steps to zero.
+ */
+
+#define TRAIN_COUNT_ALLOCATIONS
+#include "AllocationCounter.h"
+#include "Arena.h"
+#include "CppModelWriter.h"
+#include "DQNTrainer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TestHarness.h"
+
+namespace {
+
+// node: generateCppCode(GOLDEN_WEIGHTS, {2, 4, 3}, '2026-10-14T06-00-00'),
+// weights stored as Float32Array like CPUBackend.getWeights()
+const char* const GOLDEN_EXPORT = R"cpp(/**
+ * Two-Wheel Balancing Robot DQN Model
+ * Generated: 2026-10-14T06-00-00
+ * Architecture: 2-4-3
+ * History timesteps: 1
+ * Normalization: maxAngle 1.04719758 rad, maxAngularVelocity 10.0 rad/s
+ *
+ * This file contains the trained neural network weights for deployment
+ * on embedded systems (Arduino, ESP32, STM32, etc.)
+ *
+ * Inference code lives in DQNPolicy.h (native/include/ in the simulator
+ * repository); copy it next to this file. Weights live in flash only and
+ * TwoWheelBotDQN instances hold no data.
+ */
+
+#include "DQNPolicy.h"
+
+// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+
+namespace TwoWheelBotDQNWeights {
+    static const int INPUT_SIZE = 2;
+    static const int HIDDEN_SIZE = 4;
+    static const int OUTPUT_SIZE = 3;
+
+    // Inputs are clamped to these limits (rad, rad/s); the first layer holds the 1 / limit normalization
+    struct InputLimits {
+        static constexpr float maxAngle() { return 1.04719758f; }
+        static constexpr float maxAngularVelocity() { return 10.0f; }
+    };
+
+    // Network weights (stored in program memory to save RAM)
+    static DQN_FLASH dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM = {
+        // weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]
+        {
+            0.238732412f, -0.00746038789f, 0.00746038789f, 0.0954929665f, -0.0300000012f, 0.25f, 0.0f, -9.99999944e-11f
+        },
+        // biasHidden[HIDDEN_SIZE]
+        {
+            0.010000f, 0.010000f, -0.023438f, 0.123457f
+        },
+        // weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]
+        {
+            1.000000f, 2.000000f, 3.000000f, 4.000000f, 5.000000f, 6.000000f, 7.000000f, 8.000000f,
+            9.000000f, 10.000000f, -9.999999f, 0.000000f
+        },
+        // biasOutput[OUTPUT_SIZE]
+        {
+            0.000000f, -0.500000f, 0.750000f
+        }
+    };
+}
+
+typedef dqn::DQNPolicy<TwoWheelBotDQNWeights::INPUT_SIZE,
+                       TwoWheelBotDQNWeights::HIDDEN_SIZE,
+                       TwoWheelBotDQNWeights::OUTPUT_SIZE,
+                       dqn::ReLU,
+                       TwoWheelBotDQNWeights::weights,
+                       dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> > TwoWheelBotDQN;
+
+#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
+
+// Usage example:
+// TwoWheelBotDQN bot;
+// int action = bot.getAction(angle, angularVelocity);
+// float torque = bot.getMotorTorque(action);
+)cpp";
+
+train::Network goldenNetwork() {
+    train::Network network(2, 4, 3);
+    network.weightsInputHidden = {0.25f, -1.0f / 128, 1.0f / 128, 0.1f, -0.3f, 2.5f, -0.0f, -1e-9f};
+    network.biasHidden = {0.01f, 0.01f, -0.0234375f, 0.123456789f};
+    network.weightsHiddenOutput = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -9.999999f, 0.0000005f};
+    network.biasOutput = {0.0f, -0.5f, 0.75f};
+    return network;
+}
+
+train::Hyperparameters smallParams() {
+    train::Hyperparameters params;
+    params.hiddenSize = 64;
+    params.batchSize = 16;
+    params.learningRate = 0.002;
+    params.gamma = 0.95;
+    params.targetUpdateFreq = 10;
+    return params;
+}
+
+/**
+ * Fill the trainer's replay memory with transitions from a scripted walk
+ */
+void fillReplay(train::DQNTrainer& trainer, int count) {
+    dqn::XorShift64 random(7);
+    float state[2], next[2];
+    for (int i = 0; i < count; i++) {
+        state[0] = (float)(random.next() * 2.0 - 1.0);
+        state[1] = (float)(random.next() * 2.0 - 1.0);
+        next[0] = (float)(random.next() * 2.0 - 1.0);
+        next[1] = (float)(random.next() * 2.0 - 1.0);
+        trainer.train(state, i % 3, i % 7 == 0 ? -10.0 : 1.0, next, i % 7 == 0);
+    }
+}
+
+/**
+ * Greedy episode length from a start angle
+ */
+int greedySteps(const train::DQNTrainer& trainer, double startAngle, int maxSteps) {
+    dqn::BalancingRobot robot;
+    robot.reset(dqn::RobotState(startAngle));
+    float inputs[2];
+    for (int step = 0; step < maxSteps; step++) {
+        robot.normalizedInputs(inputs);
+        if (robot.step((double)train::ACTIONS[trainer.greedyAction(inputs)]).done) return step + 1;
+    }
+    return maxSteps;
+}
+
+} // namespace
+
+int main() {
+    std::printf("Running Trainer Tests...\n\n");
+
+    test::run("Replay Ring Overwrites Oldest", []() {
+        train::ReplayBuffer replay(2, 5);
+        for (int i = 0; i < 7; i++) {
+            const float state[2] = {(float)i, -(float)i};
+            const float next[2] = {(float)i + 0.5f, 0.0f};
+            replay.add(state, i % 3, (float)i * 10.0f, next, i == 6);
+        }
+        test::check(replay.size() == 5, "Size stops at capacity");
+        // Slots 0 and 1 now hold transitions 5 and 6
+        test::check(replay.state(0)[0] == 5.0f && replay.state(1)[1] == -6.0f, "Oldest slots overwritten");
+        test::check(replay.nextState(1)[0] == 6.5f && replay.reward(1) == 60.0f, "Next state and reward");
+        test::check(replay.action(1) == 0 && replay.done(1) && !replay.done(2), "Action and done flags");
+        test::check(replay.state(4)[0] == 4.0f, "Untouched slots keep their transition");
+        return std::string("7 adds into 5 slots");
+    });
+
+    test::run("Sampling Draws Distinct Slots", []() {
+        train::ReplayBuffer replay(2, 300);
+        const float state[2] = {0.0f, 0.0f};
+        for (int i = 0; i < 200; i++) replay.add(state, 0, 0.0f, state, false);
+        dqn::XorShift64 random(3);
+        int indices[128];
+        for (int round = 0; round < 50; round++) {
+            test::check(replay.sample(128, random, indices) == 128, "Full batch");
+            std::vector<int> seen(200, 0);
+            for (int i = 0; i < 128; i++) {
+                test::check(indices[i] >= 0 && indices[i] < 200, "Index inside the stored range");
+                test::check(seen[indices[i]]++ == 0, "No slot drawn twice");
+            }
+        }
+        int all[256];
+        test::check(replay.sample(256, random, all) == 200 && all[199] == 199, "Small buffers return every slot");
+        return std::string("50 batches of 128 from 200");
+    });
+
+    test::run("Batched Forward Matches Rows", []() {
+        train::Network network(4, 70, 3);
+        dqn::XorShift64 random(11);
+        network.initialize(random);
+        const int rows = 9;
+        std::vector<float> inputs(rows * 4), hidden(rows * 70), q(rows * 3);
+        for (float& x : inputs) x = (float)(random.next() * 2.0 - 1.0);
+        network.forward(inputs.data(), rows, hidden.data(), q.data());
+
+        for (int r = 0; r < rows; r++) {
+            float h[70], single[3];
+            network.forward(&inputs[r * 4], 1, h, single);
+            for (int a = 0; a < 3; a++) test::check(single[a] == q[r * 3 + a], "Row " + std::to_string(r) + " Q-value");
+            // Plain CPUBackend.forward order as reference
+            for (int a = 0; a < 3; a++) {
+                double sum = network.biasOutput[a];
+                for (int j = 0; j < 70; j++) {
+                    double z = network.biasHidden[j];
+                    for (int i = 0; i < 4; i++) z += (double)inputs[r * 4 + i] * (double)network.weightsInputHidden[i * 70 + j];
+                    sum += (z > 0.0 ? z : 0.0) * (double)network.weightsHiddenOutput[j * 3 + a];
+                }
+                test::check(std::fabs(sum - (double)q[r * 3 + a]) < 1e-4, "Matches a per-neuron forward pass");
+            }
+        }
+        return std::string("9 rows through a 4-70-3 network");
+    });
+
+    test::run("Minibatch Step Matches Per-Sample Gradients", []() {
+        train::DQNTrainer trainer(2, smallParams(), 5);
+        // Fewer than batchSize transitions: no training yet
+        fillReplay(trainer, 15);
+        test::check(trainer.getBatchCount() == 0, "No batch before batchSize transitions");
+
+        const train::Network before = trainer.network();
+        const train::Network& target = trainer.targetNetwork();
+        const train::ReplayBuffer& replay = trainer.replayBuffer();
+        const int slots[] = {3, 0, 14, 7, 7, 9};
+        const int count = 6;
+
+        // QLearning._updateNetwork per sample, all from the pre-step weights
+        const int H = before.hiddenSize;
+        std::vector<double> gW1(2 * H, 0.0), gB1(H, 0.0), gW2(H * 3, 0.0), gB2(3, 0.0);
+        double lossSum = 0.0;
+        for (int b = 0; b < count; b++) {
+            const int slot = slots[b];
+            float h[256], q[3], nh[256], nq[3];
+            before.forward(replay.state(slot), 1, h, q);
+            target.forward(replay.nextState(slot), 1, nh, nq);
+            double targetQ = replay.reward(slot);
+            if (!replay.done(slot)) targetQ += 0.95 * (double)std::max(nq[0], std::max(nq[1], nq[2]));
+            const int action = replay.action(slot);
+            const double td = std::max(-5.0, std::min(5.0, targetQ - (double)q[action]));
+            lossSum += std::fabs(td) <= 1.0 ? 0.5 * td * td : std::fabs(td) - 0.5;
+            const auto clip = [](double g) { return std::max(-0.5, std::min(0.5, g)); };
+            for (int j = 0; j < H; j++) {
+                const double hj = h[j];
+                gW2[j * 3 + action] += clip(td * hj);
+                const double e = hj > 0.0 ? td * (double)before.weightsHiddenOutput[j * 3 + action] : 0.0;
+                for (int i = 0; i < 2; i++) gW1[i * H + j] += clip(e * (double)replay.state(slot)[i]);
+                gB1[j] += clip(e);
+            }
+            gB2[action] += clip(td);
+        }
+
+        const double loss = trainer.learn(slots, count);
+        test::check(std::fabs(loss - lossSum / count) < 1e-5, "Mean Huber loss");
+        const train::Network& after = trainer.network();
+        const auto expectWeight = [](float w, double g) { return std::max(-10.0, std::min(10.0, (double)w + 0.002 * g)); };
+        for (int k = 0; k < 2 * H; k++) {
+            test::check(std::fabs((double)after.weightsInputHidden[k] - expectWeight(before.weightsInputHidden[k], gW1[k])) < 1e-6,
+                        "Input weight " + std::to_string(k));
+        }
+        for (int k = 0; k < H * 3; k++) {
+            test::check(std::fabs((double)after.weightsHiddenOutput[k] - expectWeight(before.weightsHiddenOutput[k], gW2[k])) < 1e-6,
+                        "Output weight " + std::to_string(k));
+        }
+        for (int k = 0; k < H; k++) {
+            test::check(std::fabs((double)after.biasHidden[k] - expectWeight(before.biasHidden[k], gB1[k])) < 1e-6, "Hidden bias");
+        }
+        for (int a = 0; a < 3; a++) {
+            test::check(std::fabs((double)after.biasOutput[a] - expectWeight(before.biasOutput[a], gB2[a])) < 1e-6, "Output bias");
+        }
+        return std::string("6-sample batch, loss ") + std::to_string(loss);
+    });
+
+    test::run("Target Network Syncs Every targetUpdateFreq Batches", []() {
+        train::DQNTrainer trainer(2, smallParams(), 9);
+        fillReplay(trainer, 16 + 8);  // 9 batches
+        test::check(trainer.getBatchCount() == 9, "One batch per step once the buffer holds batchSize");
+        test::check(trainer.targetNetwork().weightsHiddenOutput != trainer.network().weightsHiddenOutput,
+                    "Target lags the online network");
+        fillReplay(trainer, 1);  // 10th batch
+        test::check(trainer.targetNetwork().weightsHiddenOutput == trainer.network().weightsHiddenOutput &&
+                        trainer.targetNetwork().weightsInputHidden == trainer.network().weightsInputHidden,
+                    "Synced after 10 batches");
+        return std::string("Synced at batch 10");
+    });
+
+    test::run("Epsilon Decays Linearly", []() {
+        train::Hyperparameters params = smallParams();
+        params.epsilon = 0.5;
+        params.epsilonMin = 0.05;
+        params.epsilonDecay = 1000;
+        train::DQNTrainer trainer(2, params, 1);
+        fillReplay(trainer, 250);
+        test::check(std::fabs(trainer.getEpsilon() - (0.5 + 0.25 * (0.05 - 0.5))) < 1e-12, "Quarter way down");
+        fillReplay(trainer, 750);
+        test::check(trainer.getEpsilon() == 0.05, "At epsilonMin after epsilonDecay steps");
+
+        train::Hyperparameters wild;
+        wild.hiddenSize = 8;
+        wild.epsilonDecay = 0;
+        wild.learningRate = 1.0;
+        const train::Hyperparameters clamped = train::clampHyperparameters(wild);
+        test::check(clamped.hiddenSize == 64 && clamped.epsilonDecay == 1000 && clamped.learningRate == 0.01,
+                    "QLearning.js ranges");
+        return std::string("0.5 -> 0.05 over 1000 steps");
+    });
+
+    test::run("Arena Sized From Architecture", []() {
+        train::Arena measure;
+        test::check(measure.allocate<float>(10) == nullptr && measure.used() == 40, "Measuring arena only counts");
+        test::check(measure.allocate<int>(1) == nullptr && measure.used() == 68, "Allocations start on 64 bytes");
+
+        train::Arena arena(100);
+        float* a = arena.allocate<float>(3);
+        int* b = arena.allocate<int>(5);
+        test::check(a && b && (uintptr_t)a % 64 == 0 && (uintptr_t)b % 64 == 0, "Aligned pointers");
+        test::check(arena.allocate<float>(1) == nullptr, "Null once the block is used up");
+
+        const size_t base = train::DQNTrainer::scratchBytes(2, 64, 16);
+        test::check(train::DQNTrainer::scratchBytes(2, 128, 16) > base, "Grows with hidden size");
+        test::check(train::DQNTrainer::scratchBytes(2, 64, 128) > base, "Grows with batch size");
+        test::check(train::DQNTrainer::scratchBytes(16, 64, 16) > base, "Grows with input size");
+        const size_t floats = 16 * (2 + 2 + 64 + 3 + 64 + 3 + 1 + 64) + 2 * 64 + 64 + 64 * 3 + 3 + 64;
+        test::check(base >= floats * 4 + 16 * 4 && base < floats * 4 + 16 * 4 + 14 * 64, "Sized to the buffers plus padding");
+        return std::to_string(train::DQNTrainer::scratchBytes(2, 128, 128)) + " bytes for the 2-128-3, batch 128 default";
+    });
+
+    test::run("Training Steps Allocate Nothing", []() {
+        {
+            const size_t before = train::allocationCount();
+            // A direct call, since new-expressions may be elided
+            void* probe = ::operator new(16);
+            ::operator delete(probe);
+            const size_t counted = train::allocationCount() - before;
+            test::check(counted == 1, "Counter sees heap allocations");
+        }
+
+        train::Hyperparameters params = smallParams();
+        params.maxStepsPerEpisode = 500;
+        train::DQNTrainer trainer(4, params, 3);
+        dqn::BalancingRobot robot(dqn::RobotConfig(), 3);
+        trainer.runEpisode(robot, 2);  // Fills the replay memory past batchSize
+
+        const size_t before = train::allocationCount();
+        int steps = 0;
+        for (int e = 0; e < 40; e++) steps += trainer.runEpisode(robot, 2).steps;
+        const size_t allocations = train::allocationCount() - before;
+
+        test::check(trainer.getBatchCount() > 2 * params.targetUpdateFreq, "Covers target syncs");
+        test::check(allocations == 0, std::to_string(allocations) + " allocations in " + std::to_string(steps) + " steps");
+        return std::to_string(steps) + " training steps, " + std::to_string(trainer.getBatchCount()) +
+               " batches, 0 allocations";
+    });
+
+    test::run("Export Matches CppExporter", []() {
+        const std::string code = train::formatCppModel(goldenNetwork(), "2026-10-14T06-00-00");
+        test::check(code == GOLDEN_EXPORT, "Byte-identical to generateCppCode");
+        test::check(train::formatWeight(0.0078125f) == "0.007813f" && train::formatWeight(-0.0078125f) == "-0.007813f",
+                    "Ties round away from zero like toFixed");
+        test::check(train::formatWeight(-0.0f) == "0.000000f" && train::formatWeight(-1e-9f) == "-0.000000f",
+                    "Signed zeros like toFixed");
+        test::check(train::formatFloat(10.0f) == "10.0f" && train::formatFloat(0.25f) == "0.25f" &&
+                        train::formatFloat(-0.0f) == "0.0f" && train::formatFloat(1e-7f) == "1.00000001e-7f" &&
+                        train::formatFloat(-1e-10f) == "-1.00000001e-10f" && train::formatFloat(1.5e-6f) == "0.00000150000005f" &&
+                        train::formatFloat(123456789012.0f) == "123456791000.0f" && train::formatFloat(1.5e22f) == "1.49999997e+22f",
+                    "Folded weights like formatFloat");
+
+        train::Network history(6, 64, 3);
+        const std::string historyCode = train::formatCppModel(history, "2026-10-14T06-00-00");
+        test::check(historyCode.find(" * History timesteps: 3\n") != std::string::npos &&
+                        historyCode.find("// bot.reset(angle, angularVelocity);  // fill the 3-step history\n") !=
+                            std::string::npos,
+                    "History models get the reset example");
+        test::check(train::exportTimestamp(0) == "1970-01-01T00-00-00", "Timestamp format");
+        return std::string("2-4-3 export identical");
+    });
+
+    test::run("Training Learns To Balance", []() {
+        train::Hyperparameters params = smallParams();
+        params.batchSize = 32;
+        params.targetUpdateFreq = 100;
+        params.maxStepsPerEpisode = 1000;
+        train::DQNTrainer trainer(2, params, 1);
+        dqn::BalancingRobot robot(dqn::RobotConfig(), 1);
+
+        const double starts[] = {-0.2, -0.05, 0.05, 0.2};
+        int untrained = 0;
+        for (double start : starts) untrained += greedySteps(trainer, start, 2000);
+        for (int e = 0; e < 600; e++) trainer.runEpisode(robot);
+        int trained = 0;
+        for (double start : starts) trained += greedySteps(trainer, start, 2000);
+
+        test::check(trained > 4 * untrained && trained >= 4000, "Greedy policy survives far longer after training");
+        return "greedy steps from 4 starts: " + std::to_string(untrained) + " -> " + std::to_string(trained);
+    });
+
+    return test::summarize();
+}
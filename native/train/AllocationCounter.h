@@ -0,0 +1,68 @@
+/**
+ * Global heap allocation counter
+ *
+ * Define TRAIN_COUNT_ALLOCATIONS in exactly one translation unit before
+ * including this header to replace the global operator new/delete with
+ * versions that count every allocation; allocationCount() then reports
+ * the running total. Without the definition nothing is replaced and
+ * allocationCount() stays 0, so code can call it unconditionally.
+ *
+ *   const size_t before = train::allocationCount();
+ *   trainer.runEpisode(robot);
+ *   // train::allocationCount() - before == 0
+ *
+ * Host only; C++11.
+ */
+
+#ifndef TWOWHEELBOT_ALLOCATION_COUNTER_H
+#define TWOWHEELBOT_ALLOCATION_COUNTER_H
+
+#include <stddef.h>
+
+#include <atomic>
+
+namespace train {
+
+inline std::atomic<size_t>& allocationCounter() {
+    static std::atomic<size_t> count(0);
+    return count;
+}
+
+/**
+ * Heap allocations since startup (0 unless TRAIN_COUNT_ALLOCATIONS)
+ */
+inline size_t allocationCount() { return allocationCounter().load(std::memory_order_relaxed); }
+
+} // namespace train
+
+#ifdef TRAIN_COUNT_ALLOCATIONS
+
+#include <stdlib.h>
+
+#include <new>
+
+// new and delete stay out of line: inlined, GCC would pair malloc() and
+// free() with the new-expressions and warn about mismatches
+__attribute__((noinline)) void* operator new(size_t size) {
+    train::allocationCounter().fetch_add(1, std::memory_order_relaxed);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    train::allocationCounter().fetch_add(1, std::memory_order_relaxed);
+    return malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { operator delete(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { operator delete(p); }
+
+#endif // TRAIN_COUNT_ALLOCATIONS
+
+#endif // TWOWHEELBOT_ALLOCATION_COUNTER_H
@@ -0,0 +1,74 @@
+/**
+ * Bump allocator for the trainer's scratch buffers
+ *
+ * Every per-step buffer comes out of one block allocated at startup. The
+ * block is sized by running the same carving code against a measuring
+ * arena first:
+ *
+ *   train::Arena measure;            // no storage, only counts bytes
+ *   layout(measure);
+ *   train::Arena arena(measure.used());
+ *   layout(arena);                   // same requests, real pointers
+ *
+ * Allocations are 64-byte aligned (a cache line, and enough for any SIMD
+ * load) and live until the arena is destroyed; there is no free.
+ *
+ * Host only; C++11.
+ */
+
+#ifndef TWOWHEELBOT_TRAIN_ARENA_H
+#define TWOWHEELBOT_TRAIN_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+namespace train {
+
+class Arena {
+public:
+    static const size_t ALIGNMENT = 64;
+
+    /**
+     * Measuring arena: allocate() returns null and only advances used()
+     */
+    Arena() : base(nullptr), capacity(0), offset(0) {}
+
+    explicit Arena(size_t bytes) : storage(new unsigned char[bytes + ALIGNMENT]), capacity(bytes), offset(0) {
+        const uintptr_t address = (uintptr_t)storage.get();
+        base = storage.get() + ((ALIGNMENT - address % ALIGNMENT) % ALIGNMENT);
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @return count uninitialized Ts, or null when measuring or out of space
+     */
+    template <typename T>
+    T* allocate(size_t count) {
+        const size_t start = (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        const size_t end = start + count * sizeof(T);
+        offset = end;
+        if (!base || end > capacity) return nullptr;
+        return reinterpret_cast<T*>(base + start);
+    }
+
+    /**
+     * Bytes handed out so far, including alignment padding
+     */
+    size_t used() const { return offset; }
+    size_t size() const { return capacity; }
+    bool measuring() const { return !base; }
+
+private:
+    std::unique_ptr<unsigned char[]> storage;
+    unsigned char* base;
+    size_t capacity;
+    size_t offset;
+};
+
+} // namespace train
+
+#endif // TWOWHEELBOT_TRAIN_ARENA_H
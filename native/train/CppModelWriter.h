@@ -0,0 +1,248 @@
+/**
+ * Export a trained network as TwoWheelBotDQN C++ source
+ *
+ * Produces byte for byte what CppExporter.generateCppCode writes for the
+ * default input-major layout, so the file imports in the simulator
+ * (parseCppModel), re-exports with reexport.js (--int8, --layout) and
+ * compiles against DQNPolicy.h like a browser export.
+ *
+ * Host only; C++11.
+ */
+
+#ifndef TWOWHEELBOT_CPP_MODEL_WRITER_H
+#define TWOWHEELBOT_CPP_MODEL_WRITER_H
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "DQNTrainer.h"
+
+namespace train {
+
+/**
+ * Format a weight like JavaScript's Number.toFixed(6)
+ * toFixed rounds exact ties away from zero where printf rounds them to
+ * even, and prints -0 as 0.
+ */
+inline std::string formatWeight(float weight) {
+    const double value = weight == 0.0f ? 0.0 : (double)weight;
+    char text[48];
+    // Float values times 2e6 are exact in double, so ties are detectable
+    const double twice = fabs(value) * 2e6;
+    if (twice == floor(twice) && fmod(twice, 2.0) == 1.0 && twice < 9e15) {
+        const long long units = ((long long)twice + 1) / 2;
+        snprintf(text, sizeof(text), "%s%lld.%06lldf", value < 0.0 ? "-" : "", units / 1000000, units % 1000000);
+    } else {
+        snprintf(text, sizeof(text), "%.6ff", value);
+    }
+    return text;
+}
+
+/**
+ * Format a float like CppExporter.formatFloat: JavaScript's
+ * Number(toPrecision(9)).toString() plus ".0" when needed and the f suffix
+ * toPrecision rounds exact ties away from zero, so rounding works on the
+ * exact decimal expansion printf gives for a float.
+ */
+inline std::string formatFloat(float value) {
+    if (value == 0.0f) return "0.0f";
+    char exact[64];
+    snprintf(exact, sizeof(exact), "%.40e", fabs((double)value));
+
+    // exact = "d.dddd...e+XX": round the mantissa to 9 significant digits
+    std::string digits(1, exact[0]);
+    const char* e = strchr(exact, 'e');
+    digits.append(exact + 2, (size_t)(e - (exact + 2)));
+    int exponent = atoi(e + 1);
+    const bool roundUp = digits[9] >= '5';
+    digits.resize(9);
+    if (roundUp) {
+        int i = 8;
+        while (i >= 0 && digits[i] == '9') digits[i--] = '0';
+        if (i < 0) {
+            digits.insert(digits.begin(), '1');
+            digits.resize(9);
+            exponent++;
+        } else {
+            digits[i]++;
+        }
+    }
+    while (digits.size() > 1 && digits.back() == '0') digits.pop_back();
+
+    // Number.prototype.toString: positional for 1e-7 < |value| < 1e21
+    const int k = (int)digits.size();
+    const int n = exponent + 1;
+    std::string text = value < 0.0f ? "-" : "";
+    if (n >= k && n <= 21) {
+        text += digits + std::string(n - k, '0');
+    } else if (n > 0 && n <= 21) {
+        text += digits.substr(0, n) + "." + digits.substr(n);
+    } else if (n > -6 && n <= 0) {
+        text += "0." + std::string(-n, '0') + digits;
+    } else {
+        text += digits.substr(0, 1) + (k > 1 ? "." + digits.substr(1) : "") + "e" + (n - 1 > 0 ? "+" : "-") +
+                std::to_string(abs(n - 1));
+    }
+    return text + (text.find_first_of(".e") == std::string::npos ? ".0f" : "f");
+}
+
+/**
+ * Input limits the network was trained with (CppExporter normalization)
+ */
+struct Normalization {
+    double maxAngle;
+    double maxAngularVelocity;
+
+    Normalization(double maxAngle = dqn::SIM_PI / 3.0, double maxAngularVelocity = 10.0)
+        : maxAngle(maxAngle), maxAngularVelocity(maxAngularVelocity) {}
+};
+
+/**
+ * CppExporter.formatWeights inside formatWeightTable: eight literals per
+ * line, each table a commented brace-enclosed initializer
+ */
+inline std::string formatWeightTable(const std::string& label, const std::vector<float>& weights,
+                                     std::string (*format)(float) = formatWeight) {
+    std::string out = "        // " + label + "\n        {\n";
+    for (size_t i = 0; i < weights.size(); i += 8) {
+        if (i > 0) out += ",\n";
+        out += "            ";
+        for (size_t j = i; j < i + 8 && j < weights.size(); j++) {
+            if (j > i) out += ", ";
+            out += format(weights[j]);
+        }
+    }
+    return out + "\n        }";
+}
+
+/**
+ * CppExporter.foldNormalization: first-layer weights over raw (clamped)
+ * inputs, divided in double like the JavaScript numbers
+ */
+inline std::vector<float> foldNormalization(const Network& network, const Normalization& normalization) {
+    std::vector<float> folded(network.weightsInputHidden.size());
+    for (int i = 0; i < network.inputSize; i++) {
+        const double limit = i % 2 == 0 ? normalization.maxAngle : normalization.maxAngularVelocity;
+        for (int h = 0; h < network.hiddenSize; h++) {
+            folded[i * network.hiddenSize + h] = (float)((double)network.weightsInputHidden[i * network.hiddenSize + h] / limit);
+        }
+    }
+    return folded;
+}
+
+/**
+ * Export timestamp in the simulator's format, e.g. 2025-08-17T19-28-58 (UTC)
+ */
+inline std::string exportTimestamp(time_t now = time(nullptr)) {
+    char text[32];
+    struct tm utc;
+    gmtime_r(&now, &utc);
+    strftime(text, sizeof(text), "%Y-%m-%dT%H-%M-%S", &utc);
+    return text;
+}
+
+/**
+ * @return C++ source for network, as generateCppCode(weights, architecture,
+ *         timestamp, {normalization})
+ */
+inline std::string formatCppModel(const Network& network, const std::string& timestamp,
+                                  const Normalization& normalization = Normalization()) {
+    const std::string maxAngle = formatFloat((float)normalization.maxAngle);
+    const std::string maxAngularVelocity = formatFloat((float)normalization.maxAngularVelocity);
+    const std::string in = std::to_string(network.inputSize);
+    const std::string hidden = std::to_string(network.hiddenSize);
+    const std::string out = std::to_string(network.outputSize);
+
+    std::string code =
+        "/**\n"
+        " * Two-Wheel Balancing Robot DQN Model\n"
+        " * Generated: " + timestamp + "\n"
+        " * Architecture: " + in + "-" + hidden + "-" + out + "\n"
+        " * History timesteps: " + std::to_string(network.inputSize / 2) + "\n"
+        " * Normalization: maxAngle " + maxAngle.substr(0, maxAngle.size() - 1) + " rad, maxAngularVelocity " +
+        maxAngularVelocity.substr(0, maxAngularVelocity.size() - 1) + " rad/s\n"
+        " *\n"
+        " * This file contains the trained neural network weights for deployment\n"
+        " * on embedded systems (Arduino, ESP32, STM32, etc.)\n"
+        " *\n"
+        " * Inference code lives in DQNPolicy.h (native/include/ in the simulator\n"
+        " * repository); copy it next to this file. Weights live in flash only and\n"
+        " * TwoWheelBotDQN instances hold no data.\n"
+        " */\n"
+        "\n"
+        "#include \"DQNPolicy.h\"\n"
+        "\n"
+        "// Define DQN_MODEL_NAMESPACE before including to link several models into one binary\n"
+        "#if defined(DQN_MODEL_NAMESPACE)\n"
+        "namespace DQN_MODEL_NAMESPACE {\n"
+        "#endif\n"
+        "\n"
+        "namespace TwoWheelBotDQNWeights {\n"
+        "    static const int INPUT_SIZE = " + in + ";\n"
+        "    static const int HIDDEN_SIZE = " + hidden + ";\n"
+        "    static const int OUTPUT_SIZE = " + out + ";\n"
+        "\n"
+        "    // Inputs are clamped to these limits (rad, rad/s); the first layer holds the 1 / limit normalization\n"
+        "    struct InputLimits {\n"
+        "        static constexpr float maxAngle() { return " + maxAngle + "; }\n"
+        "        static constexpr float maxAngularVelocity() { return " + maxAngularVelocity + "; }\n"
+        "    };\n"
+        "\n"
+        "    // Network weights (stored in program memory to save RAM)\n"
+        "    static DQN_FLASH dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM = {\n";
+    code += formatWeightTable("weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]", foldNormalization(network, normalization),
+                              formatFloat) + ",\n";
+    code += formatWeightTable("biasHidden[HIDDEN_SIZE]", network.biasHidden) + ",\n";
+    code += formatWeightTable("weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]", network.weightsHiddenOutput) + ",\n";
+    code += formatWeightTable("biasOutput[OUTPUT_SIZE]", network.biasOutput) + "\n";
+    code +=
+        "    };\n"
+        "}\n"
+        "\n"
+        "typedef dqn::DQNPolicy<TwoWheelBotDQNWeights::INPUT_SIZE,\n"
+        "                       TwoWheelBotDQNWeights::HIDDEN_SIZE,\n"
+        "                       TwoWheelBotDQNWeights::OUTPUT_SIZE,\n"
+        "                       dqn::ReLU,\n"
+        "                       TwoWheelBotDQNWeights::weights,\n"
+        "                       dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> > TwoWheelBotDQN;\n"
+        "\n"
+        "#if defined(DQN_MODEL_NAMESPACE)\n"
+        "} // namespace DQN_MODEL_NAMESPACE\n"
+        "#endif\n"
+        "\n"
+        "// Usage example:\n"
+        "// TwoWheelBotDQN bot;\n";
+    // formatUsageExample: history models show the reset and per-tick call
+    if (network.inputSize > 2) {
+        code += "// bot.reset(angle, angularVelocity);  // fill the " + std::to_string(network.inputSize / 2) +
+                "-step history\n"
+                "// // each control tick (getAction records the state):\n";
+    }
+    code +=
+        "// int action = bot.getAction(angle, angularVelocity);\n"
+        "// float torque = bot.getMotorTorque(action);\n";
+    return code;
+}
+
+/**
+ * Write formatCppModel(network, timestamp, normalization) to path
+ * @return False if the file could not be written
+ */
+inline bool writeCppModel(const char* path, const Network& network, const std::string& timestamp,
+                          const Normalization& normalization = Normalization()) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    const std::string code = formatCppModel(network, timestamp, normalization);
+    const bool written = fwrite(code.data(), 1, code.size(), file) == code.size();
+    return fclose(file) == 0 && written;
+}
+
+} // namespace train
+
+#endif // TWOWHEELBOT_CPP_MODEL_WRITER_H
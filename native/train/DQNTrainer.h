@@ -0,0 +1,680 @@
+/**
+ * Native DQN trainer
+ *
+ * Host-side port of src/training/QLearning.js for long training runs
+ * without the browser:
+ *
+ *   train::DQNTrainer trainer(inputSize, hyperparams, seed);
+ *   dqn::BalancingRobot robot(config, seed);
+ *   for (int e = 0; e < hyperparams.maxEpisodes; e++) trainer.runEpisode(robot);
+ *   train::writeCppModel(path, trainer.network(), train::exportTimestamp());
+ *
+ * writeCppModel (CppModelWriter.h) emits the simulator's export format.
+ *
+ * - Same hyperparameters, ranges and defaults as Hyperparameters, the same
+ *   linear epsilon schedule, replay capacity, Huber loss, TD-error and
+ *   gradient clipping, weight clamping and target-network period
+ * - The replay memory is one preallocated ring of fixed-stride arrays;
+ *   every per-step buffer (minibatch rows and indices, activations, target
+ *   Q-values, TD errors, gradients) is carved from one Arena sized from
+ *   the architecture and batch size at construction. After that, no
+ *   training step touches the heap (tests/test_trainer.cpp counts)
+ * - A minibatch is gathered into contiguous rows and pushed through both
+ *   networks as matrix products; the backward pass accumulates the clipped
+ *   per-sample gradients the same way and applies them once per batch
+ *   (QLearning.js applies them sample by sample, so its later samples see
+ *   weights already moved by the earlier ones)
+ * - Weights use CPUBackend's input-major layout, so they export unchanged
+ *
+ * Host only; C++11.
+ */
+
+#ifndef TWOWHEELBOT_DQN_TRAINER_H
+#define TWOWHEELBOT_DQN_TRAINER_H
+
+#include <math.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Arena.h"
+#include "BalancingRobot.h"
+
+namespace train {
+
+static const int NUM_ACTIONS = 3;
+// QLearning.actions: left motor, brake, right motor
+static const float ACTIONS[NUM_ACTIONS] = {-1.0f, 0.0f, 1.0f};
+static const int MAX_TIMESTEPS = 8;
+static const int REPLAY_CAPACITY = 10000;
+
+/**
+ * QLearning.js Hyperparameters, with its defaults
+ * Out-of-range values are clamped to the same ranges (clampHyperparameters).
+ */
+struct Hyperparameters {
+    double learningRate;      // 0.0001 - 0.01
+    double gamma;             // 0.9 - 0.999
+    double epsilon;           // Initial exploration rate (0 - 1)
+    double epsilonMin;        // 0 - 0.1
+    int epsilonDecay;         // Steps of linear decay (1000 - 10000)
+    int batchSize;            // 16 - 256
+    int targetUpdateFreq;     // Batches between target syncs (10 - 1000)
+    int maxEpisodes;          // 10 - 10000
+    int maxStepsPerEpisode;   // 50 - 50000
+    int hiddenSize;           // 64 - 256
+
+    Hyperparameters()
+        : learningRate(3e-4),
+          gamma(0.99),
+          epsilon(0.9),
+          epsilonMin(0.01),
+          epsilonDecay(2500),
+          batchSize(128),
+          targetUpdateFreq(100),
+          maxEpisodes(1000),
+          maxStepsPerEpisode(8000),
+          hiddenSize(128) {}
+};
+
+template <typename T>
+inline T clampValue(T value, T min, T max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+/**
+ * Apply the Hyperparameters._validateParameter ranges
+ */
+inline Hyperparameters clampHyperparameters(const Hyperparameters& params) {
+    Hyperparameters p = params;
+    p.learningRate = clampValue(p.learningRate, 0.0001, 0.01);
+    p.gamma = clampValue(p.gamma, 0.9, 0.999);
+    p.epsilon = clampValue(p.epsilon, 0.0, 1.0);
+    p.epsilonMin = clampValue(p.epsilonMin, 0.0, 0.1);
+    p.epsilonDecay = clampValue(p.epsilonDecay, 1000, 10000);
+    p.batchSize = clampValue(p.batchSize, 16, 256);
+    p.targetUpdateFreq = clampValue(p.targetUpdateFreq, 10, 1000);
+    p.maxEpisodes = clampValue(p.maxEpisodes, 10, 10000);
+    p.maxStepsPerEpisode = clampValue(p.maxStepsPerEpisode, 50, 50000);
+    p.hiddenSize = clampValue(p.hiddenSize, 64, 256);
+    return p;
+}
+
+/**
+ * Experience replay memory in structure-of-arrays form
+ *
+ * Slot i holds states[i * stride .. +stride), actions[i], rewards[i],
+ * nextStates[i * stride ..] and dones[i]. Once full, add() overwrites the
+ * oldest slot, like ReplayBuffer.add.
+ */
+class ReplayBuffer {
+public:
+    ReplayBuffer(int stateSize, int capacity = REPLAY_CAPACITY)
+        : stride(stateSize),
+          capacity(capacity),
+          count(0),
+          head(0),
+          generation(0),
+          states((size_t)capacity * stateSize),
+          nextStates((size_t)capacity * stateSize),
+          actions(capacity),
+          rewards(capacity),
+          dones(capacity),
+          drawn(capacity, 0) {}
+
+    void add(const float* state, int action, float reward, const float* nextState, bool done) {
+        float* s = &states[(size_t)head * stride];
+        float* n = &nextStates[(size_t)head * stride];
+        for (int i = 0; i < stride; i++) {
+            s[i] = state[i];
+            n[i] = nextState[i];
+        }
+        actions[head] = action;
+        rewards[head] = reward;
+        dones[head] = done ? 1 : 0;
+
+        head = (head + 1) % capacity;
+        if (count < capacity) count++;
+    }
+
+    /**
+     * Draw batchSize distinct slots uniformly at random
+     * Draws every slot when fewer are stored (ReplayBuffer.sample).
+     * @param indices Output slots [batchSize]
+     * @return Number of slots written
+     */
+    int sample(int batchSize, dqn::XorShift64& random, int* indices) {
+        if (count <= batchSize) {
+            for (int i = 0; i < count; i++) indices[i] = i;
+            return count;
+        }
+        // Rejection sampling as in ReplayBuffer.sample; the generation
+        // stamp replaces its per-call Set
+        if (++generation == 0) {
+            for (int i = 0; i < capacity; i++) drawn[i] = 0;
+            generation = 1;
+        }
+        int n = 0;
+        while (n < batchSize) {
+            const int index = (int)(random.next() * count);
+            if (drawn[index] != generation) {
+                drawn[index] = generation;
+                indices[n++] = index;
+            }
+        }
+        return n;
+    }
+
+    int size() const { return count; }
+    int getCapacity() const { return capacity; }
+    int stateSize() const { return stride; }
+
+    void clear() {
+        count = 0;
+        head = 0;
+    }
+
+    const float* state(int slot) const { return &states[(size_t)slot * stride]; }
+    const float* nextState(int slot) const { return &nextStates[(size_t)slot * stride]; }
+    int action(int slot) const { return actions[slot]; }
+    float reward(int slot) const { return rewards[slot]; }
+    bool done(int slot) const { return dones[slot] != 0; }
+
+private:
+    int stride;
+    int capacity;
+    int count;
+    int head;
+    uint32_t generation;
+    std::vector<float> states;
+    std::vector<float> nextStates;
+    std::vector<int> actions;
+    std::vector<float> rewards;
+    std::vector<uint8_t> dones;
+    std::vector<uint32_t> drawn;
+};
+
+/**
+ * Input-hidden-output ReLU network in CPUBackend's layout:
+ * weightsInputHidden[i * hidden + h], weightsHiddenOutput[h * output + o]
+ */
+struct Network {
+    int inputSize;
+    int hiddenSize;
+    int outputSize;
+    std::vector<float> weightsInputHidden;
+    std::vector<float> biasHidden;
+    std::vector<float> weightsHiddenOutput;
+    std::vector<float> biasOutput;
+
+    Network(int inputSize, int hiddenSize, int outputSize)
+        : inputSize(inputSize),
+          hiddenSize(hiddenSize),
+          outputSize(outputSize),
+          weightsInputHidden((size_t)inputSize * hiddenSize),
+          biasHidden(hiddenSize),
+          weightsHiddenOutput((size_t)hiddenSize * outputSize),
+          biasOutput(outputSize) {}
+
+    /**
+     * CPUBackend's He initialization: normal weights with stddev
+     * sqrt(2 / fan-in), hidden biases 0.01, output biases 0
+     */
+    void initialize(dqn::XorShift64& random) {
+        heInit(weightsInputHidden, inputSize, random);
+        heInit(weightsHiddenOutput, hiddenSize, random);
+        for (float& b : biasHidden) b = 0.01f;
+        for (float& b : biasOutput) b = 0.0f;
+    }
+
+    /**
+     * Forward pass over rows independent inputs as two matrix products
+     * @param inputs [rows x inputSize]
+     * @param hidden Output ReLU activations [rows x hiddenSize]
+     * @param outputs Output Q-values [rows x outputSize]
+     */
+    void forward(const float* inputs, int rows, float* hidden, float* outputs) const {
+        dense(inputs, rows, inputSize, weightsInputHidden.data(), biasHidden.data(), hiddenSize, hidden);
+        const int cells = rows * hiddenSize;
+        for (int i = 0; i < cells; i++) hidden[i] = hidden[i] > 0.0f ? hidden[i] : 0.0f;
+        narrowDense(hidden, rows, hiddenSize, weightsHiddenOutput.data(), biasOutput.data(), outputSize, outputs);
+    }
+
+    /**
+     * Copy another network's weights (same architecture) without reallocating
+     */
+    void copyWeights(const Network& other) {
+        std::copy(other.weightsInputHidden.begin(), other.weightsInputHidden.end(), weightsInputHidden.begin());
+        std::copy(other.biasHidden.begin(), other.biasHidden.end(), biasHidden.begin());
+        std::copy(other.weightsHiddenOutput.begin(), other.weightsHiddenOutput.end(), weightsHiddenOutput.begin());
+        std::copy(other.biasOutput.begin(), other.biasOutput.end(), biasOutput.begin());
+    }
+
+    int parameterCount() const {
+        return inputSize * hiddenSize + hiddenSize + hiddenSize * outputSize + outputSize;
+    }
+
+private:
+    static void heInit(std::vector<float>& weights, int fanIn, dqn::XorShift64& random) {
+        const double stddev = sqrt(2.0 / fanIn);
+        for (float& w : weights) {
+            // Box-Muller as in MatrixUtils.heInit; 1 - u keeps log() finite
+            const double u1 = 1.0 - random.next();
+            const double u2 = random.next();
+            w = (float)(sqrt(-2.0 * log(u1)) * cos(2.0 * dqn::SIM_PI * u2) * stddev);
+        }
+    }
+
+    /**
+     * out[r][c] = bias[c] + sum_k in[r][k] * weights[k][c]
+     * The inner loop runs over contiguous output columns, so it vectorizes.
+     */
+    static void dense(const float* in, int rows, int inner, const float* weights, const float* bias, int cols,
+                      float* out) {
+        for (int r = 0; r < rows; r++) {
+            float* row = out + (size_t)r * cols;
+            for (int c = 0; c < cols; c++) row[c] = bias[c];
+            const float* x = in + (size_t)r * inner;
+            for (int k = 0; k < inner; k++) {
+                const float xk = x[k];
+                const float* w = weights + (size_t)k * cols;
+                for (int c = 0; c < cols; c++) row[c] += xk * w[c];
+            }
+        }
+    }
+
+    /**
+     * dense() for a handful of output columns (the Q-values), where a
+     * column loop is too short to vectorize: each output is a dot product
+     * split over four independent partial sums
+     */
+    static void narrowDense(const float* in, int rows, int inner, const float* weights, const float* bias, int cols,
+                            float* out) {
+        for (int r = 0; r < rows; r++) {
+            const float* x = in + (size_t)r * inner;
+            for (int c = 0; c < cols; c++) {
+                const float* w = weights + c;
+                float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+                int k = 0;
+                for (; k + 4 <= inner; k += 4) {
+                    s0 += x[k] * w[(size_t)k * cols];
+                    s1 += x[k + 1] * w[(size_t)(k + 1) * cols];
+                    s2 += x[k + 2] * w[(size_t)(k + 2) * cols];
+                    s3 += x[k + 3] * w[(size_t)(k + 3) * cols];
+                }
+                for (; k < inner; k++) s0 += x[k] * w[(size_t)k * cols];
+                out[(size_t)r * cols + c] = bias[c] + ((s0 + s1) + (s2 + s3));
+            }
+        }
+    }
+};
+
+/**
+ * StateHistory for training inputs: newest measured state first, filled
+ * with the reset state, normalized by the robot's maxAngle
+ * (BalancingRobot.getNormalizedInputs)
+ */
+class InputHistory {
+public:
+    explicit InputHistory(int timesteps) : timesteps(clampValue(timesteps, 1, MAX_TIMESTEPS)) {}
+
+    void reset(double angle, double angularVelocity) {
+        for (int t = 0; t < MAX_TIMESTEPS; t++) {
+            angles[t] = angle;
+            velocities[t] = angularVelocity;
+        }
+    }
+
+    void push(double angle, double angularVelocity) {
+        for (int t = MAX_TIMESTEPS - 1; t > 0; t--) {
+            angles[t] = angles[t - 1];
+            velocities[t] = velocities[t - 1];
+        }
+        angles[0] = angle;
+        velocities[0] = angularVelocity;
+    }
+
+    /**
+     * @param inputs Output [2 * timesteps]
+     */
+    void normalized(double maxAngle, float* inputs) const {
+        for (int t = 0; t < timesteps; t++) {
+            inputs[t * 2] = (float)dqn::clampRange(angles[t] / maxAngle, -1.0, 1.0);
+            inputs[t * 2 + 1] = (float)dqn::clampRange(velocities[t] / 10.0, -1.0, 1.0);
+        }
+    }
+
+    int inputSize() const { return timesteps * 2; }
+
+private:
+    int timesteps;
+    double angles[MAX_TIMESTEPS];
+    double velocities[MAX_TIMESTEPS];
+};
+
+/**
+ * QLearning.runEpisode result
+ */
+struct EpisodeResult {
+    int episode;
+    double reward;
+    int steps;
+    double loss;     // Mean loss over the steps that trained
+    double epsilon;
+};
+
+/**
+ * DQN with experience replay and a target network (QLearning.js)
+ */
+class DQNTrainer {
+public:
+    /**
+     * @param inputSize 2 * history timesteps
+     * @param params Hyperparameters (clamped to the QLearning.js ranges)
+     * @param seed Seeds weight init, exploration and replay sampling
+     */
+    DQNTrainer(int inputSize, const Hyperparameters& params = Hyperparameters(), uint64_t seed = 1)
+        : params(clampHyperparameters(params)),
+          initialEpsilon(this->params.epsilon),
+          random(seed),
+          online(inputSize, this->params.hiddenSize, NUM_ACTIONS),
+          target(inputSize, this->params.hiddenSize, NUM_ACTIONS),
+          replay(inputSize),
+          episode(0),
+          batchCount(0),
+          lastTargetUpdate(0),
+          globalStepCount(0),
+          epsilonDecayEnabled(true),
+          arena(scratchBytes(inputSize, this->params.hiddenSize, this->params.batchSize)) {
+        scratch.carve(arena, inputSize, this->params.hiddenSize, this->params.batchSize);
+        online.initialize(random);
+        target.copyWeights(online);
+    }
+
+    DQNTrainer(const DQNTrainer&) = delete;
+    DQNTrainer& operator=(const DQNTrainer&) = delete;
+
+    /**
+     * Bytes of per-step scratch for an architecture and batch size: the
+     * size of the trainer's one arena
+     */
+    static size_t scratchBytes(int inputSize, int hiddenSize, int batchSize) {
+        Arena measure;
+        Scratch layout;
+        layout.carve(measure, inputSize, hiddenSize, batchSize);
+        return measure.used();
+    }
+
+    /**
+     * Epsilon-greedy action (QLearning.selectAction)
+     */
+    int selectAction(const float* state, bool training = true) {
+        if (training && random.next() < params.epsilon) {
+            return (int)(random.next() * NUM_ACTIONS);
+        }
+        return greedyAction(state);
+    }
+
+    int greedyAction(const float* state) const {
+        float q[NUM_ACTIONS];
+        online.forward(state, 1, scratch.stepHidden, q);
+        return argmax(q);
+    }
+
+    /**
+     * Store a transition and train on a minibatch once the replay memory
+     * holds batchSize transitions (QLearning.train)
+     * @return Mean minibatch loss, or 0 when no training ran
+     */
+    double train(const float* state, int action, double reward, const float* nextState, bool done) {
+        globalStepCount++;
+        updateEpsilon();
+        replay.add(state, action, (float)reward, nextState, done);
+        if (replay.size() < params.batchSize) return 0.0;
+
+        const int count = replay.sample(params.batchSize, random, scratch.indices);
+        const double loss = learn(scratch.indices, count);
+
+        batchCount++;
+        if (batchCount - lastTargetUpdate >= params.targetUpdateFreq) {
+            target.copyWeights(online);
+            lastTargetUpdate = batchCount;
+        }
+        return loss;
+    }
+
+    /**
+     * Store a transition without training on it (logged robot experience,
+     * see TelemetryLog.h); the step count and epsilon are unchanged
+     */
+    void remember(const float* state, int action, double reward, const float* nextState, bool done) {
+        replay.add(state, action, (float)reward, nextState, done);
+    }
+
+    /**
+     * One gradient step on the given replay slots
+     *
+     * Per sample: TD error against the target network clipped to ±5, Huber
+     * loss, gradients of the taken action's Q-value clipped to ±0.5
+     * element-wise; the sum over the batch is applied with learningRate and
+     * weights are clamped to ±10.
+     * @return Mean Huber loss
+     */
+    double learn(const int* slots, int count) {
+        const int in = online.inputSize;
+        const int hidden = online.hiddenSize;
+        Scratch& m = scratch;
+        for (int b = 0; b < count; b++) {
+            const float* s = replay.state(slots[b]);
+            const float* n = replay.nextState(slots[b]);
+            for (int i = 0; i < in; i++) {
+                m.states[(size_t)b * in + i] = s[i];
+                m.nextStates[(size_t)b * in + i] = n[i];
+            }
+        }
+        online.forward(m.states, count, m.hidden, m.q);
+        target.forward(m.nextStates, count, m.nextHidden, m.nextQ);
+
+        double totalLoss = 0.0;
+        for (int b = 0; b < count; b++) {
+            const int slot = slots[b];
+            const float* nextQ = &m.nextQ[(size_t)b * NUM_ACTIONS];
+            double targetQ = (double)replay.reward(slot);
+            if (!replay.done(slot)) targetQ += params.gamma * (double)nextQ[argmax(nextQ)];
+
+            const double currentQ = (double)m.q[(size_t)b * NUM_ACTIONS + replay.action(slot)];
+            const double tdError = clampValue(targetQ - currentQ, -5.0, 5.0);
+            m.tdErrors[b] = (float)tdError;
+
+            const double absError = fabs(tdError);
+            totalLoss += absError <= 1.0 ? 0.5 * tdError * tdError : absError - 0.5;
+        }
+
+        const size_t inputWeights = online.weightsInputHidden.size();
+        const size_t outputWeights = online.weightsHiddenOutput.size();
+        for (size_t k = 0; k < inputWeights; k++) m.gradInputHidden[k] = 0.0f;
+        for (int j = 0; j < hidden; j++) m.gradBiasHidden[j] = 0.0f;
+        for (size_t k = 0; k < outputWeights; k++) m.gradHiddenOutput[k] = 0.0f;
+        for (int a = 0; a < NUM_ACTIONS; a++) m.gradBiasOutput[a] = 0.0f;
+
+        // Output layer, and the error each hidden unit passes back
+        for (int b = 0; b < count; b++) {
+            const int action = replay.action(slots[b]);
+            const float td = m.tdErrors[b];
+            const float* h = &m.hidden[(size_t)b * hidden];
+            float* e = &m.hiddenErrors[(size_t)b * hidden];
+            for (int j = 0; j < hidden; j++) {
+                m.gradHiddenOutput[(size_t)j * NUM_ACTIONS + action] += clampGradient(td * h[j]);
+                e[j] = h[j] > 0.0f ? td * online.weightsHiddenOutput[(size_t)j * NUM_ACTIONS + action] : 0.0f;
+            }
+            m.gradBiasOutput[action] += clampGradient(td);
+        }
+
+        // Input layer: clipped X^T * E, hidden units contiguous
+        for (int b = 0; b < count; b++) {
+            const float* x = &m.states[(size_t)b * in];
+            const float* e = &m.hiddenErrors[(size_t)b * hidden];
+            for (int i = 0; i < in; i++) {
+                const float xi = x[i];
+                float* g = &m.gradInputHidden[(size_t)i * hidden];
+                for (int j = 0; j < hidden; j++) g[j] += clampGradient(e[j] * xi);
+            }
+            for (int j = 0; j < hidden; j++) m.gradBiasHidden[j] += clampGradient(e[j]);
+        }
+
+        const float rate = (float)params.learningRate;
+        applyGradient(online.weightsInputHidden, m.gradInputHidden, rate);
+        applyGradient(online.biasHidden, m.gradBiasHidden, rate);
+        applyGradient(online.weightsHiddenOutput, m.gradHiddenOutput, rate);
+        applyGradient(online.biasOutput, m.gradBiasOutput, rate);
+
+        return count > 0 ? totalLoss / count : 0.0;
+    }
+
+    /**
+     * One training episode on robot (QLearning.runEpisode)
+     *
+     * Starts like the simulator's training mode: within ±0.05 rad for the
+     * first 100 episodes and ±π/6 after, angular velocity within ±0.25.
+     */
+    EpisodeResult runEpisode(dqn::BalancingRobot& robot, int timesteps = 1) {
+        const double startAngleRange = episode < 100 ? 0.1 : dqn::SIM_PI / 3.0;
+        const double startAngle = (random.next() - 0.5) * startAngleRange;
+        const double startVelocity = (random.next() - 0.5) * 0.5;
+        robot.reset(dqn::RobotState(startAngle, startVelocity));
+
+        InputHistory history(timesteps);
+        history.reset(robot.measuredAngle(), robot.state().angularVelocity);
+        float state[MAX_TIMESTEPS * 2], nextState[MAX_TIMESTEPS * 2];
+        history.normalized(robot.config().maxAngle, state);
+
+        EpisodeResult result = {0, 0.0, 0, 0.0, 0.0};
+        double totalLoss = 0.0;
+        int lossCount = 0;
+        for (int step = 0; step < params.maxStepsPerEpisode; step++) {
+            const int action = selectAction(state, true);
+            const dqn::StepResult outcome = robot.step((double)ACTIONS[action]);
+            history.push(robot.measuredAngle(), robot.state().angularVelocity);
+            history.normalized(robot.config().maxAngle, nextState);
+
+            const double loss = train(state, action, outcome.reward, nextState, outcome.done);
+            if (loss > 0.0) {
+                totalLoss += loss;
+                lossCount++;
+            }
+            result.reward += outcome.reward;
+            result.steps++;
+            if (outcome.done) break;
+            for (int i = 0; i < online.inputSize; i++) state[i] = nextState[i];
+        }
+
+        result.episode = ++episode;
+        result.loss = lossCount > 0 ? totalLoss / lossCount : 0.0;
+        result.epsilon = params.epsilon;
+        return result;
+    }
+
+    /**
+     * Disable the schedule to pin epsilon at epsilonMin (epsilonDecayEnabled)
+     */
+    void setEpsilonDecayEnabled(bool enabled) { epsilonDecayEnabled = enabled; }
+
+    const Network& network() const { return online; }
+    const Network& targetNetwork() const { return target; }
+    const Hyperparameters& hyperparameters() const { return params; }
+    const ReplayBuffer& replayBuffer() const { return replay; }
+    double getEpsilon() const { return params.epsilon; }
+    int getEpisode() const { return episode; }
+    long getBatchCount() const { return batchCount; }
+    long getStepCount() const { return globalStepCount; }
+
+private:
+    static int argmax(const float* q) {
+        int best = 0;
+        for (int a = 1; a < NUM_ACTIONS; a++) {
+            if (q[a] > q[best]) best = a;
+        }
+        return best;
+    }
+
+    static float clampGradient(float g) { return g < -0.5f ? -0.5f : (g > 0.5f ? 0.5f : g); }
+
+    static void applyGradient(std::vector<float>& weights, const float* gradient, float rate) {
+        const size_t n = weights.size();
+        for (size_t i = 0; i < n; i++) {
+            const float w = weights[i] + rate * gradient[i];
+            weights[i] = w < -10.0f ? -10.0f : (w > 10.0f ? 10.0f : w);
+        }
+    }
+
+    /**
+     * Linear decay from the initial epsilon to epsilonMin over epsilonDecay steps
+     */
+    void updateEpsilon() {
+        if (!epsilonDecayEnabled || globalStepCount >= params.epsilonDecay) {
+            params.epsilon = params.epsilonMin;
+            return;
+        }
+        const double fraction = (double)globalStepCount / params.epsilonDecay;
+        params.epsilon = initialEpsilon + fraction * (params.epsilonMin - initialEpsilon);
+    }
+
+    Hyperparameters params;
+    double initialEpsilon;
+    dqn::XorShift64 random;
+    Network online;
+    Network target;
+    ReplayBuffer replay;
+
+    int episode;
+    long batchCount;
+    long lastTargetUpdate;
+    long globalStepCount;
+    bool epsilonDecayEnabled;
+
+    /**
+     * Per-step buffers, all carved from the arena
+     */
+    struct Scratch {
+        int* indices;           // Sampled replay slots [batch]
+        float* states;          // [batch x input]
+        float* nextStates;      // [batch x input]
+        float* hidden;          // Online activations [batch x hidden]
+        float* q;               // Online Q-values [batch x actions]
+        float* nextHidden;      // Target activations [batch x hidden]
+        float* nextQ;           // Target Q-values [batch x actions]
+        float* tdErrors;        // Clipped TD errors [batch]
+        float* hiddenErrors;    // Backpropagated errors [batch x hidden]
+        float* gradInputHidden;
+        float* gradBiasHidden;
+        float* gradHiddenOutput;
+        float* gradBiasOutput;
+        float* stepHidden;      // selectAction activations [hidden]
+
+        void carve(Arena& arena, int in, int hiddenSize, int batch) {
+            const size_t rows = (size_t)batch;
+            indices = arena.allocate<int>(rows);
+            states = arena.allocate<float>(rows * in);
+            nextStates = arena.allocate<float>(rows * in);
+            hidden = arena.allocate<float>(rows * hiddenSize);
+            q = arena.allocate<float>(rows * NUM_ACTIONS);
+            nextHidden = arena.allocate<float>(rows * hiddenSize);
+            nextQ = arena.allocate<float>(rows * NUM_ACTIONS);
+            tdErrors = arena.allocate<float>(rows);
+            hiddenErrors = arena.allocate<float>(rows * hiddenSize);
+            gradInputHidden = arena.allocate<float>((size_t)in * hiddenSize);
+            gradBiasHidden = arena.allocate<float>(hiddenSize);
+            gradHiddenOutput = arena.allocate<float>((size_t)hiddenSize * NUM_ACTIONS);
+            gradBiasOutput = arena.allocate<float>(NUM_ACTIONS);
+            stepHidden = arena.allocate<float>(hiddenSize);
+        }
+    };
+
+    Arena arena;
+    Scratch scratch;
+};
+
+} // namespace train
+
+#endif // TWOWHEELBOT_DQN_TRAINER_H
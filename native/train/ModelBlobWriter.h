@@ -0,0 +1,88 @@
+/**
+ * Export a trained network as a binary model blob
+ *
+ * Produces byte for byte what ModelBlob.generateModelBlob writes for a
+ * float32 blob, so checkpoints bind with dqn::ModelBlob (DQNModelBlob.h),
+ * import in the simulator (parseModelBlob) and diff against earlier
+ * checkpoints with ModelDelta.js.
+ *
+ * Host only; C++11.
+ */
+
+#ifndef TWOWHEELBOT_MODEL_BLOB_WRITER_H
+#define TWOWHEELBOT_MODEL_BLOB_WRITER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "CppModelWriter.h"
+#include "DQNModelBlob.h"
+#include "DQNTrainer.h"
+
+namespace train {
+
+static const size_t MODEL_BLOB_ALIGNMENT = 16;
+
+/**
+ * @return float32 blob for network, as generateModelBlob(weights,
+ *         architecture, {normalization})
+ */
+inline std::vector<uint8_t> formatModelBlob(const Network& network, const Normalization& normalization = Normalization()) {
+    const std::vector<float> torques(ACTIONS, ACTIONS + NUM_ACTIONS);
+    const std::vector<float>* tensors[5] = {&torques, &network.weightsInputHidden, &network.biasHidden,
+                                            &network.weightsHiddenOutput, &network.biasOutput};
+    uint32_t offsets[5];
+    size_t size = sizeof(dqn::ModelBlobHeader);
+    for (int t = 0; t < 5; t++) {
+        size = (size + MODEL_BLOB_ALIGNMENT - 1) / MODEL_BLOB_ALIGNMENT * MODEL_BLOB_ALIGNMENT;
+        offsets[t] = (uint32_t)size;
+        size += tensors[t]->size() * sizeof(float);
+    }
+
+    dqn::ModelBlobHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "DQNB", 4);
+    header.version = dqn::MODEL_BLOB_VERSION;
+    header.headerSize = (uint16_t)sizeof(header);
+    header.totalSize = (uint32_t)size;
+    header.precision = dqn::BLOB_FLOAT32;
+    header.inputSize = (uint16_t)network.inputSize;
+    header.hiddenSize = (uint16_t)network.hiddenSize;
+    header.outputSize = (uint16_t)network.outputSize;
+    header.historyTimesteps = (uint16_t)(network.inputSize / 2);
+    header.angleScale = (float)(1.0 / normalization.maxAngle);
+    header.angularVelocityScale = (float)(1.0 / normalization.maxAngularVelocity);
+    header.weightScaleInputHidden = 1.0f;
+    header.weightScaleHiddenOutput = 1.0f;
+    header.actionTorquesOffset = offsets[0];
+    header.weightsInputHiddenOffset = offsets[1];
+    header.biasHiddenOffset = offsets[2];
+    header.weightsHiddenOutputOffset = offsets[3];
+    header.biasOutputOffset = offsets[4];
+
+    std::vector<uint8_t> bytes(size, 0);
+    memcpy(bytes.data(), &header, sizeof(header));
+    for (int t = 0; t < 5; t++) memcpy(&bytes[offsets[t]], tensors[t]->data(), tensors[t]->size() * sizeof(float));
+    const uint32_t crc = dqn::crc32(&bytes[dqn::MODEL_BLOB_CRC_START], size - dqn::MODEL_BLOB_CRC_START);
+    memcpy(&bytes[offsetof(dqn::ModelBlobHeader, crc)], &crc, sizeof(crc));
+    return bytes;
+}
+
+/**
+ * Write formatModelBlob(network, normalization) to path
+ * @return False if the file could not be written
+ */
+inline bool writeModelBlob(const char* path, const Network& network, const Normalization& normalization = Normalization()) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    const std::vector<uint8_t> bytes = formatModelBlob(network, normalization);
+    const bool written = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return fclose(file) == 0 && written;
+}
+
+} // namespace train
+
+#endif // TWOWHEELBOT_MODEL_BLOB_WRITER_H
@@ -0,0 +1,146 @@
+/**
+ * Telemetry logs from the robot, for offline evaluation and training
+ *
+ * Decodes captured DQNTelemetry.h streams (UART dumps, files written by a
+ * drain task) into per-tick arrays:
+ *
+ *   train::TelemetryLog log;
+ *   log.appendFile("balance_run.bin");
+ *
+ *   // Score a candidate policy on the logged states, batched
+ *   std::vector<int> actions(log.size());
+ *   candidate.getActions(log.angles().data(), log.angularVelocities().data(), actions.data(), log.size());
+ *
+ *   // Seed the native trainer's replay memory with the logged experience
+ *   train::replayTelemetry(trainer, log, robotConfig);
+ *
+ * - Records are grouped into runs: a run ends at a policy reset
+ *   (TELEMETRY_RESET) or a sequence gap (records dropped on the robot or
+ *   lost in transit), so no transition spans missing ticks
+ * - Transitions use the trainer's input history and normalization, the
+ *   robot's motor torque for each logged action and stepReward() on the
+ *   next record. The log holds the measured angle, so rewards and the
+ *   fall check see the sensor offset that the simulator leaves out
+ *
+ * Host only; C++11.
+ */
+
+#ifndef TWOWHEELBOT_TELEMETRY_LOG_H
+#define TWOWHEELBOT_TELEMETRY_LOG_H
+
+#include <math.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "DQNTelemetry.h"
+#include "DQNTrainer.h"
+
+namespace train {
+
+class TelemetryLog {
+public:
+    /**
+     * Decode captured bytes; a record may span calls
+     */
+    void append(const uint8_t* bytes, size_t size) {
+        dqn::TelemetryRecord record;
+        for (size_t i = 0; i < size; i++) {
+            if (!decoder.push(bytes[i], record)) continue;
+            // A checksummed record with an unknown action is from another format; skip it
+            if (record.action >= NUM_ACTIONS) continue;
+            items.push_back(record);
+            angleValues.push_back(record.angle);
+            angularVelocityValues.push_back(record.angularVelocity);
+            actionValues.push_back(record.action);
+        }
+    }
+
+    /**
+     * Decode a whole capture file
+     * @return False if the file could not be read
+     */
+    bool appendFile(const char* path) {
+        FILE* file = fopen(path, "rb");
+        if (!file) return false;
+        uint8_t buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) append(buffer, n);
+        const bool ok = !ferror(file);
+        fclose(file);
+        return ok;
+    }
+
+    size_t size() const { return items.size(); }
+    const std::vector<dqn::TelemetryRecord>& records() const { return items; }
+
+    // Structure-of-arrays views for getActions()
+    const std::vector<float>& angles() const { return angleValues; }
+    const std::vector<float>& angularVelocities() const { return angularVelocityValues; }
+    const std::vector<int>& actions() const { return actionValues; }
+
+    /**
+     * True if record i directly follows record i - 1 in the same run
+     */
+    bool continuesRun(size_t i) const {
+        return i > 0 && !(items[i].flags & dqn::TELEMETRY_RESET) &&
+               items[i].sequence == (uint16_t)(items[i - 1].sequence + 1);
+    }
+
+    size_t skippedBytes() const { return decoder.skippedBytes(); }
+    size_t lostRecords() const { return decoder.lostRecords(); }
+
+private:
+    dqn::TelemetryDecoder decoder;
+    std::vector<dqn::TelemetryRecord> items;
+    std::vector<float> angleValues;
+    std::vector<float> angularVelocityValues;
+    std::vector<int> actionValues;
+};
+
+/**
+ * Store the log's transitions in the trainer's replay memory
+ * Runs use the trainer's history length; a run stops at the first tick
+ * past config.maxAngle, which is stored as terminal.
+ * @param config Robot the log was recorded on (maxAngle, torque, reward type)
+ * @return Transitions stored
+ */
+inline int replayTelemetry(DQNTrainer& trainer, const TelemetryLog& log, const dqn::RobotConfig& config) {
+    const std::vector<dqn::TelemetryRecord>& records = log.records();
+    InputHistory history(trainer.network().inputSize / 2);
+    float state[MAX_TIMESTEPS * 2], nextState[MAX_TIMESTEPS * 2];
+    double torque = 0.0;
+    bool fallen = false;
+    int stored = 0;
+
+    for (size_t i = 0; i < records.size(); i++) {
+        const dqn::TelemetryRecord& record = records[i];
+        if (!log.continuesRun(i)) {
+            history.reset(record.angle, record.angularVelocity);
+            history.normalized(config.maxAngle, state);
+            torque = 0.0;
+            fallen = false;
+            continue;
+        }
+        if (fallen) continue;
+
+        // BalancingRobot.step: the previous tick's action drove this tick's state
+        const dqn::TelemetryRecord& previous = records[i - 1];
+        const double previousTorque = torque;
+        torque = dqn::clampRange((double)ACTIONS[previous.action] * config.motorTorqueRange, -config.motorStrength,
+                                 config.motorStrength);
+        history.push(record.angle, record.angularVelocity);
+        history.normalized(config.maxAngle, nextState);
+        fallen = fabs((double)record.angle) > config.maxAngle;
+        const double reward = dqn::stepReward(config, record.angle, record.angularVelocity, torque, previousTorque);
+
+        trainer.remember(state, previous.action, reward, nextState, fallen);
+        stored++;
+        for (int k = 0; k < trainer.network().inputSize; k++) state[k] = nextState[k];
+    }
+    return stored;
+}
+
+} // namespace train
+
+#endif // TWOWHEELBOT_TELEMETRY_LOG_H
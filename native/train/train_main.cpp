@@ -0,0 +1,171 @@
+/**
+ * Train a TwoWheelBotDQN model natively
+ *
+ * Runs the QLearning.js training loop on the native BalancingRobot and
+ * writes the network in the simulator's export format, ready for
+ * "Import C++" in the browser or reexport.js.
+ *
+ * Usage: train_dqn [options]
+ *   --episodes n       Training episodes (default: 1000)
+ *   --steps n          Step limit per episode (default: 8000)
+ *   --hidden n         Hidden neurons (64 - 256, default: 128)
+ *   --timesteps n      History timesteps per input (1 - 8, default: 1)
+ *   --learning-rate x, --gamma x, --epsilon x, --epsilon-min x,
+ *   --epsilon-decay n, --batch n, --target-update n
+ *                      QLearning.js hyperparameters (same defaults and ranges)
+ *   --reward name      simple, complex, efficient or offset-adaptive (default: simple)
+ *   --offset-range x   Random sensor offset per episode in radians (offset-adaptive)
+ *   --seed n           Seed for weights, exploration and the simulator (default: 1)
+ *   --out file         Output model (default: two_wheel_bot_dqn_<timestamp>.cpp)
+ *   --save-every n     Also rewrite the output every n episodes (default: 0, off)
+ *   --log-every n      Progress line every n episodes (default: 10)
+ *   --telemetry file   Seed the replay memory with a robot telemetry log
+ *                      (DQNTelemetry.h records), recorded with --reward
+ *
+ * The summary reports heap allocations made by training steps, which the
+ * trainer keeps at zero after startup.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define TRAIN_COUNT_ALLOCATIONS
+#include "AllocationCounter.h"
+#include "CppModelWriter.h"
+#include "DQNTrainer.h"
+#include "TelemetryLog.h"
+
+namespace {
+
+bool parseReward(const char* name, dqn::RewardType& type) {
+    if (std::strcmp(name, "simple") == 0) type = dqn::REWARD_SIMPLE;
+    else if (std::strcmp(name, "complex") == 0) type = dqn::REWARD_COMPLEX;
+    else if (std::strcmp(name, "efficient") == 0) type = dqn::REWARD_EFFICIENT;
+    else if (std::strcmp(name, "offset-adaptive") == 0) type = dqn::REWARD_OFFSET_ADAPTIVE;
+    else return false;
+    return true;
+}
+
+int usage(const char* program) {
+    std::fprintf(stderr,
+                 "Usage: %s [--episodes n] [--steps n] [--hidden n] [--timesteps n] [--learning-rate x]\n"
+                 "          [--gamma x] [--epsilon x] [--epsilon-min x] [--epsilon-decay n] [--batch n]\n"
+                 "          [--target-update n] [--reward simple|complex|efficient|offset-adaptive]\n"
+                 "          [--offset-range x] [--seed n] [--out file] [--save-every n] [--log-every n]\n"
+                 "          [--telemetry file]\n",
+                 program);
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    train::Hyperparameters params;
+    dqn::RobotConfig config;
+    int timesteps = 1;
+    uint64_t seed = 1;
+    std::string outPath;
+    std::string telemetryPath;
+    int saveEvery = 0;
+    int logEvery = 10;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (i + 1 >= argc) return usage(argv[0]);
+        const char* value = argv[++i];
+        if (std::strcmp(arg, "--episodes") == 0) params.maxEpisodes = std::atoi(value);
+        else if (std::strcmp(arg, "--steps") == 0) params.maxStepsPerEpisode = std::atoi(value);
+        else if (std::strcmp(arg, "--hidden") == 0) params.hiddenSize = std::atoi(value);
+        else if (std::strcmp(arg, "--timesteps") == 0) timesteps = std::atoi(value);
+        else if (std::strcmp(arg, "--learning-rate") == 0) params.learningRate = std::atof(value);
+        else if (std::strcmp(arg, "--gamma") == 0) params.gamma = std::atof(value);
+        else if (std::strcmp(arg, "--epsilon") == 0) params.epsilon = std::atof(value);
+        else if (std::strcmp(arg, "--epsilon-min") == 0) params.epsilonMin = std::atof(value);
+        else if (std::strcmp(arg, "--epsilon-decay") == 0) params.epsilonDecay = std::atoi(value);
+        else if (std::strcmp(arg, "--batch") == 0) params.batchSize = std::atoi(value);
+        else if (std::strcmp(arg, "--target-update") == 0) params.targetUpdateFreq = std::atoi(value);
+        else if (std::strcmp(arg, "--offset-range") == 0) config.trainingOffsetRange = std::atof(value);
+        else if (std::strcmp(arg, "--seed") == 0) seed = std::strtoull(value, nullptr, 10);
+        else if (std::strcmp(arg, "--out") == 0) outPath = value;
+        else if (std::strcmp(arg, "--telemetry") == 0) telemetryPath = value;
+        else if (std::strcmp(arg, "--save-every") == 0) saveEvery = std::atoi(value);
+        else if (std::strcmp(arg, "--log-every") == 0) logEvery = std::atoi(value);
+        else if (std::strcmp(arg, "--reward") == 0) {
+            if (!parseReward(value, config.rewardType)) return usage(argv[0]);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    const train::InputHistory history(timesteps);
+    train::DQNTrainer trainer(history.inputSize(), params, seed);
+    dqn::BalancingRobot robot(config, seed);
+    params = trainer.hyperparameters();
+
+    if (!telemetryPath.empty()) {
+        train::TelemetryLog log;
+        if (!log.appendFile(telemetryPath.c_str())) {
+            std::fprintf(stderr, "Could not read %s\n", telemetryPath.c_str());
+            return 1;
+        }
+        const int transitions = train::replayTelemetry(trainer, log, robot.config());
+        std::printf("Replay memory seeded with %d transitions from %s (%zu records, %zu lost)\n", transitions,
+                    telemetryPath.c_str(), log.size(), log.lostRecords());
+    }
+
+    const std::string timestamp = train::exportTimestamp();
+    // The trainer normalizes by the robot's maxAngle; the export folds the same limits
+    const train::Normalization normalization(robot.config().maxAngle);
+    if (outPath.empty()) outPath = "two_wheel_bot_dqn_" + timestamp + ".cpp";
+
+    std::printf("Training %d-%d-%d DQN for %d episodes (%d steps max, batch %d, lr %g, gamma %g)\n",
+                history.inputSize(), params.hiddenSize, train::NUM_ACTIONS, params.maxEpisodes,
+                params.maxStepsPerEpisode, params.batchSize, params.learningRate, params.gamma);
+
+    const int window = 100;
+    double recentRewards[window] = {0.0};
+    double bestAverage = 0.0;
+    size_t stepAllocations = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int e = 0; e < params.maxEpisodes; e++) {
+        const size_t allocationsBefore = train::allocationCount();
+        const train::EpisodeResult result = trainer.runEpisode(robot, timesteps);
+        stepAllocations += train::allocationCount() - allocationsBefore;
+        recentRewards[e % window] = result.reward;
+
+        const int filled = e + 1 < window ? e + 1 : window;
+        double average = 0.0;
+        for (int i = 0; i < filled; i++) average += recentRewards[i];
+        average /= filled;
+        if (average > bestAverage) bestAverage = average;
+
+        if (logEvery > 0 && result.episode % logEvery == 0) {
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::printf("episode %5d  reward %9.2f  steps %5d  avg(%d) %9.2f  loss %.5f  epsilon %.3f  %.0f steps/s\n",
+                        result.episode, result.reward, result.steps, filled, average, result.loss, result.epsilon,
+                        elapsed > 0.0 ? trainer.getStepCount() / elapsed : 0.0);
+            std::fflush(stdout);
+        }
+        if (saveEvery > 0 && result.episode % saveEvery == 0 &&
+            !train::writeCppModel(outPath.c_str(), trainer.network(), timestamp, normalization)) {
+            std::fprintf(stderr, "Could not write %s\n", outPath.c_str());
+            return 1;
+        }
+    }
+
+    if (!train::writeCppModel(outPath.c_str(), trainer.network(), timestamp, normalization)) {
+        std::fprintf(stderr, "Could not write %s\n", outPath.c_str());
+        return 1;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%ld steps, %ld batches in %.1f s; best avg(%d) reward %.2f\n", trainer.getStepCount(),
+                trainer.getBatchCount(), elapsed, window, bestAverage);
+    std::printf("%zu heap allocations in training steps (%zu bytes of arena scratch)\n", stepAllocations,
+                train::DQNTrainer::scratchBytes(history.inputSize(), params.hiddenSize, params.batchSize));
+    std::printf("Wrote %s\n", outPath.c_str());
+    return 0;
+}
@@ -0,0 +1,352 @@
+/**
+ * C++ Exporter for Two-Wheel Balancing Robot DQN models
+ *
+ * Generates C++ source for deploying a trained Q-network on embedded targets
+ * (Arduino/AVR, ESP32, STM32) and on host builds.
+ *
+ * An export only defines its weight tables and instantiates the shared
+ * dqn::DQNPolicy template from native/include/DQNPolicy.h, which provides
+ * the unrolled, float-only inference code. Weight tables are static flash
+ * data (PROGMEM on AVR, constexpr .rodata elsewhere), so a TwoWheelBotDQN
+ * instance carries no per-instance weight copy.
+ *
+ * The input normalization (angle / maxAngle, angularVelocity / 10, as
+ * RobotState.getNormalizedInputs) is folded into the first layer: the
+ * policy clamps the raw state to the export's limits and the input weights
+ * hold the 1 / limit scale.
+ */
+
+/**
+ * Normalization of models that do not record their own: maxAngle = π/3, 10 rad/s
+ */
+export const DEFAULT_NORMALIZATION = { maxAngle: Math.PI / 3, maxAngularVelocity: 10 };
+
+/**
+ * Network input for a raw state, as RobotState.getNormalizedInputs
+ * @param {number} angle - Robot angle in radians
+ * @param {number} angularVelocity - Angular velocity in rad/s
+ * @param {Object} normalization - {maxAngle, maxAngularVelocity} (default: DEFAULT_NORMALIZATION)
+ * @returns {number[]} [normalizedAngle, normalizedAngularVelocity], clamped to [-1, 1]
+ */
+export function normalizeState(angle, angularVelocity, normalization = DEFAULT_NORMALIZATION) {
+    return [
+        Math.max(-1, Math.min(1, angle / normalization.maxAngle)),
+        Math.max(-1, Math.min(1, angularVelocity / normalization.maxAngularVelocity))
+    ];
+}
+
+/**
+ * Fold the input normalization into input-major first-layer weights
+ * Even inputs are angles and odd inputs angular velocities (one pair per
+ * history timestep); each weight is divided by its input's limit.
+ * @param {Array|Float32Array} weightsInputHidden - Input-major [inputSize x hiddenSize]
+ * @param {number} inputSize
+ * @param {number} hiddenSize
+ * @param {Object} normalization - {maxAngle, maxAngularVelocity}
+ * @param {number} direction - 1 to fold, -1 to undo a fold (default: 1)
+ * @returns {number[]} Weights over raw (clamped) inputs
+ */
+export function foldNormalization(weightsInputHidden, inputSize, hiddenSize, normalization, direction = 1) {
+    const folded = new Array(inputSize * hiddenSize);
+    for (let i = 0; i < inputSize; i++) {
+        const limit = i % 2 === 0 ? normalization.maxAngle : normalization.maxAngularVelocity;
+        for (let h = 0; h < hiddenSize; h++) {
+            const w = weightsInputHidden[i * hiddenSize + h];
+            folded[i * hiddenSize + h] = direction > 0 ? w / limit : w * limit;
+        }
+    }
+    return folded;
+}
+
+/**
+ * Weight layouts understood by DQNPolicy.h
+ * - input-major: CPUBackend order (weightsInputHidden[i * HIDDEN + h],
+ *   weightsHiddenOutput[h * OUTPUT + o]); works with every kernel
+ * - neuron-major: transposed so each neuron's weights are contiguous,
+ *   rows zero-padded to `align` floats; better flash prefetch and cache
+ *   behaviour for the scalar path on ESP32/STM32
+ */
+export const WEIGHT_LAYOUTS = ['input-major', 'neuron-major'];
+
+/**
+ * Output layers understood by DQNPolicy.h
+ * - q-values: one output row per action (dqn::DQNPolicy)
+ * - difference: OUTPUT_SIZE - 1 rows holding Q[o + 1] - Q[0]
+ *   (dqn::DQNDifferencePolicy); same argmax from one fewer output dot
+ *   product per tick, input-major layout only
+ */
+export const OUTPUT_MODES = ['q-values', 'difference'];
+
+/**
+ * Subtract action 0's output weights and bias from every other action
+ * @param {Array|Float32Array} weightsHiddenOutput - Hidden-major [hiddenSize x outputSize]
+ * @param {Array|Float32Array} biasOutput - [outputSize]
+ * @param {number} hiddenSize
+ * @param {number} outputSize
+ * @returns {{weightsHiddenOutput: number[], biasOutput: number[]}} Hidden-major
+ *          [hiddenSize x (outputSize - 1)] differences and their biases
+ */
+export function actionDifferences(weightsHiddenOutput, biasOutput, hiddenSize, outputSize) {
+    const differences = [];
+    for (let h = 0; h < hiddenSize; h++) {
+        for (let o = 1; o < outputSize; o++) {
+            differences.push(weightsHiddenOutput[h * outputSize + o] - weightsHiddenOutput[h * outputSize]);
+        }
+    }
+    const biases = [];
+    for (let o = 1; o < outputSize; o++) biases.push(biasOutput[o] - biasOutput[0]);
+    return { weightsHiddenOutput: differences, biasOutput: biases };
+}
+
+/**
+ * Transpose a row-major [rows x cols] table to [cols x stride]
+ * @param {Array|Float32Array} values - Row-major values
+ * @param {number} rows - Source rows
+ * @param {number} cols - Source columns
+ * @param {number} stride - Padded length of each transposed row (>= rows)
+ * @returns {number[]} Transposed values, padding filled with zeros
+ */
+export function transposeWeights(values, rows, cols, stride) {
+    const transposed = new Array(cols * stride).fill(0);
+    for (let r = 0; r < rows; r++) {
+        for (let c = 0; c < cols; c++) {
+            transposed[c * stride + r] = values[r * cols + c];
+        }
+    }
+    return transposed;
+}
+
+/**
+ * Pad a length up to a multiple of align
+ * @param {number} length
+ * @param {number} align
+ * @returns {number}
+ */
+export function paddedStride(length, align) {
+    return Math.ceil(length / align) * align;
+}
+
+/**
+ * Generate C++ source for a trained network
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {string} timestamp - Export timestamp used in the file header
+ * @param {Object} options - Export options
+ * @param {string} options.layout - 'input-major' (default) or 'neuron-major'
+ * @param {number} options.align - Neuron-major row padding in floats (default: 1)
+ * @param {string} options.outputMode - 'q-values' (default) or 'difference'
+ * @param {Object} options.pruning - pruneNetwork() report to record in the header
+ * @param {Object} options.normalization - {maxAngle, maxAngularVelocity} the
+ *                 network was trained with (default: DEFAULT_NORMALIZATION)
+ * @returns {string} C++ source code
+ */
+export function generateCppCode(weights, architecture, timestamp, options = {}) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const layout = options.layout || 'input-major';
+    if (!WEIGHT_LAYOUTS.includes(layout)) {
+        throw new Error(`Unknown weight layout: ${layout}`);
+    }
+    const outputMode = options.outputMode || 'q-values';
+    if (!OUTPUT_MODES.includes(outputMode)) {
+        throw new Error(`Unknown output mode: ${outputMode}`);
+    }
+    const neuronMajor = layout === 'neuron-major';
+    const align = neuronMajor ? (options.align || 1) : 1;
+    if (outputMode === 'difference' && neuronMajor) {
+        throw new Error('Difference outputs need the input-major layout');
+    }
+
+    const normalization = options.normalization || DEFAULT_NORMALIZATION;
+    let weightsInputHidden = foldNormalization(weights.weightsInputHidden, inputSize, hiddenSize, normalization);
+    let weightsHiddenOutput = weights.weightsHiddenOutput;
+    let biasOutput = weights.biasOutput;
+    let inputHiddenLabel = 'weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]';
+    let hiddenOutputLabel = 'weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]';
+    let biasOutputLabel = 'biasOutput[OUTPUT_SIZE]';
+    let layoutDeclaration = '';
+    let weightsType = 'dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE>';
+    let policyType = `dqn::DQNPolicy<TwoWheelBotDQNWeights::INPUT_SIZE,
+                       TwoWheelBotDQNWeights::HIDDEN_SIZE,
+                       TwoWheelBotDQNWeights::OUTPUT_SIZE,
+                       dqn::ReLU,
+                       TwoWheelBotDQNWeights::weights,
+                       dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> >`;
+
+    if (neuronMajor) {
+        const inputStride = paddedStride(inputSize, align);
+        const hiddenStride = paddedStride(hiddenSize, align);
+        weightsInputHidden = transposeWeights(weightsInputHidden, inputSize, hiddenSize, inputStride);
+        weightsHiddenOutput = transposeWeights(weights.weightsHiddenOutput, hiddenSize, outputSize, hiddenStride);
+        inputHiddenLabel = `weightsInputHidden[HIDDEN_SIZE * ${inputStride}] (neuron-major)`;
+        hiddenOutputLabel = `weightsHiddenOutput[OUTPUT_SIZE * ${hiddenStride}] (neuron-major)`;
+        layoutDeclaration = `
+    // Each neuron's weights are contiguous, rows padded to ${align} floats
+    typedef dqn::NeuronMajor<${align}> Layout;
+`;
+        weightsType = 'dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE, Layout>';
+        policyType = `dqn::DQNLayoutPolicy<TwoWheelBotDQNWeights::INPUT_SIZE,
+                             TwoWheelBotDQNWeights::HIDDEN_SIZE,
+                             TwoWheelBotDQNWeights::OUTPUT_SIZE,
+                             dqn::ReLU,
+                             TwoWheelBotDQNWeights::Layout,
+                             TwoWheelBotDQNWeights::weights,
+                             dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> >`;
+    }
+
+    if (outputMode === 'difference') {
+        ({ weightsHiddenOutput, biasOutput } = actionDifferences(
+            weights.weightsHiddenOutput, weights.biasOutput, hiddenSize, outputSize));
+        hiddenOutputLabel = 'weightsHiddenOutput[HIDDEN_SIZE * (OUTPUT_SIZE - 1)] (Q[o + 1] - Q[0])';
+        biasOutputLabel = 'biasOutput[OUTPUT_SIZE - 1] (Q[o + 1] - Q[0])';
+        layoutDeclaration = `
+    // Output rows are action differences relative to action 0
+`;
+        weightsType = 'dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE - 1>';
+        policyType = `dqn::DQNDifferencePolicy<TwoWheelBotDQNWeights::INPUT_SIZE,
+                                 TwoWheelBotDQNWeights::HIDDEN_SIZE,
+                                 TwoWheelBotDQNWeights::OUTPUT_SIZE,
+                                 dqn::ReLU,
+                                 TwoWheelBotDQNWeights::weights,
+                                 dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> >`;
+    }
+
+    return `/**
+ * Two-Wheel Balancing Robot DQN Model
+ * Generated: ${timestamp}
+ * Architecture: ${inputSize}-${hiddenSize}-${outputSize}
+ * History timesteps: ${inputSize / 2}
+${formatNormalizationLine(normalization)}${formatPruningReport(options.pruning)} *
+ * This file contains the trained neural network weights for deployment
+ * on embedded systems (Arduino, ESP32, STM32, etc.)
+ *
+ * Inference code lives in DQNPolicy.h (native/include/ in the simulator
+ * repository); copy it next to this file. Weights live in flash only and
+ * TwoWheelBotDQN instances hold no data.
+ */
+
+#include "DQNPolicy.h"
+
+${MODEL_NAMESPACE_BEGIN}
+namespace TwoWheelBotDQNWeights {
+    static const int INPUT_SIZE = ${inputSize};
+    static const int HIDDEN_SIZE = ${hiddenSize};
+    static const int OUTPUT_SIZE = ${outputSize};
+
+    // Inputs are clamped to these limits (rad, rad/s); the first layer holds the 1 / limit normalization
+    struct InputLimits {
+        static constexpr float maxAngle() { return ${formatFloat(normalization.maxAngle)}; }
+        static constexpr float maxAngularVelocity() { return ${formatFloat(normalization.maxAngularVelocity)}; }
+    };
+${layoutDeclaration}
+    // Network weights (stored in program memory to save RAM)
+    static DQN_FLASH ${weightsType} weights DQN_PROGMEM = {
+${formatWeightTable(inputHiddenLabel, formatWeights(weightsInputHidden, 8, formatFloat))},
+${formatWeightTable('biasHidden[HIDDEN_SIZE]', formatWeights(weights.biasHidden, 8))},
+${formatWeightTable(hiddenOutputLabel, formatWeights(weightsHiddenOutput, 8))},
+${formatWeightTable(biasOutputLabel, formatWeights(biasOutput, 8))}
+    };
+}
+
+typedef ${policyType} TwoWheelBotDQN;
+
+${MODEL_NAMESPACE_END}
+${formatUsageExample('TwoWheelBotDQN', inputSize)}`;
+}
+
+/**
+ * Lines opening and closing an export's optional namespace: an includer
+ * that defines DQN_MODEL_NAMESPACE gets the weights and the policy typedef
+ * inside that namespace, so several exports link into one binary
+ */
+export const MODEL_NAMESPACE_BEGIN = `// Define DQN_MODEL_NAMESPACE before including to link several models into one binary
+#if defined(DQN_MODEL_NAMESPACE)
+namespace DQN_MODEL_NAMESPACE {
+#endif
+`;
+export const MODEL_NAMESPACE_END = `#if defined(DQN_MODEL_NAMESPACE)
+} // namespace DQN_MODEL_NAMESPACE
+#endif
+`;
+
+/**
+ * Format the normalization a model was trained with as a file header line
+ * @param {Object} normalization - {maxAngle, maxAngularVelocity}
+ * @returns {string} Comment line
+ */
+export function formatNormalizationLine(normalization) {
+    return ` * Normalization: maxAngle ${formatFloat(normalization.maxAngle).slice(0, -1)} rad, ` +
+        `maxAngularVelocity ${formatFloat(normalization.maxAngularVelocity).slice(0, -1)} rad/s\n`;
+}
+
+/**
+ * Format a pruneNetwork() report as file header lines
+ * @param {Object} report - Pruning report, or undefined
+ * @returns {string} Comment lines (empty without a report)
+ */
+export function formatPruningReport(report) {
+    if (!report) return '';
+    const percent = (report.agreementRate * 100).toFixed(2);
+    return ` * Pruned: ${report.originalHiddenSize} -> ${report.hiddenSize} hidden units ` +
+        `(${report.deadUnits.length} never active, ${report.linearUnits.length} always active merged into ` +
+        `${report.mergedUnits}, ${report.magnitudeUnits.length} by magnitude)\n` +
+        ` * Argmax agreement with the unpruned network: ${report.agreements}/${report.samples} (${percent}%) ` +
+        `on a ${report.gridSize}x${report.gridSize} grid\n`;
+}
+
+/**
+ * Format the usage comment closing an export
+ * Multi-timestep models (inputSize = 2 * timesteps) keep a state history,
+ * so their example shows the reset and the once-per-tick getAction call.
+ * @param {string} className - Policy typedef name
+ * @param {number} inputSize - Network input size
+ * @returns {string} Comment lines
+ */
+export function formatUsageExample(className, inputSize) {
+    const lines = ['// Usage example:', `// ${className} bot;`];
+    if (inputSize > 2) {
+        lines.push(`// bot.reset(angle, angularVelocity);  // fill the ${inputSize / 2}-step history`);
+        lines.push('// // each control tick (getAction records the state):');
+    }
+    lines.push('// int action = bot.getAction(angle, angularVelocity);');
+    lines.push('// float torque = bot.getMotorTorque(action);');
+    return lines.join('\n') + '\n';
+}
+
+/**
+ * Format one member of a weight-table aggregate initializer
+ * @param {string} label - Member name and extent, emitted as a comment
+ * @param {string} body - Formatted literal lines
+ * @returns {string} Commented brace-enclosed initializer
+ */
+export function formatWeightTable(label, body) {
+    return `        // ${label}\n        {\n${body.replace(/^/gm, '    ')}\n        }`;
+}
+
+/**
+ * Format a scalar as a single-precision C++ literal
+ * @param {number} value - Value to format
+ * @returns {string} Literal with 9 significant digits and an 'f' suffix
+ */
+export function formatFloat(value) {
+    const text = Number(Math.fround(value).toPrecision(9)).toString();
+    return (/[.e]/.test(text) ? text : text + '.0') + 'f';
+}
+
+/**
+ * Format a weight array as C++ float literals
+ * @param {Array|Float32Array} weights - Values to format
+ * @param {number} itemsPerLine - Number of values per output line
+ * @param {Function} format - Literal for one value (default: 6 decimals,
+ *                   as the trained weights; formatFloat for folded ones)
+ * @returns {string} Comma-separated, indented literal lines
+ */
+export function formatWeights(weights, itemsPerLine, format = w => w.toFixed(6) + 'f') {
+    const formatted = [];
+    for (let i = 0; i < weights.length; i += itemsPerLine) {
+        const line = Array.from(weights.slice(i, i + itemsPerLine))
+            .map(format)
+            .join(', ');
+        formatted.push('        ' + line);
+    }
+    return formatted.join(',\n');
+}
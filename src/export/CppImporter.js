@@ -0,0 +1,219 @@
+/**
+ * C++ Importer for Two-Wheel Balancing Robot DQN models
+ *
+ * Recovers architecture and weights from C++ files produced by CppExporter.
+ * Accepts the current layout (a dqn::DQNWeights aggregate whose members are
+ * labelled `// name[N]`), standalone `DQN_FLASH float ... DQN_PROGMEM`
+ * tables, and older exports that declared the tables as `const float`
+ * class members. Neuron-major exports are transposed back to CPUBackend
+ * order. Difference exports (dqn::DQNDifferencePolicy) import with a zero
+ * output row for action 0: Q-values become relative to action 0, which
+ * keeps every action choice. Folded first layers (an InputLimits struct)
+ * are scaled back to normalized inputs, and the limits are returned as the
+ * model's normalization.
+ */
+
+import { DEFAULT_NORMALIZATION, foldNormalization } from './CppExporter.js';
+
+/**
+ * Parse an exported C++ model
+ * @param {string} cppContent - C++ source text
+ * @param {string} filename - Original filename (used to recover the timestamp)
+ * @returns {Object} Imported model description for TwoWheelBotRL.loadImportedModel
+ */
+export function parseCppModel(cppContent, filename) {
+    // Extract architecture information
+    const inputSizeMatch = cppContent.match(/static const int INPUT_SIZE = (\d+);/);
+    const hiddenSizeMatch = cppContent.match(/static const int HIDDEN_SIZE = (\d+);/);
+    const outputSizeMatch = cppContent.match(/static const int OUTPUT_SIZE = (\d+);/);
+
+    if (!inputSizeMatch || !hiddenSizeMatch || !outputSizeMatch) {
+        throw new Error('Could not extract network architecture from C++ file');
+    }
+
+    const inputSize = parseInt(inputSizeMatch[1]);
+    const hiddenSize = parseInt(hiddenSizeMatch[1]);
+    const outputSize = parseInt(outputSizeMatch[1]);
+
+    // Extract weights arrays
+    let weightsInputHidden = extractWeightsArray(cppContent, 'weightsInputHidden');
+    const biasHidden = extractWeightsArray(cppContent, 'biasHidden');
+    let weightsHiddenOutput = extractWeightsArray(cppContent, 'weightsHiddenOutput');
+    let biasOutput = extractWeightsArray(cppContent, 'biasOutput');
+
+    // Neuron-major exports store both tables transposed and row-padded
+    const neuronMajorMatch = cppContent.match(/typedef dqn::NeuronMajor<(\d+)> Layout;/);
+    if (neuronMajorMatch) {
+        const align = parseInt(neuronMajorMatch[1]);
+        const inputStride = Math.ceil(inputSize / align) * align;
+        const hiddenStride = Math.ceil(hiddenSize / align) * align;
+        if (weightsInputHidden.length !== hiddenSize * inputStride) {
+            throw new Error(`Expected ${hiddenSize * inputStride} neuron-major input-to-hidden weights, got ${weightsInputHidden.length}`);
+        }
+        if (weightsHiddenOutput.length !== outputSize * hiddenStride) {
+            throw new Error(`Expected ${outputSize * hiddenStride} neuron-major hidden-to-output weights, got ${weightsHiddenOutput.length}`);
+        }
+        weightsInputHidden = fromNeuronMajor(weightsInputHidden, inputSize, hiddenSize, inputStride);
+        weightsHiddenOutput = fromNeuronMajor(weightsHiddenOutput, hiddenSize, outputSize, hiddenStride);
+    }
+
+    // Difference exports store Q[o + 1] - Q[0] rows only
+    if (/dqn::DQNDifferencePolicy</.test(cppContent)) {
+        if (weightsHiddenOutput.length !== hiddenSize * (outputSize - 1)) {
+            throw new Error(`Expected ${hiddenSize * (outputSize - 1)} hidden-to-output differences, got ${weightsHiddenOutput.length}`);
+        }
+        if (biasOutput.length !== outputSize - 1) {
+            throw new Error(`Expected ${outputSize - 1} output bias differences, got ${biasOutput.length}`);
+        }
+        ({ weightsHiddenOutput, biasOutput } = fromActionDifferences(weightsHiddenOutput, biasOutput, hiddenSize, outputSize));
+    }
+
+    // Validate dimensions
+    if (weightsInputHidden.length !== inputSize * hiddenSize) {
+        throw new Error(`Expected ${inputSize * hiddenSize} input-to-hidden weights, got ${weightsInputHidden.length}`);
+    }
+
+    // Exports with InputLimits hold weights over raw inputs; older ones use the default normalization
+    const limits = extractInputLimits(cppContent);
+    const normalization = limits || { ...DEFAULT_NORMALIZATION };
+    if (limits) {
+        weightsInputHidden = foldNormalization(weightsInputHidden, inputSize, hiddenSize, limits, -1);
+    }
+    if (biasHidden.length !== hiddenSize) {
+        throw new Error(`Expected ${hiddenSize} hidden biases, got ${biasHidden.length}`);
+    }
+    if (weightsHiddenOutput.length !== hiddenSize * outputSize) {
+        throw new Error(`Expected ${hiddenSize * outputSize} hidden-to-output weights, got ${weightsHiddenOutput.length}`);
+    }
+    if (biasOutput.length !== outputSize) {
+        throw new Error(`Expected ${outputSize} output biases, got ${biasOutput.length}`);
+    }
+
+    // Extract timestamp from filename or comment
+    const timestampMatch = filename.match(/(\d{4}-\d{2}-\d{2}T\d{2}-\d{2}-\d{2})/) ||
+                          cppContent.match(/Generated: (\d{4}-\d{2}-\d{2}T\d{2}-\d{2}-\d{2})/);
+    const timestamp = timestampMatch ? timestampMatch[1] : new Date().toISOString().replace(/[:.]/g, '-').slice(0, -5);
+
+    // Calculate parameter count
+    const parameterCount = weightsInputHidden.length + biasHidden.length +
+                          weightsHiddenOutput.length + biasOutput.length;
+
+    return {
+        name: `Imported_DQN_${timestamp}`,
+        architecture: { inputSize, hiddenSize, outputSize },
+        weights: {
+            architecture: {
+                inputSize: inputSize,
+                hiddenSize: hiddenSize,
+                outputSize: outputSize,
+                parameterCount: parameterCount
+            },
+            weightsInputHidden: Array.from(weightsInputHidden),
+            biasHidden: Array.from(biasHidden),
+            weightsHiddenOutput: Array.from(weightsHiddenOutput),
+            biasOutput: Array.from(biasOutput),
+            initMethod: 'imported'
+        },
+        normalization,
+        filename: filename,
+        timestamp: timestamp,
+        importDate: new Date().toISOString()
+    };
+}
+
+/**
+ * Read a folded export's input limits
+ * @param {string} cppContent - C++ source text
+ * @returns {Object|null} {maxAngle, maxAngularVelocity}, or null without an InputLimits struct
+ */
+export function extractInputLimits(cppContent) {
+    const limit = name => cppContent.match(new RegExp(`float ${name}\\(\\) \\{ return ([-+0-9.eE]+)f; \\}`));
+    const maxAngle = limit('maxAngle');
+    const maxAngularVelocity = limit('maxAngularVelocity');
+    if (!/struct InputLimits\b/.test(cppContent) || !maxAngle || !maxAngularVelocity) {
+        return null;
+    }
+    // Limits are stored as floats; the default ones map back to their exact values so re-exports are stable
+    const exact = (value, fallback) => (Math.fround(value) === Math.fround(fallback) ? fallback : value);
+    return {
+        maxAngle: exact(parseFloat(maxAngle[1]), DEFAULT_NORMALIZATION.maxAngle),
+        maxAngularVelocity: exact(parseFloat(maxAngularVelocity[1]), DEFAULT_NORMALIZATION.maxAngularVelocity)
+    };
+}
+
+/**
+ * Undo CppExporter's neuron-major transpose
+ * @param {number[]} values - [cols x stride] table
+ * @param {number} rows - Rows of the CPUBackend table
+ * @param {number} cols - Columns of the CPUBackend table
+ * @param {number} stride - Padded row length of the transposed table
+ * @returns {number[]} Row-major [rows x cols] values
+ */
+export function fromNeuronMajor(values, rows, cols, stride) {
+    const result = new Array(rows * cols);
+    for (let r = 0; r < rows; r++) {
+        for (let c = 0; c < cols; c++) {
+            result[r * cols + c] = values[c * stride + r];
+        }
+    }
+    return result;
+}
+
+/**
+ * Rebuild a full output layer from CppExporter's action differences
+ * @param {number[]} differences - Hidden-major [hiddenSize x (outputSize - 1)]
+ * @param {number[]} biases - [outputSize - 1]
+ * @param {number} hiddenSize
+ * @param {number} outputSize
+ * @returns {{weightsHiddenOutput: number[], biasOutput: number[]}} Hidden-major
+ *          [hiddenSize x outputSize] with action 0 at zero
+ */
+export function fromActionDifferences(differences, biases, hiddenSize, outputSize) {
+    const weightsHiddenOutput = new Array(hiddenSize * outputSize).fill(0);
+    for (let h = 0; h < hiddenSize; h++) {
+        for (let o = 1; o < outputSize; o++) {
+            weightsHiddenOutput[h * outputSize + o] = differences[h * (outputSize - 1) + o - 1];
+        }
+    }
+    return { weightsHiddenOutput, biasOutput: [0, ...biases] };
+}
+
+/**
+ * Extract a float array initializer by name
+ * @param {string} cppContent - C++ source text
+ * @param {string} arrayName - Array identifier (e.g. 'biasHidden')
+ * @returns {number[]} Parsed values
+ */
+export function extractWeightsArray(cppContent, arrayName) {
+    // Find the array declaration: `const float name[N] = {`, or the
+    // flash-resident form `static DQN_FLASH float name[N] DQN_PROGMEM = {`
+    const arrayPattern = new RegExp(`float\\s+${arrayName}\\s*\\[[^\\]]*\\][^={;]*=\\s*\\{([^}]+)\\};`, 's');
+    // DQNWeights aggregate: each member initializer is labelled `// name[N]`,
+    // optionally followed by a layout note
+    const memberPattern = new RegExp(`//\\s*${arrayName}\\[[^\\]]*\\][^\\n]*\\s*\\{([^}]+)\\}`, 's');
+    const match = cppContent.match(arrayPattern) || cppContent.match(memberPattern);
+
+    if (!match) {
+        throw new Error(`Could not find ${arrayName} array in C++ file`);
+    }
+
+    // Extract values between braces
+    const arrayContent = match[1];
+
+    // Parse individual values, handling potential line breaks and formatting
+    const values = arrayContent
+        .split(',')
+        .map(s => s.trim())
+        .filter(s => s.length > 0)
+        .map(s => {
+            // Remove 'f' suffix if present
+            const cleanValue = s.replace(/f$/, '');
+            const value = parseFloat(cleanValue);
+            if (isNaN(value)) {
+                throw new Error(`Invalid weight value: ${s}`);
+            }
+            return value;
+        });
+
+    return values;
+}
@@ -0,0 +1,255 @@
+/**
+ * Golden test vectors for Two-Wheel Balancing Robot DQN exports
+ *
+ * Writes <name>_golden.h next to an exported model: a fixed table of raw
+ * robot states with the outputs the JS side computes for them, so native
+ * builds (other compilers, -ffast-math, SIMD/DSP kernels, blobs) can check
+ * every precision against the network that trained it
+ * (native/tests/test_conformance.cpp):
+ * - Float Q-values and action: CPUBackend.forward (float32 tensors through
+ *   vectorMatrixMultiply) without its ±100 safety clamp, which the exports
+ *   do not apply either
+ * - int8 accumulators and action: the quantized export's integer pass on
+ *   inputs quantized as its ScaledInput does, bit-exact
+ * - Lookup-table action (single-timestep models): the lookup export's grid
+ *   indexed as DQNLookupPolicy does, bit-exact
+ *
+ * The states are a grid over and past the input limits, exact limits and
+ * tiny values, states within float rounding of a float action boundary,
+ * and seeded random sequences. Every sequence starts with a policy reset,
+ * so multi-timestep models check their state history too.
+ */
+
+import { vectorMatrixMultiply } from '../network/MatrixUtils.js';
+import {
+    DEFAULT_NORMALIZATION, formatFloat, formatNormalizationLine, formatPruningReport, normalizeState,
+    MODEL_NAMESPACE_BEGIN, MODEL_NAMESPACE_END
+} from './CppExporter.js';
+import { buildActionGrid, lookupAction } from './LookupExporter.js';
+import { argmax, quantizeNetwork, quantizedForwardInt8, quantizeRawState } from './QuantizedExporter.js';
+
+/**
+ * CPUBackend.forward on a network input, before the ±100 Q-value clamp
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {ArrayLike<number>} input - Normalized network input
+ * @returns {Float32Array} Q-values
+ */
+export function referenceForward(weights, architecture, input) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const hidden = vectorMatrixMultiply(Float32Array.from(input), Float32Array.from(weights.weightsInputHidden),
+                                        Float32Array.from(weights.biasHidden), inputSize, hiddenSize);
+    for (let h = 0; h < hiddenSize; h++) {
+        hidden[h] = Math.max(0, hidden[h]);
+    }
+    return vectorMatrixMultiply(hidden, Float32Array.from(weights.weightsHiddenOutput),
+                                Float32Array.from(weights.biasOutput), hiddenSize, outputSize);
+}
+
+/**
+ * xorshift32, so the random sequences are the same on every run
+ * @private
+ */
+function createRandom(seed) {
+    let state = seed >>> 0;
+    return () => {
+        state ^= state << 13;
+        state >>>= 0;
+        state ^= state >>> 17;
+        state ^= state << 5;
+        state >>>= 0;
+        return state / 4294967296;
+    };
+}
+
+/**
+ * Raw states to evaluate, as sequences of [angle, angularVelocity] in float32
+ * @private
+ */
+function goldenSequences(weights, architecture, normalization, options) {
+    const { maxAngle, maxAngularVelocity } = normalization;
+    const gridSize = options.gridSize || 13;
+    const boundaryCount = options.boundaryCount || 24;
+    const sequenceCount = options.sequenceCount || 16;
+    const sequenceLength = options.sequenceLength || 8;
+    const state = (angle, angularVelocity) => [Math.fround(angle), Math.fround(angularVelocity)];
+    // Action right after a reset with this state: every timestep holds it
+    const floatAction = (angle, angularVelocity) => argmax(referenceForward(weights, architecture,
+        new Array(architecture.inputSize / 2).fill(normalizeState(angle, angularVelocity, normalization)).flat()));
+    const sequences = [];
+
+    // Grid over 1.2x the limits, so clamping is covered
+    const gridAngle = a => 1.2 * maxAngle * (2 * a / (gridSize - 1) - 1);
+    const gridVelocity = v => 1.2 * maxAngularVelocity * (2 * v / (gridSize - 1) - 1);
+    for (let a = 0; a < gridSize; a++) {
+        for (let v = 0; v < gridSize; v++) {
+            sequences.push([state(gridAngle(a), gridVelocity(v))]);
+        }
+    }
+
+    // Exact limits, zero and values that flush to zero under -ffast-math
+    for (const [angle, angularVelocity] of [
+        [0, 0], [maxAngle, maxAngularVelocity], [-maxAngle, -maxAngularVelocity],
+        [maxAngle, -maxAngularVelocity], [1e-40, -1e-40], [-1e-30, 1e-30]
+    ]) {
+        sequences.push([state(angle, angularVelocity)]);
+    }
+
+    // Float action boundaries along the velocity axis of the grid: bisected
+    // to adjacent float32 values, so the Q-values there are near ties
+    const boundaries = [];
+    for (let a = 0; a < gridSize; a++) {
+        const angle = Math.fround(gridAngle(a) / 1.2);
+        for (let v = 0; v + 1 < gridSize; v++) {
+            let lo = Math.fround(gridVelocity(v) / 1.2);
+            let hi = Math.fround(gridVelocity(v + 1) / 1.2);
+            const loAction = floatAction(angle, lo);
+            if (loAction === floatAction(angle, hi)) continue;
+            for (let i = 0; i < 40; i++) {
+                const mid = Math.fround((lo + hi) / 2);
+                if (mid === lo || mid === hi) break;
+                if (floatAction(angle, mid) === loAction) lo = mid;
+                else hi = mid;
+            }
+            boundaries.push([state(angle, lo)], [state(angle, hi)]);
+        }
+    }
+    const step = Math.max(1, Math.floor(boundaries.length / boundaryCount));
+    for (let i = 0; i < boundaries.length && i / step < boundaryCount; i += step) {
+        sequences.push(boundaries[i]);
+    }
+
+    // Random sequences inside 1.1x the limits, for the state history
+    const random = createRandom(options.seed || 0x2545F491);
+    for (let s = 0; s < sequenceCount; s++) {
+        const sequence = [];
+        for (let t = 0; t < sequenceLength; t++) {
+            sequence.push(state(1.1 * maxAngle * (2 * random() - 1), 1.1 * maxAngularVelocity * (2 * random() - 1)));
+        }
+        sequences.push(sequence);
+    }
+    return sequences;
+}
+
+/**
+ * Evaluate the golden states with every JS reference
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {Object} options - Options
+ * @param {Object} options.normalization - {maxAngle, maxAngularVelocity} (default: DEFAULT_NORMALIZATION)
+ * @param {number} options.rows - Lookup grid rows, as the lookup export (default: 32)
+ * @param {number} options.cols - Lookup grid columns (default: rows)
+ * @param {number} options.gridSize - Grid states per axis (default: 13)
+ * @param {number} options.boundaryCount - Action-boundary states (default: 24)
+ * @param {number} options.sequenceCount - Random sequences (default: 16)
+ * @param {number} options.sequenceLength - States per random sequence (default: 8)
+ * @param {number} options.seed - Random sequence seed
+ * @returns {Object[]} One {angle, angularVelocity, reset, action, qValues,
+ *          int8Action, int8Accumulators, lookupAction} per state; lookupAction
+ *          is -1 for multi-timestep models
+ */
+export function generateGoldenVectors(weights, architecture, options = {}) {
+    const { inputSize } = architecture;
+    const timesteps = inputSize / 2;
+    const normalization = options.normalization || DEFAULT_NORMALIZATION;
+    const q = quantizeNetwork(weights, architecture);
+    const grid = inputSize === 2 ? buildActionGrid(weights, architecture, options) : null;
+
+    const vectors = [];
+    for (const sequence of goldenSequences(weights, architecture, normalization, options)) {
+        // Newest frame first; a reset fills every timestep with the first state
+        let frames = [];
+        let quantizedFrames = [];
+        sequence.forEach(([angle, angularVelocity], t) => {
+            const frame = normalizeState(angle, angularVelocity, normalization);
+            const quantizedFrame = quantizeRawState(angle, angularVelocity, normalization);
+            if (t === 0) {
+                frames = new Array(timesteps).fill(frame);
+                quantizedFrames = new Array(timesteps).fill(quantizedFrame);
+            } else {
+                frames = [frame].concat(frames.slice(0, timesteps - 1));
+                quantizedFrames = [quantizedFrame].concat(quantizedFrames.slice(0, timesteps - 1));
+            }
+
+            const qValues = referenceForward(weights, architecture, frames.flat());
+            const int8Accumulators = quantizedForwardInt8(q, quantizedFrames.flat());
+            let lookup = -1;
+            if (grid) {
+                const scaled = (value, limit) => Math.fround(Math.fround(value) * Math.fround(1 / limit));
+                lookup = lookupAction(grid, [scaled(angle, normalization.maxAngle),
+                                             scaled(angularVelocity, normalization.maxAngularVelocity)]);
+            }
+            vectors.push({
+                angle, angularVelocity, reset: t === 0,
+                action: argmax(qValues), qValues,
+                int8Action: argmax(int8Accumulators), int8Accumulators,
+                lookupAction: lookup
+            });
+        });
+    }
+    return vectors;
+}
+
+/**
+ * Generate the golden vector header for a trained network
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {string} timestamp - Export timestamp used in the file header
+ * @param {Object} options - Options passed to generateGoldenVectors(), plus
+ *                 options.pruning: pruneNetwork() report to record in the header
+ * @returns {Object} {code, vectors}
+ */
+export function generateGoldenCppCode(weights, architecture, timestamp, options = {}) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const normalization = options.normalization || DEFAULT_NORMALIZATION;
+    const vectors = generateGoldenVectors(weights, architecture, options);
+    const sequences = vectors.filter(v => v.reset).length;
+    const list = values => Array.from(values).join(', ');
+    const rows = vectors.map(v =>
+        `        {${formatFloat(v.angle)}, ${formatFloat(v.angularVelocity)}, ${v.reset}, ` +
+        `${v.action}, {${Array.from(v.qValues, formatFloat).join(', ')}}, ` +
+        `${v.int8Action}, {${list(v.int8Accumulators)}}, ${v.lookupAction}}`);
+
+    const code = `/**
+ * Two-Wheel Balancing Robot DQN Model (golden test vectors)
+ * Generated: ${timestamp}
+ * Architecture: ${inputSize}-${hiddenSize}-${outputSize}
+ * History timesteps: ${inputSize / 2}
+${formatNormalizationLine(normalization)}${formatPruningReport(options.pruning)} *
+ * ${vectors.length} raw states in ${sequences} sequences with the outputs the simulator computes
+ * for them: float Q-values and action (CPUBackend.forward without its ±100
+ * clamp), int8 accumulators and action of the _int8 export, and the action
+ * of the _lut export (-1 for multi-timestep models). Reset the policy with
+ * the state of every vector marked reset, then call forward once per vector.
+ * native/tests/test_conformance.cpp checks every kernel and precision
+ * against this table.
+ */
+
+#include <stdint.h>
+
+${MODEL_NAMESPACE_BEGIN}
+namespace TwoWheelBotDQNGolden {
+    static const int COUNT = ${vectors.length};
+    static const int INPUT_SIZE = ${inputSize};
+    static const int OUTPUT_SIZE = ${outputSize};
+
+    struct Vector {
+        float angle;                          // Raw state (rad, rad/s)
+        float angularVelocity;
+        bool reset;                           // Reset the policy with this state first
+        int action;                           // Float argmax
+        float qValues[OUTPUT_SIZE];
+        int int8Action;
+        int32_t int8Accumulators[OUTPUT_SIZE];
+        int lookupAction;
+    };
+
+    static const Vector vectors[COUNT] = {
+${rows.join(',\n')}
+    };
+}
+
+${MODEL_NAMESPACE_END}`;
+
+    return { code, vectors };
+}
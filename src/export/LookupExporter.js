@@ -0,0 +1,218 @@
+/**
+ * Lookup-table C++ Exporter for Two-Wheel Balancing Robot DQN models
+ *
+ * A single-timestep policy clamps both inputs to [-1, 1], so it is a fixed
+ * function from that square to an action. This exporter samples the float
+ * network offline into a rows x cols action grid over the normalized
+ * (angle, angularVelocity) square:
+ * - Rows split the normalized angle, columns the normalized angular velocity
+ * - Each cell holds the action chosen most often by the network on an
+ *   oversample x oversample sub-grid of the cell (ties: lowest action),
+ *   which minimizes the disagreement area inside the cell
+ * - Actions are packed 1, 2, 4 or 8 bits per cell, so a 32x32 grid of the
+ *   three-action model is 256 bytes of flash
+ *
+ * On the device a tick is two multiplies, two truncations and one table
+ * read (dqn::DQNLookupPolicy in DQNPolicy.h). The exporter reports how often
+ * the table agrees with the full float network on the same sweep as the
+ * int8 export.
+ */
+
+import { argmax, floatForward, weightFootprint } from './QuantizedExporter.js';
+import {
+    DEFAULT_NORMALIZATION, formatFloat, formatNormalizationLine, formatPruningReport, formatWeightTable,
+    normalizeState, MODEL_NAMESPACE_BEGIN, MODEL_NAMESPACE_END
+} from './CppExporter.js';
+
+/**
+ * Bits per cell for an action count (a power of two, so cells never
+ * straddle bytes)
+ * @param {number} outputSize - Number of actions
+ * @returns {number} 1, 2, 4 or 8
+ */
+export function cellBits(outputSize) {
+    if (outputSize > 256) {
+        throw new Error(`Lookup tables hold at most 256 actions, got ${outputSize}`);
+    }
+    return outputSize <= 2 ? 1 : outputSize <= 4 ? 2 : outputSize <= 16 ? 4 : 8;
+}
+
+/**
+ * Sample a single-timestep network into a packed action grid
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {Object} options - Grid options
+ * @param {number} options.rows - Cells along the normalized angle (default: 32)
+ * @param {number} options.cols - Cells along the normalized angular velocity (default: rows)
+ * @param {number} options.oversample - Network samples per cell and axis (default: 4)
+ * @returns {Object} {rows, cols, bits, actions (one per cell, row-major), packed}
+ */
+export function buildActionGrid(weights, architecture, options = {}) {
+    const { inputSize, outputSize } = architecture;
+    if (inputSize !== 2) {
+        throw new Error(`Lookup tables need a single-timestep model (INPUT_SIZE = 2), got ${inputSize}`);
+    }
+    const rows = options.rows || 32;
+    const cols = options.cols || rows;
+    const oversample = options.oversample || 4;
+    if (!(Number.isInteger(rows) && rows >= 1 && Number.isInteger(cols) && cols >= 1)) {
+        throw new Error(`Invalid lookup grid ${rows}x${cols}`);
+    }
+
+    const actions = new Uint8Array(rows * cols);
+    const votes = new Array(outputSize);
+    for (let r = 0; r < rows; r++) {
+        for (let c = 0; c < cols; c++) {
+            votes.fill(0);
+            for (let i = 0; i < oversample; i++) {
+                for (let j = 0; j < oversample; j++) {
+                    const angle = -1 + (2 * (r + (i + 0.5) / oversample)) / rows;
+                    const angularVelocity = -1 + (2 * (c + (j + 0.5) / oversample)) / cols;
+                    votes[argmax(floatForward(weights, architecture, [angle, angularVelocity]))]++;
+                }
+            }
+            actions[r * cols + c] = argmax(votes);
+        }
+    }
+
+    // Little-endian within each byte: cell k sits at bits (k % perByte) * bits
+    const bits = cellBits(outputSize);
+    const perByte = 8 / bits;
+    const packed = new Uint8Array(Math.ceil((rows * cols) / perByte));
+    actions.forEach((action, k) => {
+        packed[Math.floor(k / perByte)] |= action << ((k % perByte) * bits);
+    });
+    return { rows, cols, bits, actions, packed };
+}
+
+/**
+ * Action the generated lookup policy returns for a normalized input
+ * Mirrors the C++ index computation in single precision.
+ * @param {Object} grid - Grid from buildActionGrid()
+ * @param {ArrayLike<number>} input - Normalized [angle, angularVelocity]
+ * @returns {number} Action index
+ */
+export function lookupAction(grid, input) {
+    const cell = (value, count) => {
+        const clamped = Math.max(-1, Math.min(1, Math.fround(value)));
+        const index = Math.trunc(Math.fround(Math.fround(clamped + 1) * Math.fround(count * 0.5)));
+        return Math.min(index, count - 1);
+    };
+    return grid.actions[cell(input[0], grid.rows) * grid.cols + cell(input[1], grid.cols)];
+}
+
+/**
+ * Compare the lookup table with the float network over an (angle, angularVelocity) grid
+ * @param {Object} weights - Float network weights
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {Object} grid - Grid from buildActionGrid()
+ * @param {Object} options - Sweep options and normalization, as measureAgreement()
+ * @returns {Object} {samples, agreements, agreementRate, gridSize, maxAngle, maxAngularVelocity}
+ */
+export function measureLookupAgreement(weights, architecture, grid, options = {}) {
+    const gridSize = options.gridSize || 101;
+    const maxAngle = options.maxAngle || Math.PI / 3;
+    const maxAngularVelocity = options.maxAngularVelocity || 10;
+
+    let agreements = 0;
+    for (let a = 0; a < gridSize; a++) {
+        const angle = -maxAngle + (2 * maxAngle * a) / (gridSize - 1);
+        for (let v = 0; v < gridSize; v++) {
+            const angularVelocity = -maxAngularVelocity + (2 * maxAngularVelocity * v) / (gridSize - 1);
+            const input = normalizeState(angle, angularVelocity, options.normalization);
+            if (argmax(floatForward(weights, architecture, input)) === lookupAction(grid, input)) agreements++;
+        }
+    }
+
+    const samples = gridSize * gridSize;
+    return { samples, agreements, agreementRate: agreements / samples, gridSize, maxAngle, maxAngularVelocity };
+}
+
+/**
+ * Format packed cells as C++ hex literals
+ * @private
+ */
+function formatBytes(bytes, itemsPerLine) {
+    const formatted = [];
+    for (let i = 0; i < bytes.length; i += itemsPerLine) {
+        const line = Array.from(bytes.slice(i, i + itemsPerLine), b => '0x' + b.toString(16).padStart(2, '0').toUpperCase());
+        formatted.push('        ' + line.join(', '));
+    }
+    return formatted.join(',\n');
+}
+
+/**
+ * Generate lookup-table C++ source for a trained single-timestep network
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {string} timestamp - Export timestamp used in the file header
+ * @param {Object} options - Grid options passed to buildActionGrid(), sweep
+ *                 options passed to measureLookupAgreement(), plus
+ *                 options.pruning: pruneNetwork() report to record in the header and
+ *                 options.normalization: {maxAngle, maxAngularVelocity} the network
+ *                 was trained with (default: DEFAULT_NORMALIZATION)
+ * @returns {Object} {code, report, grid}
+ */
+export function generateLookupCppCode(weights, architecture, timestamp, options = {}) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const normalization = options.normalization || DEFAULT_NORMALIZATION;
+    const grid = buildActionGrid(weights, architecture, options);
+    const report = measureLookupAgreement(weights, architecture, grid, options);
+    report.tableBytes = grid.packed.length;
+    report.floatBytes = weightFootprint(architecture).floatBytes;
+    report.oversample = options.oversample || 4;
+
+    const code = `/**
+ * Two-Wheel Balancing Robot DQN Model (action lookup table)
+ * Generated: ${timestamp}
+ * Architecture: ${inputSize}-${hiddenSize}-${outputSize}
+ * History timesteps: 1
+${formatNormalizationLine(normalization)}${formatPruningReport(options.pruning)} *
+ * The float network sampled into a ${grid.rows}x${grid.cols} grid over the normalized
+ * (angle, angularVelocity) square with ${grid.bits}-bit cells: each cell holds the action
+ * the network picks most often on a ${report.oversample}x${report.oversample} sub-grid of the cell.
+ * A tick is one table read; there are no Q-values. Drop-in for getAction
+ * and getMotorTorque of the float TwoWheelBotDQN export. Inference code
+ * lives in DQNPolicy.h (native/include/); copy it next to this file.
+ *
+ * Lookup report (argmax agreement with the float network):
+ *   Sweep: ${report.gridSize}x${report.gridSize} grid, angle +/-${report.maxAngle.toFixed(4)} rad, angular velocity +/-${report.maxAngularVelocity} rad/s
+ *   Agreement: ${report.agreements}/${report.samples} (${(report.agreementRate * 100).toFixed(2)}%)
+ *   Table flash: ${report.tableBytes} bytes (float export: ${report.floatBytes} bytes)
+ */
+
+#include "DQNPolicy.h"
+
+${MODEL_NAMESPACE_BEGIN}
+namespace TwoWheelBotDQNLookupTable {
+    static const int ROWS = ${grid.rows};
+    static const int COLS = ${grid.cols};
+    static const int OUTPUT_SIZE = ${outputSize};
+
+    // Input scales: radians and rad/s to the table's [-1, 1] square (1 / limit)
+    struct InputScales {
+        static constexpr float angleScale() { return ${formatFloat(1 / normalization.maxAngle)}; }
+        static constexpr float angularVelocityScale() { return ${formatFloat(1 / normalization.maxAngularVelocity)}; }
+    };
+
+    // Row-major cells (row: angle, column: angular velocity), packed low bits first
+    static DQN_FLASH dqn::DQNActionGrid<ROWS, COLS, OUTPUT_SIZE> table DQN_PROGMEM = {
+${formatWeightTable('cells[BYTES]', formatBytes(grid.packed, 16))}
+    };
+}
+
+typedef dqn::DQNLookupPolicy<TwoWheelBotDQNLookupTable::ROWS,
+                             TwoWheelBotDQNLookupTable::COLS,
+                             TwoWheelBotDQNLookupTable::OUTPUT_SIZE,
+                             TwoWheelBotDQNLookupTable::table,
+                             dqn::ScaledInput<TwoWheelBotDQNLookupTable::InputScales> > TwoWheelBotDQNLookup;
+
+${MODEL_NAMESPACE_END}
+// Usage example:
+// TwoWheelBotDQNLookup bot;
+// int action = bot.getAction(angle, angularVelocity);
+// float torque = bot.getMotorTorque(action);
+`;
+
+    return { code, report, grid };
+}
@@ -0,0 +1,245 @@
+/**
+ * Binary model blob for Two-Wheel Balancing Robot DQN models
+ *
+ * A compact alternative to the generated C++: firmware binds a blob at run
+ * time (memory-mapped file on the host, flash partition on ESP32) through
+ * dqn::ModelBlob in native/include/DQNModelBlob.h, so policies can be
+ * swapped without recompiling, and the simulator imports it without text
+ * parsing.
+ *
+ * Layout (little-endian, version 1):
+ *   0   char[4]  magic "DQNB"
+ *   4   uint16   format version
+ *   6   uint16   header size (64)
+ *   8   uint32   CRC-32 of every byte after this field (bytes 12 .. totalSize)
+ *   12  uint32   total blob size
+ *   16  uint8    precision (0 = float32, 1 = int8)
+ *   17  uint8    activation (0 = ReLU)
+ *   18  uint8    hidden shift (int8 requantization, 0 for float32)
+ *   19  uint8    reserved (0)
+ *   20  uint16   input size, hidden size, output size, history timesteps
+ *   28  float32  angle scale: radians to network input units
+ *   32  float32  angular velocity scale: rad/s to network input units
+ *   36  float32  int8 weight scale, input-to-hidden (1 for float32)
+ *   40  float32  int8 weight scale, hidden-to-output (1 for float32)
+ *   44  uint32   offsets of the action torques, weightsInputHidden,
+ *                biasHidden, weightsHiddenOutput and biasOutput tensors
+ *
+ * Tensors follow the header, each starting on a 16-byte boundary, in
+ * CPUBackend (input-major) order. float32 blobs store float32 weights and
+ * biases; int8 blobs store quantizeNetwork() output: int8 weights and int32
+ * biases. Input units are the normalized [-1, 1] range for float32 and int8
+ * LSBs (normalized * 127) for int8; the scales come from the normalization
+ * the network was trained with (1 / maxAngle and 127 / maxAngle for the
+ * default π/3 are DQNPolicy.h's ANGLE_SCALE and QUANTIZED_ANGLE_SCALE).
+ */
+
+import { DEFAULT_NORMALIZATION } from './CppExporter.js';
+import { quantizeNetwork } from './QuantizedExporter.js';
+
+export const MODEL_BLOB_MAGIC = 'DQNB';
+export const MODEL_BLOB_VERSION = 1;
+export const MODEL_BLOB_HEADER_SIZE = 64;
+export const MODEL_BLOB_ALIGNMENT = 16;
+export const MODEL_BLOB_PRECISIONS = ['float32', 'int8'];
+
+const INT8_MAX = 127;
+
+// Motor torque for each action index (left, brake, right)
+const ACTION_TORQUES = [-1, 0, 1];
+
+const CRC32_TABLE = (() => {
+    const table = new Uint32Array(256);
+    for (let n = 0; n < 256; n++) {
+        let c = n;
+        for (let k = 0; k < 8; k++) {
+            c = c & 1 ? 0xEDB88320 ^ (c >>> 1) : c >>> 1;
+        }
+        table[n] = c >>> 0;
+    }
+    return table;
+})();
+
+/**
+ * CRC-32 (IEEE 802.3, as zlib and dqn::crc32)
+ * @param {Uint8Array} bytes
+ * @returns {number} Unsigned checksum
+ */
+export function crc32(bytes) {
+    let crc = 0xFFFFFFFF;
+    for (let i = 0; i < bytes.length; i++) {
+        crc = CRC32_TABLE[(crc ^ bytes[i]) & 0xFF] ^ (crc >>> 8);
+    }
+    return (crc ^ 0xFFFFFFFF) >>> 0;
+}
+
+/**
+ * Round a byte offset up to the tensor alignment
+ * @private
+ */
+function alignOffset(offset) {
+    return Math.ceil(offset / MODEL_BLOB_ALIGNMENT) * MODEL_BLOB_ALIGNMENT;
+}
+
+/**
+ * Generate a binary model blob for a trained network
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {Object} options - Export options
+ * @param {string} options.precision - 'float32' (default) or 'int8'
+ * @param {Object} options.normalization - {maxAngle, maxAngularVelocity} the
+ *                 network was trained with (default: DEFAULT_NORMALIZATION)
+ * @returns {Uint8Array} Blob bytes
+ */
+export function generateModelBlob(weights, architecture, options = {}) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const precision = options.precision || 'float32';
+    const normalization = options.normalization || DEFAULT_NORMALIZATION;
+    if (!MODEL_BLOB_PRECISIONS.includes(precision)) {
+        throw new Error(`Unknown blob precision: ${precision}`);
+    }
+    if (outputSize !== ACTION_TORQUES.length) {
+        throw new Error(`Expected ${ACTION_TORQUES.length} outputs (one per action), got ${outputSize}`);
+    }
+    const int8 = precision === 'int8';
+    const q = int8 ? quantizeNetwork(weights, architecture) : null;
+
+    // [name, typed array] in file order
+    const tensors = [
+        ['actionTorques', Float32Array.from(ACTION_TORQUES)],
+        ['weightsInputHidden', int8 ? q.weightsInputHidden : Float32Array.from(weights.weightsInputHidden)],
+        ['biasHidden', int8 ? q.biasHidden : Float32Array.from(weights.biasHidden)],
+        ['weightsHiddenOutput', int8 ? q.weightsHiddenOutput : Float32Array.from(weights.weightsHiddenOutput)],
+        ['biasOutput', int8 ? q.biasOutput : Float32Array.from(weights.biasOutput)]
+    ];
+
+    const offsets = [];
+    let size = MODEL_BLOB_HEADER_SIZE;
+    for (const [, values] of tensors) {
+        size = alignOffset(size);
+        offsets.push(size);
+        size += values.byteLength;
+    }
+
+    const bytes = new Uint8Array(size);
+    const view = new DataView(bytes.buffer);
+    for (let i = 0; i < 4; i++) view.setUint8(i, MODEL_BLOB_MAGIC.charCodeAt(i));
+    view.setUint16(4, MODEL_BLOB_VERSION, true);
+    view.setUint16(6, MODEL_BLOB_HEADER_SIZE, true);
+    view.setUint32(12, size, true);
+    view.setUint8(16, int8 ? 1 : 0);
+    view.setUint8(17, 0);
+    view.setUint8(18, int8 ? q.hiddenShift : 0);
+    view.setUint16(20, inputSize, true);
+    view.setUint16(22, hiddenSize, true);
+    view.setUint16(24, outputSize, true);
+    view.setUint16(26, inputSize / 2, true);
+    const inputUnits = int8 ? INT8_MAX : 1;
+    view.setFloat32(28, inputUnits / normalization.maxAngle, true);
+    view.setFloat32(32, inputUnits / normalization.maxAngularVelocity, true);
+    view.setFloat32(36, int8 ? q.weightScaleInputHidden : 1, true);
+    view.setFloat32(40, int8 ? q.weightScaleHiddenOutput : 1, true);
+    offsets.forEach((offset, i) => view.setUint32(44 + i * 4, offset, true));
+
+    tensors.forEach(([, values], i) => {
+        bytes.set(new Uint8Array(values.buffer, values.byteOffset, values.byteLength), offsets[i]);
+    });
+
+    view.setUint32(8, crc32(bytes.subarray(12)), true);
+    return bytes;
+}
+
+/**
+ * Parse a binary model blob
+ * int8 blobs are dequantized, so they import as the float network they
+ * approximate. The input scales are returned as the model's normalization.
+ * @param {ArrayBuffer|Uint8Array} buffer - Blob bytes
+ * @param {string} filename - Original filename (used to recover the timestamp)
+ * @returns {Object} Imported model description, as parseCppModel()
+ */
+export function parseModelBlob(buffer, filename) {
+    const bytes = buffer instanceof Uint8Array ? buffer : new Uint8Array(buffer);
+    if (bytes.length < MODEL_BLOB_HEADER_SIZE) {
+        throw new Error(`Model blob too small: ${bytes.length} bytes`);
+    }
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    const magic = String.fromCharCode(...bytes.subarray(0, 4));
+    if (magic !== MODEL_BLOB_MAGIC) {
+        throw new Error('Not a DQN model blob (bad magic)');
+    }
+    const version = view.getUint16(4, true);
+    if (version !== MODEL_BLOB_VERSION) {
+        throw new Error(`Unsupported model blob version ${version}`);
+    }
+    const totalSize = view.getUint32(12, true);
+    if (totalSize > bytes.length || totalSize < MODEL_BLOB_HEADER_SIZE) {
+        throw new Error(`Model blob truncated: header says ${totalSize} bytes, got ${bytes.length}`);
+    }
+    if (crc32(bytes.subarray(12, totalSize)) !== view.getUint32(8, true)) {
+        throw new Error('Model blob checksum mismatch');
+    }
+
+    const precision = view.getUint8(16);
+    if (precision >= MODEL_BLOB_PRECISIONS.length) {
+        throw new Error(`Unknown model blob precision ${precision}`);
+    }
+    const int8 = precision === 1;
+    const hiddenShift = view.getUint8(18);
+    const inputSize = view.getUint16(20, true);
+    const hiddenSize = view.getUint16(22, true);
+    const outputSize = view.getUint16(24, true);
+    const inputUnits = int8 ? INT8_MAX : 1;
+    const normalization = {
+        maxAngle: inputUnits / view.getFloat32(28, true),
+        maxAngularVelocity: inputUnits / view.getFloat32(32, true)
+    };
+    const weightScaleInputHidden = view.getFloat32(36, true);
+    const weightScaleHiddenOutput = view.getFloat32(40, true);
+
+    const tensor = (index, ArrayType, length) => {
+        const offset = view.getUint32(44 + index * 4, true);
+        if (offset + length * ArrayType.BYTES_PER_ELEMENT > totalSize) {
+            throw new Error('Model blob tensor out of bounds');
+        }
+        return Array.from(new ArrayType(bytes.slice(offset, offset + length * ArrayType.BYTES_PER_ELEMENT).buffer));
+    };
+
+    let weightsInputHidden, biasHidden, weightsHiddenOutput, biasOutput;
+    if (int8) {
+        // Same scales as quantizeNetwork: inputs 1/127, hidden 2^shift
+        const accScale1 = weightScaleInputHidden / INT8_MAX;
+        const accScale2 = accScale1 * Math.pow(2, hiddenShift) * weightScaleHiddenOutput;
+        weightsInputHidden = tensor(1, Int8Array, inputSize * hiddenSize).map(w => w * weightScaleInputHidden);
+        biasHidden = tensor(2, Int32Array, hiddenSize).map(b => b * accScale1);
+        weightsHiddenOutput = tensor(3, Int8Array, hiddenSize * outputSize).map(w => w * weightScaleHiddenOutput);
+        biasOutput = tensor(4, Int32Array, outputSize).map(b => b * accScale2);
+    } else {
+        weightsInputHidden = tensor(1, Float32Array, inputSize * hiddenSize);
+        biasHidden = tensor(2, Float32Array, hiddenSize);
+        weightsHiddenOutput = tensor(3, Float32Array, hiddenSize * outputSize);
+        biasOutput = tensor(4, Float32Array, outputSize);
+    }
+
+    const timestampMatch = filename.match(/(\d{4}-\d{2}-\d{2}T\d{2}-\d{2}-\d{2})/);
+    const timestamp = timestampMatch ? timestampMatch[1] : new Date().toISOString().replace(/[:.]/g, '-').slice(0, -5);
+    const parameterCount = weightsInputHidden.length + biasHidden.length +
+                          weightsHiddenOutput.length + biasOutput.length;
+
+    return {
+        name: `Imported_DQN_${timestamp}`,
+        architecture: { inputSize, hiddenSize, outputSize },
+        weights: {
+            architecture: { inputSize, hiddenSize, outputSize, parameterCount },
+            weightsInputHidden,
+            biasHidden,
+            weightsHiddenOutput,
+            biasOutput,
+            initMethod: 'imported'
+        },
+        precision: MODEL_BLOB_PRECISIONS[precision],
+        normalization,
+        filename: filename,
+        timestamp: timestamp,
+        importDate: new Date().toISOString()
+    };
+}
@@ -0,0 +1,173 @@
+/**
+ * Delta updates between binary model blobs
+ *
+ * A delta carries only the bytes of a new blob (ModelBlob.js) that differ
+ * from a base blob the device already runs, so a fine-tune that moves a few
+ * weights or one layer costs bytes instead of the whole blob over a slow
+ * link. The device rebuilds the new blob in its inactive slot from the
+ * active one (DoubleBufferedPolicy::beginDeltaUpdate in
+ * native/include/DQNPolicySlots.h, format in DQNModelDelta.h) and verifies
+ * it with the new blob's own CRC-32 before swapping.
+ *
+ * Layout (little-endian, version 1):
+ *   0   char[4]  magic "DQND"
+ *   4   uint16   format version
+ *   6   uint16   header size (24)
+ *   8   uint32   CRC-32 of every byte after this field (bytes 12 .. totalSize)
+ *   12  uint32   total delta size
+ *   16  uint32   base model ID: the CRC-32 field of the base blob
+ *   20  uint32   size of the blob the delta produces
+ *   24  records  uint32 offset, uint32 length, then length bytes of the new
+ *                blob at that offset; ascending and non-overlapping
+ *
+ * Bytes no record covers are copied from the base at the same offset, so
+ * every such byte must lie inside the base blob. Records stay within the
+ * tensor (or header) they patch, and changed runs closer than a record
+ * header's 8 bytes are merged into one record.
+ */
+
+import { crc32, MODEL_BLOB_HEADER_SIZE } from './ModelBlob.js';
+
+export const MODEL_DELTA_MAGIC = 'DQND';
+export const MODEL_DELTA_VERSION = 1;
+export const MODEL_DELTA_HEADER_SIZE = 24;
+export const MODEL_DELTA_RECORD_SIZE = 8;
+
+// Blob header fields naming its tensor offsets, in ModelBlob.js order
+const TENSOR_NAMES = ['actionTorques', 'weightsInputHidden', 'biasHidden', 'weightsHiddenOutput', 'biasOutput'];
+
+/**
+ * Model ID of a blob: the CRC-32 stored in its header
+ * @param {Uint8Array} blob - Blob bytes
+ * @returns {number} Unsigned ID
+ */
+export function modelBlobId(blob) {
+    return new DataView(blob.buffer, blob.byteOffset, blob.byteLength).getUint32(8, true);
+}
+
+/**
+ * Byte ranges of the header and each tensor of a blob, in file order
+ * Alignment padding belongs to the region before it.
+ * @private
+ */
+function blobRegions(blob) {
+    const view = new DataView(blob.buffer, blob.byteOffset, blob.byteLength);
+    const starts = TENSOR_NAMES.map((_, i) => view.getUint32(44 + i * 4, true));
+    const names = ['header', ...TENSOR_NAMES];
+    const bounds = [0, ...starts, blob.length];
+    return names.map((name, i) => ({ name, start: bounds[i], end: bounds[i + 1] }));
+}
+
+/**
+ * Generate a delta that turns base into target
+ * @param {Uint8Array} base - Blob the device runs
+ * @param {Uint8Array} target - New blob
+ * @returns {{delta: Uint8Array, changedTensors: string[], changedBytes: number}}
+ *          Delta bytes, the regions it patches ('header' plus tensor names)
+ *          and the blob bytes it carries
+ */
+export function generateModelDelta(base, target) {
+    for (const [label, blob] of [['Base', base], ['Target', target]]) {
+        if (blob.length < MODEL_BLOB_HEADER_SIZE || String.fromCharCode(...blob.subarray(0, 4)) !== 'DQNB') {
+            throw new Error(`${label} is not a DQN model blob`);
+        }
+    }
+
+    // [offset, end) runs of changed bytes, split at region boundaries
+    const records = [];
+    const changedTensors = [];
+    for (const { name, start, end } of blobRegions(target)) {
+        let changed = false;
+        for (let i = start; i < end; i++) {
+            if (i < base.length && base[i] === target[i]) continue;
+            changed = true;
+            const last = records[records.length - 1];
+            if (last && last.start >= start && i - last.end < MODEL_DELTA_RECORD_SIZE) {
+                last.end = i + 1;
+            } else {
+                records.push({ start: i, end: i + 1 });
+            }
+        }
+        if (changed) changedTensors.push(name);
+    }
+
+    let size = MODEL_DELTA_HEADER_SIZE;
+    for (const record of records) size += MODEL_DELTA_RECORD_SIZE + record.end - record.start;
+
+    const delta = new Uint8Array(size);
+    const view = new DataView(delta.buffer);
+    for (let i = 0; i < 4; i++) view.setUint8(i, MODEL_DELTA_MAGIC.charCodeAt(i));
+    view.setUint16(4, MODEL_DELTA_VERSION, true);
+    view.setUint16(6, MODEL_DELTA_HEADER_SIZE, true);
+    view.setUint32(12, size, true);
+    view.setUint32(16, modelBlobId(base), true);
+    view.setUint32(20, target.length, true);
+    let offset = MODEL_DELTA_HEADER_SIZE;
+    let changedBytes = 0;
+    for (const { start, end } of records) {
+        view.setUint32(offset, start, true);
+        view.setUint32(offset + 4, end - start, true);
+        delta.set(target.subarray(start, end), offset + MODEL_DELTA_RECORD_SIZE);
+        offset += MODEL_DELTA_RECORD_SIZE + end - start;
+        changedBytes += end - start;
+    }
+    view.setUint32(8, crc32(delta.subarray(12)), true);
+    return { delta, changedTensors, changedBytes };
+}
+
+/**
+ * Rebuild the target blob from its base and a delta, as the device does
+ * @param {Uint8Array} base - Blob the delta was generated against
+ * @param {Uint8Array} delta - generateModelDelta() output
+ * @returns {Uint8Array} Target blob, checked against its own CRC-32
+ */
+export function applyModelDelta(base, delta) {
+    if (delta.length < MODEL_DELTA_HEADER_SIZE || String.fromCharCode(...delta.subarray(0, 4)) !== MODEL_DELTA_MAGIC) {
+        throw new Error('Not a DQN model delta (bad magic)');
+    }
+    const view = new DataView(delta.buffer, delta.byteOffset, delta.byteLength);
+    const version = view.getUint16(4, true);
+    if (version !== MODEL_DELTA_VERSION) {
+        throw new Error(`Unsupported model delta version ${version}`);
+    }
+    const totalSize = view.getUint32(12, true);
+    if (totalSize > delta.length || totalSize < MODEL_DELTA_HEADER_SIZE) {
+        throw new Error(`Model delta truncated: header says ${totalSize} bytes, got ${delta.length}`);
+    }
+    if (crc32(delta.subarray(12, totalSize)) !== view.getUint32(8, true)) {
+        throw new Error('Model delta checksum mismatch');
+    }
+    if (view.getUint32(16, true) !== modelBlobId(base)) {
+        throw new Error('Model delta was generated against another base model');
+    }
+
+    const targetSize = view.getUint32(20, true);
+    const target = new Uint8Array(targetSize);
+    let written = 0;
+    const copyBase = (end) => {
+        if (written < end && end > base.length) {
+            throw new Error('Model delta leaves bytes past the end of the base uncovered');
+        }
+        target.set(base.subarray(written, end), written);
+        written = end;
+    };
+    for (let offset = MODEL_DELTA_HEADER_SIZE; offset < totalSize;) {
+        if (offset + MODEL_DELTA_RECORD_SIZE > totalSize) throw new Error('Model delta record truncated');
+        const start = view.getUint32(offset, true);
+        const length = view.getUint32(offset + 4, true);
+        offset += MODEL_DELTA_RECORD_SIZE;
+        if (start < written || start + length > targetSize || offset + length > totalSize) {
+            throw new Error('Model delta record out of order or out of bounds');
+        }
+        copyBase(start);
+        target.set(delta.subarray(offset, offset + length), start);
+        written = start + length;
+        offset += length;
+    }
+    copyBase(targetSize);
+
+    if (targetSize < MODEL_BLOB_HEADER_SIZE || crc32(target.subarray(12)) !== modelBlobId(target)) {
+        throw new Error('Patched model blob checksum mismatch');
+    }
+    return target;
+}
@@ -0,0 +1,272 @@
+/**
+ * Hidden-unit pruning for Two-Wheel Balancing Robot DQN models
+ *
+ * Exported policies clamp every input to [-1, 1], so each hidden unit's
+ * pre-activation b + sum(w_i * x_i) is bounded by b +/- sum|w_i| over the
+ * whole input domain. From those bounds:
+ * - Units that can never activate (upper bound <= 0), and units with all
+ *   output weights zero, contribute exactly nothing and are dropped
+ * - Units that are always active (lower bound >= 0) are linear over the
+ *   domain; when there are more of them than inputs they are merged into
+ *   one unit per input, proportional to x_i + 1, with their combined
+ *   output weights and the constant folded into the output biases
+ * - Optionally, the remaining units are removed in order of their largest
+ *   possible effect on the Q-value differences, keeping each removal only
+ *   while the argmax still agrees with the original network on at least
+ *   minAgreement of an (angle, angularVelocity) grid
+ *
+ * The result is an ordinary network with fewer hidden units, exported with
+ * CppExporter/ModelBlob like any other.
+ */
+
+import { normalizeState } from './CppExporter.js';
+import { argmax, floatForward } from './QuantizedExporter.js';
+
+export const PRUNING_MODES = ['off', 'dead', 'linear', 'magnitude'];
+
+/**
+ * Pre-activation range of every hidden unit over the input box [-1, 1]^inputSize
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @returns {Array<{low: number, high: number}>} One range per hidden unit
+ */
+export function hiddenUnitBounds(weights, architecture) {
+    const { inputSize, hiddenSize } = architecture;
+    const bounds = [];
+    for (let h = 0; h < hiddenSize; h++) {
+        let radius = 0;
+        for (let i = 0; i < inputSize; i++) radius += Math.abs(weights.weightsInputHidden[i * hiddenSize + h]);
+        bounds.push({ low: weights.biasHidden[h] - radius, high: weights.biasHidden[h] + radius });
+    }
+    return bounds;
+}
+
+/**
+ * Split a network into per-unit records
+ * @private
+ */
+function toUnits(weights, architecture) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const units = [];
+    for (let h = 0; h < hiddenSize; h++) {
+        const input = [];
+        for (let i = 0; i < inputSize; i++) input.push(weights.weightsInputHidden[i * hiddenSize + h]);
+        const output = [];
+        for (let o = 0; o < outputSize; o++) output.push(weights.weightsHiddenOutput[h * outputSize + o]);
+        units.push({ index: h, input, bias: weights.biasHidden[h], output });
+    }
+    return units;
+}
+
+/**
+ * Assemble CPUBackend-layout weights from unit records
+ * @private
+ */
+function fromUnits(units, biasOutput, inputSize, outputSize) {
+    const hiddenSize = units.length;
+    const weightsInputHidden = new Array(inputSize * hiddenSize);
+    const weightsHiddenOutput = new Array(hiddenSize * outputSize);
+    units.forEach((unit, h) => {
+        for (let i = 0; i < inputSize; i++) weightsInputHidden[i * hiddenSize + h] = unit.input[i];
+        for (let o = 0; o < outputSize; o++) weightsHiddenOutput[h * outputSize + o] = unit.output[o];
+    });
+    return {
+        weights: {
+            weightsInputHidden,
+            biasHidden: units.map(unit => unit.bias),
+            weightsHiddenOutput,
+            biasOutput: Array.from(biasOutput)
+        },
+        architecture: { inputSize, hiddenSize, outputSize }
+    };
+}
+
+/**
+ * Replace always-active units by one s * (x_i + 1) unit per input
+ * ReLU(s * z) = s * ReLU(z) for s > 0, so each merged unit is scaled to
+ * keep its weights within the ranges of the other units: a merged unit
+ * sums many output rows, and one oversized weight would coarsen the int8
+ * export's per-layer scales.
+ * @private
+ */
+function mergeLinearUnits(linearUnits, otherUnits, biasOutput, inputSize, outputSize) {
+    const merged = [];
+    const bias = Array.from(biasOutput);
+    for (let i = 0; i < inputSize; i++) {
+        const input = new Array(inputSize).fill(0);
+        input[i] = 1;
+        merged.push({ index: -1, input, bias: 1, output: new Array(outputSize).fill(0) });
+    }
+    for (const unit of linearUnits) {
+        for (let o = 0; o < outputSize; o++) {
+            bias[o] += unit.bias * unit.output[o];
+            for (let i = 0; i < inputSize; i++) {
+                // x_i = (x_i + 1) - 1
+                merged[i].output[o] += unit.input[i] * unit.output[o];
+                bias[o] -= unit.input[i] * unit.output[o];
+            }
+        }
+    }
+
+    const maxAbs = values => values.reduce((max, w) => Math.max(max, Math.abs(w)), 0);
+    const inputRange = maxAbs(otherUnits.flatMap(unit => unit.input));
+    const outputRange = maxAbs(otherUnits.flatMap(unit => unit.output));
+    for (const unit of merged) {
+        const outputMax = maxAbs(unit.output);
+        if (inputRange === 0 || outputRange === 0 || outputMax === 0) continue;
+        // Inside both ranges when possible, else equal overshoot in each layer
+        const scale = outputMax / outputRange <= inputRange
+            ? Math.max(outputMax / outputRange, Math.min(1, inputRange))
+            : Math.sqrt(outputMax * inputRange / outputRange);
+        unit.input = unit.input.map(w => w * scale);
+        unit.bias *= scale;
+        unit.output = unit.output.map(w => w / scale);
+    }
+    return { merged, biasOutput: bias };
+}
+
+/**
+ * Normalized grid inputs, as in measureAgreement(); every timestep repeats the state
+ * @private
+ */
+function sweepInputs(inputSize, options) {
+    const gridSize = options.gridSize || 101;
+    const maxAngle = options.maxAngle || Math.PI / 3;
+    const maxAngularVelocity = options.maxAngularVelocity || 10;
+    const inputs = [];
+    for (let a = 0; a < gridSize; a++) {
+        const angle = -maxAngle + (2 * maxAngle * a) / (gridSize - 1);
+        for (let v = 0; v < gridSize; v++) {
+            const angularVelocity = -maxAngularVelocity + (2 * maxAngularVelocity * v) / (gridSize - 1);
+            const state = normalizeState(angle, angularVelocity, options.normalization);
+            const input = new Float64Array(inputSize);
+            for (let i = 0; i < inputSize; i += 2) {
+                input[i] = state[0];
+                input[i + 1] = state[1];
+            }
+            inputs.push(input);
+        }
+    }
+    return { inputs, gridSize, maxAngle, maxAngularVelocity };
+}
+
+/**
+ * Argmax agreement and largest Q-value change between two networks
+ * @private
+ */
+function compareNetworks(reference, candidate, inputs) {
+    let agreements = 0;
+    let maxAbsQError = 0;
+    for (let s = 0; s < inputs.length; s++) {
+        const expected = reference.q[s];
+        const actual = floatForward(candidate.weights, candidate.architecture, inputs[s]);
+        if (reference.actions[s] === argmax(actual)) agreements++;
+        for (let o = 0; o < actual.length; o++) {
+            maxAbsQError = Math.max(maxAbsQError, Math.abs(expected[o] - actual[o]));
+        }
+    }
+    return { agreements, agreementRate: agreements / inputs.length, maxAbsQError };
+}
+
+/**
+ * Prune hidden units that are dead, linear or (optionally) negligible
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {Object} options - Pruning options
+ * @param {boolean} options.mergeLinear - Merge always-active units (default: true)
+ * @param {number} options.minAgreement - If set, also prune by magnitude while
+ *                 the argmax agreement stays at or above this rate (e.g. 0.99)
+ * @param {number} options.gridSize - Agreement sweep samples per axis (default: 101)
+ * @param {number} options.maxAngle - Angle sweep half-range in radians (default: π/3)
+ * @param {number} options.maxAngularVelocity - Angular velocity half-range in rad/s (default: 10)
+ * @param {Object} options.normalization - Network input normalization (default: DEFAULT_NORMALIZATION)
+ * @returns {Object} {weights, architecture, report}
+ */
+export function pruneNetwork(weights, architecture, options = {}) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const mergeLinear = options.mergeLinear !== false;
+    const minAgreement = options.minAgreement;
+    if (minAgreement !== undefined && !(minAgreement > 0 && minAgreement <= 1)) {
+        throw new Error(`minAgreement must be in (0, 1], got ${minAgreement}`);
+    }
+
+    const bounds = hiddenUnitBounds(weights, architecture);
+    const units = toUnits(weights, architecture);
+    const dead = units.filter(unit => bounds[unit.index].high <= 0 || unit.output.every(w => w === 0));
+    let live = units.filter(unit => !dead.includes(unit));
+
+    let linear = [];
+    let merged = [];
+    let biasOutput = Array.from(weights.biasOutput);
+    if (mergeLinear) {
+        const alwaysOn = live.filter(unit => bounds[unit.index].low >= 0);
+        if (alwaysOn.length > inputSize) {
+            linear = alwaysOn;
+            live = live.filter(unit => !linear.includes(unit));
+            ({ merged, biasOutput } = mergeLinearUnits(linear, live, biasOutput, inputSize, outputSize));
+        }
+    }
+
+    const sweep = sweepInputs(inputSize, options);
+    const reference = { q: [], actions: [] };
+    for (const input of sweep.inputs) {
+        const q = floatForward(weights, architecture, input);
+        reference.q.push(q);
+        reference.actions.push(argmax(q));
+    }
+    const build = kept => fromUnits(kept.concat(merged), biasOutput, inputSize, outputSize);
+
+    // Smallest possible effect on any Q-value difference goes first
+    const magnitude = [];
+    if (minAgreement !== undefined) {
+        const effect = unit => Math.max(0, bounds[unit.index].high) * (Math.max(...unit.output) - Math.min(...unit.output));
+        const candidates = live.slice().sort((a, b) => effect(a) - effect(b));
+        for (const unit of candidates) {
+            if (live.length <= 1) break;
+            const trial = live.filter(other => other !== unit);
+            if (compareNetworks(reference, build(trial), sweep.inputs).agreementRate >= minAgreement) {
+                live = trial;
+                magnitude.push(unit);
+            }
+        }
+    }
+
+    const pruned = build(live);
+    const comparison = compareNetworks(reference, pruned, sweep.inputs);
+    return {
+        weights: pruned.weights,
+        architecture: pruned.architecture,
+        report: {
+            originalHiddenSize: hiddenSize,
+            hiddenSize: pruned.architecture.hiddenSize,
+            deadUnits: dead.map(unit => unit.index),
+            linearUnits: linear.map(unit => unit.index),
+            mergedUnits: merged.length,
+            magnitudeUnits: magnitude.map(unit => unit.index),
+            minAgreement,
+            samples: sweep.inputs.length,
+            agreements: comparison.agreements,
+            agreementRate: comparison.agreementRate,
+            maxAbsQError: comparison.maxAbsQError,
+            gridSize: sweep.gridSize,
+            maxAngle: sweep.maxAngle,
+            maxAngularVelocity: sweep.maxAngularVelocity
+        }
+    };
+}
+
+/**
+ * Pruning options for a PRUNING_MODES entry
+ * @param {string} mode - 'off', 'dead', 'linear' or 'magnitude[:agreement]'
+ * @returns {Object|null} pruneNetwork() options, or null for 'off'
+ */
+export function pruningOptions(mode) {
+    const [name, agreement] = mode.split(':');
+    if (!PRUNING_MODES.includes(name)) {
+        throw new Error(`Unknown pruning mode: ${mode}`);
+    }
+    if (name === 'off') return null;
+    if (name === 'dead') return { mergeLinear: false };
+    if (name === 'linear') return {};
+    return { minAgreement: agreement ? parseFloat(agreement) : 0.99 };
+}
@@ -0,0 +1,374 @@
+/**
+ * Quantized C++ Exporter for Two-Wheel Balancing Robot DQN models
+ *
+ * Produces an integer-only variant of the exported controller for MCUs
+ * without an FPU:
+ * - Inputs quantized to int8 (scale 1/127 over the normalized [-1, 1] range)
+ * - Per-layer symmetric int8 weights (scale = max|w| / 127)
+ * - int32 biases and accumulators, integer ReLU
+ * - Hidden activations requantized to int16 with a rounding right shift
+ *   chosen from the worst-case accumulator over the input box
+ *
+ * Both layers use a single scale each, so the argmax can be taken directly
+ * on the int32 output accumulators without dequantizing.
+ *
+ * The exporter also sweeps (angle, angularVelocity) and reports how often
+ * the quantized argmax agrees with the float network.
+ */
+
+import {
+    DEFAULT_NORMALIZATION, formatFloat, formatNormalizationLine, formatWeightTable, formatUsageExample,
+    formatPruningReport, normalizeState, MODEL_NAMESPACE_BEGIN, MODEL_NAMESPACE_END
+} from './CppExporter.js';
+
+const INT8_MAX = 127;
+const INT16_MAX = 32767;
+
+/**
+ * Round half away from zero (matches the C++ conversion in the export)
+ * @private
+ */
+function roundHalfAway(value) {
+    return value < 0 ? -Math.floor(-value + 0.5) : Math.floor(value + 0.5);
+}
+
+/**
+ * Symmetric per-tensor int8 quantization
+ * @private
+ */
+function quantizeTensor(values) {
+    const maxAbs = values.reduce((m, v) => Math.max(m, Math.abs(v)), 0);
+    const scale = maxAbs > 0 ? maxAbs / INT8_MAX : 1;
+    const quantized = Int8Array.from(values, v => Math.max(-INT8_MAX, Math.min(INT8_MAX, roundHalfAway(v / scale))));
+    return { scale, quantized };
+}
+
+/**
+ * Quantize network weights
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @returns {Object} Quantized network with integer tensors and scales
+ */
+export function quantizeNetwork(weights, architecture) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const inputScale = 1 / INT8_MAX;
+
+    // Layer 1: int8 weights, int32 bias in accumulator units
+    const layer1 = quantizeTensor(weights.weightsInputHidden);
+    const accScale1 = inputScale * layer1.scale;
+    const biasHidden = Int32Array.from(weights.biasHidden, b => roundHalfAway(b / accScale1));
+
+    // Worst-case hidden accumulator over the clamped input box picks the shift
+    let maxHiddenAcc = 0;
+    for (let h = 0; h < hiddenSize; h++) {
+        let bound = biasHidden[h];
+        for (let i = 0; i < inputSize; i++) {
+            bound += INT8_MAX * Math.abs(layer1.quantized[i * hiddenSize + h]);
+        }
+        maxHiddenAcc = Math.max(maxHiddenAcc, bound);
+    }
+    let hiddenShift = 0;
+    while (requantize(maxHiddenAcc, hiddenShift) > INT16_MAX) {
+        hiddenShift++;
+    }
+    const hiddenScale = accScale1 * Math.pow(2, hiddenShift);
+
+    // Layer 2: int8 weights, int32 bias in output accumulator units
+    const layer2 = quantizeTensor(weights.weightsHiddenOutput);
+    const accScale2 = hiddenScale * layer2.scale;
+    const biasOutput = Int32Array.from(weights.biasOutput, b => roundHalfAway(b / accScale2));
+
+    return {
+        architecture: { inputSize, hiddenSize, outputSize },
+        inputScale,
+        weightsInputHidden: layer1.quantized,
+        weightScaleInputHidden: layer1.scale,
+        biasHidden,
+        hiddenShift,
+        hiddenScale,
+        weightsHiddenOutput: layer2.quantized,
+        weightScaleHiddenOutput: layer2.scale,
+        biasOutput,
+        outputScale: accScale2
+    };
+}
+
+/**
+ * Rounding arithmetic right shift of a non-negative accumulator
+ * @private
+ */
+function requantize(acc, shift) {
+    if (shift === 0) return acc;
+    return Math.floor((acc + Math.pow(2, shift - 1)) / Math.pow(2, shift));
+}
+
+/**
+ * Quantize one normalized input the way the generated C++ does
+ * @param {number} value - Normalized input in [-1, 1]
+ * @returns {number} int8 input
+ */
+export function quantizeInput(value) {
+    const clamped = Math.max(-1, Math.min(1, value));
+    return roundHalfAway(Math.fround(clamped * INT8_MAX));
+}
+
+/**
+ * Quantize one raw state the way the int8 export's ScaledInput does: a
+ * float32 multiply by the exported 127 / limit scales, clamp, and round
+ * half away from zero in float32
+ * @param {number} angle - Robot angle in radians
+ * @param {number} angularVelocity - Angular velocity in rad/s
+ * @param {Object} normalization - {maxAngle, maxAngularVelocity} (default: DEFAULT_NORMALIZATION)
+ * @returns {number[]} int8 [angle, angularVelocity]
+ */
+export function quantizeRawState(angle, angularVelocity, normalization = DEFAULT_NORMALIZATION) {
+    const quantize = (value, limit) => {
+        const scaled = Math.fround(Math.fround(value) * Math.fround(INT8_MAX / limit));
+        const clamped = Math.max(-INT8_MAX, Math.min(INT8_MAX, scaled));
+        return Math.trunc(Math.fround(clamped + (clamped < 0 ? -0.5 : 0.5)));
+    };
+    return [quantize(angle, normalization.maxAngle), quantize(angularVelocity, normalization.maxAngularVelocity)];
+}
+
+/**
+ * Bit-exact simulation of the generated integer forward pass
+ * @param {Object} q - Quantized network from quantizeNetwork()
+ * @param {ArrayLike<number>} input - Normalized inputs in [-1, 1]
+ * @returns {Int32Array} Output accumulators (Q-values / outputScale)
+ */
+export function quantizedForward(q, input) {
+    const x = Array.from({ length: q.architecture.inputSize }, (_, i) => quantizeInput(input[i]));
+    return quantizedForwardInt8(q, x);
+}
+
+/**
+ * Integer forward pass on already quantized inputs
+ * @param {Object} q - Quantized network from quantizeNetwork()
+ * @param {ArrayLike<number>} x - int8 inputs
+ * @returns {Int32Array} Output accumulators
+ */
+export function quantizedForwardInt8(q, x) {
+    const { inputSize, hiddenSize, outputSize } = q.architecture;
+    const hidden = new Int32Array(hiddenSize);
+    for (let h = 0; h < hiddenSize; h++) {
+        let acc = q.biasHidden[h];
+        for (let i = 0; i < inputSize; i++) {
+            acc += x[i] * q.weightsInputHidden[i * hiddenSize + h];
+        }
+        hidden[h] = acc > 0 ? requantize(acc, q.hiddenShift) : 0;
+    }
+
+    const output = new Int32Array(outputSize);
+    for (let o = 0; o < outputSize; o++) {
+        let acc = q.biasOutput[o];
+        for (let h = 0; h < hiddenSize; h++) {
+            acc += hidden[h] * q.weightsHiddenOutput[h * outputSize + o];
+        }
+        output[o] = acc;
+    }
+    return output;
+}
+
+/**
+ * Float reference forward pass (same math as CPUBackend.forward)
+ * @param {Object} weights - Network weights
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {ArrayLike<number>} input - Normalized inputs
+ * @returns {Float64Array} Q-values
+ */
+export function floatForward(weights, architecture, input) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const hidden = new Float64Array(hiddenSize);
+    for (let h = 0; h < hiddenSize; h++) {
+        let sum = weights.biasHidden[h];
+        for (let i = 0; i < inputSize; i++) {
+            sum += input[i] * weights.weightsInputHidden[i * hiddenSize + h];
+        }
+        hidden[h] = Math.max(0, sum);
+    }
+    const output = new Float64Array(outputSize);
+    for (let o = 0; o < outputSize; o++) {
+        let sum = weights.biasOutput[o];
+        for (let h = 0; h < hiddenSize; h++) {
+            sum += hidden[h] * weights.weightsHiddenOutput[h * outputSize + o];
+        }
+        output[o] = sum;
+    }
+    return output;
+}
+
+/**
+ * Index of the first maximum (same tie-break as the generated getAction)
+ * @param {ArrayLike<number>} values - Q-values
+ * @returns {number} Action index
+ */
+export function argmax(values) {
+    let best = 0;
+    for (let i = 1; i < values.length; i++) {
+        if (values[i] > values[best]) best = i;
+    }
+    return best;
+}
+
+/**
+ * Compare quantized and float argmax over an (angle, angularVelocity) grid
+ * @param {Object} weights - Float network weights
+ * @param {Object} q - Quantized network
+ * @param {Object} options - Sweep options
+ * @param {number} options.gridSize - Samples per axis (default: 101)
+ * @param {number} options.maxAngle - Angle sweep half-range in radians (default: π/3)
+ * @param {number} options.maxAngularVelocity - Angular velocity half-range in rad/s (default: 10)
+ * @param {Object} options.normalization - Network input normalization (default: DEFAULT_NORMALIZATION)
+ * @returns {Object} {samples, agreements, agreementRate, maxAbsQError}
+ */
+export function measureAgreement(weights, q, options = {}) {
+    const gridSize = options.gridSize || 101;
+    const maxAngle = options.maxAngle || Math.PI / 3;
+    const maxAngularVelocity = options.maxAngularVelocity || 10;
+    const { inputSize } = q.architecture;
+
+    let agreements = 0;
+    let maxAbsQError = 0;
+    const input = new Float64Array(inputSize);
+
+    for (let a = 0; a < gridSize; a++) {
+        const angle = -maxAngle + (2 * maxAngle * a) / (gridSize - 1);
+        for (let v = 0; v < gridSize; v++) {
+            const angularVelocity = -maxAngularVelocity + (2 * maxAngularVelocity * v) / (gridSize - 1);
+
+            // Same normalization as the float export; every timestep repeats the state
+            const state = normalizeState(angle, angularVelocity, options.normalization);
+            for (let i = 0; i < inputSize; i += 2) {
+                input[i] = state[0];
+                input[i + 1] = state[1];
+            }
+
+            const floatQ = floatForward(weights, q.architecture, input);
+            const intQ = quantizedForward(q, input);
+            if (argmax(floatQ) === argmax(intQ)) agreements++;
+            for (let o = 0; o < floatQ.length; o++) {
+                maxAbsQError = Math.max(maxAbsQError, Math.abs(floatQ[o] - intQ[o] * q.outputScale));
+            }
+        }
+    }
+
+    const samples = gridSize * gridSize;
+    return {
+        samples,
+        agreements,
+        agreementRate: agreements / samples,
+        maxAbsQError,
+        gridSize,
+        maxAngle,
+        maxAngularVelocity
+    };
+}
+
+/**
+ * Flash footprint of the float and quantized weight tables
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @returns {Object} {floatBytes, quantizedBytes}
+ */
+export function weightFootprint(architecture) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const weightCount = inputSize * hiddenSize + hiddenSize * outputSize;
+    const biasCount = hiddenSize + outputSize;
+    return {
+        floatBytes: (weightCount + biasCount) * 4,
+        quantizedBytes: weightCount + biasCount * 4
+    };
+}
+
+/**
+ * Format an integer array as C++ literals
+ * @private
+ */
+function formatIntegers(values, itemsPerLine) {
+    const formatted = [];
+    for (let i = 0; i < values.length; i += itemsPerLine) {
+        const line = Array.from(values.slice(i, i + itemsPerLine)).join(', ');
+        formatted.push('        ' + line);
+    }
+    return formatted.join(',\n');
+}
+
+/**
+ * Generate integer-only C++ source for a trained network
+ * @param {Object} weights - Network weights from CPUBackend.getWeights()
+ * @param {Object} architecture - {inputSize, hiddenSize, outputSize}
+ * @param {string} timestamp - Export timestamp used in the file header
+ * @param {Object} options - Sweep options passed to measureAgreement(), plus
+ *                 options.pruning: pruneNetwork() report to record in the header and
+ *                 options.normalization: {maxAngle, maxAngularVelocity} the network
+ *                 was trained with (default: DEFAULT_NORMALIZATION)
+ * @returns {Object} {code, report, quantized}
+ */
+export function generateQuantizedCppCode(weights, architecture, timestamp, options = {}) {
+    const { inputSize, hiddenSize, outputSize } = architecture;
+    const normalization = options.normalization || DEFAULT_NORMALIZATION;
+    const q = quantizeNetwork(weights, architecture);
+    const report = measureAgreement(weights, q, options);
+    const footprint = weightFootprint(architecture);
+    report.floatBytes = footprint.floatBytes;
+    report.quantizedBytes = footprint.quantizedBytes;
+
+    const code = `/**
+ * Two-Wheel Balancing Robot DQN Model (int8 quantized)
+ * Generated: ${timestamp}
+ * Architecture: ${inputSize}-${hiddenSize}-${outputSize}
+ * History timesteps: ${inputSize / 2}
+${formatNormalizationLine(normalization)}${formatPruningReport(options.pruning)} *
+ * Integer-only variant for MCUs without an FPU: int8 weights with one scale
+ * per layer, int32 accumulators, integer ReLU and int16 hidden activations.
+ * Drop-in API compatible with the float TwoWheelBotDQN export. Inference
+ * code lives in DQNPolicy.h (native/include/); copy it next to this file.
+ *
+ * Quantization report (argmax agreement with the float network):
+ *   Sweep: ${report.gridSize}x${report.gridSize} grid, angle +/-${report.maxAngle.toFixed(4)} rad, angular velocity +/-${report.maxAngularVelocity} rad/s
+ *   Agreement: ${report.agreements}/${report.samples} (${(report.agreementRate * 100).toFixed(2)}%)
+ *   Max |Q error|: ${report.maxAbsQError.toFixed(6)}
+ *   Weight flash: ${report.quantizedBytes} bytes (float export: ${report.floatBytes} bytes)
+ */
+
+#include "DQNPolicy.h"
+
+${MODEL_NAMESPACE_BEGIN}
+namespace TwoWheelBotDQNInt8Weights {
+    static const int INPUT_SIZE = ${inputSize};
+    static const int HIDDEN_SIZE = ${hiddenSize};
+    static const int OUTPUT_SIZE = ${outputSize};
+
+    // Hidden requantization: int16 = (acc + round) >> HIDDEN_SHIFT
+    static const int HIDDEN_SHIFT = ${q.hiddenShift};
+
+    // Input scales: radians and rad/s to int8 LSBs (127 / limit)
+    struct InputScales {
+        static constexpr float angleScale() { return ${formatFloat(INT8_MAX / normalization.maxAngle)}; }
+        static constexpr float angularVelocityScale() { return ${formatFloat(INT8_MAX / normalization.maxAngularVelocity)}; }
+    };
+
+    // Layer scales (real = integer * scale), for reference only
+    //   weightsInputHidden:  ${q.weightScaleInputHidden.toExponential(6)}
+    //   weightsHiddenOutput: ${q.weightScaleHiddenOutput.toExponential(6)}
+    //   Q-value per output LSB: ${q.outputScale.toExponential(6)}
+    static DQN_FLASH dqn::DQNQuantizedWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM = {
+${formatWeightTable('weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE]', formatIntegers(q.weightsInputHidden, 16))},
+${formatWeightTable('biasHidden[HIDDEN_SIZE]', formatIntegers(q.biasHidden, 8))},
+${formatWeightTable('weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE]', formatIntegers(q.weightsHiddenOutput, 16))},
+${formatWeightTable('biasOutput[OUTPUT_SIZE]', formatIntegers(q.biasOutput, 8))}
+    };
+}
+
+typedef dqn::QuantizedDQNPolicy<TwoWheelBotDQNInt8Weights::INPUT_SIZE,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SIZE,
+                                TwoWheelBotDQNInt8Weights::OUTPUT_SIZE,
+                                dqn::ReLU,
+                                TwoWheelBotDQNInt8Weights::HIDDEN_SHIFT,
+                                TwoWheelBotDQNInt8Weights::weights,
+                                dqn::ScaledInput<TwoWheelBotDQNInt8Weights::InputScales> > TwoWheelBotDQNInt8;
+
+${MODEL_NAMESPACE_END}
+${formatUsageExample('TwoWheelBotDQNInt8', inputSize)}`;
+
+    return { code, report, quantized: q };
+}
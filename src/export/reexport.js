@@ -0,0 +1,118 @@
+/**
+ * Re-export existing C++ models with the current exporter
+ *
+ * Parses each exported model and regenerates it in place, so models saved
+ * with an older exporter pick up changes to the generated class. Every
+ * variant keeps the normalization recorded in the model (π/3 and 10 rad/s
+ * for models exported before it was recorded).
+ *
+ * Usage: node src/export/reexport.js [--int8] [--blob] [--layout=neuron-major[:align]] [--outputs=difference] [--prune=mode] [--lut[=RxC]] [--golden] [--delta=base.dqnb] models/*.cpp
+ *   --int8    Also write the quantized variant next to each model (<name>_int8.cpp)
+ *   --blob    Also write binary model blobs (<name>.dqnb, and <name>_int8.dqnb with --int8)
+ *   --delta   With --blob, also write each blob of the base's precision as a delta
+ *             against the base blob (<name>.dqnd / <name>_int8.dqnd, see ModelDelta.js);
+ *             the base is read before anything is rewritten, so it may be one of the outputs
+ *   --layout  Weight layout of the float export (default: input-major)
+ *   --outputs Output layer of the float export: q-values (default) or difference
+ *   --prune   Prune hidden units first: dead, linear or magnitude[:agreement]
+ *             (see NetworkPruner.js); every variant is written from the pruned network
+ *   --lut     Also write an action lookup table (<name>_lut.cpp), RxC cells (default: 32x32);
+ *             single-timestep models only
+ *   --golden  Also write golden test vectors (<name>_golden.h) for every precision,
+ *             with the lookup grid of --lut (see GoldenVectors.js)
+ */
+
+import { readFileSync, writeFileSync } from 'fs';
+import { basename } from 'path';
+import { generateCppCode } from './CppExporter.js';
+import { parseCppModel } from './CppImporter.js';
+import { generateGoldenCppCode } from './GoldenVectors.js';
+import { generateLookupCppCode } from './LookupExporter.js';
+import { generateModelBlob, MODEL_BLOB_PRECISIONS } from './ModelBlob.js';
+import { generateModelDelta } from './ModelDelta.js';
+import { pruneNetwork, pruningOptions } from './NetworkPruner.js';
+import { generateQuantizedCppCode } from './QuantizedExporter.js';
+
+const args = process.argv.slice(2);
+const writeInt8 = args.includes('--int8');
+const writeBlob = args.includes('--blob');
+const layoutArg = args.find(arg => arg.startsWith('--layout='));
+const [layout, align] = layoutArg ? layoutArg.slice('--layout='.length).split(':') : ['input-major'];
+const outputsArg = args.find(arg => arg.startsWith('--outputs='));
+const outputMode = outputsArg ? outputsArg.slice('--outputs='.length) : 'q-values';
+const exportOptions = { layout, align: align ? parseInt(align) : 1, outputMode };
+const pruneArg = args.find(arg => arg.startsWith('--prune='));
+const pruneOptions = pruningOptions(pruneArg ? pruneArg.slice('--prune='.length) : 'off');
+const lutArg = args.find(arg => arg === '--lut' || arg.startsWith('--lut='));
+const [lutRows, lutCols] = lutArg && lutArg.includes('=') ? lutArg.slice('--lut='.length).split('x').map(n => parseInt(n)) : [32];
+const writeGolden = args.includes('--golden');
+const deltaArg = args.find(arg => arg.startsWith('--delta='));
+const deltaBase = deltaArg ? new Uint8Array(readFileSync(deltaArg.slice('--delta='.length))) : null;
+const deltaPrecision = deltaBase ? MODEL_BLOB_PRECISIONS[deltaBase[16]] : null;
+// Derived variants are regenerated from their float model, never parsed directly
+const files = args.filter(arg => !arg.startsWith('--') && !/_(int8|lut)\.cpp$/.test(arg));
+
+if (files.length === 0) {
+    console.error('Usage: node src/export/reexport.js [--int8] [--blob] [--layout=neuron-major[:align]] [--outputs=difference] [--prune=mode] [--lut[=RxC]] [--golden] [--delta=base.dqnb] <model.cpp> [...]');
+    process.exit(1);
+}
+
+for (const file of files) {
+    const model = parseCppModel(readFileSync(file, 'utf8'), basename(file));
+    const { normalization } = model;
+    let pruning;
+    if (pruneOptions) {
+        const pruned = pruneNetwork(model.weights, model.architecture, { ...pruneOptions, normalization });
+        ({ weights: model.weights, architecture: model.architecture, report: pruning } = pruned);
+    }
+    const cppCode = generateCppCode(model.weights, model.architecture, model.timestamp, { ...exportOptions, pruning, normalization });
+    writeFileSync(file, cppCode);
+    console.log(`Re-exported ${file} (${model.architecture.inputSize}-${model.architecture.hiddenSize}-${model.architecture.outputSize})`);
+    if (pruning) {
+        console.log(`  pruned from ${pruning.originalHiddenSize} hidden units, ` +
+                    `argmax agreement ${(pruning.agreementRate * 100).toFixed(2)}%`);
+    }
+
+    if (writeInt8) {
+        const int8File = file.replace(/\.cpp$/, '_int8.cpp');
+        const { code, report } = generateQuantizedCppCode(model.weights, model.architecture, model.timestamp, { pruning, normalization });
+        writeFileSync(int8File, code);
+        console.log(`  ${int8File}: argmax agreement ${(report.agreementRate * 100).toFixed(2)}%, ` +
+                    `${report.quantizedBytes} bytes (float ${report.floatBytes})`);
+    }
+
+    if (writeBlob) {
+        const precisions = writeInt8 ? ['float32', 'int8'] : ['float32'];
+        for (const precision of precisions) {
+            const blobFile = file.replace(/\.cpp$/, precision === 'int8' ? '_int8.dqnb' : '.dqnb');
+            const blob = generateModelBlob(model.weights, model.architecture, { precision, normalization });
+            writeFileSync(blobFile, blob);
+            console.log(`  ${blobFile}: ${blob.length} bytes`);
+            if (precision === deltaPrecision) {
+                const deltaFile = blobFile.replace(/\.dqnb$/, '.dqnd');
+                const { delta, changedTensors } = generateModelDelta(deltaBase, blob);
+                writeFileSync(deltaFile, delta);
+                console.log(`  ${deltaFile}: ${delta.length} bytes (${changedTensors.join(', ') || 'unchanged'})`);
+            }
+        }
+    }
+
+    if (lutArg && model.architecture.inputSize === 2) {
+        const lutFile = file.replace(/\.cpp$/, '_lut.cpp');
+        const { code, report } = generateLookupCppCode(model.weights, model.architecture, model.timestamp,
+                                                       { rows: lutRows, cols: lutCols || lutRows, pruning, normalization });
+        writeFileSync(lutFile, code);
+        console.log(`  ${lutFile}: argmax agreement ${(report.agreementRate * 100).toFixed(2)}%, ` +
+                    `${report.tableBytes} bytes (float ${report.floatBytes})`);
+    } else if (lutArg) {
+        console.log(`  no lookup table: ${model.architecture.inputSize / 2}-timestep model`);
+    }
+
+    if (writeGolden) {
+        const goldenFile = file.replace(/\.cpp$/, '_golden.h');
+        const { code, vectors } = generateGoldenCppCode(model.weights, model.architecture, model.timestamp,
+                                                        { rows: lutRows, cols: lutCols || lutRows, pruning, normalization });
+        writeFileSync(goldenFile, code);
+        console.log(`  ${goldenFile}: ${vectors.length} vectors`);
+    }
+}
@@ -0,0 +1,790 @@
+/**
+ * Test suite for C++ model export and import
+ */
+
+import {
+    generateCppCode, formatWeights, formatFloat, normalizeState, DEFAULT_NORMALIZATION,
+    MODEL_NAMESPACE_BEGIN, MODEL_NAMESPACE_END
+} from '../CppExporter.js';
+import { parseCppModel, extractWeightsArray } from '../CppImporter.js';
+import {
+    generateQuantizedCppCode, quantizeNetwork, quantizedForward, quantizedForwardInt8, quantizeRawState, floatForward
+} from '../QuantizedExporter.js';
+import { generateModelBlob, parseModelBlob, crc32, MODEL_BLOB_HEADER_SIZE } from '../ModelBlob.js';
+import { generateModelDelta, applyModelDelta, modelBlobId, MODEL_DELTA_HEADER_SIZE } from '../ModelDelta.js';
+import { pruneNetwork, pruningOptions, hiddenUnitBounds } from '../NetworkPruner.js';
+import { generateLookupCppCode, buildActionGrid, lookupAction, cellBits } from '../LookupExporter.js';
+import { generateGoldenCppCode, generateGoldenVectors, referenceForward } from '../GoldenVectors.js';
+import { CPUBackend } from '../../network/CPUBackend.js';
+
+/**
+ * Build a small deterministic weight set for export tests
+ * @param {number} inputSize
+ * @param {number} hiddenSize
+ * @param {number} outputSize
+ * @returns {Object} Weights in CPUBackend.getWeights() layout
+ */
+export function createTestWeights(inputSize = 2, hiddenSize = 8, outputSize = 3) {
+    const fill = (n, seed) => Array.from({ length: n }, (_, i) =>
+        Math.round(Math.sin((i + 1) * seed) * 2e6) / 1e6);
+    return {
+        weightsInputHidden: fill(inputSize * hiddenSize, 1.3),
+        biasHidden: fill(hiddenSize, 0.7),
+        weightsHiddenOutput: fill(hiddenSize * outputSize, 2.1),
+        biasOutput: fill(outputSize, 0.3)
+    };
+}
+
+/**
+ * Index of the first maximum
+ * @private
+ */
+function argmaxOf(values) {
+    return Array.from(values).reduce((best, v, i, all) => v > all[best] ? i : best, 0);
+}
+
+/**
+ * Test runner for the export module
+ */
+export class ExportTests {
+    constructor() {
+        this.testResults = [];
+    }
+
+    /**
+     * Run all export tests
+     * @returns {Object} Test results summary
+     */
+    runAllTests() {
+        console.log('Running C++ Export Tests...\n');
+
+        this.testRoundTrip();
+        this.testFlashStorage();
+        this.testFloatOnlyInference();
+        this.testLegacyImport();
+        this.testQuantizedExport();
+        this.testHistoryExport();
+        this.testNeuronMajorLayout();
+        this.testDifferenceOutputs();
+        this.testModelBlob();
+        this.testModelDelta();
+        this.testPruning();
+        this.testLookupExport();
+        this.testModelNamespace();
+        this.testNormalizationFolding();
+        this.testGoldenVectors();
+
+        return this.summarizeResults();
+    }
+
+    /**
+     * Exported weights must import back unchanged (to 6 decimals)
+     */
+    testRoundTrip() {
+        const testName = 'Export/Import Round Trip';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(2, 8, 3);
+            const cppCode = generateCppCode(weights, architecture, '2025-01-01T00-00-00');
+            const model = parseCppModel(cppCode, 'two_wheel_bot_dqn_2025-01-01T00-00-00.cpp');
+
+            this.assert(model.architecture.hiddenSize === 8, 'Hidden size survives round trip');
+            this.assert(model.timestamp === '2025-01-01T00-00-00', 'Timestamp recovered from filename');
+            for (const name of ['weightsInputHidden', 'biasHidden', 'weightsHiddenOutput', 'biasOutput']) {
+                const original = weights[name];
+                const parsed = model.weights[name];
+                this.assert(parsed.length === original.length, `${name} length matches`);
+                this.assert(parsed.every((v, i) => Math.abs(v - original[i]) < 1e-6), `${name} values match`);
+            }
+
+            this.addTestResult(testName, true, 'All round trip checks passed');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Weight tables must be static flash data, not class members
+     */
+    testFlashStorage() {
+        const testName = 'Flash-Resident Weights';
+        try {
+            const cppCode = generateCppCode(createTestWeights(), { inputSize: 2, hiddenSize: 8, outputSize: 3 }, 'test');
+
+            this.assert(cppCode.includes('static DQN_FLASH dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM'), 'Weights are static flash data');
+            this.assert(cppCode.includes('typedef dqn::DQNPolicy<'), 'Model instantiates the shared policy template');
+            this.assert(!/class TwoWheelBotDQN\b/.test(cppCode), 'No per-model class body is emitted');
+            this.assert(!/^\s+const float \w+\[/m.test(cppCode), 'No per-instance const float arrays remain');
+
+            this.addTestResult(testName, true, 'Weights are emitted as flash tables for DQNPolicy');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Generated inference must not contain double-precision constants
+     */
+    testFloatOnlyInference() {
+        const testName = 'Float-Only Inference';
+        try {
+            const cppCode = generateCppCode(createTestWeights(), { inputSize: 2, hiddenSize: 8, outputSize: 3 }, 'test');
+
+            this.assert(!cppCode.includes('M_PI'), 'No double M_PI in normalization');
+            this.assert(!/-1e10/.test(cppCode), 'No double sentinel in argmax');
+            const code = cppCode.replace(/\/\*[\s\S]*?\*\/|\/\/.*$/gm, '');
+            const doubleLiterals = code.match(/\b\d+\.\d+(e[-+]?\d+)?(?![\deE.f])/g);
+            this.assert(!doubleLiterals, `All floating literals carry an f suffix (found ${doubleLiterals})`);
+            this.assert(formatFloat(1) === '1.0f' && formatFloat(0.5) === '0.5f', 'Scalar literals are valid float literals');
+
+            this.addTestResult(testName, true, 'Inference path is single precision');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Files from the original exporter (class-member arrays) must still import
+     */
+    testLegacyImport() {
+        const testName = 'Legacy Format Import';
+        try {
+            const legacy = `class TwoWheelBotDQN {
+private:
+    static const int INPUT_SIZE = 2;
+    static const int HIDDEN_SIZE = 2;
+    static const int OUTPUT_SIZE = 3;
+    const float weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE] = {
+                ${formatWeights([0.5, -0.25, 1, 2], 8).trim()}
+    };
+    const float biasHidden[HIDDEN_SIZE] = {
+                0.1f, 0.2f
+    };
+    const float weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE] = {
+                1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f
+    };
+    const float biasOutput[OUTPUT_SIZE] = {
+                0.0f, 0.5f, -0.5f
+    };
+};`;
+            const model = parseCppModel(legacy, 'legacy.cpp');
+            this.assert(model.weights.weightsInputHidden[1] === -0.25, 'Legacy input weights parsed');
+            this.assert(extractWeightsArray(legacy, 'biasOutput')[2] === -0.5, 'Legacy output biases parsed');
+
+            this.addTestResult(testName, true, 'Legacy exports import correctly');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Quantized export must track the float network and emit a report
+     */
+    testQuantizedExport() {
+        const testName = 'Quantized Export';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(2, 8, 3);
+            const { code, report, quantized } = generateQuantizedCppCode(weights, architecture, 'test', { gridSize: 41 });
+
+            this.assert(report.samples === 41 * 41, 'Sweep covers the requested grid');
+            this.assert(report.agreementRate > 0.9, `Argmax agreement above 90% (got ${(report.agreementRate * 100).toFixed(1)}%)`);
+            this.assert(report.quantizedBytes * 2 < report.floatBytes, 'Quantized tables are much smaller');
+            this.assert(quantized.weightsInputHidden instanceof Int8Array, 'Weights are int8');
+
+            // Dequantized Q-values stay close to the float network
+            const input = [0.25, -0.5];
+            const floatQ = floatForward(weights, architecture, input);
+            const intQ = quantizedForward(quantized, input);
+            for (let o = 0; o < 3; o++) {
+                this.assert(Math.abs(intQ[o] * quantized.outputScale - floatQ[o]) < 0.1, `Q[${o}] within 0.1 of float`);
+            }
+
+            this.assert(code.includes('static DQN_FLASH dqn::DQNQuantizedWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE> weights DQN_PROGMEM'), 'int8 tables in flash');
+            this.assert(code.includes('typedef dqn::QuantizedDQNPolicy<'), 'Quantized model instantiates the shared template');
+            this.assert(code.includes('Agreement: '), 'Report embedded in generated header');
+
+            this.addTestResult(testName, true, `Agreement ${(report.agreementRate * 100).toFixed(1)}%`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Multi-timestep models export with their history length and reset usage
+     */
+    testHistoryExport() {
+        const testName = 'Multi-Timestep Export';
+        try {
+            const architecture = { inputSize: 6, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(6, 8, 3);
+            const cppCode = generateCppCode(weights, architecture, '2025-01-01T00-00-00');
+            const model = parseCppModel(cppCode, 'two_wheel_bot_dqn_2025-01-01T00-00-00.cpp');
+
+            this.assert(model.architecture.inputSize === 6, 'Input size survives the round trip');
+            this.assert(cppCode.includes('History timesteps: 3'), 'Header records the history length');
+            this.assert(cppCode.includes('// bot.reset(angle, angularVelocity);'), 'Usage shows the history reset');
+
+            const singleStep = generateCppCode(createTestWeights(), { inputSize: 2, hiddenSize: 8, outputSize: 3 }, 'test');
+            this.assert(!singleStep.includes('bot.reset('), 'Single-timestep usage is unchanged');
+
+            const { code } = generateQuantizedCppCode(weights, architecture, 'test', { gridSize: 11 });
+            this.assert(code.includes('// bot.reset(angle, angularVelocity);'), 'int8 usage shows the history reset');
+
+            this.addTestResult(testName, true, '3-timestep model exports and imports');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Neuron-major exports are transposed, padded, and import back to CPUBackend order
+     */
+    testNeuronMajorLayout() {
+        const testName = 'Neuron-Major Layout';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 6, outputSize: 3 };
+            const weights = createTestWeights(2, 6, 3);
+
+            for (const align of [1, 4]) {
+                const cppCode = generateCppCode(weights, architecture, 'test', { layout: 'neuron-major', align });
+                const inputStride = align === 4 ? 4 : 2;
+                const hiddenStride = align === 4 ? 8 : 6;
+
+                this.assert(cppCode.includes(`typedef dqn::NeuronMajor<${align}> Layout;`), `Layout declared (align ${align})`);
+                this.assert(cppCode.includes('typedef dqn::DQNLayoutPolicy<'), 'Policy is bound to the layout');
+
+                const stored = extractWeightsArray(cppCode, 'weightsHiddenOutput');
+                this.assert(stored.length === 3 * hiddenStride, `Hidden-to-output rows padded to ${hiddenStride}`);
+                // Output 1's row starts with hidden unit 0's weight to output 1
+                this.assert(Math.abs(stored[hiddenStride] - weights.weightsHiddenOutput[1]) < 1e-6, 'Rows are output-major');
+                const storedInput = extractWeightsArray(cppCode, 'weightsInputHidden');
+                this.assert(storedInput.length === 6 * inputStride, `Input-to-hidden rows padded to ${inputStride}`);
+                // Folded: the angular velocity weight carries the 1 / 10 rad/s normalization
+                this.assert(Math.abs(storedInput[1] - weights.weightsInputHidden[6] / DEFAULT_NORMALIZATION.maxAngularVelocity) < 1e-6,
+                    'Rows are hidden-major');
+
+                const model = parseCppModel(cppCode, 'test.cpp');
+                for (const key of ['weightsInputHidden', 'biasHidden', 'weightsHiddenOutput', 'biasOutput']) {
+                    this.assert(model.weights[key].length === weights[key].length, `${key} length restored`);
+                    model.weights[key].forEach((value, i) => {
+                        this.assert(Math.abs(value - weights[key][i]) < 1e-6, `${key}[${i}] restored`);
+                    });
+                }
+            }
+
+            let rejected = false;
+            try {
+                generateCppCode(weights, architecture, 'test', { layout: 'column-major' });
+            } catch (error) {
+                rejected = true;
+            }
+            this.assert(rejected, 'Unknown layouts are rejected');
+
+            this.addTestResult(testName, true, 'Both paddings round trip');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Difference exports store Q[o + 1] - Q[0] rows and import back to a
+     * network with the same action choices
+     */
+    testDifferenceOutputs() {
+        const testName = 'Difference Outputs';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 6, outputSize: 3 };
+            const weights = createTestWeights(2, 6, 3);
+            const cppCode = generateCppCode(weights, architecture, 'test', { outputMode: 'difference' });
+
+            this.assert(cppCode.includes('typedef dqn::DQNDifferencePolicy<'), 'Difference policy typedef');
+            this.assert(cppCode.includes('dqn::DQNWeights<INPUT_SIZE, HIDDEN_SIZE, OUTPUT_SIZE - 1>'), 'Out - 1 output rows');
+
+            const stored = extractWeightsArray(cppCode, 'weightsHiddenOutput');
+            this.assert(stored.length === 6 * 2, 'Two output rows per hidden unit');
+            // Hidden unit 1, action 2: w[1][2] - w[1][0]
+            this.assert(Math.abs(stored[3] - (weights.weightsHiddenOutput[5] - weights.weightsHiddenOutput[3])) < 2e-6,
+                        'Rows hold differences to action 0');
+            const bias = extractWeightsArray(cppCode, 'biasOutput');
+            this.assert(bias.length === 2 && Math.abs(bias[0] - (weights.biasOutput[1] - weights.biasOutput[0])) < 2e-6,
+                        'Biases hold differences to action 0');
+
+            const model = parseCppModel(cppCode, 'test.cpp');
+            this.assert(model.weights.weightsHiddenOutput.length === 6 * 3 && model.weights.biasOutput.length === 3,
+                        'Import restores the full output layer');
+            this.assert(model.weights.biasOutput[0] === 0, 'Action 0 imports as zero');
+            const argmax = q => q.indexOf(Math.max(...q));
+            for (let a = -1; a <= 1; a += 0.25) {
+                for (let v = -1; v <= 1; v += 0.25) {
+                    const expected = floatForward(weights, architecture, [a, v]);
+                    const imported = floatForward(model.weights, architecture, [a, v]);
+                    this.assert(Math.abs(imported[2] - (expected[2] - expected[0])) < 1e-4, 'Imported Q-values are relative to action 0');
+                    this.assert(argmax(Array.from(imported)) === argmax(Array.from(expected)), 'Same action after import');
+                }
+            }
+
+            let rejected = false;
+            try {
+                generateCppCode(weights, architecture, 'test', { layout: 'neuron-major', outputMode: 'difference' });
+            } catch (error) {
+                rejected = true;
+            }
+            this.assert(rejected, 'Difference outputs with neuron-major are rejected');
+
+            this.addTestResult(testName, true, 'Differences export, import and keep the argmax');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Binary blobs must carry the float32 weights exactly, the int8 tensors
+     * of quantizeNetwork(), and reject corrupted bytes
+     */
+    testModelBlob() {
+        const testName = 'Binary Model Blob';
+        try {
+            this.assert(crc32(new TextEncoder().encode('123456789')) === 0xCBF43926, 'CRC-32 check value');
+
+            const architecture = { inputSize: 4, hiddenSize: 6, outputSize: 3 };
+            const weights = createTestWeights(4, 6, 3);
+            const blob = generateModelBlob(weights, architecture);
+            const view = new DataView(blob.buffer);
+            this.assert(String.fromCharCode(...blob.subarray(0, 4)) === 'DQNB', 'Magic');
+            this.assert(view.getUint32(12, true) === blob.length, 'Total size recorded');
+            this.assert(view.getUint16(26, true) === 2, 'History timesteps recorded');
+            this.assert(view.getFloat32(28, true) === Math.fround(3 / Math.PI), 'Angle scale is ANGLE_SCALE');
+            for (let t = 0; t < 5; t++) {
+                const offset = view.getUint32(44 + t * 4, true);
+                this.assert(offset >= MODEL_BLOB_HEADER_SIZE && offset % 16 === 0, `Tensor ${t} 16-byte aligned`);
+            }
+
+            const model = parseModelBlob(blob, 'two_wheel_bot_dqn_2025-01-01T00-00-00.dqnb');
+            this.assert(model.timestamp === '2025-01-01T00-00-00', 'Timestamp recovered from filename');
+            this.assert(model.architecture.inputSize === 4 && model.precision === 'float32', 'Architecture recovered');
+            for (const key of ['weightsInputHidden', 'biasHidden', 'weightsHiddenOutput', 'biasOutput']) {
+                this.assert(model.weights[key].length === weights[key].length, `${key} length restored`);
+                this.assert(model.weights[key].every((v, i) => v === Math.fround(weights[key][i])), `${key} float32-exact`);
+            }
+
+            // int8 blobs hold the quantized tensors and dequantize on import
+            const int8Blob = generateModelBlob(weights, architecture, { precision: 'int8' });
+            const q = quantizeNetwork(weights, architecture);
+            const int8View = new DataView(int8Blob.buffer);
+            const int8Offset = int8View.getUint32(48, true);
+            this.assert(Array.from(new Int8Array(int8Blob.buffer, int8Offset, q.weightsInputHidden.length))
+                .every((w, i) => w === q.weightsInputHidden[i]), 'int8 weights stored as quantized');
+            this.assert(int8View.getUint8(18) === q.hiddenShift, 'Hidden shift recorded');
+            this.assert(int8View.getFloat32(28, true) === Math.fround(127 / (Math.PI / 3)), 'Angle scale folds the int8 range');
+            const dequantized = parseModelBlob(int8Blob, 'model_int8.dqnb');
+            const input = [0.3, -0.2, 0.25, -0.1];
+            const expected = floatForward(weights, architecture, input);
+            const actual = floatForward(dequantized.weights, architecture, input);
+            this.assert(actual.every((v, i) => Math.abs(v - expected[i]) < 0.05), 'Dequantized network approximates the float one');
+
+            const rejects = (bytes, pattern, message) => {
+                let error = null;
+                try {
+                    parseModelBlob(bytes, 'test.dqnb');
+                } catch (e) {
+                    error = e;
+                }
+                this.assert(error && pattern.test(error.message), message);
+            };
+            const corrupt = blob.slice();
+            corrupt[corrupt.length - 1] ^= 0x40;
+            rejects(corrupt, /checksum/, 'Flipped bit fails the checksum');
+            rejects(blob.slice(0, blob.length - 4), /truncated/, 'Truncated blob rejected');
+            rejects(new TextEncoder().encode('#include "DQNPolicy.h"'.repeat(4)), /magic/, 'C++ source rejected');
+
+            this.addTestResult(testName, true, `float32 ${blob.length} bytes, int8 ${int8Blob.length} bytes`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * A delta must carry only the changed tensors, rebuild the target blob
+     * exactly and refuse the wrong base or damaged bytes
+     */
+    testModelDelta() {
+        const testName = 'Model Blob Delta';
+        try {
+            const architecture = { inputSize: 4, hiddenSize: 16, outputSize: 3 };
+            const weights = createTestWeights(4, 16, 3);
+            const base = generateModelBlob(weights, architecture);
+
+            // Fine-tune of the output layer only
+            const tunedWeights = { ...weights, biasOutput: weights.biasOutput.map(b => b + 0.01) };
+            tunedWeights.weightsHiddenOutput = weights.weightsHiddenOutput.slice();
+            tunedWeights.weightsHiddenOutput[7] += 0.02;
+            const target = generateModelBlob(tunedWeights, architecture);
+            const { delta, changedTensors, changedBytes } = generateModelDelta(base, target);
+            const view = new DataView(delta.buffer);
+            this.assert(String.fromCharCode(...delta.subarray(0, 4)) === 'DQND', 'Magic');
+            this.assert(view.getUint32(12, true) === delta.length, 'Total size recorded');
+            this.assert(view.getUint32(16, true) === modelBlobId(base), 'Base model ID recorded');
+            this.assert(view.getUint32(20, true) === target.length, 'Target size recorded');
+            this.assert(changedTensors.join() === 'header,weightsHiddenOutput,biasOutput', 'Only changed tensors are carried');
+            this.assert(delta.length < 100 && changedBytes <= 4 + 4 + 12, `Delta is small (${delta.length} bytes)`);
+            this.assert(applyModelDelta(base, delta).every((b, i) => b === target[i]), 'Delta rebuilds the target exactly');
+
+            // Identical blobs need the header only; a new architecture rewrites everything
+            this.assert(generateModelDelta(base, base).delta.length === MODEL_DELTA_HEADER_SIZE, 'No-op delta is header only');
+            const wide = generateModelBlob(createTestWeights(4, 32, 3), { inputSize: 4, hiddenSize: 32, outputSize: 3 });
+            const grown = applyModelDelta(base, generateModelDelta(base, wide).delta);
+            this.assert(grown.length === wide.length && grown.every((b, i) => b === wide[i]), 'Larger target rebuilds');
+
+            const rejects = (baseBytes, deltaBytes, pattern, message) => {
+                let error = null;
+                try {
+                    applyModelDelta(baseBytes, deltaBytes);
+                } catch (e) {
+                    error = e;
+                }
+                this.assert(error && pattern.test(error.message), message);
+            };
+            rejects(target, delta, /another base/, 'Wrong base rejected');
+            const corrupt = delta.slice();
+            corrupt[corrupt.length - 1] ^= 0x01;
+            rejects(base, corrupt, /checksum/, 'Flipped bit fails the checksum');
+            rejects(base, delta.slice(0, delta.length - 2), /truncated/, 'Truncated delta rejected');
+            rejects(base, base, /magic/, 'A blob is not a delta');
+
+            this.addTestResult(testName, true, `${delta.length}-byte delta for a ${target.length}-byte blob`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Dead and zero-output units must drop out exactly, always-active units
+     * must merge without changing the Q-values, and magnitude pruning must
+     * respect its agreement floor
+     */
+    testPruning() {
+        const testName = 'Hidden Unit Pruning';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(2, 8, 3);
+            const H = architecture.hiddenSize;
+            // Unit 0 never activates, unit 1 has no outputs, units 2-5 are always active, 6-7 switch
+            weights.biasHidden[0] = -10;
+            weights.biasHidden[6] = 0;
+            weights.weightsHiddenOutput.fill(0, 3, 6);
+            for (let h = 2; h < 6; h++) weights.biasHidden[h] = 5;
+
+            const bounds = hiddenUnitBounds(weights, architecture);
+            const radius = Math.abs(weights.weightsInputHidden[0]) + Math.abs(weights.weightsInputHidden[H]);
+            this.assert(Math.abs(bounds[0].high - (-10 + radius)) < 1e-12 && bounds[0].high < 0, 'Box bound of a dead unit');
+            this.assert(bounds.slice(2, 6).every(b => b.low >= 0), 'Always-active units bounded above zero');
+
+            const samples = [];
+            for (let a = -1; a <= 1; a += 0.1) {
+                for (let v = -1; v <= 1; v += 0.1) samples.push([a, v]);
+            }
+            const maxQError = pruned => samples.reduce((max, x) => {
+                const expected = floatForward(weights, architecture, x);
+                const actual = floatForward(pruned.weights, pruned.architecture, x);
+                return Math.max(max, ...Array.from(actual, (q, o) => Math.abs(q - expected[o])));
+            }, 0);
+
+            const dead = pruneNetwork(weights, architecture, pruningOptions('dead'));
+            this.assert(dead.architecture.hiddenSize === 6, 'Dead and zero-output units removed');
+            this.assert(dead.report.deadUnits.join() === '0,1' && dead.report.mergedUnits === 0, 'Dead units reported');
+            this.assert(maxQError(dead) === 0, 'Dead pruning leaves the Q-values bit-identical');
+
+            const linear = pruneNetwork(weights, architecture, pruningOptions('linear'));
+            this.assert(linear.architecture.hiddenSize === 4, 'Four always-active units merged into two');
+            this.assert(linear.report.linearUnits.join() === '2,3,4,5' && linear.report.mergedUnits === 2, 'Merge reported');
+            this.assert(maxQError(linear) < 1e-9 && linear.report.agreementRate === 1, 'Merged network computes the same Q-values');
+
+            const magnitude = pruneNetwork(weights, architecture, pruningOptions('magnitude:0.9'));
+            this.assert(magnitude.report.minAgreement === 0.9 && magnitude.report.agreementRate >= 0.9, 'Agreement floor respected');
+            this.assert(magnitude.architecture.hiddenSize + magnitude.report.magnitudeUnits.length === 4, 'Magnitude removals counted');
+
+            const cppCode = generateCppCode(linear.weights, linear.architecture, 'test', { pruning: linear.report });
+            this.assert(cppCode.includes('HIDDEN_SIZE = 4') && cppCode.includes(' * Pruned: 8 -> 4 hidden units'), 'Header records the pruning');
+            this.assert(parseCppModel(cppCode, 'test.cpp').architecture.hiddenSize === 4, 'Pruned export imports back');
+
+            let rejected = false;
+            try {
+                pruningOptions('random');
+            } catch (error) {
+                rejected = true;
+            }
+            this.assert(rejected && pruningOptions('off') === null, 'Unknown modes rejected');
+
+            this.addTestResult(testName, true, `8 -> ${dead.architecture.hiddenSize} (dead) -> ${linear.architecture.hiddenSize} (linear) -> ${magnitude.architecture.hiddenSize} (magnitude)`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Lookup tables must pack one action per cell, index cells the way the
+     * generated C++ does, and reject multi-timestep models
+     */
+    testLookupExport() {
+        const testName = 'Lookup-Table Export';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(2, 8, 3);
+            this.assert(cellBits(2) === 1 && cellBits(3) === 2 && cellBits(5) === 4 && cellBits(17) === 8, 'Cell widths');
+
+            const grid = buildActionGrid(weights, architecture, { rows: 8, cols: 4, oversample: 1 });
+            this.assert(grid.packed.length === 8 && grid.bits === 2, 'Four 2-bit cells per byte');
+            const argmax = q => q.indexOf(Math.max(...q));
+            for (let r = 0; r < 8; r++) {
+                for (let c = 0; c < 4; c++) {
+                    // oversample 1 samples each cell at its center
+                    const center = [-1 + (2 * r + 1) / 8, -1 + (2 * c + 1) / 4];
+                    const k = r * 4 + c;
+                    this.assert(grid.actions[k] === argmax(Array.from(floatForward(weights, architecture, center))), `Cell ${k} holds the network action`);
+                    this.assert(((grid.packed[k >> 2] >> ((k & 3) * 2)) & 3) === grid.actions[k], `Cell ${k} packed low bits first`);
+                    this.assert(lookupAction(grid, center) === grid.actions[k], `Cell ${k} looked up`);
+                }
+            }
+            this.assert(lookupAction(grid, [1, 1]) === grid.actions[31] && lookupAction(grid, [-5, -5]) === grid.actions[0], 'Edges clamp to the last cells');
+
+            const { code, report, grid: table } = generateLookupCppCode(weights, architecture, 'test', { rows: 16 });
+            this.assert(code.includes('typedef dqn::DQNLookupPolicy<') && code.includes('dqn::DQNActionGrid<ROWS, COLS, OUTPUT_SIZE> table DQN_PROGMEM'), 'Lookup policy typedef');
+            this.assert(code.includes('ROWS = 16') && code.includes('COLS = 16') && report.tableBytes === 64, '16x16 grid in 64 bytes');
+            this.assert(report.agreementRate > 0.8 && code.includes(`Agreement: ${report.agreements}/${report.samples}`), 'Agreement reported');
+            const emitted = (code.match(/0x[0-9A-F]{2}/g) || []).map(hex => parseInt(hex, 16));
+            this.assert(emitted.length === 64 && emitted.every((b, i) => b === table.packed[i]), 'Packed bytes emitted in order');
+
+            let rejected = false;
+            try {
+                generateLookupCppCode(createTestWeights(6, 8, 3), { inputSize: 6, hiddenSize: 8, outputSize: 3 }, 'test');
+            } catch (error) {
+                rejected = true;
+            }
+            this.assert(rejected, 'Multi-timestep models are rejected');
+
+            this.addTestResult(testName, true, `16x16 table ${report.tableBytes} bytes, agreement ${(report.agreementRate * 100).toFixed(1)}%`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Every export must be linkable under DQN_MODEL_NAMESPACE, with DQNPolicy.h outside it
+     */
+    testModelNamespace() {
+        const testName = 'Namespaced Model Export';
+        try {
+            const architecture = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(2, 8, 3);
+            const exports = {
+                float: generateCppCode(weights, architecture, 'test'),
+                int8: generateQuantizedCppCode(weights, architecture, 'test', { gridSize: 11 }).code,
+                lookup: generateLookupCppCode(weights, architecture, 'test', { rows: 8, gridSize: 11 }).code
+            };
+
+            for (const [kind, code] of Object.entries(exports)) {
+                const include = code.indexOf('#include "DQNPolicy.h"');
+                const begin = code.indexOf(MODEL_NAMESPACE_BEGIN);
+                const end = code.indexOf(MODEL_NAMESPACE_END);
+                const typedef = code.lastIndexOf('typedef dqn::');
+                this.assert(include >= 0 && begin > include, `${kind}: namespace opens after the shared header`);
+                this.assert(begin < code.indexOf('namespace TwoWheelBotDQN'), `${kind}: weights inside the namespace`);
+                this.assert(typedef > begin && end > typedef, `${kind}: typedef inside the namespace`);
+                this.assert(end < code.indexOf('// Usage example'), `${kind}: namespace closes before the usage notes`);
+            }
+
+            const model = parseCppModel(exports.float, 'two_wheel_bot_dqn_test.cpp');
+            this.assert(model.weights.biasOutput.every((v, i) => Math.abs(v - weights.biasOutput[i]) < 1e-6), 'Namespaced export imports back');
+
+            this.addTestResult(testName, true, 'float, int8 and lookup exports wrap in DQN_MODEL_NAMESPACE');
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * The float export's first layer must act on raw clamped states like the
+     * trained network on normalized ones, for the robot's own maxAngle
+     */
+    testNormalizationFolding() {
+        const testName = 'Normalization Folding';
+        try {
+            const architecture = { inputSize: 4, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(4, 8, 3);
+            const normalization = { maxAngle: Math.PI / 6, maxAngularVelocity: 10 };
+            const cppCode = generateCppCode(weights, architecture, 'test', { normalization });
+
+            this.assert(cppCode.includes('static constexpr float maxAngle() { return 0.52359879f; }'), 'Limits recorded');
+            this.assert(cppCode.includes('dqn::FoldedInput<TwoWheelBotDQNWeights::InputLimits> >'), 'Policy clamps raw inputs');
+            const folded = {
+                ...weights,
+                weightsInputHidden: extractWeightsArray(cppCode, 'weightsInputHidden'),
+                biasHidden: extractWeightsArray(cppCode, 'biasHidden')
+            };
+            let maxError = 0;
+            const clamp = (angle, angularVelocity) => [
+                Math.max(-normalization.maxAngle, Math.min(normalization.maxAngle, angle)),
+                Math.max(-10, Math.min(10, angularVelocity))
+            ];
+            for (const [angle, angularVelocity] of [[0.1, -2], [-0.4, 7], [0.9, 3], [-0.05, -15]]) {
+                const expected = floatForward(weights, architecture, [...normalizeState(angle, angularVelocity, normalization),
+                    ...normalizeState(angle / 2, angularVelocity / 2, normalization)]);
+                const actual = floatForward(folded, architecture, [...clamp(angle, angularVelocity),
+                    ...clamp(angle / 2, angularVelocity / 2)]);
+                expected.forEach((q, o) => { maxError = Math.max(maxError, Math.abs(q - actual[o])); });
+            }
+            this.assert(maxError < 1e-4, `Folded layer matches on raw states (max error ${maxError})`);
+
+            const model = parseCppModel(cppCode, 'test.cpp');
+            this.assert(Math.abs(model.normalization.maxAngle - normalization.maxAngle) < 1e-7, 'Importer recovers the limits');
+            this.assert(model.weights.weightsInputHidden.every((w, i) => Math.abs(w - weights.weightsInputHidden[i]) < 1e-6),
+                'Importer unfolds the first layer');
+            this.assert(parseCppModel(generateCppCode(weights, architecture, 'test'), 'test.cpp').normalization.maxAngle === Math.PI / 3,
+                'Default limits import exactly');
+
+            const single = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const singleWeights = createTestWeights(2, 8, 3);
+            const int8 = generateQuantizedCppCode(singleWeights, single, 'test', { gridSize: 11, normalization }).code;
+            this.assert(int8.includes(`angleScale() { return ${formatFloat(127 / normalization.maxAngle)}; }`), 'int8 input scale');
+            const lookup = generateLookupCppCode(singleWeights, single, 'test', { rows: 8, gridSize: 11, normalization }).code;
+            this.assert(lookup.includes(`angleScale() { return ${formatFloat(1 / normalization.maxAngle)}; }`), 'Lookup input scale');
+            const blob = parseModelBlob(generateModelBlob(singleWeights, single, { normalization }), 'test.dqnb');
+            this.assert(Math.abs(blob.normalization.maxAngle - normalization.maxAngle) < 1e-6, 'Blob header carries the limits');
+
+            this.addTestResult(testName, true, `π/6 export matches the trained network (max |Q error| ${maxError.toExponential(2)})`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Golden vectors must hold CPUBackend.forward outputs, follow the state
+     * history across each sequence, and format as a deterministic table
+     */
+    testGoldenVectors() {
+        const testName = 'Golden Vectors';
+        try {
+            const single = { inputSize: 2, hiddenSize: 8, outputSize: 3 };
+            const weights = createTestWeights(2, 8, 3);
+            const network = new CPUBackend();
+            network.setWeights({ ...weights, architecture: { ...single, parameterCount: 8 * 2 + 8 + 8 * 3 + 3 } });
+            for (const input of [[0.1, -0.2], [-1, 1], [0.73, 0.05]]) {
+                const expected = network.forward(new Float32Array(input));
+                const actual = referenceForward(weights, single, input);
+                this.assert(actual.every((q, o) => q === expected[o]), 'Reference is CPUBackend.forward bit for bit');
+            }
+
+            const { code, vectors } = generateGoldenCppCode(weights, single, 'test', { rows: 8 });
+            this.assert(code === generateGoldenCppCode(weights, single, 'test', { rows: 8 }).code, 'Deterministic');
+            this.assert(code.includes(`static const int COUNT = ${vectors.length};`), 'Count recorded');
+            this.assert((code.match(/^ {8}\{-?[0-9]/gm) || []).length === vectors.length, 'One row per vector');
+            this.assert(vectors.some(v => v.angle > DEFAULT_NORMALIZATION.maxAngle), 'States past the limits');
+            this.assert(vectors.some(v => !v.reset), 'Sequences longer than one tick');
+            const grid = buildActionGrid(weights, single, { rows: 8 });
+            const q = quantizeNetwork(weights, single);
+            for (const v of vectors) {
+                this.assert(v.int8Action === argmaxOf(v.int8Accumulators), 'int8 action is the accumulator argmax');
+                const x = quantizeRawState(v.angle, v.angularVelocity);
+                this.assert(quantizedForwardInt8(q, x).every((acc, o) => acc === v.int8Accumulators[o]), 'int8 accumulators');
+                this.assert(v.lookupAction === lookupAction(grid, [Math.fround(v.angle * Math.fround(1 / DEFAULT_NORMALIZATION.maxAngle)),
+                    Math.fround(v.angularVelocity * Math.fround(0.1))]), 'Lookup action');
+            }
+            this.assert(quantizeRawState(Math.PI / 3, -10).join() === '127,-127', 'Limits quantize to full scale');
+
+            // Three timesteps: each vector sees its sequence, newest first, padded with the reset state
+            const history = { inputSize: 6, hiddenSize: 8, outputSize: 3 };
+            const historyWeights = createTestWeights(6, 8, 3);
+            const historyVectors = generateGoldenVectors(historyWeights, history, { sequenceLength: 5 });
+            let checked = 0;
+            historyVectors.forEach((v, i) => {
+                // State k ticks back in the vector's sequence; the reset state pads the window
+                const back = k => {
+                    let j = i;
+                    for (let n = 0; n < k && !historyVectors[j].reset; n++) j--;
+                    return historyVectors[j];
+                };
+                const input = [0, 1, 2].flatMap(k => normalizeState(back(k).angle, back(k).angularVelocity));
+                this.assert(referenceForward(historyWeights, history, input).every((value, o) => value === v.qValues[o]),
+                    `History window of vector ${i}`);
+                checked += !v.reset && !historyVectors[i - 1].reset;
+            });
+            this.assert(checked > 0 && historyVectors.every(v => v.lookupAction === -1), 'No lookup table with history');
+
+            this.addTestResult(testName, true, `${vectors.length} vectors, ${checked} full history windows`);
+        } catch (error) {
+            this.addTestResult(testName, false, error.message);
+        }
+    }
+
+    /**
+     * Add a test result
+     * @private
+     */
+    addTestResult(testName, passed, message) {
+        const result = { testName, passed, message };
+        this.testResults.push(result);
+
+        const status = passed ? '✓ PASS' : '✗ FAIL';
+        console.log(`${status}: ${testName} - ${message}`);
+    }
+
+    /**
+     * Assert a condition is true
+     * @private
+     */
+    assert(condition, message) {
+        if (!condition) {
+            throw new Error(`Assertion failed: ${message}`);
+        }
+    }
+
+    /**
+     * Summarize test results
+     * @private
+     */
+    summarizeResults() {
+        const totalTests = this.testResults.length;
+        const passedTests = this.testResults.filter(r => r.passed).length;
+        const failedTests = totalTests - passedTests;
+
+        console.log(`\n--- Test Summary ---`);
+        console.log(`Total Tests: ${totalTests}`);
+        console.log(`Passed: ${passedTests}`);
+        console.log(`Failed: ${failedTests}`);
+        console.log(`Success Rate: ${((passedTests / totalTests) * 100).toFixed(1)}%`);
+
+        if (failedTests > 0) {
+            console.log('\nFailed Tests:');
+            this.testResults.filter(r => !r.passed).forEach(result => {
+                console.log(`- ${result.testName}: ${result.message}`);
+            });
+        }
+
+        return {
+            totalTests,
+            passedTests,
+            failedTests,
+            successRate: (passedTests / totalTests) * 100,
+            results: this.testResults
+        };
+    }
+}
+
+/**
+ * Run export tests if this file is executed directly
+ */
+if (typeof window !== 'undefined') {
+    // Browser environment - can be called from console
+    window.runExportTests = () => {
+        const tests = new ExportTests();
+        return tests.runAllTests();
+    };
+} else {
+    // Node.js environment - run immediately
+    const tests = new ExportTests();
+    const summary = tests.runAllTests();
+    if (summary.failedTests > 0 && typeof process !== 'undefined') {
+        process.exitCode = 1;
+    }
+}
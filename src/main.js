@@ -15,6 +15,13 @@ import { createDefaultQLearning } from './training/QLearning.js';
 import { WebGPUBackend, checkWebGPUAvailability } from './network/WebGPUBackend.js';
 import { SystemCapabilities, ParallelQLearning } from './training/ParallelTraining.js';
 import { TrainingPerformanceTracker, SmartRenderingManager } from './training/PerformanceTracker.js';
+import { generateCppCode, formatWeights } from './export/CppExporter.js';
+import { parseCppModel, extractWeightsArray } from './export/CppImporter.js';
+import { generateQuantizedCppCode } from './export/QuantizedExporter.js';
+import { generateLookupCppCode } from './export/LookupExporter.js';
+import { generateGoldenCppCode } from './export/GoldenVectors.js';
+import { generateModelBlob, parseModelBlob } from './export/ModelBlob.js';
+import { pruneNetwork, pruningOptions } from './export/NetworkPruner.js';
 
 // Module imports (will be implemented in subsequent phases)
 // import { ModelExporter } from './export/ModelExporter.js';
@@ -1242,6 +1249,18 @@ class TwoWheelBotRL {
             this.exportModelToCpp();
         });
         
+        document.getElementById('export-model-int8')?.addEventListener('click', () => {
+            this.exportModelToQuantizedCpp();
+        });
+        
+        document.getElementById('export-model-blob')?.addEventListener('click', () => {
+            this.exportModelToBlob();
+        });
+        
+        document.getElementById('export-model-lut')?.addEventListener('click', () => {
+            this.exportModelToLookupCpp();
+        });
+        
         document.getElementById('import-model').addEventListener('click', () => {
             this.importModelFromCpp();
         });
@@ -4412,15 +4431,174 @@ class TwoWheelBotRL {
         const timestamp = now.toISOString().replace(/[:.]/g, '-').slice(0, -5);
         const filename = `two_wheel_bot_dqn_${timestamp}.cpp`;
         
-        // Get model weights
+        // Get model weights (pruned if chosen in the export panel)
+        const { weights, architecture, pruning } = this.getExportNetwork();
+        
+        // Weight layout chosen for the target ('neuron-major-4' pads rows to 4 floats,
+        // 'difference' stores the output layer as differences to action 0)
+        const layoutChoice = document.getElementById('export-layout')?.value || 'input-major';
+        const exportOptions = layoutChoice === 'neuron-major-4'
+            ? { layout: 'neuron-major', align: 4 }
+            : layoutChoice === 'difference'
+                ? { layout: 'input-major', outputMode: 'difference' }
+                : { layout: layoutChoice };
+        exportOptions.pruning = pruning;
+        exportOptions.normalization = this.getExportNormalization();
+        
+        // Generate C++ code
+        let cppCode = this.generateCppCode(weights, architecture, timestamp, exportOptions);
+        
+        this.downloadTextFile(filename, cppCode);
+        
+        // Golden test vectors for native/tests/test_conformance.cpp, from the same network
+        const goldenFilename = `two_wheel_bot_dqn_${timestamp}_golden.h`;
+        const golden = generateGoldenCppCode(weights, architecture, timestamp, {
+            pruning, normalization: exportOptions.normalization
+        });
+        this.downloadTextFile(goldenFilename, golden.code);
+        
+        alert(`Model exported as C++ file:\n${filename}\n\n` +
+              `Golden test vectors (${golden.vectors.length} states):\n${goldenFilename}` +
+              this.formatPruningSummary(pruning));
+        console.log('Model exported:', filename, goldenFilename);
+    }
+    
+    /**
+     * Network to export: the trained weights, pruned as chosen in the export panel
+     * @returns {Object} {weights, architecture, pruning} (pruning is the
+     *          pruneNetwork() report, or null when pruning is off)
+     */
+    getExportNetwork() {
         const weights = this.qlearning.qNetwork.getWeights();
         const architecture = this.qlearning.qNetwork.getArchitecture();
+        const options = pruningOptions(document.getElementById('export-pruning')?.value || 'off');
+        if (!options) {
+            return { weights, architecture, pruning: null };
+        }
         
-        // Generate C++ code
-        let cppCode = this.generateCppCode(weights, architecture, timestamp);
+        // Same angle range as the quantized export's agreement sweep
+        options.maxAngle = this.robot ? this.robot.maxAngle : Math.PI / 3;
+        options.normalization = this.getExportNormalization();
+        const pruned = pruneNetwork(weights, architecture, options);
+        console.log('Pruned network for export:', pruned.report);
+        return { weights: pruned.weights, architecture: pruned.architecture, pruning: pruned.report };
+    }
+    
+    /**
+     * Input limits the network was trained with, folded into (or recorded in) every export
+     * Matches BalancingRobot.getNormalizedInputs: the configured max angle and 10 rad/s.
+     * @returns {Object} {maxAngle, maxAngularVelocity}
+     */
+    getExportNormalization() {
+        return { maxAngle: this.robot ? this.robot.maxAngle : Math.PI / 3, maxAngularVelocity: 10 };
+    }
+    
+    /**
+     * One-line pruning summary for export alerts
+     * @param {Object|null} pruning - pruneNetwork() report
+     * @returns {string}
+     */
+    formatPruningSummary(pruning) {
+        if (!pruning) return '';
+        return `\n\nPruned ${pruning.originalHiddenSize} -> ${pruning.hiddenSize} hidden units, ` +
+               `argmax agreement ${(pruning.agreementRate * 100).toFixed(2)}%`;
+    }
+    
+    exportModelToQuantizedCpp() {
+        if (!this.qlearning || !this.qlearning.isInitialized) {
+            alert('No trained model to export. Please train the model first.');
+            return;
+        }
+        
+        // Same naming as the float export, with an _int8 suffix
+        const now = new Date();
+        const timestamp = now.toISOString().replace(/[:.]/g, '-').slice(0, -5);
+        const filename = `two_wheel_bot_dqn_${timestamp}_int8.cpp`;
+        
+        const { weights, architecture, pruning } = this.getExportNetwork();
+        const maxAngle = this.robot ? this.robot.maxAngle : Math.PI / 3;
+        
+        // Sweep the robot's configured angle range for the agreement report
+        const { code, report } = generateQuantizedCppCode(weights, architecture, timestamp, {
+            maxAngle, pruning, normalization: this.getExportNormalization()
+        });
+        
+        this.downloadTextFile(filename, code);
+        
+        const agreement = (report.agreementRate * 100).toFixed(2);
+        alert(`Quantized model exported as C++ file:\n${filename}\n\n` +
+              `Argmax agreement with float model: ${agreement}% (${report.agreements}/${report.samples})\n` +
+              `Weight flash: ${report.quantizedBytes} bytes (float: ${report.floatBytes} bytes)` +
+              this.formatPruningSummary(pruning));
+        console.log('Quantized model exported:', filename, report);
+    }
+    
+    exportModelToBlob() {
+        if (!this.qlearning || !this.qlearning.isInitialized) {
+            alert('No trained model to export. Please train the model first.');
+            return;
+        }
+        
+        const now = new Date();
+        const timestamp = now.toISOString().replace(/[:.]/g, '-').slice(0, -5);
+        const { weights, architecture, pruning } = this.getExportNetwork();
+        const normalization = this.getExportNormalization();
+        
+        // Float and int8 blobs side by side; firmware binds either at run time
+        const files = [
+            [`two_wheel_bot_dqn_${timestamp}.dqnb`, generateModelBlob(weights, architecture, { normalization })],
+            [`two_wheel_bot_dqn_${timestamp}_int8.dqnb`,
+                generateModelBlob(weights, architecture, { precision: 'int8', normalization })]
+        ];
+        for (const [filename, bytes] of files) {
+            this.downloadFile(filename, bytes, 'application/octet-stream');
+        }
+        
+        alert(`Model exported as binary blobs:\n` +
+              files.map(([filename, bytes]) => `${filename} (${bytes.length} bytes)`).join('\n') +
+              this.formatPruningSummary(pruning));
+        console.log('Model blobs exported:', files.map(([filename]) => filename));
+    }
+    
+    exportModelToLookupCpp() {
+        if (!this.qlearning || !this.qlearning.isInitialized) {
+            alert('No trained model to export. Please train the model first.');
+            return;
+        }
+        
+        const { weights, architecture, pruning } = this.getExportNetwork();
+        if (architecture.inputSize !== 2) {
+            alert('Lookup tables need a single-timestep model (history timesteps = 1).');
+            return;
+        }
         
-        // Create download
-        const blob = new Blob([cppCode], { type: 'text/plain' });
+        // Same naming as the float export, with a _lut suffix
+        const now = new Date();
+        const timestamp = now.toISOString().replace(/[:.]/g, '-').slice(0, -5);
+        const filename = `two_wheel_bot_dqn_${timestamp}_lut.cpp`;
+        const maxAngle = this.robot ? this.robot.maxAngle : Math.PI / 3;
+        
+        const { code, report, grid } = generateLookupCppCode(weights, architecture, timestamp, {
+            maxAngle, pruning, normalization: this.getExportNormalization()
+        });
+        
+        this.downloadTextFile(filename, code);
+        
+        const agreement = (report.agreementRate * 100).toFixed(2);
+        alert(`Lookup-table model exported as C++ file:\n${filename}\n\n` +
+              `${grid.rows}x${grid.cols} action grid, argmax agreement with float model: ${agreement}% ` +
+              `(${report.agreements}/${report.samples})\n` +
+              `Table flash: ${report.tableBytes} bytes (float: ${report.floatBytes} bytes)` +
+              this.formatPruningSummary(pruning));
+        console.log('Lookup-table model exported:', filename, report);
+    }
+    
+    downloadTextFile(filename, text) {
+        this.downloadFile(filename, text, 'text/plain');
+    }
+    
+    downloadFile(filename, data, type) {
+        const blob = new Blob([data], { type });
         const url = URL.createObjectURL(blob);
         const a = document.createElement('a');
         a.href = url;
@@ -4429,9 +4607,6 @@ class TwoWheelBotRL {
         a.click();
         document.body.removeChild(a);
         URL.revokeObjectURL(url);
-        
-        alert(`Model exported as C++ file:\n${filename}`);
-        console.log('Model exported:', filename);
     }
     
     importModelFromCpp() {
@@ -4442,12 +4617,19 @@ class TwoWheelBotRL {
             const file = event.target.files[0];
             if (!file) return;
             
+            // Binary blobs are read as bytes, everything else as C++ source
+            const isBlob = file.name.toLowerCase().endsWith('.dqnb');
             const reader = new FileReader();
             reader.onload = async (e) => {
                 try {
-                    const cppContent = e.target.result;
-                    console.log('Parsing C++ file:', file.name);
-                    const importedModel = this.parseCppModel(cppContent, file.name);
+                    let importedModel;
+                    if (isBlob) {
+                        console.log('Parsing model blob:', file.name);
+                        importedModel = parseModelBlob(e.target.result, file.name);
+                    } else {
+                        console.log('Parsing C++ file:', file.name);
+                        importedModel = this.parseCppModel(e.target.result, file.name);
+                    }
                     console.log('Parsed model:', importedModel);
                     
                     await this.loadImportedModel(importedModel);
@@ -4464,7 +4646,11 @@ class TwoWheelBotRL {
                 }
             };
             
-            reader.readAsText(file);
+            if (isBlob) {
+                reader.readAsArrayBuffer(file);
+            } else {
+                reader.readAsText(file);
+            }
             
             // Reset file input
             fileInput.value = '';
@@ -4477,97 +4663,11 @@ class TwoWheelBotRL {
     }
     
     parseCppModel(cppContent, filename) {
-        // Extract architecture information
-        const inputSizeMatch = cppContent.match(/static const int INPUT_SIZE = (\d+);/);
-        const hiddenSizeMatch = cppContent.match(/static const int HIDDEN_SIZE = (\d+);/);
-        const outputSizeMatch = cppContent.match(/static const int OUTPUT_SIZE = (\d+);/);
-        
-        if (!inputSizeMatch || !hiddenSizeMatch || !outputSizeMatch) {
-            throw new Error('Could not extract network architecture from C++ file');
-        }
-        
-        const inputSize = parseInt(inputSizeMatch[1]);
-        const hiddenSize = parseInt(hiddenSizeMatch[1]);
-        const outputSize = parseInt(outputSizeMatch[1]);
-        
-        // Extract weights arrays
-        const weightsInputHidden = this.extractWeightsArray(cppContent, 'weightsInputHidden');
-        const biasHidden = this.extractWeightsArray(cppContent, 'biasHidden');
-        const weightsHiddenOutput = this.extractWeightsArray(cppContent, 'weightsHiddenOutput');
-        const biasOutput = this.extractWeightsArray(cppContent, 'biasOutput');
-        
-        // Validate dimensions
-        if (weightsInputHidden.length !== inputSize * hiddenSize) {
-            throw new Error(`Expected ${inputSize * hiddenSize} input-to-hidden weights, got ${weightsInputHidden.length}`);
-        }
-        if (biasHidden.length !== hiddenSize) {
-            throw new Error(`Expected ${hiddenSize} hidden biases, got ${biasHidden.length}`);
-        }
-        if (weightsHiddenOutput.length !== hiddenSize * outputSize) {
-            throw new Error(`Expected ${hiddenSize * outputSize} hidden-to-output weights, got ${weightsHiddenOutput.length}`);
-        }
-        if (biasOutput.length !== outputSize) {
-            throw new Error(`Expected ${outputSize} output biases, got ${biasOutput.length}`);
-        }
-        
-        // Extract timestamp from filename or comment
-        const timestampMatch = filename.match(/(\d{4}-\d{2}-\d{2}T\d{2}-\d{2}-\d{2})/) || 
-                              cppContent.match(/Generated: (\d{4}-\d{2}-\d{2}T\d{2}-\d{2}-\d{2})/);
-        const timestamp = timestampMatch ? timestampMatch[1] : new Date().toISOString().replace(/[:.]/g, '-').slice(0, -5);
-        
-        // Calculate parameter count
-        const parameterCount = weightsInputHidden.length + biasHidden.length + 
-                              weightsHiddenOutput.length + biasOutput.length;
-        
-        return {
-            name: `Imported_DQN_${timestamp}`,
-            architecture: { inputSize, hiddenSize, outputSize },
-            weights: {
-                architecture: {
-                    inputSize: inputSize,
-                    hiddenSize: hiddenSize,
-                    outputSize: outputSize,
-                    parameterCount: parameterCount
-                },
-                weightsInputHidden: Array.from(weightsInputHidden),
-                biasHidden: Array.from(biasHidden),
-                weightsHiddenOutput: Array.from(weightsHiddenOutput),
-                biasOutput: Array.from(biasOutput),
-                initMethod: 'imported'
-            },
-            filename: filename,
-            importDate: new Date().toISOString()
-        };
+        return parseCppModel(cppContent, filename);
     }
     
     extractWeightsArray(cppContent, arrayName) {
-        // Find the array declaration
-        const arrayPattern = new RegExp(`const float ${arrayName}\\[.*?\\] = \\{([^}]+)\\};`, 's');
-        const match = cppContent.match(arrayPattern);
-        
-        if (!match) {
-            throw new Error(`Could not find ${arrayName} array in C++ file`);
-        }
-        
-        // Extract values between braces
-        const arrayContent = match[1];
-        
-        // Parse individual values, handling potential line breaks and formatting
-        const values = arrayContent
-            .split(',')
-            .map(s => s.trim())
-            .filter(s => s.length > 0)
-            .map(s => {
-                // Remove 'f' suffix if present
-                const cleanValue = s.replace(/f$/, '');
-                const value = parseFloat(cleanValue);
-                if (isNaN(value)) {
-                    throw new Error(`Invalid weight value: ${s}`);
-                }
-                return value;
-            });
-        
-        return values;
+        return extractWeightsArray(cppContent, arrayName);
     }
     
     async loadImportedModel(importedModel) {
@@ -4595,6 +4695,18 @@ class TwoWheelBotRL {
                 throw new Error('Import cancelled - architecture mismatch');
             }
             
+            // Input size encodes the history length (2 inputs per timestep)
+            const importedTimesteps = importedArch.inputSize / 2;
+            if (this.robot && this.robot.historyTimesteps !== importedTimesteps) {
+                this.robot.setHistoryTimesteps(importedTimesteps);
+                const historyTimestepsSlider = document.getElementById('history-timesteps');
+                const historyTimestepsValue = document.getElementById('history-timesteps-value');
+                if (historyTimestepsSlider) {
+                    historyTimestepsSlider.value = importedTimesteps;
+                    historyTimestepsValue.textContent = importedTimesteps;
+                }
+            }
+
             // Recreate Q-learning with imported architecture
             await this.initializeQLearning({
                 hiddenSize: importedArch.hiddenSize
@@ -4683,126 +4795,12 @@ class TwoWheelBotRL {
         console.log('Imported model loaded:', importedModel.name);
     }
     
-    generateCppCode(weights, architecture, timestamp) {
-        const { inputSize, hiddenSize, outputSize } = architecture;
-        
-        return `/**
- * Two-Wheel Balancing Robot DQN Model
- * Generated: ${timestamp}
- * Architecture: ${inputSize}-${hiddenSize}-${outputSize}
- * 
- * This file contains the trained neural network weights for deployment
- * on embedded systems (Arduino, ESP32, STM32, etc.)
- */
-
-#include <math.h>
-
-class TwoWheelBotDQN {
-private:
-    static const int INPUT_SIZE = ${inputSize};
-    static const int HIDDEN_SIZE = ${hiddenSize};
-    static const int OUTPUT_SIZE = ${outputSize};
-    
-    // Network weights (stored in program memory to save RAM)
-    const float weightsInputHidden[INPUT_SIZE * HIDDEN_SIZE] = {
-        ${this.formatWeights(weights.weightsInputHidden, 8)}
-    };
-    
-    const float biasHidden[HIDDEN_SIZE] = {
-        ${this.formatWeights(weights.biasHidden, 8)}
-    };
-    
-    const float weightsHiddenOutput[HIDDEN_SIZE * OUTPUT_SIZE] = {
-        ${this.formatWeights(weights.weightsHiddenOutput, 8)}
-    };
-    
-    const float biasOutput[OUTPUT_SIZE] = {
-        ${this.formatWeights(weights.biasOutput, 8)}
-    };
-    
-    // Activation function (ReLU)
-    float relu(float x) {
-        return x > 0 ? x : 0;
-    }
-    
-public:
-    /**
-     * Get action from current state
-     * @param angle Robot angle in radians
-     * @param angularVelocity Angular velocity in rad/s
-     * @return Action index (0=left, 1=brake, 2=right)
-     */
-    int getAction(float angle, float angularVelocity) {
-        // Normalize inputs
-        float input[INPUT_SIZE];
-        input[0] = constrain(angle / (M_PI / 3), -1.0, 1.0);
-        input[1] = constrain(angularVelocity / 10.0, -1.0, 1.0);
-        
-        // Hidden layer computation
-        float hidden[HIDDEN_SIZE];
-        for (int h = 0; h < HIDDEN_SIZE; h++) {
-            hidden[h] = biasHidden[h];
-            for (int i = 0; i < INPUT_SIZE; i++) {
-                hidden[h] += input[i] * weightsInputHidden[i * HIDDEN_SIZE + h];
-            }
-            hidden[h] = relu(hidden[h]);
-        }
-        
-        // Output layer computation
-        float output[OUTPUT_SIZE];
-        float maxValue = -1e10;
-        int bestAction = 0;
-        
-        for (int o = 0; o < OUTPUT_SIZE; o++) {
-            output[o] = biasOutput[o];
-            for (int h = 0; h < HIDDEN_SIZE; h++) {
-                output[o] += hidden[h] * weightsHiddenOutput[h * OUTPUT_SIZE + o];
-            }
-            
-            // Track best action
-            if (output[o] > maxValue) {
-                maxValue = output[o];
-                bestAction = o;
-            }
-        }
-        
-        return bestAction;
-    }
-    
-    /**
-     * Get motor torque for action
-     * @param action Action index
-     * @return Motor torque (-1.0 to 1.0)
-     */
-    float getMotorTorque(int action) {
-        const float actions[3] = {-1.0, 0.0, 1.0};
-        return actions[action];
-    }
-    
-private:
-    float constrain(float value, float min, float max) {
-        if (value < min) return min;
-        if (value > max) return max;
-        return value;
-    }
-};
-
-// Usage example:
-// TwoWheelBotDQN bot;
-// int action = bot.getAction(angle, angularVelocity);
-// float torque = bot.getMotorTorque(action);
-`;
+    generateCppCode(weights, architecture, timestamp, options = {}) {
+        return generateCppCode(weights, architecture, timestamp, options);
     }
     
     formatWeights(weights, itemsPerLine) {
-        const formatted = [];
-        for (let i = 0; i < weights.length; i += itemsPerLine) {
-            const line = weights.slice(i, i + itemsPerLine)
-                .map(w => w.toFixed(6) + 'f')
-                .join(', ');
-            formatted.push('        ' + line);
-        }
-        return formatted.join(',\n');
+        return formatWeights(weights, itemsPerLine);
     }
     
     resetModelParameters() {